@@ -161,11 +161,9 @@ inline void reportMemoryDelta(benchmark::State& state, const MemoryDeltaTracker&
 // =============================================================================
 //
 // This provides fine-grained allocation tracking by implementing
-// benchmark::MemoryManager. It requires overriding global new/delete
-// or using a custom allocator, which has overhead.
-//
-// For now, we use the simpler /proc/self/status approach above.
-// The MemoryManager below can be enabled for more detailed tracking.
+// benchmark::MemoryManager. bench_main.cpp overrides global new/delete to feed
+// AllocationCounter; benchmarks can read it directly (reset, run, divide by items)
+// or register the MemoryManager below for Google Benchmark's own reporting.
 
 /// Thread-safe allocation counter
 class AllocationCounter
@@ -0,0 +1,190 @@
+// Benchmarks for BatchFileReader (Linux-only)
+//
+// One process-probe tick reads stat, statm, status, cmdline and io for every PID. These
+// benchmarks read that file set for a synthetic 5k-process /proc tree three ways:
+// the per-file std::ifstream pattern LinuxProcessProbe used before batching, the batch
+// reader's synchronous fallback, and the batch reader on io_uring (with and without
+// fixed-file slots). Each reports syscalls per process alongside wall time.
+//
+// Syscall accounting: the batch reader counts its own syscalls. For the ifstream
+// baseline, read() calls come from the syscr counter in /proc/self/io and each file adds
+// its open() and close().
+
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "Fixtures/SyntheticProcTree.h"
+#include "Platform/Linux/BatchFileReader.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace
+{
+
+constexpr std::array<std::string_view, 5> PID_FILES = {"stat", "statm", "status", "cmdline", "io"};
+
+/// Synthetic /proc tree with an open descriptor on its proc root.
+class ProcTree
+{
+  public:
+    explicit ProcTree(std::int64_t processes) : m_Tree({.processes = static_cast<std::size_t>(processes)})
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) - POSIX open() is variadic
+        m_DirFd = ::open(m_Tree.procRoot().c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    }
+
+    ~ProcTree()
+    {
+        ::close(m_DirFd);
+    }
+
+    ProcTree(const ProcTree&) = delete;
+    ProcTree& operator=(const ProcTree&) = delete;
+    ProcTree(ProcTree&&) = delete;
+    ProcTree& operator=(ProcTree&&) = delete;
+
+    [[nodiscard]] std::filesystem::path pidDir(std::int64_t index) const
+    {
+        return m_Tree.procRoot() / std::to_string(pid(index));
+    }
+
+    [[nodiscard]] std::int32_t pid(std::int64_t index) const
+    {
+        return m_Tree.pid(static_cast<std::size_t>(index));
+    }
+
+    [[nodiscard]] int dirFd() const
+    {
+        return m_DirFd;
+    }
+
+  private:
+    Fixtures::SyntheticProcTree m_Tree;
+    int m_DirFd = -1;
+};
+
+/// read() syscalls made by this process so far (syscr in /proc/self/io), or 0 if unreadable.
+[[nodiscard]] std::uint64_t readSyscallCount()
+{
+    std::ifstream io("/proc/self/io");
+    std::string key;
+    std::uint64_t value = 0;
+    while (io >> key >> value)
+    {
+        if (key == "syscr:")
+        {
+            return value;
+        }
+    }
+    return 0;
+}
+
+void reportPerProcess(benchmark::State& state, std::uint64_t syscalls)
+{
+    const auto processes = static_cast<double>(state.iterations() * state.range(0));
+    state.counters["syscalls_per_process"] = benchmark::Counter(static_cast<double>(syscalls) / processes);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Baseline: what LinuxProcessProbe did per process before batching
+static void BM_ProcFiles_IfstreamBaseline(benchmark::State& state)
+{
+    const ProcTree tree(state.range(0));
+    std::size_t bytes = 0;
+
+    const std::uint64_t readsBefore = readSyscallCount();
+    for (auto _ : state)
+    {
+        for (std::int64_t index = 0; index < state.range(0); ++index)
+        {
+            const auto dir = tree.pidDir(index);
+            for (const std::string_view file : PID_FILES)
+            {
+                std::ifstream in(dir / file, std::ios::binary);
+                const std::string contents{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+                bytes += contents.size();
+            }
+        }
+        benchmark::DoNotOptimize(bytes);
+    }
+    const std::uint64_t reads = readSyscallCount() - readsBefore;
+    const auto files = static_cast<std::uint64_t>(state.iterations() * state.range(0)) * PID_FILES.size();
+
+    reportPerProcess(state, reads + (2 * files)); // + open() and close() per file
+}
+BENCHMARK(BM_ProcFiles_IfstreamBaseline)->Arg(5000)->Unit(benchmark::kMillisecond);
+
+void runBatch(benchmark::State& state, Platform::BatchFileReader::Options options, bool requireIoUring)
+{
+    const ProcTree tree(state.range(0));
+    Platform::BatchFileReader reader(options);
+    if (requireIoUring && reader.backend() != Platform::BatchFileReader::Backend::IoUring)
+    {
+        state.SkipWithError("io_uring not available");
+        return;
+    }
+    if (requireIoUring && options.registerFiles && !reader.usesRegisteredFiles())
+    {
+        state.SkipWithError("io_uring fixed-file slots not available");
+        return;
+    }
+
+    std::string path;
+    std::size_t bytes = 0;
+    const std::uint64_t syscallsBefore = reader.stats().syscalls;
+    for (auto _ : state)
+    {
+        reader.clear();
+        for (std::int64_t index = 0; index < state.range(0); ++index)
+        {
+            for (const std::string_view file : PID_FILES)
+            {
+                path = std::to_string(tree.pid(index));
+                path += '/';
+                path += file;
+                (void) reader.add(tree.dirFd(), path);
+            }
+        }
+        reader.submit();
+        for (std::size_t i = 0; i < reader.size(); ++i)
+        {
+            bytes += reader.result(i).size();
+        }
+        benchmark::DoNotOptimize(bytes);
+    }
+
+    reportPerProcess(state, reader.stats().syscalls - syscallsBefore);
+}
+
+static void BM_ProcFiles_BatchSync(benchmark::State& state)
+{
+    runBatch(state, {.useIoUring = false}, false);
+}
+BENCHMARK(BM_ProcFiles_BatchSync)->Arg(5000)->Unit(benchmark::kMillisecond);
+
+static void BM_ProcFiles_BatchIoUring(benchmark::State& state)
+{
+    runBatch(state, {.registerFiles = true}, true);
+}
+BENCHMARK(BM_ProcFiles_BatchIoUring)->Arg(5000)->Unit(benchmark::kMillisecond);
+
+static void BM_ProcFiles_BatchIoUringPlainFds(benchmark::State& state)
+{
+    runBatch(state, {.registerFiles = false}, true);
+}
+BENCHMARK(BM_ProcFiles_BatchIoUringPlainFds)->Arg(5000)->Unit(benchmark::kMillisecond);
+
+} // namespace
+
+#endif // __linux__
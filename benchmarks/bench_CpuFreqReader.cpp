@@ -0,0 +1,110 @@
+// Benchmarks for CpuFreqReader (Linux-only)
+//
+// Per-core frequency sampling touches one sysfs file per logical CPU every refresh,
+// so on large machines (128+ cores) the open/read/close pattern dominates. These
+// benchmarks compare the persistent-descriptor reader against reopening each file
+// with an ifstream, using a synthetic cpufreq tree so results don't depend on the
+// host's cpufreq driver.
+
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "Platform/Linux/CpuFreqReader.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace
+{
+
+/// Synthetic <root>/cpuN/cpufreq/scaling_cur_freq tree, removed on destruction.
+class SyntheticCpufreqTree
+{
+  public:
+    explicit SyntheticCpufreqTree(std::uint32_t cores)
+        : m_Root(std::filesystem::temp_directory_path() / ("tasksmack_bench_cpufreq_" + std::to_string(::getpid())))
+    {
+        for (std::uint32_t cpu = 0; cpu < cores; ++cpu)
+        {
+            const auto dir = m_Root / ("cpu" + std::to_string(cpu)) / "cpufreq";
+            std::filesystem::create_directories(dir);
+            std::ofstream(dir / "scaling_cur_freq") << (1200000 + (cpu * 10000)) << '\n';
+            m_Ids.push_back(cpu);
+        }
+    }
+
+    ~SyntheticCpufreqTree()
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(m_Root, ec);
+    }
+
+    SyntheticCpufreqTree(const SyntheticCpufreqTree&) = delete;
+    SyntheticCpufreqTree& operator=(const SyntheticCpufreqTree&) = delete;
+    SyntheticCpufreqTree(SyntheticCpufreqTree&&) = delete;
+    SyntheticCpufreqTree& operator=(SyntheticCpufreqTree&&) = delete;
+
+    [[nodiscard]] const std::filesystem::path& root() const
+    {
+        return m_Root;
+    }
+
+    [[nodiscard]] const std::vector<std::uint32_t>& ids() const
+    {
+        return m_Ids;
+    }
+
+  private:
+    std::filesystem::path m_Root;
+    std::vector<std::uint32_t> m_Ids;
+};
+
+// Steady-state cost: one pread per core on already-open descriptors
+static void BM_CpuFreqReader_Read(benchmark::State& state)
+{
+    const SyntheticCpufreqTree tree(static_cast<std::uint32_t>(state.range(0)));
+    Platform::CpuFreqReader reader(tree.root().string());
+    std::vector<std::uint32_t> mhz;
+    reader.read(tree.ids(), mhz); // Open descriptors outside the timed loop
+
+    for (auto _ : state)
+    {
+        reader.read(tree.ids(), mhz);
+        benchmark::DoNotOptimize(mhz.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CpuFreqReader_Read)->Arg(128)->Arg(256)->Unit(benchmark::kMicrosecond);
+
+// Baseline: open/read/close each file through an ifstream every tick
+static void BM_CpuFreqReader_IfstreamBaseline(benchmark::State& state)
+{
+    const SyntheticCpufreqTree tree(static_cast<std::uint32_t>(state.range(0)));
+    std::vector<std::uint32_t> mhz(tree.ids().size());
+
+    for (auto _ : state)
+    {
+        for (const auto cpu : tree.ids())
+        {
+            std::ifstream file(tree.root() / ("cpu" + std::to_string(cpu)) / "cpufreq" / "scaling_cur_freq");
+            std::uint64_t freqKHz = 0;
+            file >> freqKHz;
+            mhz[cpu] = static_cast<std::uint32_t>(freqKHz / 1000);
+        }
+        benchmark::DoNotOptimize(mhz.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CpuFreqReader_IfstreamBaseline)->Arg(128)->Arg(256)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+
+#endif // __linux__
@@ -0,0 +1,298 @@
+// Benchmarks for the Linux process pipeline on synthetic /proc trees (Linux-only)
+//
+// BM_ProcessProbe_Enumerate and BM_ProcessModel_Refresh in bench_ProcessModel.cpp measure
+// whatever happens to run on the benchmarking machine. These run the same pipeline against
+// deterministic trees from Fixtures::SyntheticProcTree at 1k, 10k and 50k processes, with
+// 1-11 fds and 32-544 byte command lines per process spread over eight cgroup v2 scopes,
+// so runs are comparable and the 10k+ range is covered:
+//
+//   Enumerate  LinuxProcessProbe::enumerate() alone
+//   EnumerateIfstreamBaseline
+//              the same per-process reads done the way the probe did before batching:
+//              a std::ifstream per file, a per-PID freezer.state probe, sched_getaffinity
+//              and a directory walk of <pid>/fd
+//   Snapshots  ProcessModel::updateFromCounters() on a fixed enumerate() result
+//   Refresh    ProcessModel::refresh(), i.e. enumerate() -> computeSnapshots()
+//
+// Each reports allocations and syscalls per process. Allocations come from the global
+// new/delete hooks in bench_main.cpp. Syscalls come from the raw_syscalls:sys_enter
+// tracepoint when perf can open it (needs tracefs and perf_event_paranoid <= 1 or
+// CAP_PERFMON); otherwise only read/write-family calls from /proc/self/io are counted.
+// The benchmark label says which.
+//
+// Trees live on tmpfs (/dev/shm) when it has the inodes to spare (a 50k tree needs about
+// 700k), otherwise in the temp directory. Generating the 50k tree takes a few seconds;
+// the most recent tree is kept so consecutive benchmarks of one size share it.
+
+#if defined(__linux__) && __has_include(<unistd.h>) && __has_include(<linux/perf_event.h>)
+
+#include "Domain/ProcessModel.h"
+#include "Fixtures/SyntheticProcTree.h"
+#include "MemoryTracker.h"
+#include "Platform/Linux/LinuxProcessProbe.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <linux/magic.h>
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+
+namespace
+{
+
+constexpr Fixtures::SyntheticProcOptions TREE_SHAPE = {
+    .fdsPerProcess = 1, .fdSpread = 10, .socketsPerProcess = 1, .cmdlineBytes = 32, .cmdlineSpread = 512};
+
+/// Directory for a tree of @p processes: /dev/shm if it is tmpfs with enough free inodes,
+/// else the temp directory.
+[[nodiscard]] std::filesystem::path treeParent(std::size_t processes)
+{
+    // Per process: its directory, fd/, six files and on average 6 fd links
+    const std::size_t inodes = processes * 14;
+    struct statfs fs = {};
+    if (::statfs("/dev/shm", &fs) == 0 && fs.f_type == TMPFS_MAGIC && fs.f_ffree > inodes)
+    {
+        return "/dev/shm";
+    }
+    return std::filesystem::temp_directory_path();
+}
+
+/// Synthetic tree with @p processes processes, reusing the previous one if the size matches.
+[[nodiscard]] const Fixtures::SyntheticProcTree& treeFor(std::int64_t processes)
+{
+    static std::unique_ptr<Fixtures::SyntheticProcTree> tree;
+    const auto count = static_cast<std::size_t>(processes);
+    if (!tree || tree->options().processes != count)
+    {
+        tree.reset(); // Remove the old tree before building the next one
+        Fixtures::SyntheticProcOptions options = TREE_SHAPE;
+        options.processes = count;
+        tree = std::make_unique<Fixtures::SyntheticProcTree>(options, treeParent(count));
+        tree->addCgroupV2();
+    }
+    return *tree;
+}
+
+/// Counts this process's syscalls: every syscall through the raw_syscalls:sys_enter
+/// tracepoint if perf allows it, otherwise read/write-family calls (syscr + syscw).
+class SyscallCounter
+{
+  public:
+    SyscallCounter()
+    {
+        for (const char* tracefs : {"/sys/kernel/tracing", "/sys/kernel/debug/tracing"})
+        {
+            std::ifstream idFile(std::string(tracefs) + "/events/raw_syscalls/sys_enter/id");
+            std::uint64_t id = 0;
+            if (!(idFile >> id))
+            {
+                continue;
+            }
+
+            perf_event_attr attr = {};
+            attr.type = PERF_TYPE_TRACEPOINT;
+            attr.size = sizeof(attr);
+            attr.config = id;
+            attr.inherit = 1;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) - syscall() is variadic
+            m_PerfFd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+            if (m_PerfFd >= 0)
+            {
+                return;
+            }
+        }
+    }
+
+    ~SyscallCounter()
+    {
+        if (m_PerfFd >= 0)
+        {
+            ::close(m_PerfFd);
+        }
+    }
+
+    SyscallCounter(const SyscallCounter&) = delete;
+    SyscallCounter& operator=(const SyscallCounter&) = delete;
+    SyscallCounter(SyscallCounter&&) = delete;
+    SyscallCounter& operator=(SyscallCounter&&) = delete;
+
+    /// Whether read() counts every syscall rather than only read/write-family ones.
+    [[nodiscard]] bool exact() const noexcept
+    {
+        return m_PerfFd >= 0;
+    }
+
+    [[nodiscard]] std::uint64_t read() const
+    {
+        std::uint64_t value = 0;
+        if (m_PerfFd >= 0)
+        {
+            return ::read(m_PerfFd, &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value)) ? value : 0;
+        }
+
+        std::ifstream io("/proc/self/io");
+        std::string key;
+        std::uint64_t total = 0;
+        while (io >> key >> value)
+        {
+            if (key == "syscr:" || key == "syscw:")
+            {
+                total += value;
+            }
+        }
+        return total;
+    }
+
+  private:
+    int m_PerfFd = -1;
+};
+
+/// Allocation and syscall deltas over the timed loop, reported per process.
+class PipelineCounters
+{
+  public:
+    PipelineCounters()
+    {
+        BenchmarkUtils::AllocationCounter::instance().reset();
+        m_SyscallsBefore = m_Syscalls.read();
+    }
+
+    void report(benchmark::State& state, std::size_t processes) const
+    {
+        const std::uint64_t syscalls = m_Syscalls.read() - m_SyscallsBefore;
+        const auto& allocations = BenchmarkUtils::AllocationCounter::instance();
+        const auto items = static_cast<double>(state.iterations()) * static_cast<double>(processes);
+
+        state.counters["processes"] = benchmark::Counter(static_cast<double>(processes));
+        state.counters["allocs_per_process"] = benchmark::Counter(static_cast<double>(allocations.allocationCount()) / items);
+        state.counters["alloc_bytes_per_process"] = benchmark::Counter(static_cast<double>(allocations.bytesAllocated()) / items);
+        state.counters["syscalls_per_process"] = benchmark::Counter(static_cast<double>(syscalls) / items);
+        state.SetLabel(m_Syscalls.exact() ? "syscalls: all" : "syscalls: read/write only");
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(processes));
+        BenchmarkUtils::reportMemoryCounters(state);
+    }
+
+  private:
+    SyscallCounter m_Syscalls;
+    std::uint64_t m_SyscallsBefore = 0;
+};
+
+static void BM_SyntheticProc_Enumerate(benchmark::State& state)
+{
+    const auto& tree = treeFor(state.range(0));
+    Platform::LinuxProcessProbe probe(tree.roots());
+    std::size_t processes = probe.enumerate().size(); // Warm-up: username cache, batch reader buffers
+
+    const PipelineCounters counters;
+    for (auto _ : state)
+    {
+        auto result = probe.enumerate();
+        processes = result.size();
+        benchmark::DoNotOptimize(result.data());
+    }
+    counters.report(state, processes);
+}
+BENCHMARK(BM_SyntheticProc_Enumerate)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+// Baseline: the per-process reads enumerate() replaces, one std::ifstream per file
+static void BM_SyntheticProc_EnumerateIfstreamBaseline(benchmark::State& state)
+{
+    constexpr std::array<std::string_view, 6> PID_FILES = {"stat", "statm", "status", "cmdline", "io", "cgroup"};
+    const auto& tree = treeFor(state.range(0));
+    const auto processes = static_cast<std::size_t>(state.range(0));
+    const std::filesystem::path freezerRoot = tree.sysRoot() / "fs" / "cgroup";
+    std::size_t bytes = 0;
+
+    const PipelineCounters counters;
+    for (auto _ : state)
+    {
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(tree.procRoot(), ec))
+        {
+            benchmark::DoNotOptimize(entry.path().filename().string());
+        }
+
+        for (std::size_t index = 0; index < processes; ++index)
+        {
+            const std::int32_t pid = tree.pid(index);
+            const auto dir = tree.procRoot() / std::to_string(pid);
+            for (const std::string_view file : PID_FILES)
+            {
+                std::ifstream in(dir / file, std::ios::binary);
+                const std::string contents{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+                bytes += contents.size();
+            }
+
+            const std::ifstream freezer(freezerRoot / std::to_string(pid) / "freezer.state");
+            bytes += freezer.is_open() ? 1 : 0;
+
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            bytes += static_cast<std::size_t>(sched_getaffinity(pid, sizeof(cpuSet), &cpuSet) == 0);
+
+            for (const auto& fd : std::filesystem::directory_iterator(dir / "fd", ec))
+            {
+                bytes += fd.path().native().size();
+            }
+        }
+        benchmark::DoNotOptimize(bytes);
+    }
+    counters.report(state, processes);
+}
+BENCHMARK(BM_SyntheticProc_EnumerateIfstreamBaseline)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+static void BM_SyntheticProc_Snapshots(benchmark::State& state)
+{
+    const auto& tree = treeFor(state.range(0));
+    auto probe = std::make_unique<Platform::LinuxProcessProbe>(tree.roots());
+    const std::vector<Platform::ProcessCounters> processes = probe->enumerate();
+    std::uint64_t totalCpuTime = probe->totalCpuTime();
+    Domain::ProcessModel model(std::move(probe));
+    model.updateFromCounters(processes, totalCpuTime);
+
+    const PipelineCounters counters;
+    for (auto _ : state)
+    {
+        totalCpuTime += 1000; // Advance the clock so CPU% is computed as on a live tick
+        model.updateFromCounters(processes, totalCpuTime);
+        benchmark::DoNotOptimize(model.processCount());
+    }
+    counters.report(state, processes.size());
+}
+BENCHMARK(BM_SyntheticProc_Snapshots)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+static void BM_SyntheticProc_Refresh(benchmark::State& state)
+{
+    const auto& tree = treeFor(state.range(0));
+    Domain::ProcessModel model(std::make_unique<Platform::LinuxProcessProbe>(tree.roots()));
+    model.refresh(); // Populate previous counters so every timed refresh computes deltas
+
+    const PipelineCounters counters;
+    for (auto _ : state)
+    {
+        model.refresh();
+        benchmark::DoNotOptimize(model.processCount());
+    }
+    counters.report(state, model.processCount());
+}
+BENCHMARK(BM_SyntheticProc_Refresh)->Arg(1000)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+} // namespace
+
+#endif // __linux__
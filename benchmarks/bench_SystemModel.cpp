@@ -0,0 +1,100 @@
+// Benchmarks for Domain/SystemModel per-core CPU computation
+//
+// These benchmarks measure the per-core delta/percent pass on synthetic many-core
+// inputs (64, 256 and 1024 logical CPUs). The kernel is AVX2 when built with
+// -march=x86-64-v3 (the `optimized` preset) and scalar otherwise; the "vectorized"
+// counter records which path was measured.
+
+#include "Domain/CpuCoreUsage.h"
+#include "Domain/SystemModel.h"
+#include "MemoryTracker.h"
+#include "Platform/SystemTypes.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// Synthetic per-core counters: cumulative ticks that advance by a random amount per sample
+std::vector<Platform::CpuCounters> makeCores(std::size_t count, std::uint64_t base, std::mt19937_64& rng)
+{
+    std::uniform_int_distribution<std::uint64_t> step(0, 100);
+    std::vector<Platform::CpuCounters> cores(count);
+    for (auto& core : cores)
+    {
+        core.user = base + step(rng);
+        core.nice = base / 10 + step(rng);
+        core.system = base / 2 + step(rng);
+        core.idle = base * 4 + step(rng);
+        core.iowait = base / 20 + step(rng);
+        core.irq = base / 50 + step(rng);
+        core.softirq = base / 40 + step(rng);
+        core.steal = step(rng);
+    }
+    return cores;
+}
+
+// Benchmark the SoA kernel alone
+static void BM_CpuCoreUsage_Compute(benchmark::State& state)
+{
+    const auto coreCount = static_cast<std::size_t>(state.range(0));
+    std::mt19937_64 rng(42);
+
+    Domain::CpuCoreUsage::CounterArrays previous;
+    Domain::CpuCoreUsage::CounterArrays current;
+    previous.assign(makeCores(coreCount, 100'000, rng), {});
+    current.assign(makeCores(coreCount, 100'200, rng), {});
+
+    Domain::CpuCoreUsage::UsageArrays usage;
+    for (auto _ : state)
+    {
+        Domain::CpuCoreUsage::compute(current, previous, usage);
+        benchmark::DoNotOptimize(usage.totalPercent.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(coreCount));
+    state.counters["vectorized"] = benchmark::Counter(Domain::CpuCoreUsage::isVectorized() ? 1.0 : 0.0);
+}
+BENCHMARK(BM_CpuCoreUsage_Compute)->Arg(64)->Arg(256)->Arg(1024);
+
+// Benchmark the full SystemModel update (transpose + kernel + snapshot + history)
+static void BM_SystemModel_UpdatePerCore(benchmark::State& state)
+{
+    const auto coreCount = static_cast<std::size_t>(state.range(0));
+    std::mt19937_64 rng(42);
+
+    // Monotonic sample sequence; wrapping back to the start costs one backwards tick per lap
+    constexpr std::size_t SAMPLE_COUNT = 32;
+    std::vector<Platform::SystemCounters> samples(SAMPLE_COUNT);
+    for (std::size_t i = 0; i < SAMPLE_COUNT; ++i)
+    {
+        samples[i].cpuPerCore = makeCores(coreCount, 100'000 + (i * 200), rng);
+    }
+
+    Domain::SystemModel model(nullptr);
+    double now = 0.0;
+    model.updateFromCounters(samples[0], now);
+
+    BenchmarkUtils::MemoryDeltaTracker memTracker;
+
+    std::size_t next = 1;
+    for (auto _ : state)
+    {
+        now += 1.0;
+        model.updateFromCounters(samples[next], now);
+        next = (next + 1) % SAMPLE_COUNT;
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(coreCount));
+    BenchmarkUtils::reportMemoryDelta(state, memTracker);
+}
+BENCHMARK(BM_SystemModel_UpdatePerCore)->Arg(64)->Arg(256)->Arg(1024);
+
+} // namespace
@@ -1,6 +1,62 @@
 // Benchmark entry point - Google Benchmark provides main() via benchmark_main
-// This file exists for any global setup if needed in the future
+// This file holds global setup shared by all benchmarks.
+
+#include "MemoryTracker.h"
 
 #include <benchmark/benchmark.h>
 
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
 // No custom main needed - using benchmark::benchmark_main
+
+// Global new/delete feed BenchmarkUtils::AllocationCounter so benchmarks can report
+// allocations per item (see bench_ProcessPipeline.cpp). The counters are relaxed atomics,
+// cheap enough to leave on for every benchmark.
+
+void* operator new(std::size_t size)
+{
+    BenchmarkUtils::AllocationCounter::instance().recordAllocation(size);
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc) - replacement operator new must use malloc
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (ptr != nullptr)
+    {
+        BenchmarkUtils::AllocationCounter::instance().recordDeallocation(0);
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc) - pairs with the malloc in operator new
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    ::operator delete(ptr);
+}
+
+void operator delete(void* ptr, std::size_t size) noexcept
+{
+    if (ptr != nullptr)
+    {
+        BenchmarkUtils::AllocationCounter::instance().recordDeallocation(size);
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc) - pairs with the malloc in operator new
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t size) noexcept
+{
+    ::operator delete(ptr, size);
+}
@@ -0,0 +1,186 @@
+#include "ActivitySection.h"
+
+#include "Domain/SystemSnapshot.h"
+#include "Platform/SystemTypes.h"
+#include "UI/ChartWidgets.h"
+#include "UI/Format.h"
+#include "UI/IconsFontAwesome6.h"
+#include "UI/Theme.h"
+
+#include <imgui.h>
+#include <implot.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <format>
+#include <string>
+#include <vector>
+
+namespace App::ActivitySection
+{
+
+namespace
+{
+
+using UI::Widgets::buildTimeAxis;
+using UI::Widgets::cropFrontToSize;
+using UI::Widgets::formatAgeSeconds;
+using UI::Widgets::HISTORY_PLOT_HEIGHT_DEFAULT;
+using UI::Widgets::hoveredIndexFromPlotX;
+using UI::Widgets::makeTimeAxisConfig;
+using UI::Widgets::NowBar;
+using UI::Widgets::PLOT_FLAGS_DEFAULT;
+using UI::Widgets::plotLineWithFill;
+using UI::Widgets::renderHistoryWithNowBars;
+using UI::Widgets::X_AXIS_FLAGS_DEFAULT;
+using UI::Widgets::Y_AXIS_FLAGS_DEFAULT;
+
+struct Series
+{
+    const char* label = "";
+    Platform::ActivityCounter counter = Platform::ActivityCounter::ContextSwitches;
+    double current = 0.0;
+    ImVec4 color{};
+    std::vector<float> hist;
+};
+
+/// Now bars have no natural maximum; scale each against the peak of its visible history.
+[[nodiscard]] float relativeToPeak(double current, const std::vector<float>& hist)
+{
+    double peak = current;
+    if (!hist.empty())
+    {
+        peak = std::max(peak, static_cast<double>(*std::ranges::max_element(hist)));
+    }
+    return peak > 0.0 ? static_cast<float>(current / peak) : 0.0F;
+}
+
+} // namespace
+
+void renderActivitySection(const RenderContext& ctx, const std::vector<double>& timestamps, double nowSeconds, int nowBarColumns)
+{
+    if (ctx.systemModel == nullptr || !ctx.systemModel->capabilities().hasActivity)
+    {
+        return;
+    }
+
+    const auto& theme = UI::Theme::get();
+    const auto snap = ctx.systemModel->snapshot();
+    const Domain::KernelActivity& activity = snap.activity;
+    const auto axisConfig = makeTimeAxisConfig(timestamps, ctx.maxHistorySeconds, ctx.historyScrollSeconds);
+
+    using Platform::ActivityCounter;
+    std::array<Series, 4> series = {{
+        {.label = "Context Switches",
+         .counter = ActivityCounter::ContextSwitches,
+         .current = activity.contextSwitchesPerSec,
+         .color = theme.scheme().chartCpu},
+        {.label = "Forks",
+         .counter = ActivityCounter::ProcessesCreated,
+         .current = activity.processesCreatedPerSec,
+         .color = theme.scheme().cpuSystem},
+        {.label = "Page Faults",
+         .counter = ActivityCounter::PageFaults,
+         .current = activity.pageFaultsPerSec,
+         .color = theme.scheme().chartMemory},
+        {.label = "Major Faults",
+         .counter = ActivityCounter::MajorFaults,
+         .current = activity.majorFaultsPerSec,
+         .color = theme.scheme().chartIo},
+    }};
+
+    size_t alignedCount = timestamps.size();
+    for (auto& entry : series)
+    {
+        entry.hist = ctx.systemModel->activityHistory(entry.counter);
+        alignedCount = std::min(alignedCount, entry.hist.size());
+    }
+    for (auto& entry : series)
+    {
+        cropFrontToSize(entry.hist, alignedCount);
+    }
+
+    ImGui::TextColored(theme.scheme().textPrimary, ICON_FA_GEARS "  Kernel Activity (%zu samples)", alignedCount);
+    ImGui::Spacing();
+
+    std::vector<float> timeData = buildTimeAxis(timestamps, alignedCount, nowSeconds);
+
+    auto activityPlot = [&]()
+    {
+        const UI::Widgets::PlotFontGuard fontGuard;
+        if (ImPlot::BeginPlot("##ActivityHistory", ImVec2(-1, HISTORY_PLOT_HEIGHT_DEFAULT), PLOT_FLAGS_DEFAULT))
+        {
+            UI::Widgets::setupLegendDefault();
+            ImPlot::SetupAxes("Time (s)", nullptr, X_AXIS_FLAGS_DEFAULT, ImPlotAxisFlags_AutoFit | Y_AXIS_FLAGS_DEFAULT);
+            ImPlot::SetupAxisFormat(ImAxis_Y1, UI::Widgets::formatAxisLocalized);
+            ImPlot::SetupAxisLimits(ImAxis_X1, axisConfig.xMin, axisConfig.xMax, ImPlotCond_Always);
+
+            for (const auto& entry : series)
+            {
+                if (!entry.hist.empty())
+                {
+                    plotLineWithFill(
+                        entry.label, timeData.data(), entry.hist.data(), UI::Format::checkedCount(entry.hist.size()), entry.color);
+                }
+            }
+
+            if (ImPlot::IsPlotHovered())
+            {
+                const ImPlotPoint mouse = ImPlot::GetPlotMousePos();
+                if (const auto idxVal = hoveredIndexFromPlotX(timeData, mouse.x))
+                {
+                    ImGui::BeginTooltip();
+                    const auto ageText = formatAgeSeconds(static_cast<double>(timeData[*idxVal]));
+                    ImGui::TextUnformatted(ageText.c_str());
+
+                    for (const auto& entry : series)
+                    {
+                        if (*idxVal < entry.hist.size())
+                        {
+                            ImGui::TextColored(
+                                entry.color, "%s: %s", entry.label, UI::Format::formatCountPerSecond(entry.hist[*idxVal]).c_str());
+                        }
+                    }
+                    ImGui::EndTooltip();
+                }
+            }
+
+            ImPlot::EndPlot();
+        }
+    };
+
+    std::vector<NowBar> activityBars;
+    for (const auto& entry : series)
+    {
+        activityBars.push_back({.valueText = UI::Format::formatCountPerSecond(entry.current),
+                                .label = std::string(entry.label) + "/s",
+                                .value01 = relativeToPeak(entry.current, entry.hist),
+                                .color = entry.color});
+    }
+
+    renderHistoryWithNowBars(
+        "ActivityHistoryLayout", HISTORY_PLOT_HEIGHT_DEFAULT, activityPlot, activityBars, false, static_cast<size_t>(nowBarColumns));
+
+    // Gauges and rarely-moving counters: one summary line rather than more chart series
+    std::string summary = std::format("Pages swapped in/out: {} / {}  |  Paging in/out: {} / {}",
+                                      UI::Format::formatCountPerSecond(activity.swapInPagesPerSec),
+                                      UI::Format::formatCountPerSecond(activity.swapOutPagesPerSec),
+                                      UI::Format::formatBytesPerSec(activity.pageInBytesPerSec),
+                                      UI::Format::formatBytesPerSec(activity.pageOutBytesPerSec));
+    if (activity.hasProcCounts)
+    {
+        summary += std::format("  |  Runnable: {}  Blocked: {}", activity.procsRunning, activity.procsBlocked);
+    }
+    if (activity.hasRunqueueWait)
+    {
+        summary += std::format("  |  Waiting for CPU: {:.2f} tasks", activity.runqueueWaitTasks);
+    }
+    if (activity.hasOomKills)
+    {
+        summary += std::format("  |  OOM kills: {}", activity.oomKillsTotal);
+    }
+    ImGui::TextColored(theme.scheme().textMuted, "%s", summary.c_str());
+}
+
+} // namespace App::ActivitySection
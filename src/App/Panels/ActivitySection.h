@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Domain/SystemModel.h"
+
+#include <vector>
+
+namespace App::ActivitySection
+{
+
+/// Context required to render the kernel activity section
+struct RenderContext
+{
+    Domain::SystemModel* systemModel = nullptr;
+    double maxHistorySeconds = 60.0;
+    double historyScrollSeconds = 0.0;
+};
+
+/// Render kernel activity rates (context switches, forks, page faults, swapping) with now bars.
+/// Renders nothing if the system probe does not report activity counters.
+/// @param ctx Render context with model and history config
+/// @param timestamps History timestamps from system model
+/// @param nowSeconds Current time in seconds
+/// @param nowBarColumns Number of columns for now bars layout
+void renderActivitySection(const RenderContext& ctx, const std::vector<double>& timestamps, double nowSeconds, int nowBarColumns);
+
+} // namespace App::ActivitySection
@@ -14,6 +14,7 @@
 #include <cfloat>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <format>
 #include <string>
 #include <vector>
@@ -51,6 +52,7 @@ void renderCpuCoresSection(RenderContext& ctx)
 
     auto snap = ctx.systemModel->snapshot();
     auto perCoreHist = ctx.systemModel->perCoreHistory();
+    auto perCoreFreqHist = ctx.systemModel->perCoreFreqHistory();
     auto& theme = UI::Theme::get();
 
     // CPU model header
@@ -122,7 +124,24 @@ void renderCpuCoresSection(RenderContext& ctx)
                         continue;
                     }
 
-                    const std::string coreLabel = std::format(ICON_FA_MICROCHIP " Core {}", coreIdx);
+                    // Cells are keyed by logical CPU id; offline CPUs keep their cell and history.
+                    const bool coreOnline = (coreIdx >= snap.cpuCoreOnline.size()) || (snap.cpuCoreOnline[coreIdx] != 0);
+                    const std::uint32_t coreFreqMHz =
+                        (coreIdx < snap.cpuPerCoreFreqMHz.size()) ? snap.cpuPerCoreFreqMHz[coreIdx] : 0U;
+                    std::string coreLabel;
+                    if (!coreOnline)
+                    {
+                        coreLabel = std::format(ICON_FA_MICROCHIP " Core {} (offline)", coreIdx);
+                    }
+                    else if (coreFreqMHz > 0)
+                    {
+                        coreLabel = std::format(
+                            ICON_FA_MICROCHIP " Core {} @ {:.2f} GHz", coreIdx, Domain::Numeric::toDouble(coreFreqMHz) / 1000.0);
+                    }
+                    else
+                    {
+                        coreLabel = std::format(ICON_FA_MICROCHIP " Core {}", coreIdx);
+                    }
 
                     ImGui::PushStyleColor(ImGuiCol_ChildBg, theme.scheme().childBg);
                     ImGui::PushStyleColor(ImGuiCol_Border, theme.scheme().separator);
@@ -145,8 +164,10 @@ void renderCpuCoresSection(RenderContext& ctx)
                         const auto& sampleData = samples;
                         const auto& themeRef = theme;
                         const auto& axisCfg = axisConfig;
+                        static const std::vector<float> EMPTY_FREQ;
+                        const auto& freqData = (coreIdx < perCoreFreqHist.size()) ? perCoreFreqHist[coreIdx] : EMPTY_FREQ;
 
-                        auto plotFn = [&timeData, &sampleData, &themeRef, &axisCfg]()
+                        auto plotFn = [&timeData, &sampleData, &freqData, &themeRef, &axisCfg]()
                         {
                             const UI::Widgets::PlotFontGuard fontGuard;
                             if (ImPlot::BeginPlot("##PerCorePlot", ImVec2(-1, HISTORY_PLOT_HEIGHT_DEFAULT), PLOT_FLAGS_DEFAULT))
@@ -175,6 +196,10 @@ void renderCpuCoresSection(RenderContext& ctx)
                                             ImGui::TextColored(
                                                 themeRef.scheme().chartCpu, "CPU: %.1f%%", static_cast<double>(sampleData[*idxVal]));
                                         }
+                                        if (*idxVal < freqData.size() && freqData[*idxVal] > 0.0F)
+                                        {
+                                            ImGui::Text("Freq: %.2f GHz", static_cast<double>(freqData[*idxVal]) / 1000.0);
+                                        }
                                         ImGui::EndTooltip();
                                     }
                                 }
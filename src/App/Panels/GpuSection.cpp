@@ -1,6 +1,7 @@
 #include "GpuSection.h"
 
 #include "Domain/GPUSnapshot.h"
+#include "Platform/GPUTypes.h"
 #include "UI/ChartWidgets.h"
 #include "UI/Format.h"
 #include "UI/IconsFontAwesome6.h"
@@ -24,7 +25,6 @@ namespace
 
 using UI::Widgets::buildTimeAxis;
 using UI::Widgets::computeAlpha;
-using UI::Widgets::cropFrontToSize;
 using UI::Widgets::formatAgeSeconds;
 using UI::Widgets::formatAxisPercent;
 using UI::Widgets::HISTORY_PLOT_HEIGHT_DEFAULT;
@@ -38,6 +38,45 @@ using UI::Widgets::smoothTowards;
 using UI::Widgets::X_AXIS_FLAGS_DEFAULT;
 using UI::Widgets::Y_AXIS_FLAGS_DEFAULT;
 
+/// One line per guarded vendor backend: state, timeouts and remaining backoff.
+void renderBackendHealth(const std::vector<Platform::GPUBackendHealth>& backends)
+{
+    const auto& scheme = UI::Theme::get().scheme();
+    for (const auto& backend : backends)
+    {
+        switch (backend.state)
+        {
+        case Platform::GPUBackendState::Healthy:
+            ImGui::TextColored(scheme.textSuccess, "%s %s: healthy", ICON_FA_CIRCLE_CHECK, backend.name.c_str());
+            ImGui::SameLine();
+            ImGui::TextColored(scheme.textMuted, "(last call %.1f ms)", backend.lastCallMs);
+            break;
+        case Platform::GPUBackendState::Degraded:
+            ImGui::TextColored(scheme.textWarning,
+                               "%s %s: degraded, %u timeout%s in a row",
+                               ICON_FA_TRIANGLE_EXCLAMATION,
+                               backend.name.c_str(),
+                               backend.consecutiveTimeouts,
+                               backend.consecutiveTimeouts == 1 ? "" : "s");
+            break;
+        case Platform::GPUBackendState::Backoff:
+            ImGui::TextColored(scheme.textError,
+                               "%s %s: not responding, retrying in %.0f s",
+                               ICON_FA_CIRCLE_EXCLAMATION,
+                               backend.name.c_str(),
+                               backend.backoffRemainingSeconds);
+            break;
+        }
+
+        if (backend.totalTimeouts > 0 && ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("%llu timeout(s) in total, %llu late result(s) dropped",
+                              static_cast<unsigned long long>(backend.totalTimeouts),
+                              static_cast<unsigned long long>(backend.droppedResults));
+        }
+    }
+}
+
 } // namespace
 
 void updateSmoothedGPU(const std::string& gpuId, const Domain::GPUSnapshot& snap, RenderContext& ctx)
@@ -77,20 +116,24 @@ void renderGpuSection(RenderContext& ctx)
     const auto gpuSnapshots = ctx.gpuModel->snapshots();
     const auto gpuInfos = ctx.gpuModel->gpuInfo();
     const auto caps = ctx.gpuModel->capabilities();
+    const auto backends = ctx.gpuModel->backendHealth();
     auto& theme = UI::Theme::get();
 
     if (gpuSnapshots.empty())
     {
         ImGui::TextColored(theme.scheme().textMuted, "No GPU data available");
+        renderBackendHealth(backends);
         return;
     }
 
-    // Get timestamps for history charts
-    const auto gpuTimestamps = ctx.gpuModel->historyTimestamps();
+    // History columns are read in place; the view holds the model's read lock until the section is drawn
+    const auto history = ctx.gpuModel->historyView();
+    const auto gpuTimestamps = history.timestamps();
     const double nowSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
     const auto axisConfig = makeTimeAxisConfig(gpuTimestamps, ctx.maxHistorySeconds, ctx.historyScrollSeconds);
 
     ImGui::Text("GPU Monitoring (%zu GPU%s)", gpuSnapshots.size(), gpuSnapshots.size() == 1 ? "" : "s");
+    renderBackendHealth(backends);
     ImGui::Spacing();
 
     // Update smoothed values for all GPUs
@@ -140,27 +183,18 @@ void renderGpuSection(RenderContext& ctx)
 
         ImGui::Indent();
 
-        // Get history data for this GPU
-        auto utilHist = ctx.gpuModel->utilizationHistory(snap.gpuId);
-        auto memHist = ctx.gpuModel->memoryPercentHistory(snap.gpuId);
-        auto clockHist = ctx.gpuModel->gpuClockHistory(snap.gpuId);
-        auto encoderHist = ctx.gpuModel->encoderHistory(snap.gpuId);
-        auto decoderHist = ctx.gpuModel->decoderHistory(snap.gpuId);
-        auto tempHist = ctx.gpuModel->temperatureHistory(snap.gpuId);
-        auto powerHist = ctx.gpuModel->powerHistory(snap.gpuId);
-        auto fanHist = ctx.gpuModel->fanSpeedHistory(snap.gpuId);
-
-        const size_t alignedCount = std::min({utilHist.size(), memHist.size(), gpuTimestamps.size()});
-
-        // Crop histories to aligned size using existing helper
-        cropFrontToSize(utilHist, alignedCount);
-        cropFrontToSize(memHist, alignedCount);
-        cropFrontToSize(encoderHist, alignedCount);
-        cropFrontToSize(decoderHist, alignedCount);
-        cropFrontToSize(clockHist, alignedCount);
-        cropFrontToSize(tempHist, alignedCount);
-        cropFrontToSize(powerHist, alignedCount);
-        cropFrontToSize(fanHist, alignedCount);
+        // Get history data for this GPU (all columns of a GPU have the same length)
+        const size_t alignedCount =
+            std::min(history.series(snap.gpuId, Domain::GPUMetric::UtilizationPercent).size(), gpuTimestamps.size());
+        auto column = [&](Domain::GPUMetric metric) { return history.series(snap.gpuId, metric).last(alignedCount); };
+        const auto utilHist = column(Domain::GPUMetric::UtilizationPercent);
+        const auto memHist = column(Domain::GPUMetric::MemoryUsedPercent);
+        const auto clockHist = column(Domain::GPUMetric::GpuClockMHz);
+        const auto encoderHist = column(Domain::GPUMetric::EncoderUtilPercent);
+        const auto decoderHist = column(Domain::GPUMetric::DecoderUtilPercent);
+        const auto tempHist = column(Domain::GPUMetric::TemperatureC);
+        const auto powerHist = column(Domain::GPUMetric::PowerDrawWatts);
+        const auto fanHist = column(Domain::GPUMetric::FanSpeed);
 
         std::vector<float> timeData = buildTimeAxis(gpuTimestamps, alignedCount, nowSeconds);
 
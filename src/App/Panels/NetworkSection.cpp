@@ -99,13 +99,50 @@ void renderNetworkSection(RenderContext& ctx)
     const auto netSnap = ctx.systemModel->snapshot();
     const auto& interfaces = netSnap.networkInterfaces;
 
-    // Build interface selector dropdown
-    std::vector<std::string> interfaceNames;
-    interfaceNames.emplace_back("Total (All Interfaces)");
-    for (const auto& iface : interfaces)
+    // Grouping toggle: hosts running containers can have thousands of veth interfaces
+    bool grouped = (ctx.groupNetworkInterfaces != nullptr) && *ctx.groupNetworkInterfaces;
+    if (ImGui::Checkbox("Group by type", &grouped) && ctx.groupNetworkInterfaces != nullptr)
     {
-        // Use display name if available, otherwise interface name
-        interfaceNames.push_back(iface.displayName.empty() ? iface.name : iface.displayName);
+        *ctx.groupNetworkInterfaces = grouped;
+        // Selection values mean different things in each mode - start again from "Total"
+        if (ctx.selectedNetworkInterface != nullptr)
+        {
+            *ctx.selectedNetworkInterface = -1;
+        }
+        if (ctx.smoothedNetInitialized != nullptr)
+        {
+            *ctx.smoothedNetInitialized = false;
+        }
+    }
+    ImGui::SameLine();
+
+    // Build selector dropdown: entryValues[i] is the selection value for entryNames[i]
+    // (-1 = Total, then interface indices, or InterfaceGroup indices when grouped)
+    std::vector<std::string> entryNames;
+    std::vector<int> entryValues;
+    entryNames.emplace_back("Total (All Interfaces)");
+    entryValues.push_back(-1);
+    if (grouped)
+    {
+        for (size_t g = 0; g < netSnap.networkGroups.size(); ++g)
+        {
+            const auto& group = netSnap.networkGroups[g];
+            if (group.interfaceCount > 0)
+            {
+                entryNames.push_back(
+                    std::format("{} ({})", Domain::interfaceGroupLabel(static_cast<Domain::InterfaceGroup>(g)), group.interfaceCount));
+                entryValues.push_back(static_cast<int>(g));
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < interfaces.size(); ++i)
+        {
+            // Use display name if available, otherwise interface name
+            entryNames.push_back(interfaces[i].displayName.empty() ? interfaces[i].name : interfaces[i].displayName);
+            entryValues.push_back(static_cast<int>(i));
+        }
     }
 
     const auto interfaceCount = interfaces.size();
@@ -113,9 +150,9 @@ void renderNetworkSection(RenderContext& ctx)
     // Get selected interface (or default to -1)
     int selectedInterface = (ctx.selectedNetworkInterface != nullptr) ? *ctx.selectedNetworkInterface : -1;
 
-    // Clamp selected interface to current range so indexing into interfaceNames is always safe.
+    // Clamp selected interface to current range so indexing into interfaces is always safe.
     // Interfaces can disappear (e.g., USB adapter unplugged, VPN disconnected).
-    if (std::cmp_greater_equal(selectedInterface, interfaceCount))
+    if (!grouped && std::cmp_greater_equal(selectedInterface, interfaceCount))
     {
         // Guard against potential overflow when converting from size_t to int.
         // While extremely unlikely (would require SIZE_MAX interfaces), be defensive.
@@ -137,19 +174,28 @@ void renderNetworkSection(RenderContext& ctx)
         }
     }
 
+    // A group whose last interface went away drops back to "Total"
+    auto selectedEntry = std::ranges::find(entryValues, selectedInterface);
+    if (selectedEntry == entryValues.end())
+    {
+        selectedInterface = -1;
+        selectedEntry = entryValues.begin();
+        if (ctx.selectedNetworkInterface != nullptr)
+        {
+            *ctx.selectedNetworkInterface = selectedInterface;
+        }
+    }
+
     // Interface selector
     ImGui::SetNextItemWidth(250.0F);
-    // Index 0 is "Total", indices 1+ are interfaces. selectedInterface: -1 = Total, 0+ = interface index
-    // Safe: selectedInterface is always >= -1, so selectedInterface + 1 is always >= 0
-    const size_t comboIndex = (selectedInterface < 0) ? 0 : static_cast<size_t>(selectedInterface) + 1;
-    if (ImGui::BeginCombo("##NetworkInterface", interfaceNames[comboIndex].c_str()))
+    const auto comboIndex = static_cast<size_t>(selectedEntry - entryValues.begin());
+    if (ImGui::BeginCombo("##NetworkInterface", entryNames[comboIndex].c_str()))
     {
-        for (size_t i = 0; i <= interfaceCount; ++i)
+        for (size_t i = 0; i < entryNames.size(); ++i)
         {
-            // i=0 means "Total" (selectedInterface == -1), i=1+ means interface index 0+
-            const int selectionValue = static_cast<int>(i) - 1;
+            const int selectionValue = entryValues[i];
             const bool isSelected = (selectedInterface == selectionValue);
-            if (ImGui::Selectable(interfaceNames[i].c_str(), isSelected))
+            if (ImGui::Selectable(entryNames[i].c_str(), isSelected))
             {
                 selectedInterface = selectionValue;
                 if (ctx.selectedNetworkInterface != nullptr)
@@ -172,23 +218,38 @@ void renderNetworkSection(RenderContext& ctx)
 
     ImGui::SameLine();
 
+    // Resolve the selection to an interface or a group (both null = "Total")
+    const bool hasValidSelection = selectedInterface >= 0 && (grouped || std::cmp_less(selectedInterface, interfaceCount));
+    const auto* selectedIface = (hasValidSelection && !grouped) ? &interfaces[static_cast<size_t>(selectedInterface)] : nullptr;
+    const auto* selectedGroup = (hasValidSelection && grouped) ? &netSnap.networkGroups[static_cast<size_t>(selectedInterface)] : nullptr;
+    const auto selectedGroupId = static_cast<Domain::InterfaceGroup>(std::max(selectedInterface, 0));
+
     // Show link speed for selected interface (if available and not "Total")
-    const bool hasValidSelection = selectedInterface >= 0 && std::cmp_less(selectedInterface, interfaceCount);
-    if (hasValidSelection)
+    if (selectedIface != nullptr)
     {
-        const auto& selectedIface = interfaces[static_cast<size_t>(selectedInterface)];
-        if (selectedIface.linkSpeedMbps > 0)
+        if (selectedIface->linkSpeedMbps > 0)
         {
-            const auto linkText = std::format("Link: {} Mbps", selectedIface.linkSpeedMbps);
+            const auto linkText = std::format("Link: {} Mbps", selectedIface->linkSpeedMbps);
             ImGui::TextColored(theme.scheme().textMuted, "%s", linkText.c_str());
         }
         else
         {
             ImGui::TextColored(theme.scheme().textMuted, "Link: Unknown");
         }
+        if (selectedIface->mtu > 0)
+        {
+            ImGui::SameLine();
+            const auto mtuText = std::format("MTU: {}", selectedIface->mtu);
+            ImGui::TextColored(theme.scheme().textMuted, "%s", mtuText.c_str());
+        }
         ImGui::SameLine();
-        ImGui::TextColored(selectedIface.isUp ? theme.scheme().textSuccess : theme.scheme().textError,
-                           selectedIface.isUp ? "[Up]" : "[Down]");
+        ImGui::TextColored(selectedIface->isUp ? theme.scheme().textSuccess : theme.scheme().textError,
+                           selectedIface->isUp ? "[Up]" : "[Down]");
+    }
+    else if (selectedGroup != nullptr)
+    {
+        const auto upText = std::format("{} of {} up", selectedGroup->upCount, selectedGroup->interfaceCount);
+        ImGui::TextColored(theme.scheme().textMuted, "%s", upText.c_str());
     }
 
     ImGui::Spacing();
@@ -197,30 +258,43 @@ void renderNetworkSection(RenderContext& ctx)
     double targetSent = 0.0;
     double targetRecv = 0.0;
 
-    if (selectedInterface < 0)
+    if (selectedIface != nullptr)
+    {
+        // Specific interface - use its current rates
+        targetSent = selectedIface->txBytesPerSec;
+        targetRecv = selectedIface->rxBytesPerSec;
+    }
+    else if (selectedGroup != nullptr)
+    {
+        targetSent = selectedGroup->txBytesPerSec;
+        targetRecv = selectedGroup->rxBytesPerSec;
+    }
+    else
     {
         // Total mode - use existing system-wide history
         targetSent = netSnap.netTxBytesPerSec;
         targetRecv = netSnap.netRxBytesPerSec;
     }
-    else if (hasValidSelection)
-    {
-        // Specific interface - use its current rates
-        const auto& selectedIface = interfaces[static_cast<size_t>(selectedInterface)];
-        targetSent = selectedIface.txBytesPerSec;
-        targetRecv = selectedIface.rxBytesPerSec;
-    }
 
     const auto netTimestamps = ctx.systemModel->timestamps();
     const auto netTxHist = ctx.systemModel->netTxHistory();
     const auto netRxHist = ctx.systemModel->netRxHistory();
     const size_t aligned = std::min({netTimestamps.size(), netTxHist.size(), netRxHist.size()});
 
-    // Get per-interface history if an interface is selected
-    const bool showingInterface = selectedInterface >= 0 && hasValidSelection;
-    const std::string ifaceName = showingInterface ? interfaces[static_cast<size_t>(selectedInterface)].name : "";
-    const auto ifaceTxHist = showingInterface ? ctx.systemModel->netTxHistoryForInterface(ifaceName) : std::vector<float>{};
-    const auto ifaceRxHist = showingInterface ? ctx.systemModel->netRxHistoryForInterface(ifaceName) : std::vector<float>{};
+    // Get per-interface (or per-group) history if one is selected
+    const bool showingInterface = (selectedIface != nullptr) || (selectedGroup != nullptr);
+    std::vector<float> ifaceTxHist;
+    std::vector<float> ifaceRxHist;
+    if (selectedIface != nullptr)
+    {
+        ctx.systemModel->netTxHistoryForInterface(selectedIface->name, ifaceTxHist);
+        ctx.systemModel->netRxHistoryForInterface(selectedIface->name, ifaceRxHist);
+    }
+    else if (selectedGroup != nullptr)
+    {
+        ifaceTxHist = ctx.systemModel->netTxHistoryForGroup(selectedGroupId);
+        ifaceRxHist = ctx.systemModel->netRxHistoryForGroup(selectedGroupId);
+    }
 
     // Always use default axis config even with no data
     const auto axis = aligned > 0 ? makeTimeAxisConfig(netTimestamps, ctx.maxHistorySeconds, ctx.historyScrollSeconds)
@@ -239,15 +313,20 @@ void renderNetworkSection(RenderContext& ctx)
         sentData.assign(netTxHist.end() - static_cast<std::ptrdiff_t>(aligned), netTxHist.end());
         recvData.assign(netRxHist.end() - static_cast<std::ptrdiff_t>(aligned), netRxHist.end());
 
-        // Per-interface history (if available and same length as total)
-        if (showingInterface && ifaceTxHist.size() >= aligned)
-        {
-            ifaceSentData.assign(ifaceTxHist.end() - static_cast<std::ptrdiff_t>(aligned), ifaceTxHist.end());
-        }
-        if (showingInterface && ifaceRxHist.size() >= aligned)
+        // Per-interface history, right-aligned with the total. Interfaces that appeared
+        // mid-window have fewer samples; the front is padded with zeros.
+        const auto alignSeries = [aligned](const std::vector<float>& hist, std::vector<float>& out)
         {
-            ifaceRecvData.assign(ifaceRxHist.end() - static_cast<std::ptrdiff_t>(aligned), ifaceRxHist.end());
-        }
+            if (hist.empty())
+            {
+                return;
+            }
+            const size_t count = std::min(hist.size(), aligned);
+            out.assign(aligned, 0.0F);
+            std::copy(hist.end() - static_cast<std::ptrdiff_t>(count), hist.end(), out.end() - static_cast<std::ptrdiff_t>(count));
+        };
+        alignSeries(ifaceTxHist, ifaceSentData);
+        alignSeries(ifaceRxHist, ifaceRecvData);
     }
 
     // Update smoothed network rates
@@ -272,7 +351,15 @@ void renderNetworkSection(RenderContext& ctx)
     }
 
     // Determine labels based on selection
-    const std::string ifaceDisplayName = showingInterface ? interfaces[static_cast<size_t>(selectedInterface)].name : "Network";
+    std::string ifaceDisplayName = "Network";
+    if (selectedIface != nullptr)
+    {
+        ifaceDisplayName = selectedIface->name;
+    }
+    else if (selectedGroup != nullptr)
+    {
+        ifaceDisplayName = Domain::interfaceGroupLabel(selectedGroupId);
+    }
     const std::string sentBarLabel = showingInterface ? std::format("{} Sent", ifaceDisplayName) : "Network Sent";
     const std::string recvBarLabel = showingInterface ? std::format("{} Recv", ifaceDisplayName) : "Network Received";
 
@@ -286,11 +373,7 @@ void renderNetworkSection(RenderContext& ctx)
                          .color = theme.accentColor(2)};
 
     // Determine plot title based on selection
-    std::string plotTitle = "Total";
-    if (selectedInterface >= 0 && hasValidSelection)
-    {
-        plotTitle = interfaces[static_cast<size_t>(selectedInterface)].name;
-    }
+    const std::string plotTitle = showingInterface ? ifaceDisplayName : "Total";
 
     // Colors for interface-specific lines (lighter/dashed to distinguish from total)
     const auto ifaceSentColor = ImVec4(theme.scheme().chartCpu.x, theme.scheme().chartCpu.y, theme.scheme().chartCpu.z, 0.7F);
@@ -35,8 +35,12 @@ struct RenderContext
     double* smoothedNetRecvBytesPerSec = nullptr;
     bool* smoothedNetInitialized = nullptr;
 
-    // Selected network interface (-1 = "Total" / all interfaces combined)
+    // Selected network interface (-1 = "Total" / all interfaces combined).
+    // When interfaces are grouped this holds a Domain::InterfaceGroup index instead.
     int* selectedNetworkInterface = nullptr;
+
+    // Aggregate the selector by interface group (veth, bridge, tunnel, ...)
+    bool* groupNetworkInterfaces = nullptr;
 };
 
 /// Render the Disk I/O section with history chart.
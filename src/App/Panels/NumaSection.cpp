@@ -0,0 +1,184 @@
+#include "NumaSection.h"
+
+#include "Domain/SystemSnapshot.h"
+#include "UI/ChartWidgets.h"
+#include "UI/Format.h"
+#include "UI/IconsFontAwesome6.h"
+#include "UI/Theme.h"
+
+#include <imgui.h>
+#include <implot.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <format>
+#include <string>
+#include <vector>
+
+namespace App::NumaSection
+{
+
+namespace
+{
+
+using UI::Widgets::buildTimeAxis;
+using UI::Widgets::cropFrontToSize;
+using UI::Widgets::formatAgeSeconds;
+using UI::Widgets::HISTORY_PLOT_HEIGHT_DEFAULT;
+using UI::Widgets::hoveredIndexFromPlotX;
+using UI::Widgets::makeTimeAxisConfig;
+using UI::Widgets::NowBar;
+using UI::Widgets::PLOT_FLAGS_DEFAULT;
+using UI::Widgets::renderHistoryWithNowBars;
+using UI::Widgets::X_AXIS_FLAGS_DEFAULT;
+using UI::Widgets::Y_AXIS_FLAGS_DEFAULT;
+
+/// Nodes have no theme colors of their own; take them from the ImPlot colormap so they
+/// stay distinct on 8-node hosts.
+[[nodiscard]] ImVec4 nodeColor(std::size_t nodeId)
+{
+    return ImPlot::GetColormapColor(static_cast<int>(nodeId));
+}
+
+} // namespace
+
+void renderNumaSection(const RenderContext& ctx, const std::vector<double>& timestamps, double nowSeconds, int nowBarColumns)
+{
+    if (ctx.systemModel == nullptr || !ctx.systemModel->capabilities().hasNuma)
+    {
+        return;
+    }
+
+    const auto snap = ctx.systemModel->snapshot();
+    if (snap.numaNodes.size() < 2)
+    {
+        return; // A single node is the whole machine; the CPU and memory sections already cover it
+    }
+
+    const auto& theme = UI::Theme::get();
+    const auto axisConfig = makeTimeAxisConfig(timestamps, ctx.maxHistorySeconds, ctx.historyScrollSeconds);
+
+    std::vector<std::vector<float>> cpuHist = ctx.systemModel->numaCpuHistory();
+    std::vector<std::vector<float>> memHist = ctx.systemModel->numaMemoryHistory();
+
+    size_t alignedCount = timestamps.size();
+    for (const auto& node : snap.numaNodes)
+    {
+        if (node.nodeId < cpuHist.size() && node.nodeId < memHist.size())
+        {
+            alignedCount = std::min({alignedCount, cpuHist[node.nodeId].size(), memHist[node.nodeId].size()});
+        }
+    }
+    for (auto& hist : cpuHist)
+    {
+        cropFrontToSize(hist, alignedCount);
+    }
+    for (auto& hist : memHist)
+    {
+        cropFrontToSize(hist, alignedCount);
+    }
+
+    ImGui::TextColored(
+        theme.scheme().textPrimary, ICON_FA_SERVER "  NUMA Nodes (%zu nodes, %zu samples)", snap.numaNodes.size(), alignedCount);
+    ImGui::Spacing();
+
+    std::vector<float> timeData = buildTimeAxis(timestamps, alignedCount, nowSeconds);
+
+    auto numaPlot = [&]()
+    {
+        const UI::Widgets::PlotFontGuard fontGuard;
+        if (ImPlot::BeginPlot("##NumaHistory", ImVec2(-1, HISTORY_PLOT_HEIGHT_DEFAULT), PLOT_FLAGS_DEFAULT))
+        {
+            UI::Widgets::setupLegendDefault();
+            ImPlot::SetupAxes("Time (s)", nullptr, X_AXIS_FLAGS_DEFAULT, Y_AXIS_FLAGS_DEFAULT);
+            ImPlot::SetupAxisLimits(ImAxis_Y1, 0, 100, ImPlotCond_Always);
+            ImPlot::SetupAxisFormat(ImAxis_Y1, UI::Widgets::formatAxisPercent);
+            ImPlot::SetupAxisLimits(ImAxis_X1, axisConfig.xMin, axisConfig.xMax, ImPlotCond_Always);
+
+            // CPU solid, memory dashed-thin in the same node color; fills would stack into mud with many nodes
+            for (const auto& node : snap.numaNodes)
+            {
+                if (node.nodeId >= cpuHist.size() || node.nodeId >= memHist.size())
+                {
+                    continue;
+                }
+                const ImVec4 color = nodeColor(node.nodeId);
+                const std::string cpuLabel = std::format("Node {} CPU", node.nodeId);
+                const std::string memLabel = std::format("Node {} Memory", node.nodeId);
+                const auto& cpu = cpuHist[node.nodeId];
+                const auto& mem = memHist[node.nodeId];
+
+                ImPlot::SetNextLineStyle(color, 2.0F);
+                ImPlot::PlotLine(cpuLabel.c_str(), timeData.data(), cpu.data(), UI::Format::checkedCount(cpu.size()));
+                ImPlot::SetNextLineStyle(ImVec4{color.x, color.y, color.z, color.w * 0.6F}, 1.0F);
+                ImPlot::PlotLine(memLabel.c_str(), timeData.data(), mem.data(), UI::Format::checkedCount(mem.size()));
+            }
+
+            if (ImPlot::IsPlotHovered())
+            {
+                const ImPlotPoint mouse = ImPlot::GetPlotMousePos();
+                if (const auto idxVal = hoveredIndexFromPlotX(timeData, mouse.x))
+                {
+                    ImGui::BeginTooltip();
+                    const auto ageText = formatAgeSeconds(static_cast<double>(timeData[*idxVal]));
+                    ImGui::TextUnformatted(ageText.c_str());
+
+                    for (const auto& node : snap.numaNodes)
+                    {
+                        if (node.nodeId < cpuHist.size() && *idxVal < cpuHist[node.nodeId].size() && *idxVal < memHist[node.nodeId].size())
+                        {
+                            ImGui::TextColored(nodeColor(node.nodeId),
+                                               "Node %u: CPU %s, Memory %s",
+                                               node.nodeId,
+                                               UI::Format::percentCompact(cpuHist[node.nodeId][*idxVal]).c_str(),
+                                               UI::Format::percentCompact(memHist[node.nodeId][*idxVal]).c_str());
+                        }
+                    }
+                    ImGui::EndTooltip();
+                }
+            }
+
+            ImPlot::EndPlot();
+        }
+    };
+
+    std::vector<NowBar> numaBars;
+    numaBars.reserve(snap.numaNodes.size() * 2);
+    for (const auto& node : snap.numaNodes)
+    {
+        const ImVec4 color = nodeColor(node.nodeId);
+        numaBars.push_back({.valueText = UI::Format::percentCompact(node.cpuPercent),
+                            .label = std::format("Node {} CPU ({}/{} online)", node.nodeId, node.cpuOnline, node.cpuCount),
+                            .value01 = UI::Format::percent01(node.cpuPercent),
+                            .color = color});
+        numaBars.push_back({.valueText = UI::Format::percentCompact(node.memUsedPercent),
+                            .label = std::format("Node {} Memory ({})",
+                                                 node.nodeId,
+                                                 UI::Format::bytesUsedTotalPercentCompact(
+                                                     node.memUsedBytes, node.memTotalBytes, node.memUsedPercent)),
+                            .value01 = UI::Format::percent01(node.memUsedPercent),
+                            .color = color});
+    }
+
+    renderHistoryWithNowBars(
+        "NumaHistoryLayout", HISTORY_PLOT_HEIGHT_DEFAULT, numaPlot, numaBars, false, static_cast<size_t>(nowBarColumns));
+
+    // Allocation locality per node: misses and foreign allocations mean a node ran out and spilled over
+    for (const auto& node : snap.numaNodes)
+    {
+        if (!node.hasNumaStat)
+        {
+            continue;
+        }
+        const std::string line = std::format("Node {}: local {}  |  hits {}  misses {}  foreign {}",
+                                             node.nodeId,
+                                             UI::Format::percentCompact(node.localPercent),
+                                             UI::Format::formatCountPerSecond(node.hitPagesPerSec),
+                                             UI::Format::formatCountPerSecond(node.missPagesPerSec),
+                                             UI::Format::formatCountPerSecond(node.foreignPagesPerSec));
+        const bool spilling = node.missPagesPerSec > 0.0 || node.foreignPagesPerSec > 0.0;
+        ImGui::TextColored(spilling ? theme.scheme().textWarning : theme.scheme().textMuted, "%s", line.c_str());
+    }
+}
+
+} // namespace App::NumaSection
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Domain/SystemModel.h"
+
+#include <vector>
+
+namespace App::NumaSection
+{
+
+/// Context required to render the NUMA node section
+struct RenderContext
+{
+    Domain::SystemModel* systemModel = nullptr;
+    double maxHistorySeconds = 60.0;
+    double historyScrollSeconds = 0.0;
+};
+
+/// Render per-NUMA-node CPU and memory use with now bars, plus allocation locality.
+/// Renders nothing on single-node hosts or when the system probe has no NUMA topology.
+/// @param ctx Render context with model and history config
+/// @param timestamps History timestamps from system model
+/// @param nowSeconds Current time in seconds
+/// @param nowBarColumns Number of columns for now bars layout
+void renderNumaSection(const RenderContext& ctx, const std::vector<double>& timestamps, double nowSeconds, int nowBarColumns);
+
+} // namespace App::NumaSection
@@ -0,0 +1,179 @@
+#include "PressureSection.h"
+
+#include "Domain/SystemSnapshot.h"
+#include "Platform/SystemTypes.h"
+#include "UI/ChartWidgets.h"
+#include "UI/Format.h"
+#include "UI/IconsFontAwesome6.h"
+#include "UI/Theme.h"
+
+#include <imgui.h>
+#include <implot.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace App::PressureSection
+{
+
+namespace
+{
+
+using UI::Widgets::buildTimeAxis;
+using UI::Widgets::cropFrontToSize;
+using UI::Widgets::formatAgeSeconds;
+using UI::Widgets::HISTORY_PLOT_HEIGHT_DEFAULT;
+using UI::Widgets::hoveredIndexFromPlotX;
+using UI::Widgets::makeTimeAxisConfig;
+using UI::Widgets::NowBar;
+using UI::Widgets::PLOT_FLAGS_DEFAULT;
+using UI::Widgets::plotLineWithFill;
+using UI::Widgets::renderHistoryWithNowBars;
+using UI::Widgets::X_AXIS_FLAGS_DEFAULT;
+using UI::Widgets::Y_AXIS_FLAGS_DEFAULT;
+
+/// Stalls are usually a few percent; scale the Y axis to the visible peak (in steps of
+/// 10%) instead of pinning it to 100%, so small but sustained pressure stays readable.
+constexpr double MIN_Y_AXIS_PERCENT = 10.0;
+
+struct Series
+{
+    const char* label = "";
+    Platform::PressureResource resource = Platform::PressureResource::Cpu;
+    const Domain::PressureStall* stall = nullptr;
+    ImVec4 color{};
+    std::vector<float> someHist;
+    std::vector<float> fullHist;
+};
+
+} // namespace
+
+void renderPressureSection(const RenderContext& ctx, const std::vector<double>& timestamps, double nowSeconds, int nowBarColumns)
+{
+    if (ctx.systemModel == nullptr || !ctx.systemModel->capabilities().hasPressure)
+    {
+        return;
+    }
+
+    const auto& theme = UI::Theme::get();
+    const auto snap = ctx.systemModel->snapshot();
+    const auto axisConfig = makeTimeAxisConfig(timestamps, ctx.maxHistorySeconds, ctx.historyScrollSeconds);
+
+    using Platform::PressureResource;
+    std::array<Series, Platform::PRESSURE_RESOURCE_COUNT> series = {{
+        {.label = "CPU", .resource = PressureResource::Cpu, .stall = &snap.pressureCpu, .color = theme.scheme().chartCpu},
+        {.label = "Memory", .resource = PressureResource::Memory, .stall = &snap.pressureMemory, .color = theme.scheme().chartMemory},
+        {.label = "I/O", .resource = PressureResource::Io, .stall = &snap.pressureIo, .color = theme.scheme().chartIo},
+        {.label = "IRQ", .resource = PressureResource::Irq, .stall = &snap.pressureIrq, .color = theme.scheme().cpuSystem},
+    }};
+
+    size_t alignedCount = timestamps.size();
+    for (auto& entry : series)
+    {
+        entry.someHist = ctx.systemModel->pressureSomeHistory(entry.resource);
+        entry.fullHist = ctx.systemModel->pressureFullHistory(entry.resource);
+        if (entry.stall->available)
+        {
+            alignedCount = std::min({alignedCount, entry.someHist.size(), entry.fullHist.size()});
+        }
+    }
+
+    ImGui::TextColored(theme.scheme().textPrimary, ICON_FA_HOURGLASS_HALF "  Pressure Stall (%zu samples)", alignedCount);
+    ImGui::Spacing();
+
+    double peakPercent = 0.0;
+    for (auto& entry : series)
+    {
+        cropFrontToSize(entry.someHist, alignedCount);
+        cropFrontToSize(entry.fullHist, alignedCount);
+        // irq has no "some" line; its "full" stall is plotted instead of a flat zero
+        const auto& plotted = entry.stall->hasSome ? entry.someHist : entry.fullHist;
+        if (entry.stall->available && !plotted.empty())
+        {
+            peakPercent = std::max(peakPercent, static_cast<double>(*std::ranges::max_element(plotted)));
+        }
+    }
+    const double yMax = std::clamp(std::ceil(peakPercent / 10.0) * 10.0, MIN_Y_AXIS_PERCENT, 100.0);
+    std::vector<float> timeData = buildTimeAxis(timestamps, alignedCount, nowSeconds);
+
+    auto pressurePlot = [&]()
+    {
+        const UI::Widgets::PlotFontGuard fontGuard;
+        if (ImPlot::BeginPlot("##PressureHistory", ImVec2(-1, HISTORY_PLOT_HEIGHT_DEFAULT), PLOT_FLAGS_DEFAULT))
+        {
+            UI::Widgets::setupLegendDefault();
+            ImPlot::SetupAxes("Time (s)", nullptr, X_AXIS_FLAGS_DEFAULT, ImPlotAxisFlags_Lock | Y_AXIS_FLAGS_DEFAULT);
+            ImPlot::SetupAxisFormat(ImAxis_Y1, UI::Widgets::formatAxisPercent);
+            ImPlot::SetupAxisLimits(ImAxis_Y1, 0, yMax, ImPlotCond_Always);
+            ImPlot::SetupAxisLimits(ImAxis_X1, axisConfig.xMin, axisConfig.xMax, ImPlotCond_Always);
+
+            for (const auto& entry : series)
+            {
+                const auto& plotted = entry.stall->hasSome ? entry.someHist : entry.fullHist;
+                if (entry.stall->available && !plotted.empty())
+                {
+                    plotLineWithFill(entry.label, timeData.data(), plotted.data(), UI::Format::checkedCount(plotted.size()), entry.color);
+                }
+            }
+
+            if (ImPlot::IsPlotHovered())
+            {
+                const ImPlotPoint mouse = ImPlot::GetPlotMousePos();
+                if (const auto idxVal = hoveredIndexFromPlotX(timeData, mouse.x))
+                {
+                    ImGui::BeginTooltip();
+                    const auto ageText = formatAgeSeconds(static_cast<double>(timeData[*idxVal]));
+                    ImGui::TextUnformatted(ageText.c_str());
+
+                    for (const auto& entry : series)
+                    {
+                        if (!entry.stall->available || *idxVal >= entry.someHist.size() || *idxVal >= entry.fullHist.size())
+                        {
+                            continue;
+                        }
+                        if (entry.stall->hasSome)
+                        {
+                            ImGui::TextColored(entry.color,
+                                               "%s: %s some, %s full",
+                                               entry.label,
+                                               UI::Format::percentCompact(entry.someHist[*idxVal]).c_str(),
+                                               UI::Format::percentCompact(entry.fullHist[*idxVal]).c_str());
+                        }
+                        else
+                        {
+                            ImGui::TextColored(
+                                entry.color, "%s: %s full", entry.label, UI::Format::percentCompact(entry.fullHist[*idxVal]).c_str());
+                        }
+                    }
+                    ImGui::EndTooltip();
+                }
+            }
+
+            ImPlot::EndPlot();
+        }
+    };
+
+    // Now bars show the current interval's stall share
+    std::vector<NowBar> pressureBars;
+    for (const auto& entry : series)
+    {
+        if (!entry.stall->available)
+        {
+            continue;
+        }
+        const double percent = entry.stall->hasSome ? entry.stall->somePercent : entry.stall->fullPercent;
+        pressureBars.push_back({.valueText = UI::Format::percentCompact(percent),
+                                .label = std::string(entry.label) + (entry.stall->hasSome ? " Stall" : " Stall (full)"),
+                                .value01 = UI::Format::percent01(percent),
+                                .color = entry.color});
+    }
+
+    renderHistoryWithNowBars(
+        "PressureHistoryLayout", HISTORY_PLOT_HEIGHT_DEFAULT, pressurePlot, pressureBars, false, static_cast<size_t>(nowBarColumns));
+}
+
+} // namespace App::PressureSection
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Domain/SystemModel.h"
+
+#include <vector>
+
+namespace App::PressureSection
+{
+
+/// Context required to render the pressure section
+struct RenderContext
+{
+    Domain::SystemModel* systemModel = nullptr;
+    double maxHistorySeconds = 60.0;
+    double historyScrollSeconds = 0.0;
+};
+
+/// Render the Pressure Stall Information ("some" stall %) history chart with now bars.
+/// Renders nothing if the system probe does not report PSI.
+/// @param ctx Render context with model and history config
+/// @param timestamps History timestamps from system model
+/// @param nowSeconds Current time in seconds
+/// @param nowBarColumns Number of columns for now bars layout
+void renderPressureSection(const RenderContext& ctx, const std::vector<double>& timestamps, double nowSeconds, int nowBarColumns);
+
+} // namespace App::PressureSection
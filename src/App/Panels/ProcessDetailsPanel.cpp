@@ -2,6 +2,7 @@
 
 #include "App/Panel.h"
 #include "App/UserConfig.h"
+#include "Domain/GPUEngineMask.h"
 #include "Domain/Numeric.h"
 #include "Domain/PriorityConfig.h"
 #include "Domain/ProcessSnapshot.h"
@@ -428,17 +429,19 @@ void ProcessDetailsPanel::renderBasicInfo(const Domain::ProcessSnapshot& proc)
 
     const auto computeLabelColumnWidth = []() -> float
     {
-        constexpr std::array<const char*, 10> labels = {
+        constexpr std::array<const char*, 12> labels = {
             "Name",
             "PID",
             "Parent PID",
             "User",
             "Started",
+            "Cgroup",
             "Status",
             "Threads",
             "Handles",
             "CPU Time",
             "Priority",
+            "CPU Pressure",
         };
 
         float maxTextWidth = 0.0F;
@@ -458,8 +461,8 @@ void ProcessDetailsPanel::renderBasicInfo(const Domain::ProcessSnapshot& proc)
 
     const float rowHeight = ImGui::GetTextLineHeightWithSpacing();
     const float basePadding = ImGui::GetStyle().WindowPadding.y * 2.0F;
-    const float leftHeight = (rowHeight * 5.0F) + basePadding;  // Identity rows
-    const float rightHeight = (rowHeight * 5.0F) + basePadding; // Runtime rows
+    const float leftHeight = (rowHeight * 6.0F) + basePadding;  // Identity rows
+    const float rightHeight = (rowHeight * 6.0F) + basePadding; // Runtime rows
 
     auto rightAlignedText = [](const std::string& text, const ImVec4& color)
     {
@@ -541,6 +544,16 @@ void ProcessDetailsPanel::renderBasicInfo(const Domain::ProcessSnapshot& proc)
     const std::string userText = proc.user.empty() ? "-" : proc.user;
     const std::string startedText =
         (proc.startTimeEpoch > 0) ? UI::Format::formatEpochDateTimeShort(proc.startTimeEpoch) : std::string("-");
+    // Leaf of the cgroup path (e.g. "session-2.scope"); the full path is usually too wide for the column
+    std::string cgroupText = "-";
+    if (!proc.cgroupPath.empty())
+    {
+        cgroupText = proc.cgroupPath.substr(proc.cgroupPath.find_last_of('/') + 1);
+        if (cgroupText.empty())
+        {
+            cgroupText = "/"; // Root cgroup
+        }
+    }
 
     // Identity section: Who is this process?
     ImGui::BeginGroup();
@@ -553,6 +566,7 @@ void ProcessDetailsPanel::renderBasicInfo(const Domain::ProcessSnapshot& proc)
                         {"Parent PID", {std::to_string(proc.parentPid), theme.scheme().textPrimary}},
                         {"User", {userText, theme.scheme().textPrimary}},
                         {"Started", {startedText, theme.scheme().textMuted}},
+                        {"Cgroup", {cgroupText, theme.scheme().textMuted}},
                     });
     ImGui::EndChild();
     ImGui::EndGroup();
@@ -567,6 +581,11 @@ void ProcessDetailsPanel::renderBasicInfo(const Domain::ProcessSnapshot& proc)
     // Format priority with human-readable label and nice value
     const std::string priorityText = std::format("{} (nice: {})", Domain::Priority::getPriorityLabel(proc.nice), proc.nice);
 
+    // CPU pressure of the process's cgroup (shared by everything in that cgroup)
+    const std::string cpuPressureText =
+        proc.cgroupPath.empty() ? std::string("-")
+                                : std::format("{:.1f}% some / {:.1f}% full", proc.cgroupCpuSomePercent, proc.cgroupCpuFullPercent);
+
     renderInfoTable(
         "BasicInfoRightTable",
         {
@@ -575,6 +594,7 @@ void ProcessDetailsPanel::renderBasicInfo(const Domain::ProcessSnapshot& proc)
             {handleLabel, {proc.handleCount > 0 ? formatCountLocale(proc.handleCount) : std::string("-"), theme.scheme().textPrimary}},
             {"CPU Time", {UI::Format::formatCpuTimeCompact(proc.cpuTimeSeconds), theme.scheme().textPrimary}},
             {"Priority", {priorityText, theme.scheme().textPrimary}},
+            {"CPU Pressure", {cpuPressureText, theme.scheme().textPrimary}},
         });
     ImGui::EndChild();
     ImGui::EndGroup();
@@ -1225,21 +1245,13 @@ void ProcessDetailsPanel::renderGpuUsage(const Domain::ProcessSnapshot& proc)
         }
 
         // GPU Engines
-        if (!proc.gpuEngines.empty())
+        if (proc.gpuEngines != 0)
         {
             ImGui::TableNextRow();
             ImGui::TableNextColumn();
             ImGui::Text("Active Engines:");
             ImGui::TableNextColumn();
-            std::string enginesStr;
-            for (size_t i = 0; i < proc.gpuEngines.size(); ++i)
-            {
-                if (i > 0)
-                {
-                    enginesStr += ", ";
-                }
-                enginesStr += proc.gpuEngines[i];
-            }
+            const std::string enginesStr = Domain::GPUEngine::format(proc.gpuEngines);
             ImGui::TextUnformatted(enginesStr.c_str());
         }
 
@@ -1307,21 +1319,13 @@ void ProcessDetailsPanel::renderGpuUsage(const Domain::ProcessSnapshot& proc)
                     const std::string memoryStr = UI::Format::formatBytes(static_cast<double>(gpuUsage.memoryBytes));
                     ImGui::TextColored(gpuMemColor, "%s", memoryStr.c_str());
 
-                    if (!gpuUsage.engines.empty())
+                    if (gpuUsage.engines != 0)
                     {
                         ImGui::TableNextRow();
                         ImGui::TableNextColumn();
                         ImGui::Text("Engines:");
                         ImGui::TableNextColumn();
-                        std::string engStr;
-                        for (size_t i = 0; i < gpuUsage.engines.size(); ++i)
-                        {
-                            if (i > 0)
-                            {
-                                engStr += ", ";
-                            }
-                            engStr += gpuUsage.engines[i];
-                        }
+                        const std::string engStr = Domain::GPUEngine::format(gpuUsage.engines);
                         ImGui::TextUnformatted(engStr.c_str());
                     }
 
@@ -0,0 +1,241 @@
+#pragma once
+
+#include "App/ProcessColumnConfig.h"
+#include "Domain/ProcessSnapshot.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace App
+{
+
+/// One level of a (possibly multi-column) process table sort.
+struct ProcessSortKey
+{
+    ProcessColumn column = ProcessColumn::CpuPercent;
+    bool ascending = false;
+
+    friend bool operator==(const ProcessSortKey&, const ProcessSortKey&) = default;
+};
+
+namespace ProcessSort
+{
+
+/// Snapshot field a column sorts by. Each column's comparator is instantiated with its
+/// member pointer as a constant, so it compiles down to a direct field compare instead
+/// of a switch on the column for every pair.
+template<ProcessColumn Column> inline constexpr auto FIELD = nullptr;
+template<> inline constexpr auto FIELD<ProcessColumn::PID> = &Domain::ProcessSnapshot::pid;
+template<> inline constexpr auto FIELD<ProcessColumn::Name> = &Domain::ProcessSnapshot::name;
+template<> inline constexpr auto FIELD<ProcessColumn::User> = &Domain::ProcessSnapshot::user;
+template<> inline constexpr auto FIELD<ProcessColumn::PPID> = &Domain::ProcessSnapshot::parentPid;
+template<> inline constexpr auto FIELD<ProcessColumn::State> = &Domain::ProcessSnapshot::displayState;
+template<> inline constexpr auto FIELD<ProcessColumn::Status> = &Domain::ProcessSnapshot::status;
+template<> inline constexpr auto FIELD<ProcessColumn::CpuPercent> = &Domain::ProcessSnapshot::cpuPercent;
+template<> inline constexpr auto FIELD<ProcessColumn::MemPercent> = &Domain::ProcessSnapshot::memoryPercent;
+template<> inline constexpr auto FIELD<ProcessColumn::Resident> = &Domain::ProcessSnapshot::memoryBytes;
+template<> inline constexpr auto FIELD<ProcessColumn::Virtual> = &Domain::ProcessSnapshot::virtualBytes;
+template<> inline constexpr auto FIELD<ProcessColumn::Shared> = &Domain::ProcessSnapshot::sharedBytes;
+template<> inline constexpr auto FIELD<ProcessColumn::PeakResident> = &Domain::ProcessSnapshot::peakMemoryBytes;
+template<> inline constexpr auto FIELD<ProcessColumn::Priority> = &Domain::ProcessSnapshot::nice;
+template<> inline constexpr auto FIELD<ProcessColumn::Affinity> = &Domain::ProcessSnapshot::cpuAffinityMask;
+template<> inline constexpr auto FIELD<ProcessColumn::Threads> = &Domain::ProcessSnapshot::threadCount;
+template<> inline constexpr auto FIELD<ProcessColumn::Handles> = &Domain::ProcessSnapshot::handleCount;
+template<> inline constexpr auto FIELD<ProcessColumn::CpuTime> = &Domain::ProcessSnapshot::cpuTimeSeconds;
+template<> inline constexpr auto FIELD<ProcessColumn::StartTime> = &Domain::ProcessSnapshot::startTimeEpoch;
+template<> inline constexpr auto FIELD<ProcessColumn::IoRead> = &Domain::ProcessSnapshot::ioReadBytesPerSec;
+template<> inline constexpr auto FIELD<ProcessColumn::IoWrite> = &Domain::ProcessSnapshot::ioWriteBytesPerSec;
+template<> inline constexpr auto FIELD<ProcessColumn::PageFaults> = &Domain::ProcessSnapshot::pageFaults;
+template<> inline constexpr auto FIELD<ProcessColumn::NetSent> = &Domain::ProcessSnapshot::netSentBytesPerSec;
+template<> inline constexpr auto FIELD<ProcessColumn::NetReceived> = &Domain::ProcessSnapshot::netReceivedBytesPerSec;
+template<> inline constexpr auto FIELD<ProcessColumn::Power> = &Domain::ProcessSnapshot::powerWatts;
+template<> inline constexpr auto FIELD<ProcessColumn::GpuPercent> = &Domain::ProcessSnapshot::gpuUtilPercent;
+template<> inline constexpr auto FIELD<ProcessColumn::GpuMemory> = &Domain::ProcessSnapshot::gpuMemoryBytes;
+template<> inline constexpr auto FIELD<ProcessColumn::GpuDevice> = &Domain::ProcessSnapshot::gpuDevices;
+template<> inline constexpr auto FIELD<ProcessColumn::NumaLocality> = &Domain::ProcessSnapshot::numaLocalityPercent;
+template<> inline constexpr auto FIELD<ProcessColumn::Command> = &Domain::ProcessSnapshot::command;
+
+/// -1, 0 or 1 for @p lhs before, tied with or after @p rhs in ascending order.
+template<typename T> [[nodiscard]] int order(const T& lhs, const T& rhs) noexcept
+{
+    if (lhs < rhs)
+    {
+        return -1;
+    }
+    return (rhs < lhs) ? 1 : 0;
+}
+
+template<ProcessColumn Column> [[nodiscard]] int compareColumn(const Domain::ProcessSnapshot& lhs, const Domain::ProcessSnapshot& rhs)
+{
+    return order(lhs.*FIELD<Column>, rhs.*FIELD<Column>);
+}
+
+/// Sort by number of engines, then by the engine set
+template<>
+[[nodiscard]] inline int compareColumn<ProcessColumn::GpuEngine>(const Domain::ProcessSnapshot& lhs, const Domain::ProcessSnapshot& rhs)
+{
+    if (const int byCount = order(std::popcount(lhs.gpuEngines), std::popcount(rhs.gpuEngines)); byCount != 0)
+    {
+        return byCount;
+    }
+    return order(lhs.gpuEngines, rhs.gpuEngines);
+}
+
+using CompareFn = int (*)(const Domain::ProcessSnapshot&, const Domain::ProcessSnapshot&);
+
+/// Secondary sort level, compared only when every earlier level ties
+struct TieBreaker
+{
+    CompareFn compare = nullptr;
+    bool ascending = false;
+};
+
+/// Sort @p indices by @p Column, then by @p tieBreakers, then by PID so equal rows keep
+/// a stable order from one refresh to the next.
+template<ProcessColumn Column>
+void sortBy(std::span<std::size_t> indices,
+            const std::vector<Domain::ProcessSnapshot>& snapshots,
+            bool ascending,
+            std::span<const TieBreaker> tieBreakers)
+{
+    std::ranges::sort(indices,
+                      [&snapshots, ascending, tieBreakers](std::size_t a, std::size_t b)
+                      {
+                          const auto& procA = snapshots[a];
+                          const auto& procB = snapshots[b];
+                          if (const int primary = compareColumn<Column>(procA, procB); primary != 0)
+                          {
+                              return ascending ? primary < 0 : primary > 0;
+                          }
+                          for (const TieBreaker& level : tieBreakers)
+                          {
+                              if (const int result = level.compare(procA, procB); result != 0)
+                              {
+                                  return level.ascending ? result < 0 : result > 0;
+                              }
+                          }
+                          return procA.pid < procB.pid;
+                      });
+}
+
+using SortFn = void (*)(std::span<std::size_t>, const std::vector<Domain::ProcessSnapshot>&, bool, std::span<const TieBreaker>);
+
+template<std::size_t... I> [[nodiscard]] constexpr auto makeCompareTable(std::index_sequence<I...> /*columns*/)
+{
+    return std::array<CompareFn, sizeof...(I)>{&compareColumn<static_cast<ProcessColumn>(I)>...};
+}
+
+template<std::size_t... I> [[nodiscard]] constexpr auto makeSortTable(std::index_sequence<I...> /*columns*/)
+{
+    return std::array<SortFn, sizeof...(I)>{&sortBy<static_cast<ProcessColumn>(I)>...};
+}
+
+/// Column -> instantiated comparator / sort, so a runtime column picks its specialization by index
+inline constexpr auto COMPARE_TABLE = makeCompareTable(std::make_index_sequence<processColumnCount()>{});
+inline constexpr auto SORT_TABLE = makeSortTable(std::make_index_sequence<processColumnCount()>{});
+
+/// Case-insensitive (ASCII) substring match of @p term in @p name.
+[[nodiscard]] inline bool nameMatches(std::string_view name, std::string_view term) noexcept
+{
+    // Safe/necessary: std::tolower is undefined for negative signed char values (except EOF).
+    auto lower = [](char ch) { return std::tolower(static_cast<unsigned char>(ch)); };
+    return term.empty() || !std::ranges::search(name, term, [&lower](char a, char b) { return lower(a) == lower(b); }).empty();
+}
+
+} // namespace ProcessSort
+
+/// Filtered and sorted row order of the process table, kept across frames.
+///
+/// The table used to filter and sort every snapshot on every frame, although the data
+/// only changes once per refresh. update() rebuilds the order only when the model's
+/// data generation, the filter text or the sort keys differ from the last build, so a
+/// steady-state frame costs a few comparisons. The first key's comparator is
+/// specialized at compile time; further keys (ImGuiTableFlags_SortMulti) break ties.
+class ProcessSortIndex
+{
+  public:
+    /// Rebuild the order if any input changed since the last call.
+    /// An empty @p keys leaves rows in snapshot order (tree view).
+    /// Returns true if the order was rebuilt.
+    bool update(const std::vector<Domain::ProcessSnapshot>& snapshots,
+                std::uint64_t generation,
+                std::string_view filter,
+                std::span<const ProcessSortKey> keys)
+    {
+        if (m_Valid && generation == m_Generation && filter == m_Filter && std::ranges::equal(keys, m_Keys))
+        {
+            return false;
+        }
+
+        m_Generation = generation;
+        m_Filter.assign(filter);
+        m_Keys.assign(keys.begin(), keys.end());
+        m_Valid = true;
+
+        m_Indices.clear();
+        m_Indices.reserve(snapshots.size());
+        m_RunningCount = 0;
+        for (std::size_t i = 0; i < snapshots.size(); ++i)
+        {
+            if (snapshots[i].displayState == "Running")
+            {
+                ++m_RunningCount;
+            }
+            if (ProcessSort::nameMatches(snapshots[i].name, filter))
+            {
+                m_Indices.push_back(i);
+            }
+        }
+
+        if (keys.empty())
+        {
+            return true;
+        }
+
+        m_TieBreakers.clear();
+        for (const ProcessSortKey& key : keys.subspan(1))
+        {
+            m_TieBreakers.push_back({.compare = ProcessSort::COMPARE_TABLE[std::to_underlying(key.column)], .ascending = key.ascending});
+        }
+        ProcessSort::SORT_TABLE[std::to_underlying(keys.front().column)](m_Indices, snapshots, keys.front().ascending, m_TieBreakers);
+        return true;
+    }
+
+    /// Force the next update() to rebuild (e.g. the snapshot vector was replaced).
+    void invalidate() noexcept
+    {
+        m_Valid = false;
+    }
+
+    /// Snapshot indices of the rows to show, in display order.
+    [[nodiscard]] const std::vector<std::size_t>& indices() const noexcept
+    {
+        return m_Indices;
+    }
+
+    /// Processes in the "Running" state (before filtering), counted during the last rebuild.
+    [[nodiscard]] std::size_t runningCount() const noexcept
+    {
+        return m_RunningCount;
+    }
+
+  private:
+    std::vector<std::size_t> m_Indices;
+    std::vector<ProcessSortKey> m_Keys;
+    std::vector<ProcessSort::TieBreaker> m_TieBreakers;
+    std::string m_Filter;
+    std::uint64_t m_Generation = 0;
+    std::size_t m_RunningCount = 0;
+    bool m_Valid = false;
+};
+
+} // namespace App
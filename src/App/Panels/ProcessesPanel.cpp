@@ -3,6 +3,8 @@
 #include "App/Panel.h"
 #include "App/ProcessColumnConfig.h"
 #include "App/UserConfig.h"
+#include "Core/StartupTrace.h"
+#include "Domain/GPUEngineMask.h"
 #include "Domain/PriorityConfig.h"
 #include "Domain/ProcessModel.h"
 #include "Platform/Factory.h"
@@ -15,14 +17,15 @@
 
 #include <algorithm>
 #include <array>
-#include <cctype>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <format>
+#include <future>
 #include <memory>
 #include <optional>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -52,13 +55,6 @@ constexpr std::string_view UNIT_POWER = " WW";           // Power (mW is wider t
 constexpr std::string_view TREE_VIEW_LABEL = "Tree View";
 constexpr std::string_view LIST_VIEW_LABEL = "List View";
 
-[[nodiscard]] auto lowerAscii(char ch) -> int
-{
-    // Safe/necessary: std::tolower is undefined for negative signed char values (except EOF).
-    // Cast to unsigned char to avoid UB when char is signed.
-    return std::tolower(static_cast<unsigned char>(ch));
-}
-
 [[nodiscard]] constexpr auto toImGuiId(ProcessColumn col) noexcept -> ImGuiID
 {
     // Safe: ProcessColumn is a small uint8_t-backed enum; ImGuiID is a wider unsigned type.
@@ -283,16 +279,19 @@ void ProcessesPanel::onAttach()
     const int intervalMs = UserConfig::get().settings().refreshIntervalMs;
     m_RefreshInterval = std::chrono::milliseconds(intervalMs);
     m_RefreshAccumulatorSec = 0.0F;
-    m_ForceRefresh = true;
 
     // Create process model with platform probe; refresh is driven by onUpdate().
     m_ProcessModel = std::make_unique<Domain::ProcessModel>(Platform::makeProcessProbe());
 
-    // Initial population - call refresh twice to seed history
-    // First call sets up m_HasPrevSampleTime, second call populates history
-    m_ProcessModel->refresh();
-    m_ProcessModel->refresh();
-    m_ForceRefresh = false;
+    // The first sample (a full /proc walk) runs in the background so the window shows at once.
+    // CPU usage needs a second sample; rather than taking it back to back, the regular refresh
+    // one interval after the seed lands provides it.
+    m_SeedTask = std::async(std::launch::async,
+                            [model = m_ProcessModel.get()]
+                            {
+                                const Core::StartupTrace::Scope phase("Process seed");
+                                model->refresh();
+                            });
 
     spdlog::info("ProcessesPanel: initialized with main-loop-driven refresh");
 }
@@ -313,6 +312,10 @@ void ProcessesPanel::onDetach()
 {
     // Save column settings to user config
     UserConfig::get().settings().processColumns = m_ColumnSettings;
+    if (m_SeedTask.valid())
+    {
+        m_SeedTask.wait();
+    }
     m_ProcessModel.reset();
 }
 
@@ -323,6 +326,16 @@ void ProcessesPanel::onUpdate(float deltaTime)
         return;
     }
 
+    if (m_SeedTask.valid())
+    {
+        if (m_SeedTask.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return; // One refresh at a time; the interval starts when the seed lands
+        }
+        m_SeedTask.get();
+        m_RefreshAccumulatorSec = 0.0F;
+    }
+
     m_RefreshAccumulatorSec += deltaTime;
 
     using SecondsF = std::chrono::duration<float>;
@@ -345,13 +358,6 @@ void ProcessesPanel::onUpdate(float deltaTime)
         {
             m_RefreshAccumulatorSec = 0.0F;
         }
-
-        // Rebuild tree structure on refresh timer if tree view is enabled
-        if (m_TreeViewEnabled)
-        {
-            auto currentSnapshots = m_ProcessModel->snapshots();
-            m_CachedTree = buildProcessTree(currentSnapshots);
-        }
     }
 }
 
@@ -393,8 +399,22 @@ void ProcessesPanel::renderContent()
     // Ensure text size cache is valid for current font (called once per frame)
     ensureTextSizeCacheValid();
 
-    // Get thread-safe copy of snapshots
-    auto currentSnapshots = m_ProcessModel->snapshots();
+    // Copy the model's snapshots only when they changed; the row order and tree are derived from this copy
+    if (const std::uint64_t generation = m_ProcessModel->generation(); generation != m_SnapshotGeneration)
+    {
+        m_Snapshots = m_ProcessModel->snapshots();
+        m_SnapshotGeneration = generation;
+        if (m_TreeViewEnabled)
+        {
+            m_CachedTree = buildProcessTree(m_Snapshots);
+        }
+    }
+    const auto& currentSnapshots = m_Snapshots;
+    if (currentSnapshots.empty() && m_SeedTask.valid())
+    {
+        ImGui::TextColored(UI::Theme::get().scheme().textMuted, "%s Loading processes...", ICON_FA_LIST);
+        return;
+    }
 
     // Search bar
     const auto& theme = UI::Theme::get();
@@ -445,61 +465,14 @@ void ProcessesPanel::renderContent()
         }
     }
 
-    // Filter snapshots based on search
+    // Filter and sort only when the data, filter or sort keys changed (keys are updated from the table below)
     const std::string_view searchTerm(m_SearchBuffer);
-    std::vector<size_t> filteredIndices;
-    filteredIndices.reserve(currentSnapshots.size());
-
-    for (size_t i = 0; i < currentSnapshots.size(); ++i)
-    {
-        if (searchTerm.empty())
-        {
-            filteredIndices.push_back(i);
-        }
-        else
-        {
-            // Case-insensitive search in process name
-            const auto& name = currentSnapshots[i].name;
-            bool found = false;
-            if (name.size() >= searchTerm.size())
-            {
-                for (size_t j = 0; j <= name.size() - searchTerm.size(); ++j)
-                {
-                    bool match = true;
-                    for (size_t k = 0; k < searchTerm.size(); ++k)
-                    {
-                        if (lowerAscii(name[j + k]) != lowerAscii(searchTerm[k]))
-                        {
-                            match = false;
-                            break;
-                        }
-                    }
-                    if (match)
-                    {
-                        found = true;
-                        break;
-                    }
-                }
-            }
-            if (found)
-            {
-                filteredIndices.push_back(i);
-            }
-        }
-    }
+    m_SortIndex.update(currentSnapshots, m_SnapshotGeneration, searchTerm, activeSortKeys());
+    const std::vector<std::size_t>& filteredIndices = m_SortIndex.indices();
 
     // Process count with state summary (filtered/total)
     ImGui::SameLine();
-
-    // Count processes by state
-    size_t runningCount = 0;
-    for (const auto& proc : currentSnapshots)
-    {
-        if (proc.displayState == "Running")
-        {
-            ++runningCount;
-        }
-    }
+    const std::size_t runningCount = m_SortIndex.runningCount();
 
     std::string summaryStr;
     if (searchTerm.empty())
@@ -625,121 +598,37 @@ void ProcessesPanel::renderContent()
             ++headerIdx;
         }
 
-        // Handle sorting: Disable in tree view mode to maintain parent-child hierarchy
+        // Handle sorting: Disable in tree view mode to maintain parent-child hierarchy.
+        // Sort specs are re-read only when the user changes them; m_SortIndex re-sorts only
+        // when the keys or the data change, not every frame.
         if (!m_TreeViewEnabled)
         {
-            if (ImGuiTableSortSpecs* sortSpecs = ImGui::TableGetSortSpecs())
+            ImGuiTableSortSpecs* sortSpecs = ImGui::TableGetSortSpecs();
+            if (sortSpecs != nullptr && sortSpecs->SpecsDirty)
             {
-                if (sortSpecs->SpecsCount > 0)
+                m_SortKeys.clear();
+                for (int i = 0; i < sortSpecs->SpecsCount; ++i)
                 {
-                    const ImGuiTableColumnSortSpecs& spec = sortSpecs->Specs[0];
-                    const bool ascending = (spec.SortDirection == ImGuiSortDirection_Ascending);
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) - ImGui exposes specs as a C array
+                    const ImGuiTableColumnSortSpecs& spec = sortSpecs->Specs[i];
 
                     // Use ColumnUserID to get ProcessColumn (we set user_id = enum value)
-                    const std::optional<ProcessColumn> sortColOpt = columnFromUserId(spec.ColumnUserID);
-                    if (!sortColOpt.has_value())
+                    if (const std::optional<ProcessColumn> column = columnFromUserId(spec.ColumnUserID))
                     {
-                        sortSpecs->SpecsDirty = true;
-                        ImGui::EndTable();
-                        return;
+                        m_SortKeys.push_back({.column = *column, .ascending = (spec.SortDirection == ImGuiSortDirection_Ascending)});
                     }
-
-                    const ProcessColumn sortCol = *sortColOpt;
-
-                    std::ranges::sort(filteredIndices,
-                                      [&currentSnapshots, sortCol, ascending](size_t a, size_t b)
-                                      {
-                                          const auto& procA = currentSnapshots[a];
-                                          const auto& procB = currentSnapshots[b];
-
-                                          auto compare = [ascending](const auto& lhs, const auto& rhs) -> bool
-                                          {
-                                              return ascending ? (lhs < rhs) : (rhs < lhs);
-                                          };
-
-                                          switch (sortCol)
-                                          {
-                                          case ProcessColumn::PID:
-                                              return compare(procA.pid, procB.pid);
-                                          case ProcessColumn::User:
-                                              return compare(procA.user, procB.user);
-                                          case ProcessColumn::CpuPercent:
-                                              return compare(procA.cpuPercent, procB.cpuPercent);
-                                          case ProcessColumn::MemPercent:
-                                              return compare(procA.memoryPercent, procB.memoryPercent);
-                                          case ProcessColumn::Virtual:
-                                              return compare(procA.virtualBytes, procB.virtualBytes);
-                                          case ProcessColumn::Resident:
-                                              return compare(procA.memoryBytes, procB.memoryBytes);
-                                          case ProcessColumn::PeakResident:
-                                              return compare(procA.peakMemoryBytes, procB.peakMemoryBytes);
-                                          case ProcessColumn::Shared:
-                                              return compare(procA.sharedBytes, procB.sharedBytes);
-                                          case ProcessColumn::CpuTime:
-                                              return compare(procA.cpuTimeSeconds, procB.cpuTimeSeconds);
-                                          case ProcessColumn::StartTime:
-                                              return compare(procA.startTimeEpoch, procB.startTimeEpoch);
-                                          case ProcessColumn::State:
-                                              return compare(procA.displayState, procB.displayState);
-                                          case ProcessColumn::Status:
-                                              return compare(procA.status, procB.status);
-                                          case ProcessColumn::Name:
-                                              return compare(procA.name, procB.name);
-                                          case ProcessColumn::PPID:
-                                              return compare(procA.parentPid, procB.parentPid);
-                                          case ProcessColumn::Priority:
-                                              return compare(procA.nice, procB.nice);
-                                          case ProcessColumn::Threads:
-                                              return compare(procA.threadCount, procB.threadCount);
-                                          case ProcessColumn::Handles:
-                                              return compare(procA.handleCount, procB.handleCount);
-                                          case ProcessColumn::PageFaults:
-                                              return compare(procA.pageFaults, procB.pageFaults);
-                                          case ProcessColumn::Affinity:
-                                              return compare(procA.cpuAffinityMask, procB.cpuAffinityMask);
-                                          case ProcessColumn::Command:
-                                              return compare(procA.command, procB.command);
-                                          case ProcessColumn::IoRead:
-                                              return compare(procA.ioReadBytesPerSec, procB.ioReadBytesPerSec);
-                                          case ProcessColumn::IoWrite:
-                                              return compare(procA.ioWriteBytesPerSec, procB.ioWriteBytesPerSec);
-                                          case ProcessColumn::NetSent:
-                                              return compare(procA.netSentBytesPerSec, procB.netSentBytesPerSec);
-                                          case ProcessColumn::NetReceived:
-                                              return compare(procA.netReceivedBytesPerSec, procB.netReceivedBytesPerSec);
-                                          case ProcessColumn::Power:
-                                              return compare(procA.powerWatts, procB.powerWatts);
-                                          case ProcessColumn::GpuPercent:
-                                              return compare(procA.gpuUtilPercent, procB.gpuUtilPercent);
-                                          case ProcessColumn::GpuMemory:
-                                              return compare(procA.gpuMemoryBytes, procB.gpuMemoryBytes);
-                                          case ProcessColumn::GpuEngine:
-                                          {
-                                              // Sort by number of engines, then by first engine name
-                                              if (procA.gpuEngines.size() != procB.gpuEngines.size())
-                                              {
-                                                  return compare(procA.gpuEngines.size(), procB.gpuEngines.size());
-                                              }
-                                              if (!procA.gpuEngines.empty() && !procB.gpuEngines.empty())
-                                              {
-                                                  return compare(procA.gpuEngines[0], procB.gpuEngines[0]);
-                                              }
-                                              return false;
-                                          }
-                                          case ProcessColumn::GpuDevice:
-                                              return compare(procA.gpuDevices, procB.gpuDevices);
-                                          default:
-                                              return false;
-                                          }
-                                      });
                 }
+                sortSpecs->SpecsDirty = false;
             }
         } // End of sorting (disabled in tree view mode)
 
+        // No-op unless the sort keys or the view mode changed this frame
+        m_SortIndex.update(currentSnapshots, m_SnapshotGeneration, searchTerm, activeSortKeys());
+
         // Render process rows - tree view or flat list
         if (m_TreeViewEnabled)
         {
-            // Render tree view (tree is rebuilt in onUpdate on refresh timer)
+            // Render tree view (tree is rebuilt when the snapshot generation changes)
             renderTreeView(currentSnapshots, filteredIndices, m_CachedTree);
         }
         else
@@ -777,6 +666,17 @@ void ProcessesPanel::renderContent()
             UserConfig::get().settings().processColumns = m_ColumnSettings;
         }
 
+        // numa_maps is too expensive to read for every process: sample only the rows drawn this frame
+        if (m_ProcessModel && m_ProcessModel->capabilities().hasNumaResidency && m_ColumnSettings.isVisible(ProcessColumn::NumaLocality))
+        {
+            if (m_SelectedPid > 0 && std::ranges::find(m_NumaRequestPids, m_SelectedPid) == m_NumaRequestPids.end())
+            {
+                m_NumaRequestPids.push_back(m_SelectedPid);
+            }
+            m_ProcessModel->requestNumaLocality(m_NumaRequestPids);
+        }
+        m_NumaRequestPids.clear();
+
         ImGui::EndTable();
     }
 }
@@ -1187,17 +1087,9 @@ void ProcessesPanel::renderProcessRow(const Domain::ProcessSnapshot& proc, int d
 
         case ProcessColumn::GpuEngine:
         {
-            if (!proc.gpuEngines.empty())
+            if (proc.gpuEngines != 0)
             {
-                std::string enginesStr;
-                for (size_t i = 0; i < proc.gpuEngines.size(); ++i)
-                {
-                    if (i > 0)
-                    {
-                        enginesStr += ", ";
-                    }
-                    enginesStr += proc.gpuEngines[i];
-                }
+                const std::string enginesStr = Domain::GPUEngine::format(proc.gpuEngines);
                 ImGui::TextUnformatted(enginesStr.c_str());
             }
             else
@@ -1220,6 +1112,20 @@ void ProcessesPanel::renderProcessRow(const Domain::ProcessSnapshot& proc, int d
             break;
         }
 
+        case ProcessColumn::NumaLocality:
+        {
+            m_NumaRequestPids.push_back(proc.pid);
+            if (proc.numaNode >= 0)
+            {
+                renderRightAlignedText(std::format("N{} {:.0f}%", proc.numaNode, proc.numaLocalityPercent));
+            }
+            else
+            {
+                renderRightAlignedText("-");
+            }
+            break;
+        }
+
         default:
             break;
         }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "App/Panel.h"
+#include "App/Panels/ProcessSortIndex.h"
 #include "App/ProcessColumnConfig.h"
 #include "Domain/ProcessModel.h"
 #include "Domain/ProcessSnapshot.h"
@@ -9,7 +10,9 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <future>
 #include <memory>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -93,6 +96,7 @@ class ProcessesPanel : public Panel
     std::chrono::milliseconds m_RefreshInterval{1000};
     float m_RefreshAccumulatorSec = 0.0F;
     bool m_ForceRefresh = false;
+    std::future<void> m_SeedTask; // First refresh, run off the main thread at attach
 
     // Column visibility
     ProcessColumnSettings m_ColumnSettings;
@@ -104,7 +108,18 @@ class ProcessesPanel : public Panel
     bool m_TreeViewEnabled = false;
     std::unordered_set<std::uint64_t> m_CollapsedKeys; // uniqueKeys that are collapsed in tree view
 
-    // Cached tree structure (rebuilt on refresh timer in onUpdate)
+    // PIDs of rows drawn with the NUMA column visible; handed to the model after the table
+    std::vector<std::int32_t> m_NumaRequestPids;
+
+    // Copy of the model's snapshots, re-fetched only when ProcessModel::generation() moves
+    std::vector<Domain::ProcessSnapshot> m_Snapshots;
+    std::uint64_t m_SnapshotGeneration = 0;
+
+    // Row order (filter + multi-column sort), rebuilt only when data, filter or sort keys change
+    ProcessSortIndex m_SortIndex;
+    std::vector<ProcessSortKey> m_SortKeys{{.column = ProcessColumn::CpuPercent, .ascending = false}};
+
+    // Cached tree structure (rebuilt with the snapshot copy when the generation changes)
     std::unordered_map<std::uint64_t, std::vector<std::size_t>> m_CachedTree;
 
     /// Cache for text size measurements to avoid repeated ImGui::CalcTextSize calls.
@@ -150,6 +165,12 @@ class ProcessesPanel : public Panel
     /// Get the number of visible columns
     [[nodiscard]] int visibleColumnCount() const;
 
+    /// Sort keys in effect: none in tree view, which keeps the hierarchy in snapshot order.
+    [[nodiscard]] std::span<const ProcessSortKey> activeSortKeys() const
+    {
+        return m_TreeViewEnabled ? std::span<const ProcessSortKey>{} : std::span<const ProcessSortKey>{m_SortKeys};
+    }
+
     /// Build parent-child process tree structure
     /// @param snapshots The full list of process snapshots.
     /// @return Map of parent uniqueKey to vector of child indices
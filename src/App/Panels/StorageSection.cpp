@@ -10,7 +10,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <format>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -36,6 +39,227 @@ using UI::Widgets::Y_AXIS_FLAGS_DEFAULT;
 
 constexpr size_t STORAGE_NOW_BAR_COLUMNS = 2; // Read, Write
 
+/// Extended per-device statistics, laid out like `iostat -x`.
+void renderDeviceTable(const Domain::StorageSnapshot& snap, const Domain::StorageModel& model)
+{
+    const auto& theme = UI::Theme::get();
+    if (snap.disks.empty())
+    {
+        return;
+    }
+
+    ImGui::Separator();
+    ImGui::Spacing();
+    ImGui::TextColored(theme.scheme().textPrimary, ICON_FA_LIST "  Device Statistics");
+    ImGui::Spacing();
+
+    constexpr ImGuiTableFlags tableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+    constexpr int COLUMN_COUNT = 10;
+    constexpr float SPARKLINE_HEIGHT = 16.0F;
+
+    if (ImGui::BeginTable("##DiskDeviceTable", COLUMN_COUNT, tableFlags))
+    {
+        ImGui::TableSetupColumn("Device", ImGuiTableColumnFlags_None, 1.5F);
+        ImGui::TableSetupColumn("r/s", ImGuiTableColumnFlags_None, 1.0F);
+        ImGui::TableSetupColumn("w/s", ImGuiTableColumnFlags_None, 1.0F);
+        ImGui::TableSetupColumn("r_await", ImGuiTableColumnFlags_None, 1.0F);
+        ImGui::TableSetupColumn("w_await", ImGuiTableColumnFlags_None, 1.0F);
+        ImGui::TableSetupColumn("rareq-sz", ImGuiTableColumnFlags_None, 1.0F);
+        ImGui::TableSetupColumn("wareq-sz", ImGuiTableColumnFlags_None, 1.0F);
+        ImGui::TableSetupColumn("aqu-sz", ImGuiTableColumnFlags_None, 0.8F);
+        ImGui::TableSetupColumn("%util", ImGuiTableColumnFlags_None, 0.8F);
+        ImGui::TableSetupColumn("%util history", ImGuiTableColumnFlags_None, 2.0F);
+        ImGui::TableHeadersRow();
+
+        const auto history = model.historyView();
+
+        for (const auto& disk : snap.disks)
+        {
+            ImGui::TableNextRow();
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(disk.deviceName.c_str());
+            if (ImGui::IsItemHovered() && (disk.hasDiscardStats || disk.hasFlushStats))
+            {
+                ImGui::BeginTooltip();
+                const auto inFlightText = std::format("In flight: {}", disk.ioInFlight);
+                ImGui::TextUnformatted(inFlightText.c_str());
+                if (disk.hasDiscardStats)
+                {
+                    ImGui::Text("Discard: %.1f/s, %s, %.2f ms",
+                                disk.discardOpsPerSec,
+                                UI::Format::formatBytesPerSec(disk.discardBytesPerSec).c_str(),
+                                disk.avgDiscardTimeMs);
+                }
+                if (disk.hasFlushStats)
+                {
+                    ImGui::Text("Flush: %.1f/s, %.2f ms", disk.flushOpsPerSec, disk.avgFlushTimeMs);
+                }
+                ImGui::EndTooltip();
+            }
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", disk.readOpsPerSec);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f", disk.writeOpsPerSec);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f ms", disk.avgReadTimeMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f ms", disk.avgWriteTimeMs);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(UI::Format::formatBytes(disk.avgReadRequestBytes).c_str());
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(UI::Format::formatBytes(disk.avgWriteRequestBytes).c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", disk.avgQueueSize);
+            ImGui::TableNextColumn();
+            const auto utilText = std::format("{:.1f}%", disk.utilizationPercent);
+            ImGui::TextUnformatted(utilText.c_str());
+
+            ImGui::TableNextColumn();
+            const auto utilHist = history.series(disk.deviceId, Domain::DiskMetric::UtilizationPercent);
+            if (!utilHist.empty())
+            {
+                ImGui::PushID(static_cast<int>(disk.deviceId));
+                ImGui::PlotLines("##util",
+                                 utilHist.data(),
+                                 UI::Format::checkedCount(utilHist.size()),
+                                 0,
+                                 nullptr,
+                                 0.0F,
+                                 100.0F,
+                                 ImVec2(-1.0F, SPARKLINE_HEIGHT));
+                ImGui::PopID();
+            }
+        }
+
+        ImGui::EndTable();
+    }
+}
+
+/// Filesystem capacity per mount, with the backing disk's utilization and a time-to-full projection.
+void renderMountTable(const Domain::StorageSnapshot& snap)
+{
+    const auto& theme = UI::Theme::get();
+    if (!snap.hasMountStats || snap.mounts.empty())
+    {
+        return;
+    }
+
+    ImGui::Separator();
+    ImGui::Spacing();
+    ImGui::TextColored(theme.scheme().textPrimary, ICON_FA_FOLDER "  Filesystems");
+    ImGui::Spacing();
+
+    constexpr ImGuiTableFlags tableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+    constexpr int COLUMN_COUNT = 9;
+    constexpr double WARN_PERCENT = 85.0;
+    constexpr double CRITICAL_PERCENT = 95.0;
+
+    auto percentColor = [&theme](double percent)
+    {
+        if (percent >= CRITICAL_PERCENT)
+        {
+            return theme.scheme().textError;
+        }
+        return percent >= WARN_PERCENT ? theme.scheme().textWarning : theme.scheme().textPrimary;
+    };
+
+    if (ImGui::BeginTable("##MountTable", COLUMN_COUNT, tableFlags))
+    {
+        ImGui::TableSetupColumn("Mount", ImGuiTableColumnFlags_None, 2.0F);
+        ImGui::TableSetupColumn("Type", ImGuiTableColumnFlags_None, 0.8F);
+        ImGui::TableSetupColumn("Device", ImGuiTableColumnFlags_None, 1.0F);
+        ImGui::TableSetupColumn("Size", ImGuiTableColumnFlags_None, 1.0F);
+        ImGui::TableSetupColumn("Avail", ImGuiTableColumnFlags_None, 1.0F);
+        ImGui::TableSetupColumn("Use%", ImGuiTableColumnFlags_None, 0.8F);
+        ImGui::TableSetupColumn("Inodes", ImGuiTableColumnFlags_None, 0.8F);
+        ImGui::TableSetupColumn("Fill rate", ImGuiTableColumnFlags_None, 1.2F);
+        ImGui::TableSetupColumn("Full in", ImGuiTableColumnFlags_None, 1.0F);
+        ImGui::TableHeadersRow();
+
+        for (const auto& mount : snap.mounts)
+        {
+            ImGui::TableNextRow();
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(mount.mountPoint.c_str());
+
+            ImGui::TableNextColumn();
+            ImGui::TextColored(theme.scheme().textMuted, "%s", mount.fsType.c_str());
+
+            // Device, with the I/O load of the disk behind it so capacity and activity read together
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(mount.deviceName.empty() ? "-" : mount.deviceName.c_str());
+            const auto disk = std::ranges::find(snap.disks, mount.diskName, &Domain::DiskSnapshot::deviceName);
+            if (disk != snap.disks.end() && ImGui::IsItemHovered())
+            {
+                ImGui::BeginTooltip();
+                ImGui::Text("Disk %s: %.1f%% busy", disk->deviceName.c_str(), disk->utilizationPercent);
+                const auto ioText = std::format("Read {}  Write {}",
+                                                UI::Format::formatBytesPerSec(disk->readBytesPerSec),
+                                                UI::Format::formatBytesPerSec(disk->writeBytesPerSec));
+                ImGui::TextUnformatted(ioText.c_str());
+                ImGui::EndTooltip();
+            }
+
+            if (!mount.hasCapacity)
+            {
+                for (int column = 3; column < COLUMN_COUNT; ++column)
+                {
+                    ImGui::TableNextColumn();
+                    ImGui::TextColored(theme.scheme().textMuted, "-");
+                }
+                continue;
+            }
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(UI::Format::formatBytes(static_cast<double>(mount.totalBytes)).c_str());
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(UI::Format::formatBytes(static_cast<double>(mount.availBytes)).c_str());
+
+            ImGui::TableNextColumn();
+            ImGui::TextColored(percentColor(mount.usedPercent), "%.1f%%", mount.usedPercent);
+
+            ImGui::TableNextColumn();
+            if (mount.totalInodes > 0)
+            {
+                ImGui::TextColored(percentColor(mount.inodeUsedPercent), "%.1f%%", mount.inodeUsedPercent);
+            }
+            else
+            {
+                ImGui::TextColored(theme.scheme().textMuted, "-");
+            }
+
+            ImGui::TableNextColumn();
+            if (mount.readOnly)
+            {
+                ImGui::TextColored(theme.scheme().textMuted, "read-only");
+            }
+            else
+            {
+                const char* sign = mount.fillBytesPerSec < 0.0 ? "-" : "";
+                const auto rateText = sign + UI::Format::formatBytesPerSec(std::abs(mount.fillBytesPerSec));
+                ImGui::TextUnformatted(rateText.c_str());
+            }
+
+            ImGui::TableNextColumn();
+            if (mount.secondsToFull >= 0.0)
+            {
+                const auto fullText = UI::Format::formatDurationShort(mount.secondsToFull);
+                const bool imminent = mount.secondsToFull < 3600.0;
+                ImGui::TextColored(imminent ? theme.scheme().textError : theme.scheme().textPrimary, "%s", fullText.c_str());
+            }
+            else
+            {
+                ImGui::TextColored(theme.scheme().textMuted, "-");
+            }
+        }
+
+        ImGui::EndTable();
+    }
+}
+
 } // namespace
 
 void updateSmoothedDiskIO(double targetRead, double targetWrite, float deltaTimeSeconds, RenderContext& ctx)
@@ -70,29 +294,36 @@ void renderStorageSection(RenderContext& ctx)
         return;
     }
 
-    const auto& diskSnap = ctx.storageModel->latestSnapshot();
-    const auto diskTimestamps = ctx.storageModel->historyTimestamps();
-    const auto diskReadHist = ctx.storageModel->totalReadHistory();
-    const auto diskWriteHist = ctx.storageModel->totalWriteHistory();
-    const size_t alignedDisk = std::min({diskTimestamps.size(), diskReadHist.size(), diskWriteHist.size()});
-
-    const auto diskAxis = alignedDisk > 0 ? makeTimeAxisConfig(diskTimestamps, ctx.maxHistorySeconds, ctx.historyScrollSeconds)
-                                          : makeTimeAxisConfig({}, ctx.maxHistorySeconds, ctx.historyScrollSeconds);
+    const auto diskSnap = ctx.storageModel->latestSnapshot();
 
     std::vector<float> diskTimes;
     std::vector<float> readData;
     std::vector<float> writeData;
-
-    if (alignedDisk > 0)
+    UI::Widgets::TimeAxisConfig diskAxis;
+    size_t alignedDisk = 0;
     {
-        diskTimes = buildTimeAxis(diskTimestamps, alignedDisk, nowSeconds);
-        readData.reserve(alignedDisk);
-        writeData.reserve(alignedDisk);
-        // Copy from double to float
-        for (size_t i = diskReadHist.size() - alignedDisk; i < diskReadHist.size(); ++i)
+        // Scoped: the view holds the model's read lock
+        const auto history = ctx.storageModel->historyView();
+        const auto diskTimestamps = history.timestamps();
+        const auto diskReadHist = history.totalReadBytesPerSec();
+        const auto diskWriteHist = history.totalWriteBytesPerSec();
+        alignedDisk = std::min({diskTimestamps.size(), diskReadHist.size(), diskWriteHist.size()});
+
+        diskAxis = makeTimeAxisConfig(alignedDisk > 0 ? diskTimestamps : std::span<const double>{},
+                                      ctx.maxHistorySeconds,
+                                      ctx.historyScrollSeconds);
+
+        if (alignedDisk > 0)
         {
-            readData.push_back(static_cast<float>(diskReadHist[i]));
-            writeData.push_back(static_cast<float>(diskWriteHist[i]));
+            diskTimes = buildTimeAxis(diskTimestamps, alignedDisk, nowSeconds);
+            readData.reserve(alignedDisk);
+            writeData.reserve(alignedDisk);
+            // Copy from double to float
+            for (size_t i = diskReadHist.size() - alignedDisk; i < diskReadHist.size(); ++i)
+            {
+                readData.push_back(static_cast<float>(diskReadHist[i]));
+                writeData.push_back(static_cast<float>(diskWriteHist[i]));
+            }
         }
     }
 
@@ -161,6 +392,12 @@ void renderStorageSection(RenderContext& ctx)
     ImGui::TextColored(theme.scheme().textPrimary, ICON_FA_HARD_DRIVE "  Disk I/O History (%zu samples)", alignedDisk);
     renderHistoryWithNowBars(
         "SystemDiskHistoryLayout", HISTORY_PLOT_HEIGHT_DEFAULT, diskPlot, {readBar, writeBar}, false, STORAGE_NOW_BAR_COLUMNS);
+    ImGui::Spacing();
+
+    renderDeviceTable(diskSnap, *ctx.storageModel);
+    ImGui::Spacing();
+
+    renderMountTable(diskSnap);
 }
 
 } // namespace App::StorageSection
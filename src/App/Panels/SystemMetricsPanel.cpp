@@ -1,11 +1,15 @@
 #include "SystemMetricsPanel.h"
 
 #include "App/Panel.h"
+#include "App/Panels/ActivitySection.h"
 #include "App/Panels/CpuCoresSection.h"
 #include "App/Panels/GpuSection.h"
 #include "App/Panels/MemorySection.h"
 #include "App/Panels/NetworkSection.h"
+#include "App/Panels/NumaSection.h"
+#include "App/Panels/PressureSection.h"
 #include "App/UserConfig.h"
+#include "Core/StartupTrace.h"
 #include "Domain/GPUModel.h"
 #include "Domain/Numeric.h"
 #include "Domain/StorageModel.h"
@@ -28,6 +32,7 @@
 #include <cstdint>
 #include <format>
 #include <functional>
+#include <future>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -146,35 +151,33 @@ void SystemMetricsPanel::onAttach()
     m_StorageModel = std::make_unique<Domain::StorageModel>(Platform::makeDiskProbe());
     m_StorageModel->setMaxHistorySeconds(m_MaxHistorySeconds);
 
-    m_GPUModel = std::make_unique<Domain::GPUModel>(Platform::makeGPUProbe());
+    // GPU backends (vendor dlopen, sysfs walks) are discovered on the model's worker once
+    // frames are running; the GPU tab appears when discovery finds a GPU
+    m_GPUModel = Domain::GPUModel::withDeferredDiscovery(&Platform::makeGPUProbe);
+    m_GPUModel->setMaxHistorySeconds(m_MaxHistorySeconds);
 
-    // Initial refresh to seed histories
-    m_Model->refresh();
-    m_StorageModel->sample();
-    if (m_GPUModel)
-    {
-        m_GPUModel->refresh();
-    }
-
-    m_TimestampsCache = m_Model->timestamps();
-    if (!m_TimestampsCache.empty())
-    {
-        m_CurrentNowSeconds = m_TimestampsCache.back();
-    }
-    else
-    {
-        m_CurrentNowSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
-    }
+    // Seed the histories in the background so the first frame does not wait on /proc and
+    // /sys; charts show empty until the seed lands and the next sample follows one interval later
+    m_CurrentNowSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
     m_ForceRefresh = false;
-
-    const auto initialSnap = m_Model->snapshot();
-    // NOTE: m_Hostname intentionally stores the raw hostname without any icon prefix.
-    // UI code (e.g., tab labels) is responsible for adding icons when rendering.
-    m_Hostname = initialSnap.hostname.empty() ? "System" : initialSnap.hostname;
+    m_SeedTask = std::async(std::launch::async,
+                            [model = m_Model.get(), storage = m_StorageModel.get()]
+                            {
+                                {
+                                    const Core::StartupTrace::Scope phase("System seed");
+                                    model->refresh();
+                                }
+                                const Core::StartupTrace::Scope phase("Storage seed");
+                                storage->sample();
+                            });
 }
 
 void SystemMetricsPanel::onDetach()
 {
+    if (m_SeedTask.valid())
+    {
+        m_SeedTask.wait();
+    }
     m_GPUModel.reset();
     m_StorageModel.reset();
     m_Model.reset();
@@ -201,6 +204,43 @@ void SystemMetricsPanel::onUpdate(float deltaTime)
         return;
     }
 
+    if (m_GPUModel && !m_GPUReadyTraced)
+    {
+        if (m_GPUModel->isReady())
+        {
+            Core::StartupTrace::get().mark("GPU backends");
+            m_GPUReadyTraced = true;
+        }
+        else
+        {
+            m_GPUModel->refreshAsync(); // Starts discovery; no-op while it runs
+        }
+    }
+
+    if (m_SeedTask.valid())
+    {
+        if (m_SeedTask.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return; // Models are being seeded on the background task
+        }
+        m_SeedTask.get();
+        m_RefreshAccumulatorSec = 0.0F;
+
+        m_TimestampsCache = m_Model->timestamps();
+        if (!m_TimestampsCache.empty())
+        {
+            m_CurrentNowSeconds = m_TimestampsCache.back();
+        }
+
+        const auto initialSnap = m_Model->snapshot();
+        // NOTE: m_Hostname intentionally stores the raw hostname without any icon prefix.
+        // UI code (e.g., tab labels) is responsible for adding icons when rendering.
+        m_Hostname = initialSnap.hostname.empty() ? "System" : initialSnap.hostname;
+    }
+
+    // AC plug/unplug shows up on this frame rather than on the next refresh tick
+    (void) m_Model->pollPowerChange();
+
     m_RefreshAccumulatorSec += deltaTime;
     using SecondsF = std::chrono::duration<float>;
     const float intervalSec = std::chrono::duration_cast<SecondsF>(m_RefreshInterval).count();
@@ -219,7 +259,14 @@ void SystemMetricsPanel::onUpdate(float deltaTime)
 
         if (m_GPUModel)
         {
-            m_GPUModel->refresh();
+            m_GPUModel->setMaxHistorySeconds(m_MaxHistorySeconds);
+            // GPU probes run on the model's worker so a hung driver cannot stall the frame;
+            // per-process counters below are from the last refresh that completed
+            m_GPUModel->refreshAsync();
+            if (m_ProcessModel != nullptr)
+            {
+                m_ProcessModel->updateGPUUsage(m_GPUModel->processCounters(), m_GPUModel->gpuInfo());
+            }
         }
 
         m_TimestampsCache = m_Model->timestamps();
@@ -370,6 +417,7 @@ void SystemMetricsPanel::renderContent()
                     .smoothedNetRecvBytesPerSec = &m_SmoothedNetwork.recvBytesPerSec,
                     .smoothedNetInitialized = &m_SmoothedNetwork.initialized,
                     .selectedNetworkInterface = &m_SelectedNetworkInterface,
+                    .groupNetworkInterfaces = &m_GroupNetworkInterfaces,
                 };
                 NetworkSection::renderNetworkSection(netCtx);
                 ImGui::EndTabItem();
@@ -618,6 +666,42 @@ void SystemMetricsPanel::renderOverview()
         ImGui::Spacing();
     }
 
+    // Pressure stall history section (Linux PSI; skipped when unavailable)
+    if (m_Model->capabilities().hasPressure)
+    {
+        const PressureSection::RenderContext pressureCtx{
+            .systemModel = m_Model.get(),
+            .maxHistorySeconds = m_MaxHistorySeconds,
+            .historyScrollSeconds = m_HistoryScrollSeconds,
+        };
+        PressureSection::renderPressureSection(pressureCtx, timestamps, nowSeconds, static_cast<int>(OVERVIEW_NOW_BAR_COLUMNS));
+        ImGui::Spacing();
+    }
+
+    // Kernel activity section (context switches, forks, faults, swapping)
+    if (m_Model->capabilities().hasActivity)
+    {
+        const ActivitySection::RenderContext activityCtx{
+            .systemModel = m_Model.get(),
+            .maxHistorySeconds = m_MaxHistorySeconds,
+            .historyScrollSeconds = m_HistoryScrollSeconds,
+        };
+        ActivitySection::renderActivitySection(activityCtx, timestamps, nowSeconds, static_cast<int>(OVERVIEW_NOW_BAR_COLUMNS));
+        ImGui::Spacing();
+    }
+
+    // Per-NUMA-node CPU/memory section (multi-node hosts only)
+    if (m_Model->capabilities().hasNuma && snap.numaNodes.size() > 1)
+    {
+        const NumaSection::RenderContext numaCtx{
+            .systemModel = m_Model.get(),
+            .maxHistorySeconds = m_MaxHistorySeconds,
+            .historyScrollSeconds = m_HistoryScrollSeconds,
+        };
+        NumaSection::renderNumaSection(numaCtx, timestamps, nowSeconds, static_cast<int>(OVERVIEW_NOW_BAR_COLUMNS));
+        ImGui::Spacing();
+    }
+
     // Power & Battery history chart (combines per-process power aggregation with battery charge %)
     if (m_ProcessModel != nullptr || snap.power.hasBattery)
     {
@@ -12,6 +12,7 @@
 #include <implot.h>
 
 #include <chrono>
+#include <future>
 #include <memory>
 #include <unordered_map>
 
@@ -75,6 +76,8 @@ class SystemMetricsPanel : public Panel
     std::unique_ptr<Domain::SystemModel> m_Model;
     std::unique_ptr<Domain::StorageModel> m_StorageModel;
     std::unique_ptr<Domain::GPUModel> m_GPUModel;
+    bool m_GPUReadyTraced = false; // Startup trace has the GPU discovery mark
+    std::future<void> m_SeedTask;  // First system and storage samples, taken off the main thread
     Domain::ProcessModel* m_ProcessModel = nullptr; // non-owning
 
     double m_MaxHistorySeconds = 300.0;
@@ -138,6 +141,8 @@ class SystemMetricsPanel : public Panel
 
     // Selected network interface (-1 means "Total" / all interfaces combined)
     int m_SelectedNetworkInterface = -1;
+    // Network selector lists interface groups (veth, bridge, ...) instead of individual interfaces
+    bool m_GroupNetworkInterfaces = false;
 
     // GPU smoothed values (uses type from GpuSection)
     std::unordered_map<std::string, GpuSection::SmoothedGPU> m_SmoothedGPUs;
@@ -11,7 +11,7 @@ namespace App
 
 /// All available columns for the process table.
 /// Order here defines the default column order.
-/// Grouped by category: Identity, State, Resources, Scheduling, Time, I/O, Network, Power, GPU, Command
+/// Grouped by category: Identity, State, Resources, Scheduling, Time, I/O, Network, Power, GPU, NUMA, Command
 enum class ProcessColumn : std::uint8_t
 {
     // Identity - who is this process?
@@ -51,6 +51,8 @@ enum class ProcessColumn : std::uint8_t
     GpuMemory,
     GpuEngine,
     GpuDevice,
+    // NUMA
+    NumaLocality,
     // Command line (typically last, stretches to fill)
     Command,
     Count
@@ -58,7 +60,7 @@ enum class ProcessColumn : std::uint8_t
 
 [[nodiscard]] constexpr auto allProcessColumns() -> std::array<ProcessColumn, static_cast<std::size_t>(ProcessColumn::Count)>
 {
-    // Order matches enum definition: Identity, State, Resources, Scheduling, Time, I/O, Network, Power, GPU, Command
+    // Order matches enum definition: Identity, State, Resources, Scheduling, Time, I/O, Network, Power, GPU, NUMA, Command
     return {// Identity
             ProcessColumn::PID,
             ProcessColumn::Name,
@@ -96,6 +98,8 @@ enum class ProcessColumn : std::uint8_t
             ProcessColumn::GpuMemory,
             ProcessColumn::GpuEngine,
             ProcessColumn::GpuDevice,
+            // NUMA
+            ProcessColumn::NumaLocality,
             // Command (last)
             ProcessColumn::Command};
 }
@@ -204,6 +208,10 @@ constexpr auto getColumnInfo(ProcessColumn col) -> ProcessColumnInfo
         // GPU Device
         {.name="GPU Dev", .menuName="GPU Device", .configKey="gpu_device", .defaultWidth=60.0F, .defaultVisible=false, .canHide=true, .description="Which GPU(s) the process is using"},
 
+        // === NUMA ===
+        // NUMA Locality
+        {.name="NUMA", .menuName="NUMA Locality", .configKey="numa_locality", .defaultWidth=80.0F, .defaultVisible=false, .canHide=true, .description="Node holding most of the process's memory and its share of resident pages (sampled for visible rows)"},
+
         // === Command (last, stretches) ===
         // Command
         {.name="Command", .menuName="Command Line", .configKey="command", .defaultWidth=0.0F, .defaultVisible=true, .canHide=true, .description="Full command line (0 = stretch)"},
@@ -1,5 +1,6 @@
 #include "Application.h"
 
+#include "Core/StartupTrace.h"
 #include "Core/Window.h"
 
 #include <spdlog/spdlog.h>
@@ -113,6 +114,7 @@ void Application::run()
         }
 
         m_Window->swapBuffers();
+        StartupTrace::get().markFirstFrame();
     }
 
     spdlog::info("Exiting main loop");
@@ -0,0 +1,219 @@
+#include "StartupTrace.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Core
+{
+
+StartupTrace& StartupTrace::get()
+{
+    static StartupTrace instance;
+    return instance;
+}
+
+void StartupTrace::begin()
+{
+    // NOLINTNEXTLINE(concurrency-mt-unsafe) - called once at startup before any threads are created
+    const char* traceFile = std::getenv(TRACE_FILE_ENV);
+
+    const std::scoped_lock lock(m_Mutex);
+    m_Start = std::chrono::steady_clock::now();
+    m_Phases.clear();
+    m_Threads.assign(1, std::this_thread::get_id());
+    m_LastMark.assign(1, m_Start);
+    m_TraceFile = (traceFile != nullptr) ? std::filesystem::path(traceFile) : std::filesystem::path();
+    m_FirstFrameDone = false;
+
+    if (!m_TraceFile.empty())
+    {
+        spdlog::info("Startup: profiling mode, timeline goes to {}", m_TraceFile.string());
+    }
+}
+
+void StartupTrace::setTraceFile(std::filesystem::path path)
+{
+    const std::scoped_lock lock(m_Mutex);
+    m_TraceFile = std::move(path);
+}
+
+void StartupTrace::mark(std::string_view phase)
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point start;
+    {
+        const std::scoped_lock lock(m_Mutex);
+        const std::size_t thread = threadIndex(std::this_thread::get_id());
+        start = std::exchange(m_LastMark[thread], now);
+    }
+    record(std::string(phase), start, now);
+}
+
+void StartupTrace::record(std::string name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    Phase phase;
+    bool profiling = false;
+    {
+        const std::scoped_lock lock(m_Mutex);
+        const std::size_t thread = threadIndex(std::this_thread::get_id());
+        m_LastMark[thread] = std::max(m_LastMark[thread], end);
+
+        const double startMs = toMs(start);
+        m_Phases.push_back(Phase{.name = std::move(name), .startMs = startMs, .durationMs = toMs(end) - startMs, .thread = thread});
+        if (!m_FirstFrameDone)
+        {
+            return; // Logged with the whole timeline by markFirstFrame()
+        }
+        phase = m_Phases.back();
+        profiling = !m_TraceFile.empty();
+    }
+
+    // Deferred phases arrive on worker threads too: only profiling mode logs them at info and
+    // rewrites the file, and neither happens under m_Mutex
+    spdlog::log(profiling ? spdlog::level::info : spdlog::level::debug,
+                "Startup: {} done after {:.1f} ms (took {:.1f} ms, deferred)",
+                phase.name,
+                phase.startMs + phase.durationMs,
+                phase.durationMs);
+    if (profiling)
+    {
+        writeTraceFile();
+    }
+}
+
+void StartupTrace::markFirstFrame()
+{
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<Phase> timeline;
+    double firstFrameMs = 0.0;
+    bool profiling = false;
+    {
+        const std::scoped_lock lock(m_Mutex);
+        if (m_FirstFrameDone)
+        {
+            return;
+        }
+        m_FirstFrameDone = true;
+
+        // The frame itself: from the last main-thread phase to the swap
+        const std::size_t thread = threadIndex(std::this_thread::get_id());
+        const double startMs = toMs(m_LastMark[thread]);
+        m_Phases.push_back({.name = "First frame", .startMs = startMs, .durationMs = toMs(now) - startMs, .thread = thread});
+        m_LastMark[thread] = now;
+
+        timeline = m_Phases;
+        firstFrameMs = toMs(now);
+        profiling = !m_TraceFile.empty();
+    }
+
+    spdlog::info("Startup: first frame after {:.1f} ms", firstFrameMs);
+    for (const auto& phase : timeline)
+    {
+        logPhase(phase, profiling);
+    }
+    if (profiling)
+    {
+        writeTraceFile();
+    }
+}
+
+bool StartupTrace::firstFrameDone() const
+{
+    const std::scoped_lock lock(m_Mutex);
+    return m_FirstFrameDone;
+}
+
+std::vector<StartupTrace::Phase> StartupTrace::phases() const
+{
+    const std::scoped_lock lock(m_Mutex);
+    return m_Phases;
+}
+
+double StartupTrace::toMs(std::chrono::steady_clock::time_point time) const
+{
+    return std::chrono::duration<double, std::milli>(time - m_Start).count();
+}
+
+std::size_t StartupTrace::threadIndex(std::thread::id id)
+{
+    const auto it = std::ranges::find(m_Threads, id);
+    if (it != m_Threads.end())
+    {
+        return static_cast<std::size_t>(std::distance(m_Threads.begin(), it));
+    }
+    m_Threads.push_back(id);
+    // A thread's first mark() covers nothing before it: start from now
+    m_LastMark.push_back(std::chrono::steady_clock::now());
+    return m_Threads.size() - 1;
+}
+
+void StartupTrace::logPhase(const Phase& phase, bool profiling)
+{
+    const auto level = profiling ? spdlog::level::info : spdlog::level::debug;
+    spdlog::log(level,
+                "Startup: {:>8.1f} ms {:>8.1f} ms  [thread {}] {}",
+                phase.startMs,
+                phase.durationMs,
+                phase.thread,
+                phase.name);
+}
+
+void StartupTrace::writeTraceFile() const
+{
+    // Writers take turns, and each copies the timeline only once it holds the file, so an
+    // older timeline never lands after a newer one; m_Mutex is held just for the copy
+    const std::scoped_lock fileLock(m_FileMutex);
+    std::filesystem::path path;
+    std::vector<Phase> timeline;
+    {
+        const std::scoped_lock lock(m_Mutex);
+        path = m_TraceFile;
+        timeline = m_Phases;
+    }
+    if (path.empty())
+    {
+        return;
+    }
+
+    std::ofstream out(path, std::ios::trunc);
+    if (!out)
+    {
+        spdlog::warn("Startup: cannot write timeline to {}", path.string());
+        return;
+    }
+
+    // Chrome trace-event format: complete events ("X") in microseconds
+    out << "{\"traceEvents\":[";
+    for (std::size_t i = 0; i < timeline.size(); ++i)
+    {
+        const auto& phase = timeline[i];
+        std::string name;
+        name.reserve(phase.name.size());
+        for (const char ch : phase.name)
+        {
+            if (ch == '"' || ch == '\\')
+            {
+                name.push_back('\\');
+            }
+            name.push_back(ch);
+        }
+        out << (i == 0 ? "" : ",") << "\n{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << phase.thread
+            << ",\"ts\":" << phase.startMs * 1000.0 << ",\"dur\":" << phase.durationMs * 1000.0 << '}';
+    }
+    out << "\n]}\n";
+}
+
+} // namespace Core
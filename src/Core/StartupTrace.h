@@ -0,0 +1,106 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Core
+{
+
+/// Timeline of the startup path, from runApp() to the first presented frame.
+///
+/// Phases are spans on the thread that ran them. mark() closes a phase that began where the
+/// calling thread's previous phase ended (so consecutive marks on the main thread tile the
+/// critical path); Scope times a block, typically background work started during attach.
+/// markFirstFrame() logs the timeline once; phases finished after it (deferred work such as
+/// model seeding and GPU discovery) are logged as they complete. Thread-safe.
+///
+/// Profiling mode: with TASKSMACK_STARTUP_TRACE=<file> every phase is logged at info level
+/// and the timeline is written to <file> in Chrome trace-event format (chrome://tracing,
+/// Perfetto), rewritten as deferred phases arrive. Outside profiling mode phases are only
+/// logged at debug level and nothing is written.
+class StartupTrace
+{
+  public:
+    static constexpr const char* TRACE_FILE_ENV = "TASKSMACK_STARTUP_TRACE";
+
+    struct Phase
+    {
+        std::string name;
+        double startMs = 0.0;
+        double durationMs = 0.0;
+        std::size_t thread = 0; // 0 = the thread that called begin(); others numbered as they appear
+    };
+
+    /// Times the enclosing block as one phase.
+    class Scope
+    {
+      public:
+        explicit Scope(std::string name) : m_Name(std::move(name)), m_Start(std::chrono::steady_clock::now())
+        {
+        }
+        ~Scope()
+        {
+            StartupTrace::get().record(std::move(m_Name), m_Start, std::chrono::steady_clock::now());
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(Scope&&) = delete;
+
+      private:
+        std::string m_Name;
+        std::chrono::steady_clock::time_point m_Start;
+    };
+
+    [[nodiscard]] static StartupTrace& get();
+
+    /// Restart the clock and drop recorded phases (called first thing in runApp()).
+    /// Reads TASKSMACK_STARTUP_TRACE to enable profiling mode.
+    void begin();
+
+    /// Enable profiling mode explicitly; an empty path disables it.
+    void setTraceFile(std::filesystem::path path);
+
+    /// Record that @p phase has finished on this thread.
+    void mark(std::string_view phase);
+
+    /// Record the first presented frame and log the timeline; later calls do nothing.
+    void markFirstFrame();
+
+    [[nodiscard]] bool firstFrameDone() const;
+    [[nodiscard]] std::vector<Phase> phases() const;
+
+  private:
+    StartupTrace() = default;
+
+    void record(std::string name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+
+    // Caller holds m_Mutex
+    [[nodiscard]] double toMs(std::chrono::steady_clock::time_point time) const;
+    [[nodiscard]] std::size_t threadIndex(std::thread::id id);
+
+    static void logPhase(const Phase& phase, bool profiling);
+
+    /// Rewrite the trace file with the current timeline (profiling mode only).
+    /// Caller must not hold m_Mutex.
+    void writeTraceFile() const;
+
+    mutable std::mutex m_Mutex;
+    mutable std::mutex m_FileMutex; // Serializes trace file writes; taken before m_Mutex, never after
+    std::chrono::steady_clock::time_point m_Start = std::chrono::steady_clock::now();
+    std::vector<Phase> m_Phases;
+    std::vector<std::thread::id> m_Threads;                          // Index = Phase::thread
+    std::vector<std::chrono::steady_clock::time_point> m_LastMark; // Per thread, for mark()
+    std::filesystem::path m_TraceFile;
+    bool m_FirstFrameDone = false;
+};
+
+} // namespace Core
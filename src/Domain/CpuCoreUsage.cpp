@@ -0,0 +1,258 @@
+#include "CpuCoreUsage.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace Domain::CpuCoreUsage
+{
+
+namespace
+{
+
+[[nodiscard]] constexpr std::uint64_t saturatingDelta(std::uint64_t current, std::uint64_t previous) noexcept
+{
+    return current > previous ? current - previous : 0;
+}
+
+[[nodiscard]] constexpr double clampPercent(double value) noexcept
+{
+    return std::clamp(value, 0.0, 100.0);
+}
+
+void zeroCore(UsageArrays& out, std::size_t i) noexcept
+{
+    out.totalPercent[i] = 0.0;
+    out.userPercent[i] = 0.0;
+    out.systemPercent[i] = 0.0;
+    out.idlePercent[i] = 0.0;
+    out.iowaitPercent[i] = 0.0;
+    out.stealPercent[i] = 0.0;
+}
+
+/// Scalar reference for one core; used for the fallback path and the vector tail.
+void computeCore(const CounterArrays& cur, const CounterArrays& prev, UsageArrays& out, std::size_t i) noexcept
+{
+    // Deltas are only meaningful if the core reported counters in both samples.
+    if (i >= prev.size() || cur.online[i] == 0 || prev.online[i] == 0)
+    {
+        zeroCore(out, i);
+        return;
+    }
+
+    const std::uint64_t dUser = saturatingDelta(cur.user[i], prev.user[i]);
+    const std::uint64_t dNice = saturatingDelta(cur.nice[i], prev.nice[i]);
+    const std::uint64_t dSystem = saturatingDelta(cur.system[i], prev.system[i]);
+    const std::uint64_t dIdle = saturatingDelta(cur.idle[i], prev.idle[i]);
+    const std::uint64_t dIowait = saturatingDelta(cur.iowait[i], prev.iowait[i]);
+    const std::uint64_t dIrq = saturatingDelta(cur.irq[i], prev.irq[i]);
+    const std::uint64_t dSoftirq = saturatingDelta(cur.softirq[i], prev.softirq[i]);
+    const std::uint64_t dSteal = saturatingDelta(cur.steal[i], prev.steal[i]);
+    const std::uint64_t dGuest = saturatingDelta(cur.guest[i], prev.guest[i]);
+    const std::uint64_t dGuestNice = saturatingDelta(cur.guestNice[i], prev.guestNice[i]);
+
+    const std::uint64_t total = dUser + dNice + dSystem + dIdle + dIowait + dIrq + dSoftirq + dSteal + dGuest + dGuestNice;
+    if (total == 0)
+    {
+        zeroCore(out, i);
+        return;
+    }
+
+    const double scale = 100.0 / static_cast<double>(total);
+    const double idle = static_cast<double>(dIdle) * scale;
+
+    out.totalPercent[i] = clampPercent(100.0 - idle);
+    out.userPercent[i] = clampPercent(static_cast<double>(dUser + dNice) * scale);
+    out.systemPercent[i] = clampPercent(static_cast<double>(dSystem) * scale);
+    out.idlePercent[i] = clampPercent(idle);
+    out.iowaitPercent[i] = clampPercent(static_cast<double>(dIowait) * scale);
+    out.stealPercent[i] = clampPercent(static_cast<double>(dSteal) * scale);
+}
+
+#if defined(__AVX2__)
+
+constexpr std::size_t LANES = 4; // 4 x uint64_t / double per 256-bit register
+
+[[nodiscard]] inline __m256i loadDelta(const std::vector<std::uint64_t>& cur, const std::vector<std::uint64_t>& prev, std::size_t i) noexcept
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast) - unaligned SIMD loads
+    const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cur.data() + i));
+    const __m256i p = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prev.data() + i));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    // Tick counters stay far below 2^63, so a signed compare detects counters that went backwards.
+    const __m256i delta = _mm256_sub_epi64(c, p);
+    const __m256i negative = _mm256_cmpgt_epi64(_mm256_setzero_si256(), delta);
+    return _mm256_andnot_si256(negative, delta);
+}
+
+/// uint64 -> double for values below 2^52 (AVX2 has no native conversion).
+/// Per-interval tick deltas are many orders of magnitude below that bound.
+[[nodiscard]] inline __m256d toDouble(__m256i value) noexcept
+{
+    const __m256d magic = _mm256_set1_pd(4503599627370496.0); // 2^52
+    return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(value, _mm256_castpd_si256(magic))), magic);
+}
+
+/// All-ones lanes for cores online in both samples.
+[[nodiscard]] inline __m256d loadOnlineMask(const CounterArrays& cur, const CounterArrays& prev, std::size_t i) noexcept
+{
+    std::uint32_t curOnline = 0;
+    std::uint32_t prevOnline = 0;
+    std::memcpy(&curOnline, cur.online.data() + i, sizeof(curOnline));
+    std::memcpy(&prevOnline, prev.online.data() + i, sizeof(prevOnline));
+
+    const __m256i bothOnline = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(static_cast<int>(curOnline & prevOnline)));
+    const __m256i offline = _mm256_cmpeq_epi64(bothOnline, _mm256_setzero_si256());
+    return _mm256_castsi256_pd(_mm256_xor_si256(offline, _mm256_set1_epi64x(-1)));
+}
+
+[[nodiscard]] inline __m256d clampPercent(__m256d value) noexcept
+{
+    return _mm256_min_pd(_mm256_max_pd(value, _mm256_setzero_pd()), _mm256_set1_pd(100.0));
+}
+
+void computeVector(const CounterArrays& cur, const CounterArrays& prev, UsageArrays& out, std::size_t count) noexcept
+{
+    const __m256d hundred = _mm256_set1_pd(100.0);
+    const __m256d zero = _mm256_setzero_pd();
+    const std::size_t vectorCount = std::min(count, prev.size());
+
+    std::size_t i = 0;
+    for (; i + LANES <= vectorCount; i += LANES)
+    {
+        const __m256i dUser = loadDelta(cur.user, prev.user, i);
+        const __m256i dNice = loadDelta(cur.nice, prev.nice, i);
+        const __m256i dSystem = loadDelta(cur.system, prev.system, i);
+        const __m256i dIdle = loadDelta(cur.idle, prev.idle, i);
+        const __m256i dIowait = loadDelta(cur.iowait, prev.iowait, i);
+        const __m256i dSteal = loadDelta(cur.steal, prev.steal, i);
+
+        const __m256i dUserNice = _mm256_add_epi64(dUser, dNice);
+        __m256i total = _mm256_add_epi64(dUserNice, dSystem);
+        total = _mm256_add_epi64(total, dIdle);
+        total = _mm256_add_epi64(total, dIowait);
+        total = _mm256_add_epi64(total, loadDelta(cur.irq, prev.irq, i));
+        total = _mm256_add_epi64(total, loadDelta(cur.softirq, prev.softirq, i));
+        total = _mm256_add_epi64(total, dSteal);
+        total = _mm256_add_epi64(total, loadDelta(cur.guest, prev.guest, i));
+        total = _mm256_add_epi64(total, loadDelta(cur.guestNice, prev.guestNice, i));
+
+        // Lanes with no elapsed ticks or an offline core get scale 0 (the inf from
+        // 100/0 is masked out).
+        const __m256d totalD = toDouble(total);
+        const __m256d hasTicks = _mm256_and_pd(_mm256_cmp_pd(totalD, zero, _CMP_GT_OQ), loadOnlineMask(cur, prev, i));
+        const __m256d scale = _mm256_and_pd(hasTicks, _mm256_div_pd(hundred, totalD));
+
+        const __m256d idle = _mm256_mul_pd(toDouble(dIdle), scale);
+        const __m256d busy = _mm256_and_pd(hasTicks, clampPercent(_mm256_sub_pd(hundred, idle)));
+
+        _mm256_storeu_pd(out.totalPercent.data() + i, busy);
+        _mm256_storeu_pd(out.userPercent.data() + i, clampPercent(_mm256_mul_pd(toDouble(dUserNice), scale)));
+        _mm256_storeu_pd(out.systemPercent.data() + i, clampPercent(_mm256_mul_pd(toDouble(dSystem), scale)));
+        _mm256_storeu_pd(out.idlePercent.data() + i, clampPercent(idle));
+        _mm256_storeu_pd(out.iowaitPercent.data() + i, clampPercent(_mm256_mul_pd(toDouble(dIowait), scale)));
+        _mm256_storeu_pd(out.stealPercent.data() + i, clampPercent(_mm256_mul_pd(toDouble(dSteal), scale)));
+    }
+
+    for (; i < count; ++i)
+    {
+        computeCore(cur, prev, out, i);
+    }
+}
+
+#endif
+
+} // namespace
+
+void CounterArrays::assign(const std::vector<Platform::CpuCounters>& cores, const std::vector<std::uint32_t>& ids)
+{
+    const bool haveIds = (ids.size() == cores.size());
+
+    std::size_t slotCount = size();
+    for (std::size_t i = 0; i < cores.size(); ++i)
+    {
+        const std::size_t id = haveIds ? ids[i] : i;
+        slotCount = std::max(slotCount, id + 1);
+    }
+
+    for (auto* field : {&user, &nice, &system, &idle, &iowait, &irq, &softirq, &steal, &guest, &guestNice})
+    {
+        field->resize(slotCount);
+    }
+    online.assign(slotCount, 0);
+
+    for (std::size_t i = 0; i < cores.size(); ++i)
+    {
+        const auto& core = cores[i];
+        const std::size_t slot = haveIds ? ids[i] : i;
+        online[slot] = 1;
+        user[slot] = core.user;
+        nice[slot] = core.nice;
+        system[slot] = core.system;
+        idle[slot] = core.idle;
+        iowait[slot] = core.iowait;
+        irq[slot] = core.irq;
+        softirq[slot] = core.softirq;
+        steal[slot] = core.steal;
+        guest[slot] = core.guest;
+        guestNice[slot] = core.guestNice;
+    }
+}
+
+void UsageArrays::resize(std::size_t count)
+{
+    for (auto* field : {&totalPercent, &userPercent, &systemPercent, &idlePercent, &iowaitPercent, &stealPercent})
+    {
+        field->resize(count);
+    }
+    online.resize(count);
+}
+
+bool isVectorized() noexcept
+{
+#if defined(__AVX2__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void compute(const CounterArrays& current, const CounterArrays& previous, UsageArrays& out)
+{
+    const std::size_t count = current.size();
+    out.resize(count);
+    std::copy(current.online.begin(), current.online.end(), out.online.begin());
+
+#if defined(__AVX2__)
+    computeVector(current, previous, out, count);
+#else
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        computeCore(current, previous, out, i);
+    }
+#endif
+}
+
+void toCpuUsage(const UsageArrays& usage, std::vector<CpuUsage>& out)
+{
+    const std::size_t count = usage.size();
+    out.resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = CpuUsage{.totalPercent = usage.totalPercent[i],
+                          .userPercent = usage.userPercent[i],
+                          .systemPercent = usage.systemPercent[i],
+                          .idlePercent = usage.idlePercent[i],
+                          .iowaitPercent = usage.iowaitPercent[i],
+                          .stealPercent = usage.stealPercent[i]};
+    }
+}
+
+} // namespace Domain::CpuCoreUsage
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Platform/SystemTypes.h"
+#include "SystemSnapshot.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Domain::CpuCoreUsage
+{
+
+/// Per-core CPU counters in structure-of-arrays layout.
+///
+/// Each field holds one cumulative tick counter per core, so the delta/percent pass
+/// can stream through contiguous uint64_t arrays and process several cores per
+/// instruction instead of walking CpuCounters structs one at a time.
+///
+/// Slots are indexed by logical CPU id, not by position in the probe output, so a
+/// core going offline (vCPU unplug, SMT toggle) leaves every other core in place.
+/// Offline slots keep their storage and are flagged in `online`.
+struct CounterArrays
+{
+    std::vector<std::uint64_t> user;
+    std::vector<std::uint64_t> nice;
+    std::vector<std::uint64_t> system;
+    std::vector<std::uint64_t> idle;
+    std::vector<std::uint64_t> iowait;
+    std::vector<std::uint64_t> irq;
+    std::vector<std::uint64_t> softirq;
+    std::vector<std::uint64_t> steal;
+    std::vector<std::uint64_t> guest;
+    std::vector<std::uint64_t> guestNice;
+    std::vector<std::uint8_t> online; // 1 if the CPU reported counters this sample
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return user.size();
+    }
+
+    /// Transpose probe counters into the slots named by @p ids (parallel to @p cores;
+    /// empty means ids are positions). Slots only ever grow: slots without an entry in
+    /// this sample are marked offline but keep their storage.
+    void assign(const std::vector<Platform::CpuCounters>& cores, const std::vector<std::uint32_t>& ids);
+};
+
+/// Per-core percentages in structure-of-arrays layout (output of compute()).
+struct UsageArrays
+{
+    std::vector<double> totalPercent;
+    std::vector<double> userPercent;
+    std::vector<double> systemPercent;
+    std::vector<double> idlePercent;
+    std::vector<double> iowaitPercent;
+    std::vector<double> stealPercent;
+    std::vector<std::uint8_t> online; // Copied from the current sample's CounterArrays
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return totalPercent.size();
+    }
+
+    void resize(std::size_t count);
+};
+
+/// True when compute() uses the AVX2 kernel (builds with -march=x86-64-v3, e.g. the
+/// `optimized` preset). Otherwise a scalar loop is used.
+[[nodiscard]] bool isVectorized() noexcept;
+
+/// Compute per-core usage for every slot of @p current in one pass.
+///
+/// Semantics match SystemModel's aggregate CPU calculation: user% includes nice,
+/// total% = 100 - idle%, all values clamped to [0, 100], and a core with no elapsed
+/// ticks reports all zeros. Individual counters that move backwards (per-CPU iowait
+/// is known to do this) contribute zero rather than wrapping. A slot that is not
+/// online in both samples (offline, or just came online) also reports all zeros.
+void compute(const CounterArrays& current, const CounterArrays& previous, UsageArrays& out);
+
+/// Convenience: write compute() results into CpuUsage structs for the snapshot.
+void toCpuUsage(const UsageArrays& usage, std::vector<CpuUsage>& out);
+
+} // namespace Domain::CpuCoreUsage
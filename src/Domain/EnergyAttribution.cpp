@@ -0,0 +1,150 @@
+#include "EnergyAttribution.h"
+
+#include "Numeric.h"
+#include "Platform/ProcessTypes.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Domain
+{
+
+namespace
+{
+
+constexpr double MICROJOULES_PER_JOULE = 1'000'000.0;
+
+[[nodiscard]] bool sameLayout(const std::vector<Platform::EnergyZoneCounters>& lhs, const std::vector<Platform::EnergyZoneCounters>& rhs)
+{
+    return std::ranges::equal(lhs,
+                              rhs,
+                              [](const Platform::EnergyZoneCounters& a, const Platform::EnergyZoneCounters& b)
+                              { return a.package == b.package && a.domain == b.domain; });
+}
+
+} // namespace
+
+std::uint64_t EnergyAttribution::counterDelta(std::uint64_t previous, std::uint64_t current, std::uint64_t maxRange) noexcept
+{
+    if (current >= previous)
+    {
+        return current - previous;
+    }
+    if (maxRange > previous)
+    {
+        return (maxRange - previous) + current; // Wrapped to 0 past max_energy_range_uj
+    }
+    return 0; // Counter reset or unknown range: skip the interval rather than invent energy
+}
+
+std::size_t EnergyAttribution::slotOf(std::int32_t packageId)
+{
+    const auto it = std::ranges::lower_bound(m_Packages, packageId, {}, &Package::id);
+    if (it != m_Packages.end() && it->id == packageId)
+    {
+        return static_cast<std::size_t>(it - m_Packages.begin());
+    }
+    const auto inserted = m_Packages.insert(it, Package{.id = packageId});
+    return static_cast<std::size_t>(inserted - m_Packages.begin());
+}
+
+void EnergyAttribution::beginInterval(const Platform::EnergyCounters& counters, double elapsedSeconds)
+{
+    m_Packages.clear();
+    for (const auto& zone : counters.zones)
+    {
+        (void) slotOf(zone.package);
+    }
+
+    m_CpuSlot.assign(counters.cpuPackage.size(), NO_PACKAGE);
+    for (std::size_t cpu = 0; cpu < counters.cpuPackage.size(); ++cpu)
+    {
+        const auto it = std::ranges::find(m_Packages, counters.cpuPackage[cpu], &Package::id);
+        if (it != m_Packages.end())
+        {
+            m_CpuSlot[cpu] = static_cast<std::size_t>(it - m_Packages.begin());
+        }
+    }
+
+    m_HasInterval = !counters.zones.empty() && elapsedSeconds > 0.0 && sameLayout(m_PrevZones, counters.zones);
+    if (m_HasInterval)
+    {
+        for (std::size_t index = 0; index < counters.zones.size(); ++index)
+        {
+            const auto& current = counters.zones[index];
+            const auto& previous = m_PrevZones[index];
+            const std::size_t slot = slotOf(current.package);
+            m_Packages[slot].energyMicrojoules[static_cast<std::size_t>(current.domain)] +=
+                counterDelta(previous.energyMicrojoules, current.energyMicrojoules, current.maxEnergyRangeMicrojoules);
+        }
+    }
+
+    m_PrevZones = counters.zones;
+    m_ElapsedSeconds = elapsedSeconds;
+}
+
+std::size_t EnergyAttribution::packageOf(std::int32_t cpu) const noexcept
+{
+    if (m_Packages.size() == 1)
+    {
+        return 0; // Every CPU is on the only package, known or not
+    }
+    if (cpu < 0 || static_cast<std::size_t>(cpu) >= m_CpuSlot.size())
+    {
+        return NO_PACKAGE;
+    }
+    return m_CpuSlot[static_cast<std::size_t>(cpu)];
+}
+
+void EnergyAttribution::addCpuTime(std::size_t package, std::uint64_t cpuTicks) noexcept
+{
+    if (package < m_Packages.size())
+    {
+        m_Packages[package].cpuTicks += cpuTicks;
+    }
+}
+
+double EnergyAttribution::watts(std::size_t package, std::uint64_t cpuTicks) const noexcept
+{
+    if (!m_HasInterval || package >= m_Packages.size() || cpuTicks == 0)
+    {
+        return 0.0;
+    }
+    const Package& entry = m_Packages[package];
+    if (entry.cpuTicks == 0)
+    {
+        return 0.0;
+    }
+
+    const std::uint64_t energy = entry.energyMicrojoules[static_cast<std::size_t>(Platform::EnergyDomain::Package)] +
+                                 entry.energyMicrojoules[static_cast<std::size_t>(Platform::EnergyDomain::Dram)];
+    const double share = Numeric::toDouble(cpuTicks) / Numeric::toDouble(entry.cpuTicks);
+    return (Numeric::toDouble(energy) * share) / MICROJOULES_PER_JOULE / m_ElapsedSeconds;
+}
+
+std::vector<PackagePower> EnergyAttribution::packagePower() const
+{
+    std::vector<PackagePower> result;
+    if (!m_HasInterval)
+    {
+        return result;
+    }
+
+    auto toWatts = [this](const Package& entry, Platform::EnergyDomain domain)
+    { return Numeric::toDouble(entry.energyMicrojoules[static_cast<std::size_t>(domain)]) / MICROJOULES_PER_JOULE / m_ElapsedSeconds; };
+
+    result.reserve(m_Packages.size());
+    for (const auto& entry : m_Packages)
+    {
+        result.push_back({.package = entry.id,
+                          .packageWatts = toWatts(entry, Platform::EnergyDomain::Package),
+                          .coreWatts = toWatts(entry, Platform::EnergyDomain::Core),
+                          .uncoreWatts = toWatts(entry, Platform::EnergyDomain::Uncore),
+                          .dramWatts = toWatts(entry, Platform::EnergyDomain::Dram)});
+    }
+    return result;
+}
+
+} // namespace Domain
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Platform/ProcessTypes.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Domain
+{
+
+/// Power of one CPU package over the last interval, by energy domain.
+/// coreWatts and uncoreWatts are parts of packageWatts; dramWatts is not.
+struct PackagePower
+{
+    std::int32_t package = 0;
+    double packageWatts = 0.0;
+    double coreWatts = 0.0;
+    double uncoreWatts = 0.0;
+    double dramWatts = 0.0;
+};
+
+/// Splits CPU package energy between processes by the CPU time they used on each package.
+///
+/// Per interval: beginInterval() turns the cumulative counters into per-package energy
+/// deltas (handling RAPL wraparound at max_energy_range_uj), addCpuTime() adds each
+/// process's CPU ticks for the interval to the package of the CPU it last ran on, and
+/// watts() gives a process its share of that package's package + DRAM energy. Energy of a
+/// package on which no process ran stays unattributed.
+///
+/// Not thread-safe; ProcessModel guards it with its own mutex.
+class EnergyAttribution
+{
+  public:
+    static constexpr std::size_t NO_PACKAGE = static_cast<std::size_t>(-1);
+
+    /// Start an interval of @p elapsedSeconds ending at @p counters. The first call, and any
+    /// call after the zone layout changed, only records the baseline.
+    void beginInterval(const Platform::EnergyCounters& counters, double elapsedSeconds);
+
+    /// Whether the current interval has energy to attribute.
+    [[nodiscard]] bool hasInterval() const noexcept
+    {
+        return m_HasInterval;
+    }
+
+    /// Package slot of logical CPU @p cpu, for addCpuTime() and watts(). CPUs with no known
+    /// package map to NO_PACKAGE, except on single-package hosts.
+    [[nodiscard]] std::size_t packageOf(std::int32_t cpu) const noexcept;
+
+    /// Add @p cpuTicks of CPU time used in this interval on package slot @p package.
+    void addCpuTime(std::size_t package, std::uint64_t cpuTicks) noexcept;
+
+    /// Power of a process that used @p cpuTicks on package slot @p package this interval.
+    /// Valid once every process's addCpuTime() is in.
+    [[nodiscard]] double watts(std::size_t package, std::uint64_t cpuTicks) const noexcept;
+
+    /// Interval power of each package, in package order.
+    [[nodiscard]] std::vector<PackagePower> packagePower() const;
+
+    /// Energy counter delta from @p previous to @p current, across one wrap at @p maxRange.
+    [[nodiscard]] static std::uint64_t counterDelta(std::uint64_t previous, std::uint64_t current, std::uint64_t maxRange) noexcept;
+
+  private:
+    static constexpr std::size_t DOMAIN_COUNT = 4; // Indexed by Platform::EnergyDomain
+
+    struct Package
+    {
+        std::int32_t id = 0;
+        std::array<std::uint64_t, DOMAIN_COUNT> energyMicrojoules{}; // Interval deltas
+        std::uint64_t cpuTicks = 0;                                   // Interval CPU time of all processes
+    };
+
+    [[nodiscard]] std::size_t slotOf(std::int32_t packageId);
+
+    std::vector<Package> m_Packages; // Sorted by id
+    std::vector<std::size_t> m_CpuSlot; // Package slot per logical CPU
+    std::vector<Platform::EnergyZoneCounters> m_PrevZones;
+    double m_ElapsedSeconds = 0.0;
+    bool m_HasInterval = false;
+};
+
+} // namespace Domain
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Domain
+{
+
+/// Set of GPU engine classes, one bit per class (ProcessSnapshot::gpuEngines).
+/// Replaces the engine name strings of Platform::ProcessGPUCounters::activeEngines so a
+/// process row stays free of per-row heap allocations.
+using GPUEngineMask = std::uint8_t;
+
+namespace GPUEngine
+{
+
+inline constexpr GPUEngineMask Render = 1U << 0;
+inline constexpr GPUEngineMask Compute = 1U << 1;
+inline constexpr GPUEngineMask Copy = 1U << 2;
+inline constexpr GPUEngineMask VideoDecode = 1U << 3;
+inline constexpr GPUEngineMask VideoEncode = 1U << 4;
+inline constexpr GPUEngineMask VideoEnhance = 1U << 5;
+inline constexpr GPUEngineMask Other = 1U << 6;
+
+/// Engine names as reported by the probes, indexed by bit position.
+inline constexpr std::array<std::string_view, 7> NAMES = {
+    "3D", "Compute", "Copy", "Video Decode", "Video Encode", "Video Enhance", "Other"};
+
+/// Bit for a probe engine name; unknown names map to Other.
+[[nodiscard]] constexpr GPUEngineMask fromName(std::string_view name) noexcept
+{
+    for (std::size_t bit = 0; bit < NAMES.size(); ++bit)
+    {
+        if (NAMES[bit] == name)
+        {
+            return static_cast<GPUEngineMask>(1U << bit);
+        }
+    }
+    return Other;
+}
+
+/// "3D, Video Decode" for display; empty for no engines.
+[[nodiscard]] inline std::string format(GPUEngineMask mask)
+{
+    std::string result;
+    for (std::size_t bit = 0; bit < NAMES.size(); ++bit)
+    {
+        if ((mask & (1U << bit)) == 0)
+        {
+            continue;
+        }
+        if (!result.empty())
+        {
+            result += ", ";
+        }
+        result += NAMES[bit];
+    }
+    return result;
+}
+
+} // namespace GPUEngine
+
+} // namespace Domain
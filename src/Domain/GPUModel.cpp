@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -17,7 +18,11 @@
 // NOLINTNEXTLINE(misc-include-cleaner) - std::ranges::find_if is in <ranges>, libc++ provides fallback in <algorithm>
 #include <ranges>
 #include <shared_mutex>
+#include <span>
+#include <stop_token>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -25,36 +30,68 @@
 namespace Domain
 {
 
-GPUModel::GPUModel(std::unique_ptr<Platform::IGPUProbe> probe)
-    : m_Probe(std::move(probe)), m_PrevSampleTime(std::chrono::steady_clock::now())
+GPUModel::GPUModel(std::unique_ptr<Platform::IGPUProbe> probe) : m_PrevSampleTime(std::chrono::steady_clock::now())
 {
-    if (!m_Probe)
+    attachProbe(std::move(probe));
+}
+
+GPUModel::GPUModel(DeferredTag /*tag*/, ProbeFactory probeFactory)
+    : m_ProbeFactory(std::move(probeFactory)), m_PrevSampleTime(std::chrono::steady_clock::now())
+{
+}
+
+std::unique_ptr<GPUModel> GPUModel::withDeferredDiscovery(ProbeFactory probeFactory)
+{
+    return std::unique_ptr<GPUModel>(new GPUModel(DeferredTag{}, std::move(probeFactory)));
+}
+
+void GPUModel::attachProbe(std::unique_ptr<Platform::IGPUProbe> probe)
+{
+    if (!probe)
     {
         spdlog::warn("GPUModel: No GPU probe provided");
+        m_Ready.store(true, std::memory_order_release);
         return;
     }
 
-    // Enumerate GPUs once at construction
+    // Enumerate GPUs once, outside the lock: vendor backends may take a while
+    std::vector<Platform::GPUInfo> gpus;
+    Platform::GPUCapabilities capabilities;
     try
     {
-        m_GPUInfo = m_Probe->enumerateGPUs();
-        spdlog::info("GPUModel: Detected {} GPU(s)", m_GPUInfo.size());
-
-        // Initialize history buffers for each GPU
-        for (const auto& info : m_GPUInfo)
-        {
-            m_Histories.emplace(info.id, History<GPUSnapshot, GPU_HISTORY_CAPACITY>{});
-        }
+        gpus = probe->enumerateGPUs();
+        capabilities = probe->capabilities();
+        spdlog::info("GPUModel: Detected {} GPU(s)", gpus.size());
     }
     catch (const std::exception& e)
     {
         spdlog::error("GPUModel: Failed to enumerate GPUs: {}", e.what());
     }
+
+    {
+        const std::unique_lock lock(m_Mutex);
+        m_Probe = std::move(probe);
+        m_GPUInfo = std::move(gpus);
+        m_Capabilities = capabilities;
+        m_HasPerProcessMetrics = capabilities.hasPerProcessMetrics;
+
+        // Create history columns for each GPU
+        for (const auto& info : m_GPUInfo)
+        {
+            m_Histories.try_emplace(info.id);
+        }
+    }
+    m_Ready.store(true, std::memory_order_release);
+}
+
+bool GPUModel::isReady() const noexcept
+{
+    return m_Ready.load(std::memory_order_acquire);
 }
 
 void GPUModel::refresh()
 {
-    if (!m_Probe)
+    if (!isReady() || !m_Probe)
     {
         return;
     }
@@ -63,6 +100,11 @@ void GPUModel::refresh()
     {
         // Read current counters
         auto currentCounters = m_Probe->readGPUCounters();
+        std::vector<Platform::ProcessGPUCounters> processCounters;
+        if (m_HasPerProcessMetrics)
+        {
+            processCounters = m_Probe->readProcessGPUCounters();
+        }
         auto currentTime = std::chrono::steady_clock::now();
 
         // Calculate time delta
@@ -90,28 +132,21 @@ void GPUModel::refresh()
         {
             const std::unique_lock lock(m_Mutex);
             m_Snapshots = std::move(newSnapshots);
+            m_ProcessCounters = std::move(processCounters);
 
-            // Record timestamp for this sample
+            // Record this sample: one row for every GPU with history, new GPUs get columns now
             const double nowSec = std::chrono::duration<double>(currentTime.time_since_epoch()).count();
-            m_HistoryTimestamps.push_back(nowSec);
-
-            // Trim timestamps to match history capacity
-            if (m_HistoryTimestamps.size() > GPU_HISTORY_CAPACITY)
+            m_Timestamps.push(nowSec);
+            for (const auto& [gpuId, snapshot] : m_Snapshots)
             {
-                m_HistoryTimestamps.erase(m_HistoryTimestamps.begin(),
-                                          m_HistoryTimestamps.begin() +
-                                              static_cast<std::ptrdiff_t>(m_HistoryTimestamps.size() - GPU_HISTORY_CAPACITY));
+                m_Histories.try_emplace(gpuId);
             }
-
-            // Push to history under lock protection
-            for (const auto& [gpuId, snapshot] : m_Snapshots)
+            for (auto& [gpuId, columns] : m_Histories)
             {
-                auto histIt = m_Histories.find(gpuId);
-                if (histIt != m_Histories.end())
-                {
-                    histIt->second.push(snapshot);
-                }
+                const auto snapIt = m_Snapshots.find(gpuId);
+                appendHistory(columns, snapIt != m_Snapshots.end() ? &snapIt->second : nullptr);
             }
+            trimHistory(nowSec);
 
             m_PrevCounters.clear();
             for (const auto& counter : currentCounters)
@@ -127,6 +162,74 @@ void GPUModel::refresh()
     }
 }
 
+void GPUModel::refreshAsync()
+{
+    if (isReady() && !m_Probe)
+    {
+        return;
+    }
+
+    {
+        const std::scoped_lock lock(m_WorkerMutex);
+        if (m_RefreshPending)
+        {
+            return; // Previous refresh still stuck in the probe; do not queue behind it
+        }
+        m_RefreshPending = true;
+        if (!m_Worker.joinable())
+        {
+            m_Worker = std::jthread([this](const std::stop_token& stopToken) { workerLoop(stopToken); });
+        }
+    }
+    m_WorkerWake.notify_one();
+}
+
+bool GPUModel::refreshPending() const
+{
+    const std::scoped_lock lock(m_WorkerMutex);
+    return m_RefreshPending;
+}
+
+void GPUModel::workerLoop(const std::stop_token& stopToken)
+{
+    while (true)
+    {
+        {
+            std::unique_lock lock(m_WorkerMutex); // NOLINT(misc-const-correctness) - lock guard pattern
+            if (!m_WorkerWake.wait(lock, stopToken, [this] { return m_RefreshPending; }))
+            {
+                return;
+            }
+        }
+
+        if (!isReady())
+        {
+            // Deferred discovery: create the probe here, off the caller's thread
+            std::unique_ptr<Platform::IGPUProbe> probe;
+            try
+            {
+                probe = m_ProbeFactory ? m_ProbeFactory() : nullptr;
+            }
+            catch (const std::exception& e)
+            {
+                spdlog::error("GPUModel: GPU probe creation failed: {}", e.what());
+            }
+            attachProbe(std::move(probe));
+        }
+
+        refresh();
+
+        const std::scoped_lock lock(m_WorkerMutex);
+        m_RefreshPending = false;
+    }
+}
+
+std::vector<Platform::GPUBackendHealth> GPUModel::backendHealth() const
+{
+    // The probe synchronizes its own health; m_Mutex is not needed
+    return isReady() && m_Probe ? m_Probe->backendHealth() : std::vector<Platform::GPUBackendHealth>{};
+}
+
 std::vector<GPUSnapshot> GPUModel::snapshots() const
 {
     const std::shared_lock lock(m_Mutex);
@@ -139,23 +242,10 @@ std::vector<GPUSnapshot> GPUModel::snapshots() const
     return result;
 }
 
-std::vector<GPUSnapshot> GPUModel::history(const std::string& gpuId) const
+std::vector<Platform::ProcessGPUCounters> GPUModel::processCounters() const
 {
     const std::shared_lock lock(m_Mutex);
-    auto it = m_Histories.find(gpuId);
-    if (it == m_Histories.end())
-    {
-        return {};
-    }
-
-    // Copy history data to vector for thread-safe return
-    std::vector<GPUSnapshot> result;
-    result.reserve(it->second.size());
-    for (size_t i = 0; i < it->second.size(); ++i)
-    {
-        result.push_back(it->second[i]);
-    }
-    return result;
+    return m_ProcessCounters;
 }
 
 std::vector<Platform::GPUInfo> GPUModel::gpuInfo() const
@@ -166,11 +256,14 @@ std::vector<Platform::GPUInfo> GPUModel::gpuInfo() const
 
 Platform::GPUCapabilities GPUModel::capabilities() const
 {
-    if (!m_Probe)
-    {
-        return Platform::GPUCapabilities{};
-    }
-    return m_Probe->capabilities();
+    const std::shared_lock lock(m_Mutex);
+    return m_Capabilities;
+}
+
+void GPUModel::setMaxHistorySeconds(double seconds)
+{
+    std::unique_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    m_MaxHistorySeconds = seconds;
 }
 
 GPUSnapshot
@@ -236,69 +329,128 @@ GPUModel::computeSnapshot(const Platform::GPUCounters& current, const Platform::
     return snapshot;
 }
 
-// Template helper for extracting history fields - reduces code duplication
-template<typename FieldPtr> std::vector<float> GPUModel::getHistoryField(const std::string& gpuId, FieldPtr field) const
+void GPUModel::appendHistory(Columns& columns, const GPUSnapshot* snapshot)
 {
-    const std::shared_lock lock(m_Mutex);
-    auto it = m_Histories.find(gpuId);
-    if (it == m_Histories.end())
+    auto column = [&columns](GPUMetric metric) -> SpanHistory<float>& { return columns[static_cast<std::size_t>(metric)]; };
+    if (snapshot == nullptr)
     {
-        return {};
+        for (auto& series : columns)
+        {
+            series.push(0.0F);
+        }
+        return;
     }
 
-    std::vector<float> result;
-    result.reserve(it->second.size());
-    for (size_t i = 0; i < it->second.size(); ++i)
+    column(GPUMetric::UtilizationPercent).push(static_cast<float>(snapshot->utilizationPercent));
+    column(GPUMetric::MemoryUsedPercent).push(static_cast<float>(snapshot->memoryUsedPercent));
+    column(GPUMetric::GpuClockMHz).push(static_cast<float>(snapshot->gpuClockMHz));
+    column(GPUMetric::EncoderUtilPercent).push(static_cast<float>(snapshot->encoderUtilPercent));
+    column(GPUMetric::DecoderUtilPercent).push(static_cast<float>(snapshot->decoderUtilPercent));
+    column(GPUMetric::TemperatureC).push(static_cast<float>(snapshot->temperatureC));
+    column(GPUMetric::PowerDrawWatts).push(static_cast<float>(snapshot->powerDrawWatts));
+    column(GPUMetric::FanSpeed).push(static_cast<float>(snapshot->fanSpeedRPMPercent));
+}
+
+void GPUModel::trimHistory(double nowSeconds)
+{
+    const double cutoff = nowSeconds - m_MaxHistorySeconds;
+    const auto timestamps = m_Timestamps.view();
+    const auto expired = static_cast<std::size_t>(std::ranges::find_if(timestamps, [cutoff](double t) { return t >= cutoff; }) -
+                                                  timestamps.begin());
+    m_Timestamps.dropFront(expired);
+
+    // Columns of GPUs that appeared later start after the first timestamp
+    const std::size_t rows = m_Timestamps.size();
+    for (auto& [gpuId, columns] : m_Histories)
     {
-        result.push_back(static_cast<float>(it->second[i].*field));
+        for (auto& series : columns)
+        {
+            series.keepNewest(rows);
+        }
     }
-    return result;
+}
+
+std::vector<float> GPUModel::copySeries(std::string_view gpuId, GPUMetric metric) const
+{
+    const std::shared_lock lock(m_Mutex);
+    const auto it = m_Histories.find(gpuId);
+    if (it == m_Histories.end())
+    {
+        return {};
+    }
+    const auto series = it->second[static_cast<std::size_t>(metric)].view();
+    return {series.begin(), series.end()};
 }
 
 std::vector<float> GPUModel::utilizationHistory(const std::string& gpuId) const
 {
-    return getHistoryField(gpuId, &GPUSnapshot::utilizationPercent);
+    return copySeries(gpuId, GPUMetric::UtilizationPercent);
 }
 
 std::vector<float> GPUModel::memoryPercentHistory(const std::string& gpuId) const
 {
-    return getHistoryField(gpuId, &GPUSnapshot::memoryUsedPercent);
+    return copySeries(gpuId, GPUMetric::MemoryUsedPercent);
 }
 
 std::vector<float> GPUModel::gpuClockHistory(const std::string& gpuId) const
 {
-    return getHistoryField(gpuId, &GPUSnapshot::gpuClockMHz);
+    return copySeries(gpuId, GPUMetric::GpuClockMHz);
 }
 
 std::vector<float> GPUModel::encoderHistory(const std::string& gpuId) const
 {
-    return getHistoryField(gpuId, &GPUSnapshot::encoderUtilPercent);
+    return copySeries(gpuId, GPUMetric::EncoderUtilPercent);
 }
 
 std::vector<float> GPUModel::decoderHistory(const std::string& gpuId) const
 {
-    return getHistoryField(gpuId, &GPUSnapshot::decoderUtilPercent);
+    return copySeries(gpuId, GPUMetric::DecoderUtilPercent);
 }
 
 std::vector<float> GPUModel::temperatureHistory(const std::string& gpuId) const
 {
-    return getHistoryField(gpuId, &GPUSnapshot::temperatureC);
+    return copySeries(gpuId, GPUMetric::TemperatureC);
 }
 
 std::vector<float> GPUModel::powerHistory(const std::string& gpuId) const
 {
-    return getHistoryField(gpuId, &GPUSnapshot::powerDrawWatts);
+    return copySeries(gpuId, GPUMetric::PowerDrawWatts);
 }
 
 std::vector<float> GPUModel::fanSpeedHistory(const std::string& gpuId) const
 {
-    return getHistoryField(gpuId, &GPUSnapshot::fanSpeedRPMPercent);
+    return copySeries(gpuId, GPUMetric::FanSpeed);
 }
 
 std::vector<double> GPUModel::historyTimestamps() const
 {
     const std::shared_lock lock(m_Mutex);
-    return m_HistoryTimestamps;
+    const auto timestamps = m_Timestamps.view();
+    return {timestamps.begin(), timestamps.end()};
+}
+
+GPUModel::HistoryView GPUModel::historyView() const
+{
+    return HistoryView(*this);
+}
+
+// =============================================================================
+// HistoryView
+// =============================================================================
+
+GPUModel::HistoryView::HistoryView(const GPUModel& model) : m_Lock(model.m_Mutex), m_Model(&model)
+{
+}
+
+std::span<const double> GPUModel::HistoryView::timestamps() const noexcept
+{
+    return m_Model->m_Timestamps.view();
+}
+
+std::span<const float> GPUModel::HistoryView::series(std::string_view gpuId, GPUMetric metric) const
+{
+    const auto it = m_Model->m_Histories.find(gpuId);
+    return it != m_Model->m_Histories.end() ? it->second[static_cast<std::size_t>(metric)].view() : std::span<const float>{};
 }
 
 } // namespace Domain
@@ -5,24 +5,70 @@
 #include "Platform/GPUTypes.h"
 #include "Platform/IGPUProbe.h"
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 namespace Domain
 {
 
-// GPU history capacity: 5 minutes at 1 second intervals = 300 samples
-inline constexpr size_t GPU_HISTORY_CAPACITY = 300;
-
+/// Samples the GPU probe, computes per-GPU snapshots and keeps their history.
+/// Thread-safe (background sampling + UI reads).
+///
+/// History is columnar: one SpanHistory<float> per (GPU, metric), all aligned at their
+/// newest end with one timestamp ring shared by every GPU. Retention follows
+/// setMaxHistorySeconds(), like the other models. A GPU missing from a sample records
+/// zeros so its columns stay aligned with the timestamps.
+///
+/// refreshAsync() runs refresh() on the model's own worker so a slow vendor backend never
+/// stalls the caller; use either it or refresh(), not both. Built by withDeferredDiscovery(), the
+/// model creates its probe and enumerates GPUs on that worker at the first refreshAsync(),
+/// so backend discovery (vendor dlopen, sysfs walks) stays off the startup path; until
+/// then isReady() is false and the model reports no GPUs.
 class GPUModel
 {
   public:
+    /// Read-only access to the history columns without copying.
+    /// Holds a shared lock on the model for its lifetime, so keep it scoped to one
+    /// render pass and do not call other GPUModel methods while it is alive.
+    class HistoryView
+    {
+      public:
+        /// Sample times (steady-clock seconds), oldest first.
+        [[nodiscard]] std::span<const double> timestamps() const noexcept;
+
+        /// History of one metric for @p gpuId, oldest first. Empty if the GPU has no history.
+        [[nodiscard]] std::span<const float> series(std::string_view gpuId, GPUMetric metric) const;
+
+      private:
+        friend class GPUModel;
+        explicit HistoryView(const GPUModel& model);
+
+        std::shared_lock<std::shared_mutex> m_Lock;
+        const GPUModel* m_Model;
+    };
+
+    using ProbeFactory = std::function<std::unique_ptr<Platform::IGPUProbe>()>;
+
     explicit GPUModel(std::unique_ptr<Platform::IGPUProbe> probe);
     ~GPUModel() = default;
 
+    // Model whose probe is created by @p probeFactory on the worker at the first refreshAsync()
+    [[nodiscard]] static std::unique_ptr<GPUModel> withDeferredDiscovery(ProbeFactory probeFactory);
+
     GPUModel(const GPUModel&) = delete;
     GPUModel& operator=(const GPUModel&) = delete;
     GPUModel(GPUModel&&) = delete;
@@ -31,13 +77,25 @@ class GPUModel
     // Refresh metrics (called by sampler thread)
     void refresh();
 
+    // Queue refresh() on the worker thread and return at once; skipped while one is still running
+    void refreshAsync();
+
+    // Whether a refreshAsync() has not finished yet
+    [[nodiscard]] bool refreshPending() const;
+
+    // Whether the probe exists and GPUs are enumerated (false until deferred discovery finishes)
+    [[nodiscard]] bool isReady() const noexcept;
+
+    // Health of the vendor backends behind the probe (does not wait for a running refresh)
+    [[nodiscard]] std::vector<Platform::GPUBackendHealth> backendHealth() const;
+
     // Get current snapshots (thread-safe)
     [[nodiscard]] std::vector<GPUSnapshot> snapshots() const;
 
-    // Get history for specific GPU (returns copy for thread safety)
-    [[nodiscard]] std::vector<GPUSnapshot> history(const std::string& gpuId) const;
+    // Lock the history for zero-copy reads (see HistoryView)
+    [[nodiscard]] HistoryView historyView() const;
 
-    // Get flattened history arrays for specific GPU (for chart plotting)
+    // Get flattened history arrays for specific GPU; these copy, prefer historyView()
     [[nodiscard]] std::vector<float> utilizationHistory(const std::string& gpuId) const;
     [[nodiscard]] std::vector<float> memoryPercentHistory(const std::string& gpuId) const;
     [[nodiscard]] std::vector<float> gpuClockHistory(const std::string& gpuId) const;
@@ -50,24 +108,56 @@ class GPUModel
     // Get timestamps for GPU history
     [[nodiscard]] std::vector<double> historyTimestamps() const;
 
+    // Per-process GPU usage from the last refresh (empty unless the probe has per-process metrics)
+    [[nodiscard]] std::vector<Platform::ProcessGPUCounters> processCounters() const;
+
     // GPU info (static, rarely changes)
     [[nodiscard]] std::vector<Platform::GPUInfo> gpuInfo() const;
 
     // Capabilities
     [[nodiscard]] Platform::GPUCapabilities capabilities() const;
 
+    // Configure history retention
+    void setMaxHistorySeconds(double seconds);
+
   private:
+    struct DeferredTag
+    {
+    };
+    GPUModel(DeferredTag /*tag*/, ProbeFactory probeFactory);
+
+    static constexpr std::size_t GPU_METRIC_COUNT = static_cast<std::size_t>(GPUMetric::Count);
+
+    // Lets the history map be probed with a string_view without building a std::string
+    struct IdHash
+    {
+        using is_transparent = void;
+        [[nodiscard]] std::size_t operator()(std::string_view id) const noexcept
+        {
+            return std::hash<std::string_view>{}(id);
+        }
+    };
+
+    using Columns = std::array<SpanHistory<float>, GPU_METRIC_COUNT>;
+
+    // Set once, before m_Ready; other threads read m_Probe only after seeing m_Ready
     std::unique_ptr<Platform::IGPUProbe> m_Probe;
+    ProbeFactory m_ProbeFactory;
+    std::atomic<bool> m_Ready{false};
     std::vector<Platform::GPUInfo> m_GPUInfo;
 
+    // Probe capabilities, fixed once the probe exists; refresh() reads per-process counters if supported
+    Platform::GPUCapabilities m_Capabilities;
+    bool m_HasPerProcessMetrics = false;
+    std::vector<Platform::ProcessGPUCounters> m_ProcessCounters;
+
     // Current snapshots per GPU
     std::unordered_map<std::string, GPUSnapshot> m_Snapshots;
 
-    // History buffers per GPU
-    std::unordered_map<std::string, History<GPUSnapshot, GPU_HISTORY_CAPACITY>> m_Histories;
-
-    // Timestamps for history data
-    std::vector<double> m_HistoryTimestamps;
+    // History columns per GPU, aligned at the newest end with m_Timestamps
+    std::unordered_map<std::string, Columns, IdHash, std::equal_to<>> m_Histories;
+    SpanHistory<double> m_Timestamps; // Steady-clock seconds, shared by all GPUs
+    double m_MaxHistorySeconds = 300.0;
 
     // Previous counters for rate calculation
     std::unordered_map<std::string, Platform::GPUCounters> m_PrevCounters;
@@ -80,8 +170,25 @@ class GPUModel
     [[nodiscard]] GPUSnapshot
     computeSnapshot(const Platform::GPUCounters& current, const Platform::GPUCounters* previous, double timeDeltaSeconds) const;
 
-    // Helper template: extract a field from GPU history and return as float vector
-    template<typename FieldPtr> [[nodiscard]] std::vector<float> getHistoryField(const std::string& gpuId, FieldPtr field) const;
+    // Helper: append one row of history (zeros for a GPU without a snapshot this sample)
+    static void appendHistory(Columns& columns, const GPUSnapshot* snapshot);
+
+    // Helper: drop rows older than the retention window
+    void trimHistory(double nowSeconds);
+
+    // Helper: copy one metric column
+    [[nodiscard]] std::vector<float> copySeries(std::string_view gpuId, GPUMetric metric) const;
+
+    // Helper: take ownership of the probe, enumerate its GPUs and mark the model ready
+    void attachProbe(std::unique_ptr<Platform::IGPUProbe> probe);
+
+    void workerLoop(const std::stop_token& stopToken);
+
+    // refreshAsync() worker, started on first use. Declared last so it stops before the state it reads.
+    mutable std::mutex m_WorkerMutex;
+    std::condition_variable_any m_WorkerWake;
+    bool m_RefreshPending = false;
+    std::jthread m_Worker;
 };
 
 } // namespace Domain
@@ -7,6 +7,20 @@
 namespace Domain
 {
 
+/// Per-GPU metrics kept as history columns (GPUModel::HistoryView::series).
+enum class GPUMetric : std::uint8_t
+{
+    UtilizationPercent = 0,
+    MemoryUsedPercent,
+    GpuClockMHz,
+    EncoderUtilPercent,
+    DecoderUtilPercent,
+    TemperatureC,
+    PowerDrawWatts,
+    FanSpeed, // RPM or percent, as reported by the probe
+    Count,
+};
+
 // Immutable snapshot of a single GPU at a point in time
 struct GPUSnapshot
 {
@@ -3,7 +3,9 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <span>
 #include <utility>
+#include <vector>
 
 namespace Domain
 {
@@ -113,4 +115,106 @@ template<typename T, std::size_t Capacity> class History
     std::size_t m_Size = 0;
 };
 
+/// Growable ring buffer whose contents are always readable as one contiguous span.
+///
+/// Each value is stored twice, at its slot and at slot + capacity, so the live window
+/// [start, start + size) never wraps: view() hands out a span with no copy, at the cost
+/// of a second store per push. Capacity doubles when a push finds the ring full.
+template<typename T> class SpanHistory
+{
+  public:
+    /// Append a value, growing the ring if it is full.
+    void push(T value)
+    {
+        if (m_Size == m_Capacity)
+        {
+            grow(m_Capacity == 0 ? INITIAL_CAPACITY : m_Capacity * 2);
+        }
+        const std::size_t slot = (m_Start + m_Size) % m_Capacity;
+        m_Data[slot] = value;
+        m_Data[slot + m_Capacity] = std::move(value);
+        ++m_Size;
+    }
+
+    /// Drop the @p count oldest entries.
+    void dropFront(std::size_t count) noexcept
+    {
+        count = std::min(count, m_Size);
+        if (count == 0)
+        {
+            return;
+        }
+        m_Start = (m_Start + count) % m_Capacity;
+        m_Size -= count;
+    }
+
+    /// Keep only the newest @p count entries.
+    void keepNewest(std::size_t count) noexcept
+    {
+        if (m_Size > count)
+        {
+            dropFront(m_Size - count);
+        }
+    }
+
+    /// Clear all data and free the storage.
+    void release() noexcept
+    {
+        std::vector<T>().swap(m_Data);
+        m_Capacity = 0;
+        m_Start = 0;
+        m_Size = 0;
+    }
+
+    /// Entries in chronological order (oldest first). Invalidated by push() and release().
+    [[nodiscard]] std::span<const T> view() const noexcept
+    {
+        if (m_Size == 0)
+        {
+            return {};
+        }
+        return {m_Data.data() + m_Start, m_Size};
+    }
+
+    /// Most recent value (or default if empty).
+    [[nodiscard]] T latest() const
+    {
+        return m_Size == 0 ? T{} : m_Data[m_Start + m_Size - 1];
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_Size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_Size == 0;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return m_Capacity;
+    }
+
+  private:
+    static constexpr std::size_t INITIAL_CAPACITY = 64;
+
+    void grow(std::size_t newCapacity)
+    {
+        std::vector<T> data(newCapacity * 2);
+        const auto current = view();
+        std::ranges::copy(current, data.begin());
+        std::ranges::copy(current, data.begin() + static_cast<std::ptrdiff_t>(newCapacity));
+        m_Data = std::move(data);
+        m_Capacity = newCapacity;
+        m_Start = 0;
+    }
+
+    std::vector<T> m_Data; // 2 * m_Capacity entries; the upper half mirrors the lower
+    std::size_t m_Capacity = 0;
+    std::size_t m_Start = 0;
+    std::size_t m_Size = 0;
+};
+
 } // namespace Domain
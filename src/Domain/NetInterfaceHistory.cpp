@@ -0,0 +1,308 @@
+#include "NetInterfaceHistory.h"
+
+#include "Numeric.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Domain
+{
+
+namespace
+{
+
+// Initial ring length; grown on demand to cover the history window
+constexpr std::size_t INITIAL_STRIDE = 64;
+
+// rtnl_link_ops kinds that carry tunneled or overlay traffic
+constexpr std::array<std::string_view, 13> TUNNEL_KINDS = {
+    "tun", "wireguard", "vxlan", "geneve", "gre", "gretap", "ip6gre", "ip6gretap", "ipip", "ip6tnl", "sit", "vti", "ipvlan"};
+
+[[nodiscard]] bool startsWithAny(std::string_view name, std::initializer_list<std::string_view> prefixes)
+{
+    return std::ranges::any_of(prefixes, [name](std::string_view prefix) { return name.starts_with(prefix); });
+}
+
+[[nodiscard]] double rate(std::uint64_t current, std::uint64_t previous, double timeDeltaSeconds)
+{
+    // Counter went backwards (interface reset or wrap) - report zero rather than a bogus spike
+    return current >= previous ? Numeric::toDouble(current - previous) / timeDeltaSeconds : 0.0;
+}
+
+} // namespace
+
+InterfaceGroup classifyInterface(std::string_view name, std::string_view kind)
+{
+    if (!kind.empty())
+    {
+        if (kind == "veth")
+        {
+            return InterfaceGroup::Veth;
+        }
+        if (kind == "bridge")
+        {
+            return InterfaceGroup::Bridge;
+        }
+        if (std::ranges::find(TUNNEL_KINDS, kind) != TUNNEL_KINDS.end())
+        {
+            return InterfaceGroup::Tunnel;
+        }
+        return InterfaceGroup::Virtual;
+    }
+
+    // No kind (e.g. /proc/net/dev fallback or non-Linux probes): fall back to naming conventions
+    if (name.starts_with("veth"))
+    {
+        return InterfaceGroup::Veth;
+    }
+    if (startsWithAny(name, {"docker", "br-", "virbr", "cni", "cbr"}))
+    {
+        return InterfaceGroup::Bridge;
+    }
+    if (startsWithAny(name, {"tun", "tap", "wg", "vxlan", "flannel", "tailscale", "zt"}))
+    {
+        return InterfaceGroup::Tunnel;
+    }
+    if (startsWithAny(name, {"dummy", "ifb", "vEthernet"}) || name.contains("Loopback"))
+    {
+        return InterfaceGroup::Virtual;
+    }
+    return InterfaceGroup::Physical;
+}
+
+const char* interfaceGroupLabel(InterfaceGroup group)
+{
+    switch (group)
+    {
+    case InterfaceGroup::Physical:
+        return "Physical";
+    case InterfaceGroup::Veth:
+        return "veth";
+    case InterfaceGroup::Bridge:
+        return "Bridge";
+    case InterfaceGroup::Tunnel:
+        return "Tunnel";
+    case InterfaceGroup::Virtual:
+        return "Virtual";
+    }
+    return "Unknown";
+}
+
+NetInterfaceHistory::NetInterfaceHistory() : m_Stride(INITIAL_STRIDE)
+{
+}
+
+void NetInterfaceHistory::update(const std::vector<Platform::SystemCounters::InterfaceCounters>& interfaces,
+                                 double timeDeltaSeconds,
+                                 bool appendHistory,
+                                 SystemSnapshot& out)
+{
+    ++m_Generation;
+    out.networkInterfaces.clear();
+    out.networkInterfaces.reserve(interfaces.size());
+    out.networkGroups = {};
+
+    for (const auto& iface : interfaces)
+    {
+        const std::size_t slotIndex = acquireSlot(iface);
+        Slot& slot = m_Slots[slotIndex];
+
+        SystemSnapshot::InterfaceSnapshot ifaceSnap;
+        ifaceSnap.name = iface.name;
+        ifaceSnap.displayName = iface.displayName;
+        ifaceSnap.isUp = iface.isUp;
+        ifaceSnap.linkSpeedMbps = iface.linkSpeedMbps;
+        ifaceSnap.mtu = iface.mtu;
+        ifaceSnap.ifIndex = iface.ifIndex;
+        ifaceSnap.group = classifyInterface(iface.name, iface.kind);
+
+        if (slot.hasPrevious && timeDeltaSeconds > 0.0)
+        {
+            ifaceSnap.rxBytesPerSec = rate(iface.rxBytes, slot.prevRxBytes, timeDeltaSeconds);
+            ifaceSnap.txBytesPerSec = rate(iface.txBytes, slot.prevTxBytes, timeDeltaSeconds);
+        }
+        slot.prevRxBytes = iface.rxBytes;
+        slot.prevTxBytes = iface.txBytes;
+        slot.hasPrevious = true;
+        slot.lastSeen = m_Generation;
+
+        if (appendHistory)
+        {
+            const std::size_t cell = (slotIndex * m_Stride) + m_Head;
+            m_RxArena[cell] = static_cast<float>(ifaceSnap.rxBytesPerSec);
+            m_TxArena[cell] = static_cast<float>(ifaceSnap.txBytesPerSec);
+            slot.sampleCount = std::min(slot.sampleCount + 1, m_Stride);
+        }
+
+        auto& group = out.networkGroups[static_cast<std::size_t>(ifaceSnap.group)];
+        ++group.interfaceCount;
+        group.upCount += ifaceSnap.isUp ? 1U : 0U;
+        group.rxBytesPerSec += ifaceSnap.rxBytesPerSec;
+        group.txBytesPerSec += ifaceSnap.txBytesPerSec;
+
+        out.networkInterfaces.push_back(std::move(ifaceSnap));
+    }
+
+    for (std::size_t i = 0; i < m_Slots.size(); ++i)
+    {
+        if (m_Slots[i].live && m_Slots[i].lastSeen != m_Generation)
+        {
+            releaseSlot(i);
+        }
+    }
+
+    if (appendHistory)
+    {
+        m_Head = (m_Head + 1) % m_Stride;
+    }
+}
+
+void NetInterfaceHistory::reserveSamples(std::size_t samples)
+{
+    if (samples <= m_Stride)
+    {
+        return;
+    }
+
+    // Re-lay every ring so its newest sample sits just before the new head. All counts are
+    // <= the old stride, so placing the head at the old stride keeps every ring in bounds.
+    const std::size_t newStride = std::bit_ceil(samples);
+    const std::size_t newHead = m_Stride;
+    std::vector<float> rxArena(m_Slots.size() * newStride, 0.0F);
+    std::vector<float> txArena(m_Slots.size() * newStride, 0.0F);
+
+    for (std::size_t s = 0; s < m_Slots.size(); ++s)
+    {
+        const std::size_t count = m_Slots[s].sampleCount;
+        for (std::size_t k = 0; k < count; ++k)
+        {
+            const std::size_t from = (s * m_Stride) + ((m_Head + m_Stride - count + k) % m_Stride);
+            const std::size_t to = (s * newStride) + (newHead - count + k);
+            rxArena[to] = m_RxArena[from];
+            txArena[to] = m_TxArena[from];
+        }
+    }
+
+    m_RxArena = std::move(rxArena);
+    m_TxArena = std::move(txArena);
+    m_Stride = newStride;
+    m_Head = newHead;
+}
+
+void NetInterfaceHistory::clampSamples(std::size_t samples)
+{
+    for (auto& slot : m_Slots)
+    {
+        slot.sampleCount = std::min(slot.sampleCount, samples);
+    }
+}
+
+void NetInterfaceHistory::copyRxHistory(const std::string& name, std::vector<float>& out) const
+{
+    copyHistory(m_RxArena, name, out);
+}
+
+void NetInterfaceHistory::copyTxHistory(const std::string& name, std::vector<float>& out) const
+{
+    copyHistory(m_TxArena, name, out);
+}
+
+void NetInterfaceHistory::copyHistory(const std::vector<float>& arena, const std::string& name, std::vector<float>& out) const
+{
+    out.clear();
+    const auto it = m_NameToSlot.find(name);
+    if (it == m_NameToSlot.end())
+    {
+        return;
+    }
+
+    const std::size_t count = m_Slots[it->second].sampleCount;
+    const std::size_t base = it->second * m_Stride;
+    const std::size_t start = (m_Head + m_Stride - count) % m_Stride;
+    out.resize(count);
+
+    // At most two contiguous chunks: [start, stride) then [0, head)
+    const std::size_t firstChunk = std::min(count, m_Stride - start);
+    const auto ringBegin = arena.begin() + static_cast<std::ptrdiff_t>(base);
+    std::copy_n(ringBegin + static_cast<std::ptrdiff_t>(start), firstChunk, out.begin());
+    std::copy_n(ringBegin, count - firstChunk, out.begin() + static_cast<std::ptrdiff_t>(firstChunk));
+}
+
+std::size_t NetInterfaceHistory::acquireSlot(const Platform::SystemCounters::InterfaceCounters& iface)
+{
+    if (iface.ifIndex != 0)
+    {
+        if (const auto it = m_IndexToSlot.find(iface.ifIndex); it != m_IndexToSlot.end())
+        {
+            Slot& slot = m_Slots[it->second];
+            if (slot.name != iface.name)
+            {
+                // Renamed in place (same ifindex): keep counters and history, move the name key
+                if (const auto nameIt = m_NameToSlot.find(slot.name); nameIt != m_NameToSlot.end() && nameIt->second == it->second)
+                {
+                    m_NameToSlot.erase(nameIt);
+                }
+                slot.name = iface.name;
+                m_NameToSlot[slot.name] = it->second;
+            }
+            return it->second;
+        }
+    }
+    else if (const auto it = m_NameToSlot.find(iface.name); it != m_NameToSlot.end() && m_Slots[it->second].ifIndex == 0)
+    {
+        return it->second;
+    }
+
+    std::size_t slotIndex = 0;
+    if (!m_FreeSlots.empty())
+    {
+        slotIndex = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    }
+    else
+    {
+        slotIndex = m_Slots.size();
+        m_Slots.emplace_back();
+        m_RxArena.resize(m_Slots.size() * m_Stride, 0.0F);
+        m_TxArena.resize(m_Slots.size() * m_Stride, 0.0F);
+    }
+
+    Slot& slot = m_Slots[slotIndex];
+    slot.name = iface.name;
+    slot.ifIndex = iface.ifIndex;
+    slot.live = true;
+    if (iface.ifIndex != 0)
+    {
+        m_IndexToSlot[iface.ifIndex] = slotIndex;
+    }
+    m_NameToSlot[iface.name] = slotIndex;
+    return slotIndex;
+}
+
+void NetInterfaceHistory::releaseSlot(std::size_t slotIndex)
+{
+    Slot& slot = m_Slots[slotIndex];
+
+    // A replacement interface may already have claimed the name (or index) this tick
+    if (const auto it = m_NameToSlot.find(slot.name); it != m_NameToSlot.end() && it->second == slotIndex)
+    {
+        m_NameToSlot.erase(it);
+    }
+    if (const auto it = m_IndexToSlot.find(slot.ifIndex); slot.ifIndex != 0 && it != m_IndexToSlot.end() && it->second == slotIndex)
+    {
+        m_IndexToSlot.erase(it);
+    }
+
+    slot = Slot{};
+    m_FreeSlots.push_back(slotIndex);
+}
+
+} // namespace Domain
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Platform/SystemTypes.h"
+#include "SystemSnapshot.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Domain
+{
+
+/// Classify an interface from its link kind (if the probe reports one) or its name.
+[[nodiscard]] InterfaceGroup classifyInterface(std::string_view name, std::string_view kind);
+
+/// Short label for an interface group ("Physical", "veth", ...).
+[[nodiscard]] const char* interfaceGroupLabel(InterfaceGroup group);
+
+/// Per-interface rate computation and history, sized for hosts with thousands of
+/// short-lived interfaces (container veths).
+///
+/// Each interface owns a slot, looked up by ifindex (stable across renames) or by name
+/// when the probe has no index. Slots hold the previous counters, so rates need no
+/// search through the previous sample. Rx/tx histories live in one pooled arena: every
+/// slot is a fixed-stride ring in a shared float array, and all rings advance together,
+/// so appending a sample is one store per interface and never allocates. Slots whose
+/// interface disappears go on a free list and are reused by the next new interface.
+///
+/// Not thread-safe; SystemModel guards it with its own mutex.
+class NetInterfaceHistory
+{
+  public:
+    NetInterfaceHistory();
+
+    /// Match @p interfaces to slots, fill @p out with per-interface rates (parallel to
+    /// @p interfaces) and per-group totals, and reclaim slots for interfaces that are gone.
+    /// Rates are zero for new interfaces, on counter resets and when @p timeDeltaSeconds <= 0.
+    /// If @p appendHistory is set, the rates are also appended to the rings.
+    void update(const std::vector<Platform::SystemCounters::InterfaceCounters>& interfaces,
+                double timeDeltaSeconds,
+                bool appendHistory,
+                SystemSnapshot& out);
+
+    /// Ensure each ring can hold at least @p samples entries (grows the arena stride).
+    void reserveSamples(std::size_t samples);
+
+    /// Limit every ring to its newest @p samples entries (after the time window is trimmed).
+    void clampSamples(std::size_t samples);
+
+    /// Copy an interface's history (oldest first) into @p out. Empty if unknown.
+    void copyRxHistory(const std::string& name, std::vector<float>& out) const;
+    void copyTxHistory(const std::string& name, std::vector<float>& out) const;
+
+    /// Number of interfaces currently tracked (for tests and diagnostics).
+    [[nodiscard]] std::size_t liveCount() const noexcept
+    {
+        return m_NameToSlot.size();
+    }
+
+    /// Number of slots in the arena, live or free.
+    [[nodiscard]] std::size_t slotCapacity() const noexcept
+    {
+        return m_Slots.size();
+    }
+
+  private:
+    struct Slot
+    {
+        std::string name;
+        std::uint32_t ifIndex = 0;
+        std::uint64_t prevRxBytes = 0;
+        std::uint64_t prevTxBytes = 0;
+        std::uint64_t lastSeen = 0;  // update() generation that last reported this interface
+        std::size_t sampleCount = 0; // Valid entries in this slot's ring (<= m_Stride)
+        bool live = false;
+        bool hasPrevious = false;
+    };
+
+    [[nodiscard]] std::size_t acquireSlot(const Platform::SystemCounters::InterfaceCounters& iface);
+    void releaseSlot(std::size_t slot);
+    void copyHistory(const std::vector<float>& arena, const std::string& name, std::vector<float>& out) const;
+
+    std::vector<Slot> m_Slots;
+    std::vector<std::size_t> m_FreeSlots;
+    std::unordered_map<std::uint32_t, std::size_t> m_IndexToSlot; // Interfaces with an ifindex
+    std::unordered_map<std::string, std::size_t> m_NameToSlot;    // Every live interface
+
+    // Ring arena: slot s occupies [s * m_Stride, (s + 1) * m_Stride); the next sample of
+    // every slot is written at column m_Head.
+    std::vector<float> m_RxArena;
+    std::vector<float> m_TxArena;
+    std::size_t m_Stride;
+    std::size_t m_Head = 0;
+    std::uint64_t m_Generation = 0;
+};
+
+} // namespace Domain
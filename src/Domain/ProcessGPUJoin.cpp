@@ -0,0 +1,139 @@
+#include "ProcessGPUJoin.h"
+
+#include "GPUEngineMask.h"
+#include "Platform/GPUTypes.h"
+#include "ProcessSnapshot.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace Domain
+{
+
+void ProcessGPUJoin::update(std::span<const Platform::ProcessGPUCounters> counters, std::span<const Platform::GPUInfo> gpus)
+{
+    m_Usage.clear();
+
+    // Sort indices rather than the counters: entries carry strings and engine vectors
+    std::vector<std::size_t> order(counters.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::ranges::sort(order,
+                      [&](std::size_t lhs, std::size_t rhs)
+                      {
+                          if (counters[lhs].pid != counters[rhs].pid)
+                          {
+                              return counters[lhs].pid < counters[rhs].pid;
+                          }
+                          return counters[lhs].gpuId < counters[rhs].gpuId;
+                      });
+
+    for (const std::size_t index : order)
+    {
+        const auto& counter = counters[index];
+        if (m_Usage.empty() || m_Usage.back().pid != counter.pid)
+        {
+            m_Usage.emplace_back().pid = counter.pid;
+        }
+        auto& usage = m_Usage.back();
+
+        // Several entries for the same GPU (probes reporting per context) merge into one
+        if (usage.perGpu.empty() || usage.perGpu.back().gpuId != counter.gpuId)
+        {
+            auto& perGpu = usage.perGpu.emplace_back();
+            perGpu.gpuId = counter.gpuId;
+            const auto info = std::ranges::find(gpus, counter.gpuId, &Platform::GPUInfo::id);
+            if (info != gpus.end())
+            {
+                perGpu.gpuName = info->name;
+                perGpu.isIntegrated = info->isIntegrated;
+            }
+            else
+            {
+                perGpu.gpuName = counter.gpuName; // No enumerating backend for it (e.g. amdgpu without ROCm)
+            }
+
+            if (!usage.devices.empty())
+            {
+                usage.devices += ',';
+            }
+            usage.devices += counter.gpuId;
+        }
+        auto& perGpu = usage.perGpu.back();
+
+        GPUEngineMask engines = 0;
+        for (const auto& engine : counter.activeEngines)
+        {
+            engines |= GPUEngine::fromName(engine);
+        }
+
+        perGpu.utilPercent = std::min(perGpu.utilPercent + counter.gpuUtilPercent, 100.0);
+        perGpu.memoryBytes += counter.gpuMemoryBytes;
+        perGpu.engines |= engines;
+
+        usage.utilPercent += counter.gpuUtilPercent;
+        usage.encoderUtil += counter.encoderUtilPercent;
+        usage.decoderUtil += counter.decoderUtilPercent;
+        usage.memoryBytes += counter.gpuMemoryBytes;
+        usage.engines |= engines;
+    }
+}
+
+bool ProcessGPUJoin::apply(std::span<ProcessSnapshot> snapshots) const
+{
+    bool changed = false;
+    for (auto& snapshot : snapshots)
+    {
+        const auto it = std::ranges::lower_bound(m_Usage, snapshot.pid, {}, &ProcessUsage::pid);
+        if (it == m_Usage.end() || it->pid != snapshot.pid)
+        {
+            changed = clear(snapshot) || changed;
+            continue;
+        }
+        if (matches(snapshot, *it))
+        {
+            continue;
+        }
+
+        changed = true;
+        snapshot.gpuUtilPercent = it->utilPercent;
+        snapshot.gpuMemoryBytes = it->memoryBytes;
+        snapshot.gpuEncoderUtil = it->encoderUtil;
+        snapshot.gpuDecoderUtil = it->decoderUtil;
+        snapshot.gpuEngines = it->engines;
+        snapshot.gpuDevices = it->devices;
+        snapshot.perGpuUsage = it->perGpu;
+    }
+    return changed;
+}
+
+bool ProcessGPUJoin::matches(const ProcessSnapshot& snapshot, const ProcessUsage& usage)
+{
+    // Exact comparison on purpose: apply() copies these values, so equal means unchanged
+    return snapshot.gpuUtilPercent == usage.utilPercent && snapshot.gpuMemoryBytes == usage.memoryBytes &&
+           snapshot.gpuEncoderUtil == usage.encoderUtil && snapshot.gpuDecoderUtil == usage.decoderUtil &&
+           snapshot.gpuEngines == usage.engines && snapshot.gpuDevices == usage.devices && snapshot.perGpuUsage == usage.perGpu;
+}
+
+bool ProcessGPUJoin::clear(ProcessSnapshot& snapshot)
+{
+    if (snapshot.gpuUtilPercent == 0.0 && snapshot.gpuMemoryBytes == 0 && snapshot.gpuEncoderUtil == 0.0 &&
+        snapshot.gpuDecoderUtil == 0.0 && snapshot.gpuEngines == 0 && snapshot.gpuDevices.empty() && snapshot.perGpuUsage.empty())
+    {
+        return false;
+    }
+
+    snapshot.gpuUtilPercent = 0.0;
+    snapshot.gpuMemoryBytes = 0;
+    snapshot.gpuEncoderUtil = 0.0;
+    snapshot.gpuDecoderUtil = 0.0;
+    snapshot.gpuEngines = 0;
+    snapshot.gpuDevices.clear();
+    snapshot.perGpuUsage.clear();
+    return true;
+}
+
+} // namespace Domain
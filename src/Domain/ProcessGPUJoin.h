@@ -0,0 +1,57 @@
+#pragma once
+
+#include "GPUEngineMask.h"
+#include "Platform/GPUTypes.h"
+#include "ProcessSnapshot.h"
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Domain
+{
+
+/// Joins per-process GPU counters (one entry per PID and GPU) into process snapshots.
+///
+/// update() folds the counters into one entry per PID, sorted by PID, so apply() costs a
+/// binary search per snapshot instead of a scan of the counters. Usage on several GPUs is
+/// summed into the snapshot totals and kept per GPU in ProcessSnapshot::perGpuUsage.
+///
+/// Not thread-safe; ProcessModel guards it with its own mutex.
+class ProcessGPUJoin
+{
+  public:
+    /// Replace the joined counters. @p gpus supplies names for ProcessSnapshot::perGpuUsage.
+    void update(std::span<const Platform::ProcessGPUCounters> counters, std::span<const Platform::GPUInfo> gpus);
+
+    /// Set the GPU fields of every snapshot: from the counters of its PID, or cleared.
+    /// Returns true if any snapshot's GPU fields changed.
+    [[nodiscard]] bool apply(std::span<ProcessSnapshot> snapshots) const;
+
+    /// Number of processes with GPU counters.
+    [[nodiscard]] std::size_t processCount() const noexcept
+    {
+        return m_Usage.size();
+    }
+
+  private:
+    struct ProcessUsage
+    {
+        std::int32_t pid = 0;
+        double utilPercent = 0.0;
+        double encoderUtil = 0.0;
+        double decoderUtil = 0.0;
+        std::uint64_t memoryBytes = 0;
+        GPUEngineMask engines = 0;
+        std::string devices;
+        std::vector<ProcessSnapshot::PerGPUUsage> perGpu;
+    };
+
+    [[nodiscard]] static bool matches(const ProcessSnapshot& snapshot, const ProcessUsage& usage);
+    [[nodiscard]] static bool clear(ProcessSnapshot& snapshot);
+
+    std::vector<ProcessUsage> m_Usage; // Sorted by pid
+};
+
+} // namespace Domain
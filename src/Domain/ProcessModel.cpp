@@ -1,6 +1,8 @@
 #include "ProcessModel.h"
 
+#include "EnergyAttribution.h"
 #include "Numeric.h"
+#include "Platform/GPUTypes.h"
 #include "Platform/IProcessProbe.h"
 #include "Platform/ProcessTypes.h"
 #include "ProcessSnapshot.h"
@@ -12,9 +14,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -60,16 +64,95 @@ void ProcessModel::refresh()
 
     auto currentCounters = m_Probe->enumerate();
     const std::uint64_t currentTotalCpuTime = m_Probe->totalCpuTime();
+    const auto energy = m_Probe->readEnergyCounters();
 
-    computeSnapshots(currentCounters, currentTotalCpuTime);
+    computeSnapshots(currentCounters, currentTotalCpuTime, energy);
+
+    if (m_Capabilities.hasNumaResidency)
+    {
+        refreshNumaLocality();
+    }
+}
+
+void ProcessModel::requestNumaLocality(std::span<const std::int32_t> pids)
+{
+    std::unique_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    m_NumaRequests.assign(pids.begin(), pids.end());
+}
+
+void ProcessModel::refreshNumaLocality()
+{
+    std::vector<std::int32_t> pids;
+    {
+        std::unique_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+        pids.swap(m_NumaRequests);
+    }
+    if (pids.empty())
+    {
+        return;
+    }
+
+    // Probe reads happen outside the lock: numa_maps of a large process can take milliseconds
+    std::vector<std::pair<std::int32_t, NumaLocality>> results;
+    results.reserve(pids.size());
+    for (const std::int32_t pid : pids)
+    {
+        NumaLocality locality;
+        if (m_Probe->readNumaResidency(pid, m_NumaScratch))
+        {
+            const auto dominant = std::ranges::max_element(m_NumaScratch);
+            std::uint64_t total = 0;
+            for (const std::uint64_t kib : m_NumaScratch)
+            {
+                total += kib;
+            }
+            if (total > 0)
+            {
+                locality.node = static_cast<std::int32_t>(std::distance(m_NumaScratch.begin(), dominant));
+                locality.percent = 100.0 * Numeric::toDouble(*dominant) / Numeric::toDouble(total);
+            }
+        }
+        results.emplace_back(pid, locality);
+    }
+
+    std::unique_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    for (const auto& [pid, locality] : results)
+    {
+        const auto it = std::ranges::find(m_Snapshots, pid, &ProcessSnapshot::pid);
+        if (it == m_Snapshots.end())
+        {
+            continue; // Exited between enumerate() and the read
+        }
+        it->numaNode = locality.node;
+        it->numaLocalityPercent = locality.percent;
+        m_NumaLocality[it->uniqueKey] = locality;
+    }
+    if (!results.empty())
+    {
+        ++m_Generation;
+    }
+}
+
+void ProcessModel::updateGPUUsage(std::span<const Platform::ProcessGPUCounters> counters, std::span<const Platform::GPUInfo> gpus)
+{
+    std::unique_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    m_GPUJoin.update(counters, gpus);
+    // GPU counters refresh faster than processes and are often unchanged; keep the generation
+    // (and the views' cached sort and tree) unless a snapshot actually moved
+    if (m_GPUJoin.apply(m_Snapshots))
+    {
+        ++m_Generation;
+    }
 }
 
 void ProcessModel::updateFromCounters(const std::vector<Platform::ProcessCounters>& counters, std::uint64_t totalCpuTime)
 {
-    computeSnapshots(counters, totalCpuTime);
+    computeSnapshots(counters, totalCpuTime, Platform::EnergyCounters{});
 }
 
-void ProcessModel::computeSnapshots(const std::vector<Platform::ProcessCounters>& counters, std::uint64_t totalCpuTime)
+void ProcessModel::computeSnapshots(const std::vector<Platform::ProcessCounters>& counters,
+                                    std::uint64_t totalCpuTime,
+                                    const Platform::EnergyCounters& energy)
 {
     std::unique_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
 
@@ -99,6 +182,9 @@ void ProcessModel::computeSnapshots(const std::vector<Platform::ProcessCounters>
     std::vector<ProcessSnapshot> newSnapshots;
     newSnapshots.reserve(counters.size());
 
+    m_Energy.beginInterval(energy, elapsedSeconds);
+    m_EnergyShares.clear();
+
     // Track active keys to prune stale entries (reuse existing set)
     m_ActiveKeys.clear();
     m_ActiveKeys.reserve(counters.size());
@@ -166,6 +252,13 @@ void ProcessModel::computeSnapshots(const std::vector<Platform::ProcessCounters>
             computeSnapshot(current, previous, totalCpuDelta, m_SystemTotalMemory, m_TicksPerSecond, elapsedSeconds, timeDeltaUs);
         snapshot.peakMemoryBytes = peakRss;
 
+        // Carry the last sampled locality forward; it is only re-read while the row is requested
+        if (const auto numaIt = m_NumaLocality.find(key); numaIt != m_NumaLocality.end())
+        {
+            snapshot.numaNode = numaIt->second.node;
+            snapshot.numaLocalityPercent = numaIt->second.percent;
+        }
+
         // =======================================================================
         // Network Rate Calculation (Baseline Approach)
         // =======================================================================
@@ -210,17 +303,47 @@ void ProcessModel::computeSnapshots(const std::vector<Platform::ProcessCounters>
         aggNetRecv += snapRef.netReceivedBytesPerSec;
         aggPageFaults += snapRef.pageFaultsPerSec;
         aggThreads += static_cast<double>(snapRef.threadCount);
-        aggPower += snapRef.powerWatts;
+
+        if (m_Energy.hasInterval())
+        {
+            // CPU time of this interval only, charged to the package the process last ran on
+            EnergyShare share;
+            share.package = m_Energy.packageOf(current.lastCpu);
+            if (previous != nullptr)
+            {
+                const std::uint64_t currentTicks = current.userTime + current.systemTime;
+                const std::uint64_t previousTicks = previous->userTime + previous->systemTime;
+                share.cpuTicks = currentTicks >= previousTicks ? currentTicks - previousTicks : 0;
+            }
+            m_Energy.addCpuTime(share.package, share.cpuTicks);
+            m_EnergyShares.push_back(share);
+        }
 
         m_PrevCounters[key] = current;
     }
 
+    // Package energy counters replace probe-side per-process energy when the probe has them
+    if (m_Energy.hasInterval())
+    {
+        for (std::size_t index = 0; index < newSnapshots.size(); ++index)
+        {
+            newSnapshots[index].powerWatts = m_Energy.watts(m_EnergyShares[index].package, m_EnergyShares[index].cpuTicks);
+        }
+    }
+    for (const auto& snapshot : newSnapshots)
+    {
+        aggPower += snapshot.powerWatts;
+    }
+
+    (void) m_GPUJoin.apply(newSnapshots);
     m_Snapshots = std::move(newSnapshots);
+    ++m_Generation;
     m_NetworkBaselines = std::move(newNetworkBaselines);
 
     // Prune stale entries from tracking maps (dead processes) using modern C++23 idiom
     std::erase_if(m_PrevCounters, [this](const auto& entry) { return !m_ActiveKeys.contains(entry.first); });
     std::erase_if(m_PeakRss, [this](const auto& entry) { return !m_ActiveKeys.contains(entry.first); });
+    std::erase_if(m_NumaLocality, [this](const auto& entry) { return !m_ActiveKeys.contains(entry.first); });
 
     m_PrevTotalCpuTime = totalCpuTime;
 
@@ -244,6 +367,12 @@ std::vector<ProcessSnapshot> ProcessModel::snapshots() const
     return m_Snapshots;
 }
 
+std::uint64_t ProcessModel::generation() const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    return m_Generation;
+}
+
 std::vector<double> ProcessModel::systemNetSentHistory() const
 {
     std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
@@ -274,6 +403,12 @@ std::vector<double> ProcessModel::systemPowerHistory() const
     return std::vector<double>(m_SystemPowerHistory.begin(), m_SystemPowerHistory.end());
 }
 
+std::vector<PackagePower> ProcessModel::packagePower() const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    return m_Energy.packagePower();
+}
+
 std::vector<double> ProcessModel::historyTimestamps() const
 {
     std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
@@ -323,6 +458,7 @@ ProcessSnapshot ProcessModel::computeSnapshot(const Platform::ProcessCounters& c
     snapshot.pageFaults = current.pageFaultCount;
     snapshot.cpuAffinityMask = current.cpuAffinityMask;
     snapshot.startTimeEpoch = current.startTimeEpoch;
+    snapshot.cgroupPath = current.cgroupPath;
     snapshot.uniqueKey = makeUniqueKey(current.pid, current.startTimeTicks);
 
     if (systemTotalMemory > 0)
@@ -391,6 +527,23 @@ ProcessSnapshot ProcessModel::computeSnapshot(const Platform::ProcessCounters& c
         }
     }
 
+    // cgroup CPU pressure: stall microseconds over elapsed microseconds. Deltas are only
+    // meaningful if the process stayed in the same cgroup across both samples.
+    if (previous != nullptr && timeDeltaUs > 0 && current.hasCgroupCpuPressure && previous->hasCgroupCpuPressure &&
+        current.cgroupPath == previous->cgroupPath)
+    {
+        auto stallPercent = [timeDeltaUs](std::uint64_t currentUs, std::uint64_t previousUs) -> double
+        {
+            if (currentUs < previousUs)
+            {
+                return 0.0;
+            }
+            return std::clamp(100.0 * Numeric::toDouble(currentUs - previousUs) / Numeric::toDouble(timeDeltaUs), 0.0, 100.0);
+        };
+        snapshot.cgroupCpuSomePercent = stallPercent(current.cgroupCpuSomeStallUs, previous->cgroupCpuSomeStallUs);
+        snapshot.cgroupCpuFullPercent = stallPercent(current.cgroupCpuFullStallUs, previous->cgroupCpuFullStallUs);
+    }
+
     return snapshot;
 }
 
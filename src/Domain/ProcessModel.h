@@ -1,6 +1,9 @@
 #pragma once
 
+#include "EnergyAttribution.h"
+#include "Platform/GPUTypes.h"
 #include "Platform/IProcessProbe.h"
+#include "ProcessGPUJoin.h"
 #include "ProcessSnapshot.h"
 
 #include <chrono>
@@ -9,6 +12,7 @@
 #include <deque>
 #include <memory>
 #include <shared_mutex>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -41,12 +45,19 @@ class ProcessModel
     /// Get latest computed snapshots (copy for thread safety).
     [[nodiscard]] std::vector<ProcessSnapshot> snapshots() const;
 
+    /// Changes whenever snapshots() would return different data (refresh, GPU join, NUMA
+    /// locality), so views can keep a copy and derived data between refreshes. Thread-safe.
+    [[nodiscard]] std::uint64_t generation() const;
+
     // Aggregated system-level histories derived from per-process data
     [[nodiscard]] std::vector<double> systemNetSentHistory() const;
     [[nodiscard]] std::vector<double> systemNetRecvHistory() const;
     [[nodiscard]] std::vector<double> systemPageFaultsHistory() const;
     [[nodiscard]] std::vector<double> systemThreadCountHistory() const;
     [[nodiscard]] std::vector<double> systemPowerHistory() const;
+
+    /// CPU package power over the last refresh interval (empty without energy counters).
+    [[nodiscard]] std::vector<PackagePower> packagePower() const;
     [[nodiscard]] std::vector<double> historyTimestamps() const;
 
     void setMaxHistorySeconds(double seconds);
@@ -54,6 +65,17 @@ class ProcessModel
     /// Number of processes in latest snapshot.
     [[nodiscard]] std::size_t processCount() const;
 
+    /// Ask for NUMA locality of these processes on the next refresh().
+    /// Reading numa_maps walks the process's page tables, so it is sampled only for the
+    /// rows the UI is showing; each call replaces the previous request.
+    /// Results appear in ProcessSnapshot::numaNode / numaLocalityPercent. Thread-safe.
+    void requestNumaLocality(std::span<const std::int32_t> pids);
+
+    /// Replace the per-process GPU usage joined into snapshots (from GPUModel::processCounters()).
+    /// Applied to the current snapshots at once and to every later refresh() until replaced,
+    /// so GPU and process sampling may run at different rates. Thread-safe.
+    void updateGPUUsage(std::span<const Platform::ProcessGPUCounters> counters, std::span<const Platform::GPUInfo> gpus);
+
     /// What the underlying probe supports.
     [[nodiscard]] const Platform::ProcessCapabilities& capabilities() const;
 
@@ -127,12 +149,38 @@ class ProcessModel
 
     // Latest computed snapshots
     std::vector<ProcessSnapshot> m_Snapshots;
+    std::uint64_t m_Generation = 0; // Bumped with every change to m_Snapshots
+
+    // Lazily sampled NUMA locality (keyed by uniqueKey), carried across refreshes until re-read
+    struct NumaLocality
+    {
+        std::int32_t node = -1;
+        double percent = -1.0;
+    };
+    std::unordered_map<std::uint64_t, NumaLocality> m_NumaLocality;
+    std::vector<std::int32_t> m_NumaRequests;
+    std::vector<std::uint64_t> m_NumaScratch; // Per-node KiB, reused across reads (refresh() thread only)
+
+    // Latest per-process GPU usage, joined into each new set of snapshots
+    ProcessGPUJoin m_GPUJoin;
+
+    // Package energy split by per-interval CPU time; m_EnergyShares holds each new
+    // snapshot's package slot and CPU ticks until every process's time is in
+    struct EnergyShare
+    {
+        std::size_t package = EnergyAttribution::NO_PACKAGE;
+        std::uint64_t cpuTicks = 0;
+    };
+    EnergyAttribution m_Energy;
+    std::vector<EnergyShare> m_EnergyShares;
 
     // Thread safety
     mutable std::shared_mutex m_Mutex;
 
     // Helpers
-    void computeSnapshots(const std::vector<Platform::ProcessCounters>& counters, std::uint64_t totalCpuTime);
+    void computeSnapshots(const std::vector<Platform::ProcessCounters>& counters,
+                          std::uint64_t totalCpuTime,
+                          const Platform::EnergyCounters& energy);
 
     [[nodiscard]] static ProcessSnapshot computeSnapshot(const Platform::ProcessCounters& current,
                                                          const Platform::ProcessCounters* previous,
@@ -142,6 +190,8 @@ class ProcessModel
                                                          double elapsedSeconds,
                                                          std::uint64_t timeDeltaUs);
 
+    void refreshNumaLocality();
+
     void trimHistory();
 
     [[nodiscard]] static std::uint64_t makeUniqueKey(std::int32_t pid, std::uint64_t startTime);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "GPUEngineMask.h"
+
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -37,6 +39,10 @@ struct ProcessSnapshot
     double netReceivedBytesPerSec = 0.0; // Optional (0 if not supported)
     double pageFaultsPerSec = 0.0;       // Optional (0 if not supported)
     double powerWatts = 0.0;             // Current power consumption in watts (computed from energy delta)
+    double cgroupCpuSomePercent = 0.0;   // CPU pressure of the process's cgroup: some tasks stalled (% of interval)
+    double cgroupCpuFullPercent = 0.0;   // CPU pressure of the process's cgroup: all tasks stalled (% of interval)
+    double numaLocalityPercent = -1.0;   // Share of resident pages on numaNode (-1 = not sampled)
+    std::int32_t numaNode = -1;          // NUMA node holding most of the process's memory (-1 = unknown)
 
     std::uint64_t peakMemoryBytes = 0; // Peak RSS (from OS on Windows, tracked on Linux)
     std::uint64_t sharedBytes = 0;     // Shared memory
@@ -48,6 +54,7 @@ struct ProcessSnapshot
     std::uint64_t gpuMemoryBytes = 0; // Total VRAM allocated across all GPUs
     double gpuEncoderUtil = 0.0;      // Aggregate encoder utilization
     double gpuDecoderUtil = 0.0;      // Aggregate decoder utilization
+    GPUEngineMask gpuEngines = 0;     // Union of active engines across all GPUs (GPUEngine bits)
 
     // Strings at the end (reduce padding and improve cache for hot integer/float fields)
     std::string name;
@@ -56,19 +63,19 @@ struct ProcessSnapshot
     std::string displayState; // "Running", "Sleeping", "Zombie", etc.
     std::string status;       // Process status (e.g., "Suspended", "Efficiency Mode")
     std::string gpuDevices;   // Comma-separated GPU IDs: "0" or "0,1"
-
-    // GPU engines (union of active engines across all GPUs)
-    std::vector<std::string> gpuEngines; // ["3D", "Compute"]
+    std::string cgroupPath;   // cgroup v2 path (empty if unknown)
 
     // Per-GPU breakdown (for tooltip/details view)
     struct PerGPUUsage
     {
-        std::string gpuId;                // GPU identifier
-        std::string gpuName;              // e.g., "NVIDIA RTX 4090"
-        bool isIntegrated = false;        // Integrated vs discrete
-        double utilPercent = 0.0;         // GPU % on this specific GPU
-        std::uint64_t memoryBytes = 0;    // VRAM allocated on this GPU
-        std::vector<std::string> engines; // Active engines on this GPU
+        std::string gpuId;             // GPU identifier
+        std::string gpuName;           // e.g., "NVIDIA RTX 4090"
+        bool isIntegrated = false;     // Integrated vs discrete
+        GPUEngineMask engines = 0;     // Active engines on this GPU
+        double utilPercent = 0.0;      // GPU % on this specific GPU
+        std::uint64_t memoryBytes = 0; // VRAM allocated on this GPU
+
+        [[nodiscard]] bool operator==(const PerGPUUsage&) const = default;
     };
     std::vector<PerGPUUsage> perGpuUsage; // Breakdown for multi-GPU processes
 };
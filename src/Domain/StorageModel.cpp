@@ -7,18 +7,58 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
+#include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 namespace Domain
 {
 
+namespace
+{
+
+/// Least-squares slope of @p y over @p x; 0 with fewer than two distinct x values.
+[[nodiscard]] double leastSquaresSlope(std::span<const double> x, std::span<const double> y)
+{
+    const std::size_t n = std::min(x.size(), y.size());
+    if (n < 2)
+    {
+        return 0.0;
+    }
+
+    double meanX = 0.0;
+    double meanY = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        meanX += x[i];
+        meanY += y[i];
+    }
+    meanX /= static_cast<double>(n);
+    meanY /= static_cast<double>(n);
+
+    double sxx = 0.0;
+    double sxy = 0.0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const double dx = x[i] - meanX;
+        sxx += dx * dx;
+        sxy += dx * (y[i] - meanY);
+    }
+    return sxx > 0.0 ? sxy / sxx : 0.0;
+}
+
+} // namespace
+
 StorageModel::StorageModel(std::unique_ptr<Platform::IDiskProbe> probe)
     : m_Probe(std::move(probe)), m_StartTime(std::chrono::steady_clock::now())
 {
@@ -32,34 +72,43 @@ void StorageModel::sample()
         return;
     }
 
-    const auto now = std::chrono::steady_clock::now();
     // Use absolute time (since epoch) to match SystemModel's timestamp format
-    const double nowSeconds = std::chrono::duration<double>(now.time_since_epoch()).count();
+    const double nowSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    updateFromCounters(m_Probe->read(), nowSeconds);
+}
 
-    const Platform::SystemDiskCounters counters = m_Probe->read();
-    const Platform::DiskCapabilities caps = m_Probe->capabilities();
+void StorageModel::updateFromCounters(const Platform::SystemDiskCounters& counters, double nowSeconds)
+{
+    const Platform::DiskCapabilities caps = capabilities();
 
     StorageSnapshot snapshot;
     snapshot.hasDiskStats = caps.hasDiskStats;
     snapshot.hasReadWriteBytes = caps.hasReadWriteBytes;
     snapshot.hasIoTime = caps.hasIoTime;
+    snapshot.hasMountStats = caps.hasMountStats;
+    snapshot.disks.reserve(counters.disks.size());
+    snapshot.mounts.reserve(counters.mounts.size());
+
+    // Device slots and history columns are read through HistoryView, so the whole update runs under the lock
+    std::unique_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    ++m_Generation;
 
     // Process each disk
     for (const auto& diskCounters : counters.disks)
     {
-        const std::string& deviceName = diskCounters.deviceName;
-
-        // Get or create state for this device
-        auto& state = m_DiskStates[deviceName];
-        state.deviceName = deviceName;
+        const DiskDeviceId id = acquireDevice(diskCounters.deviceName);
+        Device& device = m_Devices[id];
 
-        const DiskSnapshot diskSnap = computeDiskSnapshot(diskCounters, state);
-        snapshot.disks.push_back(diskSnap);
+        DiskSnapshot disk = computeDiskSnapshot(diskCounters, device.state, nowSeconds);
+        disk.deviceId = id;
+        snapshot.disks.push_back(std::move(disk));
 
         // Update state for next sample
-        state.prevCounters = diskCounters;
-        state.prevTime = now;
-        state.hasPrev = true;
+        device.state.prevCounters = diskCounters;
+        device.state.prevSeconds = nowSeconds;
+        device.state.hasPrev = true;
+        device.lastSeenSeconds = nowSeconds;
+        device.lastSeenGeneration = m_Generation;
     }
 
     // Compute system-wide totals
@@ -71,28 +120,134 @@ void StorageModel::sample()
         snapshot.totalWriteOpsPerSec += disk.writeOpsPerSec;
     }
 
-    // Update shared state
+    // Append one row to every column
+    m_Timestamps.push(nowSeconds);
+    m_TotalReadHistory.push(snapshot.totalReadBytesPerSec);
+    m_TotalWriteHistory.push(snapshot.totalWriteBytesPerSec);
+    for (const auto& disk : snapshot.disks)
+    {
+        appendDeviceSample(m_Devices[disk.deviceId], &disk);
+    }
+    for (auto& device : m_Devices)
     {
-        std::unique_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
-        m_LatestSnapshot = snapshot;
-        m_History.push_back(snapshot);
-        m_Timestamps.push_back(nowSeconds);
-        trimHistory(nowSeconds);
-        m_HasPrevSample = true;
-        m_PrevSampleTime = now;
+        if (device.lifecycle != DeviceLifecycle::Free && device.lastSeenGeneration != m_Generation)
+        {
+            device.lifecycle = DeviceLifecycle::Departed;
+            appendDeviceSample(device, nullptr);
+        }
     }
 
+    // Mounts: capacity trend per filesystem; unmounted filesystems drop their history at once
+    const double cutoff = nowSeconds - m_MaxHistorySeconds;
+    for (const auto& mountCounters : counters.mounts)
+    {
+        auto it = m_Mounts.find(mountCounters.mountPoint);
+        if (it == m_Mounts.end())
+        {
+            it = m_Mounts.emplace(mountCounters.mountPoint, MountState{}).first;
+        }
+        it->second.lastSeenGeneration = m_Generation;
+        snapshot.mounts.push_back(computeMountSnapshot(mountCounters, it->second, nowSeconds, cutoff));
+    }
+    (void) std::erase_if(m_Mounts, [this](const auto& entry) { return entry.second.lastSeenGeneration != m_Generation; });
+
+    trimHistory(nowSeconds);
+    m_LatestSnapshot = std::move(snapshot);
+    m_HasPrevSample = true;
+
     spdlog::trace("StorageModel: sampled {} disks, total read: {:.2f} MB/s, write: {:.2f} MB/s",
-                  snapshot.disks.size(),
-                  snapshot.totalReadBytesPerSec / (1024.0 * 1024.0),
-                  snapshot.totalWriteBytesPerSec / (1024.0 * 1024.0));
+                  m_LatestSnapshot.disks.size(),
+                  m_LatestSnapshot.totalReadBytesPerSec / (1024.0 * 1024.0),
+                  m_LatestSnapshot.totalWriteBytesPerSec / (1024.0 * 1024.0));
+}
+
+DiskDeviceId StorageModel::acquireDevice(std::string_view name)
+{
+    if (const auto it = m_DeviceIds.find(name); it != m_DeviceIds.end())
+    {
+        Device& device = m_Devices[it->second];
+        if (device.lifecycle == DeviceLifecycle::Departed)
+        {
+            // Re-plugged devices may restart their counters; rates resume from the next sample
+            device.state.hasPrev = false;
+            device.lifecycle = DeviceLifecycle::Live;
+        }
+        return it->second;
+    }
+
+    DiskDeviceId id = 0;
+    if (!m_FreeDevices.empty())
+    {
+        id = m_FreeDevices.back();
+        m_FreeDevices.pop_back();
+    }
+    else
+    {
+        id = static_cast<DiskDeviceId>(m_Devices.size());
+        m_Devices.emplace_back();
+    }
+
+    Device& device = m_Devices[id];
+    device.name.assign(name);
+    device.state = DiskState{};
+    device.lifecycle = DeviceLifecycle::Live;
+    m_DeviceIds.emplace(device.name, id);
+    spdlog::debug("StorageModel: tracking device {} as slot {}", device.name, id);
+    return id;
+}
+
+void StorageModel::appendDeviceSample(Device& device, const DiskSnapshot* snap)
+{
+    // Departed devices record zeros so every column stays aligned with the timestamps
+    std::array<double, DISK_METRIC_COUNT> values{};
+    if (snap != nullptr)
+    {
+        values = {snap->readBytesPerSec,
+                  snap->writeBytesPerSec,
+                  snap->readOpsPerSec,
+                  snap->writeOpsPerSec,
+                  snap->utilizationPercent,
+                  snap->avgQueueSize,
+                  snap->avgReadTimeMs,
+                  snap->avgWriteTimeMs};
+    }
+    for (std::size_t i = 0; i < DISK_METRIC_COUNT; ++i)
+    {
+        device.columns[i].push(static_cast<float>(values[i]));
+    }
 }
 
-DiskSnapshot StorageModel::computeDiskSnapshot(const Platform::DiskCounters& current, DiskState& state)
+void StorageModel::retireDepartedDevices(double cutoff)
+{
+    for (std::size_t id = 0; id < m_Devices.size(); ++id)
+    {
+        Device& device = m_Devices[id];
+        if (device.lifecycle != DeviceLifecycle::Departed || device.lastSeenSeconds >= cutoff)
+        {
+            continue;
+        }
+
+        spdlog::debug("StorageModel: releasing history for departed device {}", device.name);
+        (void) m_DeviceIds.erase(device.name);
+        for (auto& column : device.columns)
+        {
+            column.release();
+        }
+        device.name.clear();
+        device.state = DiskState{};
+        device.lifecycle = DeviceLifecycle::Free;
+        m_FreeDevices.push_back(static_cast<DiskDeviceId>(id));
+    }
+}
+
+DiskSnapshot StorageModel::computeDiskSnapshot(const Platform::DiskCounters& current, const DiskState& state, double nowSeconds)
 {
     DiskSnapshot snap;
     snap.deviceName = current.deviceName;
     snap.isPhysicalDevice = current.isPhysicalDevice;
+    snap.ioInFlight = current.ioInFlight;
+    snap.hasDiscardStats = current.hasDiscardStats;
+    snap.hasFlushStats = current.hasFlushStats;
 
     // Set cumulative totals
     snap.totalReadBytes = current.readSectors * current.sectorSize;
@@ -106,55 +261,126 @@ DiskSnapshot StorageModel::computeDiskSnapshot(const Platform::DiskCounters& cur
         return snap;
     }
 
-    // Compute deltas
-    const auto deltaTime = std::chrono::steady_clock::now() - state.prevTime;
-    const double deltaSeconds = std::chrono::duration<double>(deltaTime).count();
-
+    const double deltaSeconds = nowSeconds - state.prevSeconds;
     if (deltaSeconds <= 0.0)
     {
         return snap;
     }
 
-    const uint64_t deltaReadSectors =
-        (current.readSectors >= state.prevCounters.readSectors) ? (current.readSectors - state.prevCounters.readSectors) : 0;
+    const Platform::DiskCounters& prev = state.prevCounters;
 
-    const uint64_t deltaWriteSectors =
-        (current.writeSectors >= state.prevCounters.writeSectors) ? (current.writeSectors - state.prevCounters.writeSectors) : 0;
+    // Counters that went backwards (device re-created under the same name) contribute zero
+    auto delta = [](std::uint64_t curr, std::uint64_t before) -> std::uint64_t
+    {
+        return curr >= before ? curr - before : 0;
+    };
+    auto toDouble = [](std::uint64_t value)
+    {
+        return static_cast<double>(value);
+    };
+    // Per-request average of a counter delta; 0 when no request completed
+    auto perOp = [&toDouble](std::uint64_t total, std::uint64_t ops)
+    {
+        return ops > 0 ? toDouble(total) / toDouble(ops) : 0.0;
+    };
+
+    const uint64_t deltaReadSectors = delta(current.readSectors, prev.readSectors);
+    const uint64_t deltaWriteSectors = delta(current.writeSectors, prev.writeSectors);
+    const uint64_t deltaReadOps = delta(current.readsCompleted, prev.readsCompleted);
+    const uint64_t deltaWriteOps = delta(current.writesCompleted, prev.writesCompleted);
+    const uint64_t deltaIoTime = delta(current.ioTimeMs, prev.ioTimeMs);
+    const double deltaMs = deltaSeconds * 1000.0;
+
+    // Compute rates
+    snap.readBytesPerSec = toDouble(deltaReadSectors * current.sectorSize) / deltaSeconds;
+    snap.writeBytesPerSec = toDouble(deltaWriteSectors * current.sectorSize) / deltaSeconds;
+    snap.readOpsPerSec = toDouble(deltaReadOps) / deltaSeconds;
+    snap.writeOpsPerSec = toDouble(deltaWriteOps) / deltaSeconds;
+    snap.readMergesPerSec = toDouble(delta(current.readsMerged, prev.readsMerged)) / deltaSeconds;
+    snap.writeMergesPerSec = toDouble(delta(current.writesMerged, prev.writesMerged)) / deltaSeconds;
+
+    // Latency and request size, as iostat -x computes them
+    snap.avgReadTimeMs = perOp(delta(current.readTimeMs, prev.readTimeMs), deltaReadOps);
+    snap.avgWriteTimeMs = perOp(delta(current.writeTimeMs, prev.writeTimeMs), deltaWriteOps);
+    snap.avgReadRequestBytes = perOp(deltaReadSectors * current.sectorSize, deltaReadOps);
+    snap.avgWriteRequestBytes = perOp(deltaWriteSectors * current.sectorSize, deltaWriteOps);
+
+    // Queue depth: the weighted counter grows by (requests in flight) per elapsed millisecond
+    snap.avgQueueSize = toDouble(delta(current.weightedIoTimeMs, prev.weightedIoTimeMs)) / deltaMs;
+
+    // Compute utilization (percentage of time the device was busy)
+    snap.utilizationPercent = (toDouble(deltaIoTime) / deltaMs) * 100.0;
+    snap.utilizationPercent = std::clamp(snap.utilizationPercent, 0.0, 100.0);
 
-    const uint64_t deltaReadOps =
-        (current.readsCompleted >= state.prevCounters.readsCompleted) ? (current.readsCompleted - state.prevCounters.readsCompleted) : 0;
+    if (current.hasDiscardStats && prev.hasDiscardStats)
+    {
+        const uint64_t deltaDiscardOps = delta(current.discardsCompleted, prev.discardsCompleted);
+        snap.discardOpsPerSec = toDouble(deltaDiscardOps) / deltaSeconds;
+        snap.discardBytesPerSec = toDouble(delta(current.discardSectors, prev.discardSectors) * current.sectorSize) / deltaSeconds;
+        snap.avgDiscardTimeMs = perOp(delta(current.discardTimeMs, prev.discardTimeMs), deltaDiscardOps);
+    }
+    if (current.hasFlushStats && prev.hasFlushStats)
+    {
+        const uint64_t deltaFlushOps = delta(current.flushesCompleted, prev.flushesCompleted);
+        snap.flushOpsPerSec = toDouble(deltaFlushOps) / deltaSeconds;
+        snap.avgFlushTimeMs = perOp(delta(current.flushTimeMs, prev.flushTimeMs), deltaFlushOps);
+    }
 
-    const uint64_t deltaWriteOps = (current.writesCompleted >= state.prevCounters.writesCompleted)
-                                     ? (current.writesCompleted - state.prevCounters.writesCompleted)
-                                     : 0;
+    return snap;
+}
 
-    const uint64_t deltaReadTime =
-        (current.readTimeMs >= state.prevCounters.readTimeMs) ? (current.readTimeMs - state.prevCounters.readTimeMs) : 0;
+MountSnapshot
+StorageModel::computeMountSnapshot(const Platform::MountCounters& current, MountState& state, double nowSeconds, double cutoff)
+{
+    MountSnapshot snap;
+    snap.mountPoint = current.mountPoint;
+    snap.fsType = current.fsType;
+    snap.deviceName = current.deviceName;
+    snap.diskName = current.diskName;
+    snap.readOnly = current.readOnly;
+    snap.hasCapacity = current.hasCapacity;
+    if (!current.hasCapacity)
+    {
+        return snap;
+    }
 
-    const uint64_t deltaWriteTime =
-        (current.writeTimeMs >= state.prevCounters.writeTimeMs) ? (current.writeTimeMs - state.prevCounters.writeTimeMs) : 0;
+    const uint64_t usedBytes = current.totalBytes >= current.freeBytes ? current.totalBytes - current.freeBytes : 0;
+    snap.totalBytes = current.totalBytes;
+    snap.usedBytes = usedBytes;
+    snap.availBytes = current.availBytes;
 
-    const uint64_t deltaIoTime = (current.ioTimeMs >= state.prevCounters.ioTimeMs) ? (current.ioTimeMs - state.prevCounters.ioTimeMs) : 0;
+    // Root-reserved blocks count as neither used nor available, which is how df computes Use%
+    const uint64_t usable = usedBytes + current.availBytes;
+    snap.usedPercent = usable > 0 ? static_cast<double>(usedBytes) * 100.0 / static_cast<double>(usable) : 0.0;
 
-    // Compute rates
-    snap.readBytesPerSec = static_cast<double>(deltaReadSectors * current.sectorSize) / deltaSeconds;
-    snap.writeBytesPerSec = static_cast<double>(deltaWriteSectors * current.sectorSize) / deltaSeconds;
-    snap.readOpsPerSec = static_cast<double>(deltaReadOps) / deltaSeconds;
-    snap.writeOpsPerSec = static_cast<double>(deltaWriteOps) / deltaSeconds;
+    snap.totalInodes = current.totalInodes;
+    snap.usedInodes = current.totalInodes >= current.freeInodes ? current.totalInodes - current.freeInodes : 0;
+    snap.inodeUsedPercent =
+        current.totalInodes > 0 ? static_cast<double>(snap.usedInodes) * 100.0 / static_cast<double>(current.totalInodes) : 0.0;
 
-    // Compute average I/O times
-    if (deltaReadOps > 0)
+    // Only fresh readings enter the trend; repeating a cached value would flatten the slope
+    if (current.capacitySequence != state.lastSequence)
     {
-        snap.avgReadTimeMs = static_cast<double>(deltaReadTime) / static_cast<double>(deltaReadOps);
+        state.sampleTimes.push(nowSeconds);
+        state.usedBytes.push(static_cast<double>(usedBytes));
+        state.lastSequence = current.capacitySequence;
     }
-    if (deltaWriteOps > 0)
+
+    // Keep the newest reading even when it is older than the window, so a trend can restart from it
+    std::size_t expired = 0;
+    const auto times = state.sampleTimes.view();
+    while (expired + 1 < times.size() && times[expired] < cutoff)
     {
-        snap.avgWriteTimeMs = static_cast<double>(deltaWriteTime) / static_cast<double>(deltaWriteOps);
+        ++expired;
     }
+    state.sampleTimes.dropFront(expired);
+    state.usedBytes.dropFront(expired);
 
-    // Compute utilization (percentage of time the device was busy)
-    snap.utilizationPercent = (static_cast<double>(deltaIoTime) / (deltaSeconds * 1000.0)) * 100.0;
-    snap.utilizationPercent = std::clamp(snap.utilizationPercent, 0.0, 100.0);
+    snap.fillBytesPerSec = leastSquaresSlope(state.sampleTimes.view(), state.usedBytes.view());
+    if (snap.fillBytesPerSec > 0.0)
+    {
+        snap.secondsToFull = static_cast<double>(current.availBytes) / snap.fillBytesPerSec;
+    }
 
     return snap;
 }
@@ -162,11 +388,25 @@ DiskSnapshot StorageModel::computeDiskSnapshot(const Platform::DiskCounters& cur
 void StorageModel::trimHistory(double nowSeconds)
 {
     const double cutoff = nowSeconds - m_MaxHistorySeconds;
-    while (!m_Timestamps.empty() && (m_Timestamps.front() < cutoff))
+    const auto timestamps = m_Timestamps.view();
+    const auto expired = static_cast<std::size_t>(std::ranges::find_if(timestamps, [cutoff](double t) { return t >= cutoff; }) -
+                                                  timestamps.begin());
+
+    m_Timestamps.dropFront(expired);
+    m_TotalReadHistory.dropFront(expired);
+    m_TotalWriteHistory.dropFront(expired);
+
+    // Device columns end at the newest row but may start later than the timestamps
+    const std::size_t rows = m_Timestamps.size();
+    for (auto& device : m_Devices)
     {
-        m_Timestamps.pop_front();
-        m_History.pop_front();
+        for (auto& column : device.columns)
+        {
+            column.keepNewest(rows);
+        }
     }
+
+    retireDepartedDevices(cutoff);
 }
 
 StorageSnapshot StorageModel::latestSnapshot() const
@@ -175,40 +415,36 @@ StorageSnapshot StorageModel::latestSnapshot() const
     return m_LatestSnapshot;
 }
 
-std::vector<StorageSnapshot> StorageModel::history() const
+StorageModel::HistoryView StorageModel::historyView() const
 {
-    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
-    return std::vector<StorageSnapshot>(m_History.begin(), m_History.end());
+    return HistoryView(*this);
 }
 
 std::vector<double> StorageModel::totalReadHistory() const
 {
     std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
-    std::vector<double> out;
-    out.reserve(m_History.size());
-    for (const auto& snap : m_History)
-    {
-        out.push_back(snap.totalReadBytesPerSec);
-    }
-    return out;
+    const auto view = m_TotalReadHistory.view();
+    return {view.begin(), view.end()};
 }
 
 std::vector<double> StorageModel::totalWriteHistory() const
 {
     std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
-    std::vector<double> out;
-    out.reserve(m_History.size());
-    for (const auto& snap : m_History)
-    {
-        out.push_back(snap.totalWriteBytesPerSec);
-    }
-    return out;
+    const auto view = m_TotalWriteHistory.view();
+    return {view.begin(), view.end()};
 }
 
 std::vector<double> StorageModel::historyTimestamps() const
 {
     std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
-    return std::vector<double>(m_Timestamps.begin(), m_Timestamps.end());
+    const auto view = m_Timestamps.view();
+    return {view.begin(), view.end()};
+}
+
+std::size_t StorageModel::trackedDeviceCount() const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    return m_DeviceIds.size();
 }
 
 void StorageModel::setMaxHistorySeconds(double seconds)
@@ -226,4 +462,62 @@ Platform::DiskCapabilities StorageModel::capabilities() const
     return Platform::DiskCapabilities{};
 }
 
+// =============================================================================
+// HistoryView
+// =============================================================================
+
+StorageModel::HistoryView::HistoryView(const StorageModel& model) : m_Lock(model.m_Mutex), m_Model(&model)
+{
+}
+
+std::span<const double> StorageModel::HistoryView::timestamps() const noexcept
+{
+    return m_Model->m_Timestamps.view();
+}
+
+std::span<const double> StorageModel::HistoryView::totalReadBytesPerSec() const noexcept
+{
+    return m_Model->m_TotalReadHistory.view();
+}
+
+std::span<const double> StorageModel::HistoryView::totalWriteBytesPerSec() const noexcept
+{
+    return m_Model->m_TotalWriteHistory.view();
+}
+
+std::optional<DiskDeviceId> StorageModel::HistoryView::findDevice(std::string_view name) const
+{
+    if (const auto it = m_Model->m_DeviceIds.find(name); it != m_Model->m_DeviceIds.end())
+    {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+std::span<const float> StorageModel::HistoryView::series(DiskDeviceId id, DiskMetric metric) const noexcept
+{
+    if (id >= m_Model->m_Devices.size() || metric >= DiskMetric::Count)
+    {
+        return {};
+    }
+    const Device& device = m_Model->m_Devices[id];
+    if (device.lifecycle == DeviceLifecycle::Free)
+    {
+        return {};
+    }
+    return device.columns[static_cast<std::size_t>(metric)].view();
+}
+
+std::span<const double> StorageModel::HistoryView::mountSampleTimes(std::string_view mountPoint) const
+{
+    const auto it = m_Model->m_Mounts.find(mountPoint);
+    return it != m_Model->m_Mounts.end() ? it->second.sampleTimes.view() : std::span<const double>{};
+}
+
+std::span<const double> StorageModel::HistoryView::mountUsedBytes(std::string_view mountPoint) const
+{
+    const auto it = m_Model->m_Mounts.find(mountPoint);
+    return it != m_Model->m_Mounts.end() ? it->second.usedBytes.view() : std::span<const double>{};
+}
+
 } // namespace Domain
@@ -1,13 +1,20 @@
 #pragma once
 
+#include "Domain/History.h"
 #include "Domain/StorageSnapshot.h"
 #include "Platform/IDiskProbe.h"
 
+#include <array>
 #include <chrono>
-#include <deque>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <shared_mutex>
+#include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -16,9 +23,48 @@ namespace Domain
 
 /// Manages disk/storage metrics: samples probe, computes rates, maintains history.
 /// Thread-safe (allows background sampling + UI reads).
+///
+/// History is columnar: one SpanHistory per system total and one per (device, metric),
+/// all aligned at their newest end with historyTimestamps(). Device names are interned
+/// into DiskDeviceId slots on first sight. A device missing from a sample is Departed:
+/// it keeps recording zeros until its last real sample ages out of the window, then its
+/// columns are freed and the slot is reused by the next new device.
+///
+/// Mounted filesystems keep their own short history of used bytes, appended only when
+/// the probe reports a fresh capacity reading; the fill rate is the least-squares slope
+/// of that history, and the time-to-full projection extrapolates it to the free space.
 class StorageModel
 {
   public:
+    /// Read-only access to the history columns without copying.
+    /// Holds a shared lock on the model for its lifetime, so keep it scoped to one
+    /// render pass; the sampler blocks while a view is alive.
+    class HistoryView
+    {
+      public:
+        [[nodiscard]] std::span<const double> timestamps() const noexcept;
+        [[nodiscard]] std::span<const double> totalReadBytesPerSec() const noexcept;
+        [[nodiscard]] std::span<const double> totalWriteBytesPerSec() const noexcept;
+
+        /// Look up a tracked device by name.
+        [[nodiscard]] std::optional<DiskDeviceId> findDevice(std::string_view name) const;
+
+        /// History of one metric for @p id, oldest first. Empty if the id is not tracked.
+        [[nodiscard]] std::span<const float> series(DiskDeviceId id, DiskMetric metric) const noexcept;
+
+        /// Capacity readings for a mount: when each was taken and the used bytes at that time.
+        /// Both spans have the same length; empty if the mount is not known.
+        [[nodiscard]] std::span<const double> mountSampleTimes(std::string_view mountPoint) const;
+        [[nodiscard]] std::span<const double> mountUsedBytes(std::string_view mountPoint) const;
+
+      private:
+        friend class StorageModel;
+        explicit HistoryView(const StorageModel& model);
+
+        std::shared_lock<std::shared_mutex> m_Lock;
+        const StorageModel* m_Model;
+    };
+
     explicit StorageModel(std::unique_ptr<Platform::IDiskProbe> probe);
     ~StorageModel() = default;
 
@@ -30,18 +76,24 @@ class StorageModel
     /// Sample the probe and compute new snapshot (call from background thread).
     void sample();
 
+    /// Compute a new snapshot from externally-provided counters taken at @p nowSeconds
+    /// (steady-clock seconds, as used for historyTimestamps()). sample() delegates here.
+    void updateFromCounters(const Platform::SystemDiskCounters& counters, double nowSeconds);
+
     /// Get the latest snapshot (thread-safe, called from UI thread).
     [[nodiscard]] StorageSnapshot latestSnapshot() const;
 
-    /// Get historical snapshots for graphing (thread-safe).
-    /// Returns snapshots in chronological order (oldest first).
-    [[nodiscard]] std::vector<StorageSnapshot> history() const;
+    /// Lock the history for zero-copy reads (see HistoryView).
+    [[nodiscard]] HistoryView historyView() const;
 
-    // System-level history helpers (aligned to timestamps)
+    // System-level history helpers (aligned to timestamps); these copy, prefer historyView()
     [[nodiscard]] std::vector<double> totalReadHistory() const;
     [[nodiscard]] std::vector<double> totalWriteHistory() const;
     [[nodiscard]] std::vector<double> historyTimestamps() const;
 
+    /// Number of devices currently holding a slot (live or departed).
+    [[nodiscard]] std::size_t trackedDeviceCount() const;
+
     /// Configure history retention.
     void setMaxHistorySeconds(double seconds);
 
@@ -49,27 +101,74 @@ class StorageModel
     [[nodiscard]] Platform::DiskCapabilities capabilities() const;
 
   private:
+    static constexpr std::size_t DISK_METRIC_COUNT = static_cast<std::size_t>(DiskMetric::Count);
+
+    enum class DeviceLifecycle : std::uint8_t
+    {
+        Free,     // Slot unused, columns released
+        Live,     // Reported by the latest sample
+        Departed, // Missing from the latest sample; history kept until it ages out
+    };
+
     struct DiskState
     {
-        std::string deviceName;
         Platform::DiskCounters prevCounters;
-        std::chrono::steady_clock::time_point prevTime;
+        double prevSeconds = 0.0;
         bool hasPrev = false;
     };
 
-    static DiskSnapshot computeDiskSnapshot(const Platform::DiskCounters& current, DiskState& state);
+    struct Device
+    {
+        std::string name;
+        DiskState state;
+        std::array<SpanHistory<float>, DISK_METRIC_COUNT> columns;
+        double lastSeenSeconds = 0.0;
+        std::uint64_t lastSeenGeneration = 0;
+        DeviceLifecycle lifecycle = DeviceLifecycle::Free;
+    };
+
+    struct MountState
+    {
+        SpanHistory<double> sampleTimes; // nowSeconds of each fresh capacity reading
+        SpanHistory<double> usedBytes;
+        std::uint64_t lastSequence = 0; // MountCounters::capacitySequence of the newest reading
+        std::uint64_t lastSeenGeneration = 0;
+    };
+
+    // Lets the name map be probed with a string_view without building a std::string
+    struct NameHash
+    {
+        using is_transparent = void;
+        [[nodiscard]] std::size_t operator()(std::string_view name) const noexcept
+        {
+            return std::hash<std::string_view>{}(name);
+        }
+    };
+
+    static DiskSnapshot computeDiskSnapshot(const Platform::DiskCounters& current, const DiskState& state, double nowSeconds);
+    static MountSnapshot computeMountSnapshot(const Platform::MountCounters& current, MountState& state, double nowSeconds, double cutoff);
+    [[nodiscard]] DiskDeviceId acquireDevice(std::string_view name);
+    void appendDeviceSample(Device& device, const DiskSnapshot* snap);
+    void retireDepartedDevices(double cutoff);
     void trimHistory(double nowSeconds);
 
     std::unique_ptr<Platform::IDiskProbe> m_Probe;
 
     mutable std::shared_mutex m_Mutex;
     StorageSnapshot m_LatestSnapshot;
-    std::deque<StorageSnapshot> m_History;
-    std::deque<double> m_Timestamps; // Seconds since start
+    SpanHistory<double> m_Timestamps; // Steady-clock seconds
+    SpanHistory<double> m_TotalReadHistory;
+    SpanHistory<double> m_TotalWriteHistory;
+
+    // Device slots, indexed by DiskDeviceId
+    std::vector<Device> m_Devices;
+    std::vector<DiskDeviceId> m_FreeDevices;
+    std::unordered_map<std::string, DiskDeviceId, NameHash, std::equal_to<>> m_DeviceIds;
+    std::uint64_t m_Generation = 0;
+
+    // Mounted filesystems, keyed by mount point; dropped as soon as they are unmounted
+    std::unordered_map<std::string, MountState, NameHash, std::equal_to<>> m_Mounts;
 
-    // Per-device state for delta calculations
-    std::unordered_map<std::string, DiskState> m_DiskStates;
-    std::chrono::steady_clock::time_point m_PrevSampleTime;
     std::chrono::steady_clock::time_point m_StartTime;
     bool m_HasPrevSample = false;
 
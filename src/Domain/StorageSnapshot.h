@@ -7,11 +7,29 @@
 namespace Domain
 {
 
+/// Interned device handle issued by StorageModel; stable while the device stays tracked.
+using DiskDeviceId = std::uint32_t;
+
+/// Per-device metrics kept as history columns by StorageModel.
+enum class DiskMetric : std::uint8_t
+{
+    ReadBytesPerSec = 0,
+    WriteBytesPerSec,
+    ReadOpsPerSec,
+    WriteOpsPerSec,
+    UtilizationPercent,
+    QueueSize,
+    ReadAwaitMs,
+    WriteAwaitMs,
+    Count,
+};
+
 /// Computed disk I/O metrics for a single device (derived from counter deltas).
 /// Immutable snapshot for UI consumption.
 struct DiskSnapshot
 {
     std::string deviceName;
+    DiskDeviceId deviceId = 0; // Key for StorageModel::HistoryView::series()
 
     // Rates (per second)
     double readBytesPerSec = 0.0;
@@ -28,17 +46,59 @@ struct DiskSnapshot
     uint64_t totalReadOps = 0;
     uint64_t totalWriteOps = 0;
 
-    // Average I/O times (milliseconds)
+    // Average I/O times (milliseconds): iostat r_await / w_await, queueing included
     double avgReadTimeMs = 0.0;
     double avgWriteTimeMs = 0.0;
 
+    // iostat -x extended statistics over the last interval
+    double readMergesPerSec = 0.0;     // rrqm/s
+    double writeMergesPerSec = 0.0;    // wrqm/s
+    double avgReadRequestBytes = 0.0;  // rareq-sz
+    double avgWriteRequestBytes = 0.0; // wareq-sz
+    double avgQueueSize = 0.0;         // aqu-sz: mean requests queued or in service
+    std::uint64_t ioInFlight = 0;      // Requests in flight at sample time
+
+    // Discard (TRIM) and flush, when the kernel reports them
+    bool hasDiscardStats = false;
+    bool hasFlushStats = false;
+    double discardOpsPerSec = 0.0; // d/s
+    double discardBytesPerSec = 0.0;
+    double avgDiscardTimeMs = 0.0; // d_await
+    double flushOpsPerSec = 0.0;   // f/s
+    double avgFlushTimeMs = 0.0;   // f_await
+
     bool isPhysicalDevice = true;
 };
 
+/// Capacity and fill trend of one mounted filesystem.
+struct MountSnapshot
+{
+    std::string mountPoint;
+    std::string fsType;
+    std::string deviceName; // Block device backing the mount; empty if virtual
+    std::string diskName;   // Whole disk; matches DiskSnapshot::deviceName when that disk is listed
+
+    bool hasCapacity = false;
+    bool readOnly = false;
+    uint64_t totalBytes = 0;
+    uint64_t usedBytes = 0;
+    uint64_t availBytes = 0;  // Available to unprivileged users
+    double usedPercent = 0.0; // used / (used + avail), as df reports it
+    uint64_t totalInodes = 0; // 0 if the filesystem allocates inodes dynamically
+    uint64_t usedInodes = 0;
+    double inodeUsedPercent = 0.0;
+
+    // Least-squares slope of used bytes over the history window; negative while space is freed
+    double fillBytesPerSec = 0.0;
+    // Projected seconds until availBytes reaches zero at fillBytesPerSec; -1 when not filling
+    double secondsToFull = -1.0;
+};
+
 /// Aggregate storage metrics across all devices.
 struct StorageSnapshot
 {
     std::vector<DiskSnapshot> disks;
+    std::vector<MountSnapshot> mounts;
 
     // System-wide totals
     double totalReadBytesPerSec = 0.0;
@@ -50,6 +110,7 @@ struct StorageSnapshot
     bool hasDiskStats = false;
     bool hasReadWriteBytes = false;
     bool hasIoTime = false;
+    bool hasMountStats = false;
 };
 
 } // namespace Domain
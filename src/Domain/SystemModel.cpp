@@ -1,5 +1,6 @@
 #include "SystemModel.h"
 
+#include "CpuCoreUsage.h"
 #include "Numeric.h"
 #include "Platform/IPowerProbe.h"
 #include "Platform/ISystemProbe.h"
@@ -10,6 +11,7 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -24,6 +26,36 @@
 namespace Domain
 {
 
+namespace
+{
+
+/// Maps each cumulative activity counter to its KernelActivity rate field. The scale
+/// converts the counter's unit per second into the field's unit (KiB -> bytes, ns -> tasks).
+struct ActivityRateField
+{
+    Platform::ActivityCounter counter;
+    double KernelActivity::* rate;
+    double scale;
+};
+
+using Platform::ActivityCounter;
+constexpr std::array<ActivityRateField, Platform::ACTIVITY_COUNTER_COUNT> ACTIVITY_RATE_FIELDS = {{
+    {.counter = ActivityCounter::ContextSwitches, .rate = &KernelActivity::contextSwitchesPerSec, .scale = 1.0},
+    {.counter = ActivityCounter::ProcessesCreated, .rate = &KernelActivity::processesCreatedPerSec, .scale = 1.0},
+    {.counter = ActivityCounter::PageInKiB, .rate = &KernelActivity::pageInBytesPerSec, .scale = 1024.0},
+    {.counter = ActivityCounter::PageOutKiB, .rate = &KernelActivity::pageOutBytesPerSec, .scale = 1024.0},
+    {.counter = ActivityCounter::SwapInPages, .rate = &KernelActivity::swapInPagesPerSec, .scale = 1.0},
+    {.counter = ActivityCounter::SwapOutPages, .rate = &KernelActivity::swapOutPagesPerSec, .scale = 1.0},
+    {.counter = ActivityCounter::PageFaults, .rate = &KernelActivity::pageFaultsPerSec, .scale = 1.0},
+    {.counter = ActivityCounter::MajorFaults, .rate = &KernelActivity::majorFaultsPerSec, .scale = 1.0},
+    {.counter = ActivityCounter::OomKills, .rate = &KernelActivity::oomKillsPerSec, .scale = 1.0},
+    {.counter = ActivityCounter::NumaMigrations, .rate = &KernelActivity::numaMigrationsPerSec, .scale = 1.0},
+    {.counter = ActivityCounter::RunqueueWaitNs, .rate = &KernelActivity::runqueueWaitTasks, .scale = 1e-9},
+    {.counter = ActivityCounter::Timeslices, .rate = &KernelActivity::timeslicesPerSec, .scale = 1.0},
+}};
+
+} // namespace
+
 SystemModel::SystemModel(std::unique_ptr<Platform::ISystemProbe> probe, std::unique_ptr<Platform::IPowerProbe> powerProbe)
     : m_Probe(std::move(probe)), m_PowerProbe(std::move(powerProbe))
 {
@@ -75,21 +107,43 @@ void SystemModel::trimHistory(double nowSeconds)
     trimSamples(m_BatteryChargeHistory);
     trimSamples(m_NetRxHistory);
     trimSamples(m_NetTxHistory);
+    for (auto& psiHist : m_PressureSomeHistory)
+    {
+        trimSamples(psiHist);
+    }
+    for (auto& psiHist : m_PressureFullHistory)
+    {
+        trimSamples(psiHist);
+    }
+    for (auto& activityHist : m_ActivityHistory)
+    {
+        trimSamples(activityHist);
+    }
 
-    // Per-interface network history
-    for (auto& [name, hist] : m_PerInterfaceRxHistory)
+    for (auto& groupHist : m_NetGroupRxHistory)
     {
-        trimSamples(hist);
+        trimSamples(groupHist);
     }
-    for (auto& [name, hist] : m_PerInterfaceTxHistory)
+    for (auto& groupHist : m_NetGroupTxHistory)
     {
-        trimSamples(hist);
+        trimSamples(groupHist);
     }
 
     for (auto& coreHist : m_PerCoreHistory)
     {
         trimSamples(coreHist);
     }
+    for (auto& freqHist : m_PerCoreFreqHistory)
+    {
+        trimSamples(freqHist);
+    }
+    for (auto* perNode : {&m_NumaMemoryHistory, &m_NumaCpuHistory, &m_NumaLocalHistory})
+    {
+        for (auto& nodeHist : *perNode)
+        {
+            trimSamples(nodeHist);
+        }
+    }
 
     // Ensure all history buffers remain aligned by truncating to the smallest non-empty size.
     std::size_t minSize = std::numeric_limits<std::size_t>::max();
@@ -114,10 +168,41 @@ void SystemModel::trimHistory(double nowSeconds)
     updateMin(m_BatteryChargeHistory.size());
     updateMin(m_NetRxHistory.size());
     updateMin(m_NetTxHistory.size());
+    for (const auto& psiHist : m_PressureSomeHistory)
+    {
+        updateMin(psiHist.size());
+    }
+    for (const auto& psiHist : m_PressureFullHistory)
+    {
+        updateMin(psiHist.size());
+    }
+    for (const auto& activityHist : m_ActivityHistory)
+    {
+        updateMin(activityHist.size());
+    }
+    for (const auto& groupHist : m_NetGroupRxHistory)
+    {
+        updateMin(groupHist.size());
+    }
+    for (const auto& groupHist : m_NetGroupTxHistory)
+    {
+        updateMin(groupHist.size());
+    }
     for (const auto& coreHist : m_PerCoreHistory)
     {
         updateMin(coreHist.size());
     }
+    for (const auto& freqHist : m_PerCoreFreqHistory)
+    {
+        updateMin(freqHist.size());
+    }
+    for (const auto* perNode : {&m_NumaMemoryHistory, &m_NumaCpuHistory, &m_NumaLocalHistory})
+    {
+        for (const auto& nodeHist : *perNode)
+        {
+            updateMin(nodeHist.size());
+        }
+    }
 
     if (minSize != std::numeric_limits<std::size_t>::max())
     {
@@ -142,11 +227,45 @@ void SystemModel::trimHistory(double nowSeconds)
         trimToMin(m_BatteryChargeHistory);
         trimToMin(m_NetRxHistory);
         trimToMin(m_NetTxHistory);
+        for (auto& psiHist : m_PressureSomeHistory)
+        {
+            trimToMin(psiHist);
+        }
+        for (auto& psiHist : m_PressureFullHistory)
+        {
+            trimToMin(psiHist);
+        }
+        for (auto& activityHist : m_ActivityHistory)
+        {
+            trimToMin(activityHist);
+        }
+        for (auto& groupHist : m_NetGroupRxHistory)
+        {
+            trimToMin(groupHist);
+        }
+        for (auto& groupHist : m_NetGroupTxHistory)
+        {
+            trimToMin(groupHist);
+        }
         for (auto& coreHist : m_PerCoreHistory)
         {
             trimToMin(coreHist);
         }
+        for (auto& freqHist : m_PerCoreFreqHistory)
+        {
+            trimToMin(freqHist);
+        }
+        for (auto* perNode : {&m_NumaMemoryHistory, &m_NumaCpuHistory, &m_NumaLocalHistory})
+        {
+            for (auto& nodeHist : *perNode)
+            {
+                trimToMin(nodeHist);
+            }
+        }
     }
+
+    // Per-interface rings are trimmed implicitly: keep at most one sample per timestamp
+    m_InterfaceHistory.clampSamples(m_Timestamps.size());
 }
 
 void SystemModel::setMaxHistorySeconds(double seconds)
@@ -172,17 +291,36 @@ void SystemModel::refresh()
     // Also read power data if probe is available (outside mutex - it's I/O)
     if (m_PowerProbe)
     {
-        auto powerCounters = m_PowerProbe->read();
-        auto powerStatus = computePowerStatus(powerCounters);
-
-        // Only lock to update the snapshot
-        std::unique_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
-        m_Snapshot.power = powerStatus;
+        refreshPower();
     }
 
     updateFromCounters(counters);
 }
 
+bool SystemModel::pollPowerChange()
+{
+    if (!m_PowerProbe || !m_PowerProbe->pollChanged())
+    {
+        return false;
+    }
+
+    spdlog::debug("SystemModel: power supply changed, refreshing power status");
+    refreshPower();
+    return true;
+}
+
+void SystemModel::refreshPower()
+{
+    // Supplies can come and go (battery hotplug), so capabilities follow the probe's last scan
+    const auto powerCounters = m_PowerProbe->read();
+    const auto powerCapabilities = m_PowerProbe->capabilities();
+
+    // Probe reads stay outside the lock; capabilities and the status derived from them change together
+    std::unique_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    m_PowerCapabilities = powerCapabilities;
+    m_Snapshot.power = computePowerStatus(powerCounters);
+}
+
 void SystemModel::updateFromCounters(const Platform::SystemCounters& counters)
 {
     const double nowSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
@@ -270,24 +408,42 @@ std::vector<float> SystemModel::netTxHistory() const
 
 std::vector<float> SystemModel::netRxHistoryForInterface(const std::string& interfaceName) const
 {
-    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
-    const auto it = m_PerInterfaceRxHistory.find(interfaceName);
-    if (it != m_PerInterfaceRxHistory.end())
-    {
-        return std::vector<float>(it->second.begin(), it->second.end());
-    }
-    return {};
+    std::vector<float> out;
+    netRxHistoryForInterface(interfaceName, out);
+    return out;
 }
 
 std::vector<float> SystemModel::netTxHistoryForInterface(const std::string& interfaceName) const
+{
+    std::vector<float> out;
+    netTxHistoryForInterface(interfaceName, out);
+    return out;
+}
+
+void SystemModel::netRxHistoryForInterface(const std::string& interfaceName, std::vector<float>& out) const
 {
     std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
-    const auto it = m_PerInterfaceTxHistory.find(interfaceName);
-    if (it != m_PerInterfaceTxHistory.end())
-    {
-        return std::vector<float>(it->second.begin(), it->second.end());
-    }
-    return {};
+    m_InterfaceHistory.copyRxHistory(interfaceName, out);
+}
+
+void SystemModel::netTxHistoryForInterface(const std::string& interfaceName, std::vector<float>& out) const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    m_InterfaceHistory.copyTxHistory(interfaceName, out);
+}
+
+std::vector<float> SystemModel::netRxHistoryForGroup(InterfaceGroup group) const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    const auto& hist = m_NetGroupRxHistory[static_cast<std::size_t>(group)];
+    return std::vector<float>(hist.begin(), hist.end());
+}
+
+std::vector<float> SystemModel::netTxHistoryForGroup(InterfaceGroup group) const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    const auto& hist = m_NetGroupTxHistory[static_cast<std::size_t>(group)];
+    return std::vector<float>(hist.begin(), hist.end());
 }
 
 std::vector<float> SystemModel::memoryCachedHistory() const
@@ -316,6 +472,77 @@ std::vector<std::vector<float>> SystemModel::perCoreHistory() const
     return result;
 }
 
+std::vector<std::vector<float>> SystemModel::perCoreFreqHistory() const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    std::vector<std::vector<float>> result;
+    result.reserve(m_PerCoreFreqHistory.size());
+
+    for (const auto& freqHist : m_PerCoreFreqHistory)
+    {
+        result.emplace_back(freqHist.begin(), freqHist.end());
+    }
+
+    return result;
+}
+
+std::vector<float> SystemModel::pressureSomeHistory(Platform::PressureResource resource) const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    const auto& hist = m_PressureSomeHistory[static_cast<std::size_t>(resource)];
+    return std::vector<float>(hist.begin(), hist.end());
+}
+
+std::vector<float> SystemModel::pressureFullHistory(Platform::PressureResource resource) const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    const auto& hist = m_PressureFullHistory[static_cast<std::size_t>(resource)];
+    return std::vector<float>(hist.begin(), hist.end());
+}
+
+std::vector<float> SystemModel::activityHistory(Platform::ActivityCounter counter) const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    const auto& hist = m_ActivityHistory[static_cast<std::size_t>(counter)];
+    return std::vector<float>(hist.begin(), hist.end());
+}
+
+std::vector<std::vector<float>> SystemModel::numaMemoryHistory() const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    std::vector<std::vector<float>> result;
+    result.reserve(m_NumaMemoryHistory.size());
+    for (const auto& nodeHist : m_NumaMemoryHistory)
+    {
+        result.emplace_back(nodeHist.begin(), nodeHist.end());
+    }
+    return result;
+}
+
+std::vector<std::vector<float>> SystemModel::numaCpuHistory() const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    std::vector<std::vector<float>> result;
+    result.reserve(m_NumaCpuHistory.size());
+    for (const auto& nodeHist : m_NumaCpuHistory)
+    {
+        result.emplace_back(nodeHist.begin(), nodeHist.end());
+    }
+    return result;
+}
+
+std::vector<std::vector<float>> SystemModel::numaLocalHistory() const
+{
+    std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
+    std::vector<std::vector<float>> result;
+    result.reserve(m_NumaLocalHistory.size());
+    for (const auto& nodeHist : m_NumaLocalHistory)
+    {
+        result.emplace_back(nodeHist.begin(), nodeHist.end());
+    }
+    return result;
+}
+
 std::vector<double> SystemModel::timestamps() const
 {
     std::shared_lock lock(m_Mutex); // NOLINT(misc-const-correctness) - lock guard pattern
@@ -377,36 +604,24 @@ void SystemModel::computeSnapshot(const Platform::SystemCounters& counters, doub
     snap.loadAvg15 = counters.loadAvg15;
     snap.cpuFreqMHz = counters.cpuFreqMHz;
 
-    // Per-interface network - always populate metadata, compute rates only with previous data
+    // Per-interface network - always populate metadata, compute rates only with previous data.
+    // Rings must hold the sample about to be appended alongside the retained window.
     const double timeDelta = m_HasPrevious ? (nowSeconds - m_PrevTimestamp) : 0.0;
-    for (const auto& iface : counters.networkInterfaces)
-    {
-        SystemSnapshot::InterfaceSnapshot ifaceSnap;
-        ifaceSnap.name = iface.name;
-        ifaceSnap.displayName = iface.displayName;
-        ifaceSnap.isUp = iface.isUp;
-        ifaceSnap.linkSpeedMbps = iface.linkSpeedMbps;
+    m_InterfaceHistory.reserveSamples(m_Timestamps.size() + 1);
+    m_InterfaceHistory.update(counters.networkInterfaces, timeDelta, m_HasPrevious, snap);
 
-        // Compute rates only if we have previous data and positive time delta
-        if (m_HasPrevious && timeDelta > 0.0)
-        {
-            const auto* prevIface = findPreviousInterface(iface.name);
-            if (prevIface != nullptr)
-            {
-                if (iface.rxBytes >= prevIface->rxBytes)
-                {
-                    const uint64_t rxDelta = iface.rxBytes - prevIface->rxBytes;
-                    ifaceSnap.rxBytesPerSec = Numeric::toDouble(rxDelta) / timeDelta;
-                }
-                if (iface.txBytes >= prevIface->txBytes)
-                {
-                    const uint64_t txDelta = iface.txBytes - prevIface->txBytes;
-                    ifaceSnap.txBytesPerSec = Numeric::toDouble(txDelta) / timeDelta;
-                }
-            }
-        }
+    // Scheduler/paging activity (gauges now, rates once a previous sample exists)
+    snap.activity = computeKernelActivity(counters.activity, m_PrevCounters.activity, timeDelta);
+
+    m_CoreCounters.assign(counters.cpuPerCore, counters.cpuPerCoreIds);
 
-        snap.networkInterfaces.push_back(std::move(ifaceSnap));
+    // Per-core frequency, mapped into the same logical-CPU-id slots (0 = unknown/offline)
+    snap.cpuPerCoreFreqMHz.assign(m_CoreCounters.size(), 0);
+    const bool haveCoreIds = (counters.cpuPerCoreIds.size() == counters.cpuPerCore.size());
+    for (std::size_t i = 0; i < counters.cpuPerCoreFreqMHz.size() && i < counters.cpuPerCore.size(); ++i)
+    {
+        const std::size_t slot = haveCoreIds ? counters.cpuPerCoreIds[i] : i;
+        snap.cpuPerCoreFreqMHz[slot] = counters.cpuPerCoreFreqMHz[i];
     }
 
     // CPU usage (requires previous sample for delta)
@@ -415,21 +630,41 @@ void SystemModel::computeSnapshot(const Platform::SystemCounters& counters, doub
         // Total CPU
         snap.cpuTotal = computeCpuUsage(counters.cpuTotal, m_PrevCounters.cpuTotal);
 
-        // Per-core CPU
-        const std::size_t numCores = std::min(counters.cpuPerCore.size(), m_PrevCounters.cpuPerCore.size());
-        snap.cpuPerCore.reserve(numCores);
-
-        // Resize per-core history if needed
-        if (m_PerCoreHistory.size() < numCores)
+        // Per-core CPU: one vectorized pass over all cores (SoA counters keyed by
+        // logical CPU id, so hotplug never shifts other cores)
+        CpuCoreUsage::compute(m_CoreCounters, m_PrevCoreCounters, m_CoreUsage);
+        CpuCoreUsage::toCpuUsage(m_CoreUsage, snap.cpuPerCore);
+        snap.cpuCoreOnline = m_CoreUsage.online;
+        const std::size_t numCores = m_CoreUsage.size();
+
+        // A CPU id seen for the first time gets histories backfilled with zeros so every
+        // per-core history stays aligned with m_Timestamps.
+        const std::size_t existingSamples = m_Timestamps.size();
+        for (auto* perCore : {&m_PerCoreHistory, &m_PerCoreFreqHistory})
         {
-            m_PerCoreHistory.resize(numCores);
+            if (perCore->size() < numCores)
+            {
+                const std::size_t firstNew = perCore->size();
+                perCore->resize(numCores);
+                for (std::size_t i = firstNew; i < numCores; ++i)
+                {
+                    (*perCore)[i].assign(existingSamples, 0.0F);
+                }
+            }
         }
 
-        for (std::size_t i = 0; i < numCores; ++i)
-        {
-            auto coreUsage = computeCpuUsage(counters.cpuPerCore[i], m_PrevCounters.cpuPerCore[i]);
-            snap.cpuPerCore.push_back(coreUsage);
-        }
+        // Pressure stall percentages from total= deltas
+        using Platform::PressureResource;
+        auto pressureAt = [](const Platform::SystemCounters& source, PressureResource resource) -> const Platform::PressureCounters&
+        { return source.pressure[static_cast<std::size_t>(resource)]; };
+        snap.pressureCpu = computePressureStall(
+            pressureAt(counters, PressureResource::Cpu), pressureAt(m_PrevCounters, PressureResource::Cpu), timeDelta);
+        snap.pressureMemory = computePressureStall(
+            pressureAt(counters, PressureResource::Memory), pressureAt(m_PrevCounters, PressureResource::Memory), timeDelta);
+        snap.pressureIo = computePressureStall(
+            pressureAt(counters, PressureResource::Io), pressureAt(m_PrevCounters, PressureResource::Io), timeDelta);
+        snap.pressureIrq = computePressureStall(
+            pressureAt(counters, PressureResource::Irq), pressureAt(m_PrevCounters, PressureResource::Irq), timeDelta);
 
         // Compute total network rates (aggregate of all interfaces, bytes per second)
         if (timeDelta > 0.0)
@@ -448,6 +683,9 @@ void SystemModel::computeSnapshot(const Platform::SystemCounters& counters, doub
         }
     }
 
+    // Per-NUMA-node memory, CPU (from the per-core usage above) and allocation rates
+    snap.numaNodes = computeNumaNodes(counters.numaNodes, m_PrevCounters.numaNodes, snap, timeDelta);
+
     // Store snapshot (preserve power status that was set separately in refresh())
     const auto preservedPower = m_Snapshot.power;
     m_Snapshot = snap;
@@ -472,25 +710,211 @@ void SystemModel::computeSnapshot(const Platform::SystemCounters& counters, doub
         m_NetRxHistory.push_back(static_cast<float>(snap.netRxBytesPerSec));
         m_NetTxHistory.push_back(static_cast<float>(snap.netTxBytesPerSec));
 
-        // Per-interface network history
-        for (const auto& ifaceSnap : snap.networkInterfaces)
+        // Per-group network history (per-interface rings were appended in m_InterfaceHistory.update)
+        for (std::size_t i = 0; i < snap.networkGroups.size(); ++i)
+        {
+            m_NetGroupRxHistory[i].push_back(static_cast<float>(snap.networkGroups[i].rxBytesPerSec));
+            m_NetGroupTxHistory[i].push_back(static_cast<float>(snap.networkGroups[i].txBytesPerSec));
+        }
+
+        // Pressure stall history (percent of wall time)
+        const std::array<const PressureStall*, Platform::PRESSURE_RESOURCE_COUNT> pressureByResource = {
+            &snap.pressureCpu, &snap.pressureMemory, &snap.pressureIo, &snap.pressureIrq};
+        for (std::size_t i = 0; i < pressureByResource.size(); ++i)
+        {
+            m_PressureSomeHistory[i].push_back(Numeric::clampPercentToFloat(pressureByResource[i]->somePercent));
+            m_PressureFullHistory[i].push_back(Numeric::clampPercentToFloat(pressureByResource[i]->fullPercent));
+        }
+
+        // Kernel activity rate history
+        for (const auto& field : ACTIVITY_RATE_FIELDS)
+        {
+            m_ActivityHistory[static_cast<std::size_t>(field.counter)].push_back(static_cast<float>(snap.activity.*field.rate));
+        }
+
+        // Per-NUMA-node history, slotted by node id. A node seen for the first time gets its
+        // histories backfilled with zeros (like per-core history); absent nodes record zero.
+        std::size_t numaSlots = m_NumaMemoryHistory.size();
+        for (const auto& node : snap.numaNodes)
+        {
+            numaSlots = std::max(numaSlots, static_cast<std::size_t>(node.nodeId) + 1);
+        }
+        for (auto* perNode : {&m_NumaMemoryHistory, &m_NumaCpuHistory, &m_NumaLocalHistory})
+        {
+            if (perNode->size() < numaSlots)
+            {
+                const std::size_t firstNew = perNode->size();
+                perNode->resize(numaSlots);
+                for (std::size_t i = firstNew; i < numaSlots; ++i)
+                {
+                    (*perNode)[i].assign(m_Timestamps.size(), 0.0F);
+                }
+            }
+            for (auto& nodeHist : *perNode)
+            {
+                nodeHist.push_back(0.0F);
+            }
+        }
+        for (const auto& node : snap.numaNodes)
         {
-            m_PerInterfaceRxHistory[ifaceSnap.name].push_back(static_cast<float>(ifaceSnap.rxBytesPerSec));
-            m_PerInterfaceTxHistory[ifaceSnap.name].push_back(static_cast<float>(ifaceSnap.txBytesPerSec));
+            m_NumaMemoryHistory[node.nodeId].back() = Numeric::clampPercentToFloat(node.memUsedPercent);
+            m_NumaCpuHistory[node.nodeId].back() = Numeric::clampPercentToFloat(node.cpuPercent);
+            m_NumaLocalHistory[node.nodeId].back() = Numeric::clampPercentToFloat(node.localPercent);
         }
 
         m_Timestamps.push_back(nowSeconds);
 
-        for (std::size_t i = 0; i < snap.cpuPerCore.size() && i < m_PerCoreHistory.size(); ++i)
+        for (std::size_t i = 0; i < m_CoreUsage.size() && i < m_PerCoreHistory.size(); ++i)
         {
-            m_PerCoreHistory[i].push_back(Numeric::clampPercentToFloat(snap.cpuPerCore[i].totalPercent));
+            m_PerCoreHistory[i].push_back(static_cast<float>(m_CoreUsage.totalPercent[i]));
+        }
+        for (std::size_t i = 0; i < snap.cpuPerCoreFreqMHz.size() && i < m_PerCoreFreqHistory.size(); ++i)
+        {
+            m_PerCoreFreqHistory[i].push_back(static_cast<float>(snap.cpuPerCoreFreqMHz[i]));
         }
 
         trimHistory(nowSeconds);
     }
 
-    // Update previous timestamp for next iteration
+    // Update previous timestamp and per-core counters for next iteration
     m_PrevTimestamp = nowSeconds;
+    std::swap(m_CoreCounters, m_PrevCoreCounters);
+}
+
+PressureStall SystemModel::computePressureStall(const Platform::PressureCounters& current,
+                                                const Platform::PressureCounters& previous,
+                                                double timeDeltaSeconds)
+{
+    PressureStall stall;
+    stall.available = current.available;
+    stall.hasSome = current.hasSome;
+    stall.hasFull = current.hasFull;
+
+    if (!current.available || !previous.available || timeDeltaSeconds <= 0.0)
+    {
+        return stall;
+    }
+
+    // Stall microseconds accumulated over the interval, as a share of elapsed wall time
+    const double intervalUs = timeDeltaSeconds * 1'000'000.0;
+    auto stallPercent = [intervalUs](std::uint64_t curr, std::uint64_t prev) -> double
+    {
+        if (curr < prev)
+        {
+            return 0.0; // Counter reset
+        }
+        return std::clamp(100.0 * (Numeric::toDouble(curr - prev) / intervalUs), 0.0, 100.0);
+    };
+
+    if (current.hasSome && previous.hasSome)
+    {
+        stall.somePercent = stallPercent(current.someTotalUs, previous.someTotalUs);
+    }
+    if (current.hasFull && previous.hasFull)
+    {
+        stall.fullPercent = stallPercent(current.fullTotalUs, previous.fullTotalUs);
+    }
+
+    return stall;
+}
+
+KernelActivity SystemModel::computeKernelActivity(const Platform::ActivityCounters& current,
+                                                  const Platform::ActivityCounters& previous,
+                                                  double timeDeltaSeconds)
+{
+    KernelActivity activity;
+    auto present = [&current](ActivityCounter counter) { return current.present[static_cast<std::size_t>(counter)]; };
+
+    activity.available = std::ranges::any_of(current.present, [](bool isPresent) { return isPresent; });
+    activity.hasOomKills = present(ActivityCounter::OomKills);
+    activity.hasNumaMigrations = present(ActivityCounter::NumaMigrations);
+    activity.hasRunqueueWait = present(ActivityCounter::RunqueueWaitNs);
+    activity.hasProcCounts = current.hasProcCounts;
+    activity.oomKillsTotal = current.totals[static_cast<std::size_t>(ActivityCounter::OomKills)];
+    activity.procsRunning = current.procsRunning;
+    activity.procsBlocked = current.procsBlocked;
+
+    if (timeDeltaSeconds <= 0.0)
+    {
+        return activity;
+    }
+
+    for (const auto& field : ACTIVITY_RATE_FIELDS)
+    {
+        const auto index = static_cast<std::size_t>(field.counter);
+        // Counter missing from either sample, or went backwards (reset) - leave the rate at zero
+        if (!current.present[index] || !previous.present[index] || current.totals[index] < previous.totals[index])
+        {
+            continue;
+        }
+        activity.*field.rate = field.scale * Numeric::toDouble(current.totals[index] - previous.totals[index]) / timeDeltaSeconds;
+    }
+
+    return activity;
+}
+
+std::vector<NumaNodeUsage> SystemModel::computeNumaNodes(const std::vector<Platform::NumaNodeCounters>& current,
+                                                        const std::vector<Platform::NumaNodeCounters>& previous,
+                                                        const SystemSnapshot& cpu,
+                                                        double timeDeltaSeconds)
+{
+    std::vector<NumaNodeUsage> nodes;
+    nodes.reserve(current.size());
+
+    for (const auto& counters : current)
+    {
+        NumaNodeUsage node;
+        node.nodeId = counters.nodeId;
+        node.memTotalBytes = counters.memTotalBytes;
+        node.memUsedBytes = counters.memTotalBytes > counters.memFreeBytes ? counters.memTotalBytes - counters.memFreeBytes : 0;
+        node.memFilePagesBytes = counters.filePagesBytes;
+        if (counters.memTotalBytes > 0)
+        {
+            node.memUsedPercent = 100.0 * (Numeric::toDouble(node.memUsedBytes) / Numeric::toDouble(counters.memTotalBytes));
+        }
+
+        // Per-core usage is slotted by logical CPU id, so cpulist ids index it directly
+        node.cpuCount = counters.cpuIds.size();
+        double busySum = 0.0;
+        for (const std::uint32_t cpuId : counters.cpuIds)
+        {
+            if (cpuId < cpu.cpuPerCore.size() && cpuId < cpu.cpuCoreOnline.size() && cpu.cpuCoreOnline[cpuId] != 0)
+            {
+                busySum += cpu.cpuPerCore[cpuId].totalPercent;
+                ++node.cpuOnline;
+            }
+        }
+        if (node.cpuOnline > 0)
+        {
+            node.cpuPercent = busySum / static_cast<double>(node.cpuOnline);
+        }
+
+        node.hasNumaStat = counters.hasNumaStat;
+        const auto prevIt =
+            std::ranges::find_if(previous, [&counters](const Platform::NumaNodeCounters& prev) { return prev.nodeId == counters.nodeId; });
+        if (counters.hasNumaStat && prevIt != previous.end() && prevIt->hasNumaStat && timeDeltaSeconds > 0.0)
+        {
+            // Counters that went backwards (node hot-removed and re-added) report zero
+            auto rate = [timeDeltaSeconds](std::uint64_t curr, std::uint64_t prev) -> double
+            { return curr >= prev ? Numeric::toDouble(curr - prev) / timeDeltaSeconds : 0.0; };
+
+            node.hitPagesPerSec = rate(counters.numaHit, prevIt->numaHit);
+            node.missPagesPerSec = rate(counters.numaMiss, prevIt->numaMiss);
+            node.foreignPagesPerSec = rate(counters.numaForeign, prevIt->numaForeign);
+            node.localPagesPerSec = rate(counters.localNode, prevIt->localNode);
+            node.otherPagesPerSec = rate(counters.otherNode, prevIt->otherNode);
+
+            const double allocated = node.localPagesPerSec + node.otherPagesPerSec;
+            if (allocated > 0.0)
+            {
+                node.localPercent = 100.0 * (node.localPagesPerSec / allocated);
+            }
+        }
+
+        nodes.push_back(node);
+    }
+
+    return nodes;
 }
 
 CpuUsage SystemModel::computeCpuUsage(const Platform::CpuCounters& current, const Platform::CpuCounters& previous)
@@ -568,10 +992,4 @@ PowerStatus SystemModel::computePowerStatus(const Platform::PowerCounters& count
     return status;
 }
 
-const Platform::SystemCounters::InterfaceCounters* SystemModel::findPreviousInterface(const std::string& name) const
-{
-    auto it = std::ranges::find_if(m_PrevCounters.networkInterfaces, [&name](const auto& iface) { return iface.name == name; });
-    return (it != m_PrevCounters.networkInterfaces.end()) ? &(*it) : nullptr;
-}
-
 } // namespace Domain
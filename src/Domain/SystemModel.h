@@ -1,15 +1,17 @@
 #pragma once
 
+#include "CpuCoreUsage.h"
+#include "NetInterfaceHistory.h"
 #include "Platform/IPowerProbe.h"
 #include "Platform/ISystemProbe.h"
 #include "SamplingConfig.h"
 #include "SystemSnapshot.h"
 
+#include <array>
 #include <deque>
 #include <memory>
 #include <shared_mutex>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace Domain
@@ -33,6 +35,11 @@ class SystemModel
     /// Thread-safe.
     void refresh();
 
+    /// Re-read power status now if the power probe reports a supply change (AC plugged or
+    /// unplugged), instead of waiting for the next refresh(). Cheap when nothing changed,
+    /// so it can be called every frame. Returns true if the power status was updated.
+    bool pollPowerChange();
+
     /// Update with externally-provided counters (for background sampler).
     /// Thread-safe.
     void updateFromCounters(const Platform::SystemCounters& counters);
@@ -67,7 +74,26 @@ class SystemModel
     [[nodiscard]] std::vector<float> netTxHistory() const;
     [[nodiscard]] std::vector<float> netRxHistoryForInterface(const std::string& interfaceName) const;
     [[nodiscard]] std::vector<float> netTxHistoryForInterface(const std::string& interfaceName) const;
+    /// Buffer-reusing variants: overwrite @p out (empty if the interface is unknown).
+    /// Interfaces that appeared mid-window have fewer samples than timestamps().
+    void netRxHistoryForInterface(const std::string& interfaceName, std::vector<float>& out) const;
+    void netTxHistoryForInterface(const std::string& interfaceName, std::vector<float>& out) const;
+    /// Summed rate history of all interfaces in one group (aligned with timestamps()).
+    [[nodiscard]] std::vector<float> netRxHistoryForGroup(InterfaceGroup group) const;
+    [[nodiscard]] std::vector<float> netTxHistoryForGroup(InterfaceGroup group) const;
     [[nodiscard]] std::vector<std::vector<float>> perCoreHistory() const;
+    /// Per-core frequency history in MHz, indexed by logical CPU id (0 = unknown/offline).
+    [[nodiscard]] std::vector<std::vector<float>> perCoreFreqHistory() const;
+    /// Stall-percentage history for one PSI resource ("some" and "full" lines).
+    [[nodiscard]] std::vector<float> pressureSomeHistory(Platform::PressureResource resource) const;
+    [[nodiscard]] std::vector<float> pressureFullHistory(Platform::PressureResource resource) const;
+    /// Rate history for one activity counter, in the units of the matching KernelActivity field.
+    [[nodiscard]] std::vector<float> activityHistory(Platform::ActivityCounter counter) const;
+    /// Per-NUMA-node histories (memory used %, CPU busy %, local allocation %), indexed by
+    /// node id. Offline nodes and id gaps record zeros.
+    [[nodiscard]] std::vector<std::vector<float>> numaMemoryHistory() const;
+    [[nodiscard]] std::vector<std::vector<float>> numaCpuHistory() const;
+    [[nodiscard]] std::vector<std::vector<float>> numaLocalHistory() const;
     [[nodiscard]] std::vector<double> timestamps() const;
 
   private:
@@ -81,6 +107,11 @@ class SystemModel
     double m_PrevTimestamp = 0.0;
     bool m_HasPrevious = false;
 
+    // Per-core counters in SoA form (current tick is scratch, swapped into previous)
+    CpuCoreUsage::CounterArrays m_CoreCounters;
+    CpuCoreUsage::CounterArrays m_PrevCoreCounters;
+    CpuCoreUsage::UsageArrays m_CoreUsage;
+
     // Latest computed snapshot
     SystemSnapshot m_Snapshot;
 
@@ -97,11 +128,23 @@ class SystemModel
     std::deque<float> m_BatteryChargeHistory;
     std::deque<float> m_NetRxHistory;
     std::deque<float> m_NetTxHistory;
-    // Per-interface network history (keyed by interface name)
-    std::unordered_map<std::string, std::deque<float>> m_PerInterfaceRxHistory;
-    std::unordered_map<std::string, std::deque<float>> m_PerInterfaceTxHistory;
+    // Per-interface rates and history (pooled ring arena, keyed by ifindex or name)
+    NetInterfaceHistory m_InterfaceHistory;
+    // Per-group network history, indexed by InterfaceGroup
+    std::array<std::deque<float>, INTERFACE_GROUP_COUNT> m_NetGroupRxHistory;
+    std::array<std::deque<float>, INTERFACE_GROUP_COUNT> m_NetGroupTxHistory;
     std::deque<double> m_Timestamps;
     std::vector<std::deque<float>> m_PerCoreHistory;
+    std::vector<std::deque<float>> m_PerCoreFreqHistory;
+    // PSI history, indexed by Platform::PressureResource
+    std::array<std::deque<float>, Platform::PRESSURE_RESOURCE_COUNT> m_PressureSomeHistory;
+    std::array<std::deque<float>, Platform::PRESSURE_RESOURCE_COUNT> m_PressureFullHistory;
+    // Kernel activity rate history, indexed by Platform::ActivityCounter
+    std::array<std::deque<float>, Platform::ACTIVITY_COUNTER_COUNT> m_ActivityHistory;
+    // Per-NUMA-node history, indexed by node id
+    std::vector<std::deque<float>> m_NumaMemoryHistory;
+    std::vector<std::deque<float>> m_NumaCpuHistory;
+    std::vector<std::deque<float>> m_NumaLocalHistory;
 
     double m_MaxHistorySeconds = Domain::Sampling::HISTORY_SECONDS_DEFAULT; // Default 5 minutes
 
@@ -110,12 +153,18 @@ class SystemModel
 
     // Helpers
     void computeSnapshot(const Platform::SystemCounters& counters, double nowSeconds);
+    void refreshPower();
     void trimHistory(double nowSeconds);
     [[nodiscard]] static CpuUsage computeCpuUsage(const Platform::CpuCounters& current, const Platform::CpuCounters& previous);
+    [[nodiscard]] static PressureStall
+    computePressureStall(const Platform::PressureCounters& current, const Platform::PressureCounters& previous, double timeDeltaSeconds);
+    [[nodiscard]] static KernelActivity
+    computeKernelActivity(const Platform::ActivityCounters& current, const Platform::ActivityCounters& previous, double timeDeltaSeconds);
+    [[nodiscard]] static std::vector<NumaNodeUsage> computeNumaNodes(const std::vector<Platform::NumaNodeCounters>& current,
+                                                                     const std::vector<Platform::NumaNodeCounters>& previous,
+                                                                     const SystemSnapshot& cpu,
+                                                                     double timeDeltaSeconds);
     [[nodiscard]] PowerStatus computePowerStatus(const Platform::PowerCounters& counters) const;
-
-    /// Find a previous interface by name for rate calculation.
-    [[nodiscard]] const Platform::SystemCounters::InterfaceCounters* findPreviousInterface(const std::string& name) const;
 };
 
 } // namespace Domain
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -7,6 +9,19 @@
 namespace Domain
 {
 
+/// Coarse network interface category used to roll up hosts with many interfaces
+/// (container veths, bridges, overlays) into a handful of series.
+enum class InterfaceGroup : std::uint8_t
+{
+    Physical = 0, // NICs and anything not recognized as virtual (includes Wi-Fi)
+    Veth,         // Container veth pairs
+    Bridge,       // Linux bridges: docker0, br-*, virbr*, cni*
+    Tunnel,       // Tunnels and overlays: tun/tap, WireGuard, VXLAN, GRE, ...
+    Virtual,      // Other virtual links: dummy, macvlan, ifb, bonds, VLANs, vEthernet
+};
+
+inline constexpr std::size_t INTERFACE_GROUP_COUNT = 5;
+
 /// CPU usage percentages (computed from counter deltas).
 struct CpuUsage
 {
@@ -18,6 +33,71 @@ struct CpuUsage
     double stealPercent = 0.0;  // Stolen by hypervisor %
 };
 
+/// Pressure stall percentages for one resource (Linux PSI).
+/// Computed from deltas of the cumulative total= counters over the sampling interval,
+/// so they track the actual interval rather than the kernel's 10s/60s/300s averages.
+struct PressureStall
+{
+    bool available = false;
+    bool hasSome = false;
+    bool hasFull = false;
+    double somePercent = 0.0; // Share of wall time at least one task was stalled
+    double fullPercent = 0.0; // Share of wall time all non-idle tasks were stalled at once
+};
+
+/// Scheduler, paging and fault activity (Linux /proc/stat, /proc/vmstat, /proc/schedstat).
+/// Rates are per second over the sampling interval and stay zero until two samples exist
+/// or when the kernel does not report the counter.
+struct KernelActivity
+{
+    bool available = false;
+    double contextSwitchesPerSec = 0.0;
+    double processesCreatedPerSec = 0.0; // Forks and clones
+    double pageInBytesPerSec = 0.0;      // Read from block devices (pgpgin)
+    double pageOutBytesPerSec = 0.0;     // Written to block devices (pgpgout)
+    double swapInPagesPerSec = 0.0;
+    double swapOutPagesPerSec = 0.0;
+    double pageFaultsPerSec = 0.0; // Minor + major
+    double majorFaultsPerSec = 0.0;
+    double oomKillsPerSec = 0.0;
+    double numaMigrationsPerSec = 0.0; // Pages moved by NUMA balancing
+    double runqueueWaitTasks = 0.0;    // Average runnable tasks waiting for a CPU (wait seconds per second)
+    double timeslicesPerSec = 0.0;
+
+    std::uint64_t oomKillsTotal = 0; // Since boot
+    std::uint64_t procsRunning = 0;  // Runnable tasks at sample time
+    std::uint64_t procsBlocked = 0;  // Tasks in uninterruptible I/O wait at sample time
+
+    bool hasOomKills = false;       // Kernel 4.13+
+    bool hasNumaMigrations = false; // CONFIG_NUMA_BALANCING
+    bool hasRunqueueWait = false;   // /proc/schedstat (CONFIG_SCHEDSTATS)
+    bool hasProcCounts = false;
+};
+
+/// Memory, CPU and allocation locality of one NUMA node.
+/// Allocation rates are pages per second over the sampling interval (zero until two
+/// samples exist or without numastat).
+struct NumaNodeUsage
+{
+    std::uint32_t nodeId = 0;
+    std::uint64_t memTotalBytes = 0;
+    std::uint64_t memUsedBytes = 0;      // Total - free (includes this node's page cache)
+    std::uint64_t memFilePagesBytes = 0; // Page cache on this node
+    double memUsedPercent = 0.0;
+
+    double cpuPercent = 0.0;   // Mean busy % of the node's online CPUs
+    std::size_t cpuCount = 0;  // CPUs on the node (online or not)
+    std::size_t cpuOnline = 0; // Of which online this sample
+
+    bool hasNumaStat = false;
+    double hitPagesPerSec = 0.0;     // Allocated here as intended
+    double missPagesPerSec = 0.0;    // Allocated here, another node was preferred
+    double foreignPagesPerSec = 0.0; // Meant for here, allocated elsewhere (memory pressure)
+    double localPagesPerSec = 0.0;   // Allocated here by tasks on this node's CPUs
+    double otherPagesPerSec = 0.0;   // Allocated here by tasks on other nodes' CPUs
+    double localPercent = 100.0;     // local / (local + other); 100 when nothing was allocated
+};
+
 /// Battery/power state snapshot for UI.
 struct PowerStatus
 {
@@ -51,7 +131,9 @@ struct SystemSnapshot
 {
     // CPU usage
     CpuUsage cpuTotal;
-    std::vector<CpuUsage> cpuPerCore;
+    std::vector<CpuUsage> cpuPerCore;        // Indexed by logical CPU id
+    std::vector<std::uint8_t> cpuCoreOnline; // Parallel to cpuPerCore; 0 = offline (usage is zero)
+    std::vector<std::uint32_t> cpuPerCoreFreqMHz; // Indexed by logical CPU id; 0 = unknown/offline
 
     // Memory (bytes)
     std::uint64_t memoryTotalBytes = 0;
@@ -71,7 +153,7 @@ struct SystemSnapshot
 
     // System info
     std::uint64_t uptimeSeconds = 0;
-    int coreCount = 0;
+    int coreCount = 0; // Online cores
     std::string hostname;
     std::string cpuModel;
 
@@ -83,6 +165,18 @@ struct SystemSnapshot
     // CPU frequency in MHz
     std::uint64_t cpuFreqMHz = 0;
 
+    // Pressure stall information - Linux only (zero until two samples exist)
+    PressureStall pressureCpu;
+    PressureStall pressureMemory;
+    PressureStall pressureIo;
+    PressureStall pressureIrq;
+
+    // Scheduler/paging activity - Linux only
+    KernelActivity activity;
+
+    // Per-NUMA-node breakdown, ascending node id (empty without NUMA information)
+    std::vector<NumaNodeUsage> numaNodes;
+
     // Network rates (bytes per second, computed from counter deltas)
     double netRxBytesPerSec = 0.0;
     double netTxBytesPerSec = 0.0;
@@ -96,9 +190,22 @@ struct SystemSnapshot
         double txBytesPerSec = 0.0; // Transmit rate
         bool isUp = false;          // Interface operational status
         uint64_t linkSpeedMbps = 0; // Link speed (0 if unknown)
+        uint32_t mtu = 0;           // MTU in bytes (0 if unknown)
+        uint32_t ifIndex = 0;       // OS interface index (0 if unknown)
+        InterfaceGroup group = InterfaceGroup::Physical;
     };
     std::vector<InterfaceSnapshot> networkInterfaces;
 
+    /// Per-group totals of the interfaces above, indexed by InterfaceGroup.
+    struct InterfaceGroupSnapshot
+    {
+        std::size_t interfaceCount = 0;
+        std::size_t upCount = 0;
+        double rxBytesPerSec = 0.0;
+        double txBytesPerSec = 0.0;
+    };
+    std::array<InterfaceGroupSnapshot, INTERFACE_GROUP_COUNT> networkGroups{};
+
     // Power/battery status
     PowerStatus power;
 };
@@ -63,6 +63,9 @@ struct ProcessGPUCounters
 {
     std::int32_t pid = 0;
     std::string gpuId; // Which GPU
+    // Name to show when gpuId matches no GPUInfo (e.g. "amdgpu 0000:03:00.0" from DRM client
+    // stats, whose PCI address ids only line up with DRMGPUProbe); empty if the probe has none
+    std::string gpuName;
 
     // Memory allocated by process (bytes)
     std::uint64_t gpuMemoryBytes = 0;
@@ -92,4 +95,23 @@ struct GPUCapabilities
     bool supportsMultiGPU = false;
 };
 
+// Health of one vendor backend (NVML, ROCm, DRM, ...) run behind a GuardedGPUProbe
+enum class GPUBackendState : std::uint8_t
+{
+    Healthy,  // Last call answered within its deadline
+    Degraded, // Recent calls timed out, breaker not yet open
+    Backoff,  // Circuit breaker open: calls are skipped until the backoff ends
+};
+
+struct GPUBackendHealth
+{
+    std::string name;
+    GPUBackendState state = GPUBackendState::Healthy;
+    std::uint32_t consecutiveTimeouts = 0;
+    std::uint64_t totalTimeouts = 0;
+    std::uint64_t droppedResults = 0; // Results that arrived after their deadline
+    double lastCallMs = 0.0;          // Duration of the last call that met its deadline
+    double backoffRemainingSeconds = 0.0;
+};
+
 } // namespace Platform
@@ -0,0 +1,259 @@
+#include "GuardedGPUProbe.h"
+
+#include "GPUTypes.h"
+#include "IGPUProbe.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Platform
+{
+
+struct GuardedGPUProbe::State
+{
+    std::mutex mutex;
+    std::condition_variable wake; // Worker: a call was posted, or stop
+    std::condition_variable done; // Caller: the call it waits for completed
+
+    std::unique_ptr<IGPUProbe> backend;
+    std::string name;
+
+    // Call hand-off
+    bool stop = false;
+    bool hasCall = false;
+    bool busy = false; // Posted or still running in the backend
+    Call call = Call::Counters;
+    std::uint64_t callSeq = 0;
+    std::uint64_t waitingSeq = 0; // Call the caller still waits for (0 = it gave up)
+    std::uint64_t completedSeq = 0;
+    std::vector<GPUInfo> gpus;
+    std::vector<GPUCounters> counters;
+    std::vector<ProcessGPUCounters> processCounters;
+
+    // Health and circuit breaker
+    std::uint32_t consecutiveTimeouts = 0;
+    std::uint64_t totalTimeouts = 0;
+    std::uint64_t droppedResults = 0;
+    double lastCallMs = 0.0;
+    bool breakerOpen = false;
+    std::chrono::milliseconds backoff{0};
+    std::chrono::steady_clock::time_point backoffUntil;
+
+    /// Count a missed deadline and open (or re-open) the breaker when due. Caller holds mutex.
+    void recordTimeout(const GPUProbeGuardConfig& config, std::chrono::steady_clock::time_point now)
+    {
+        ++consecutiveTimeouts;
+        ++totalTimeouts;
+
+        if (breakerOpen)
+        {
+            // The trial call after a backoff failed as well
+            backoff = std::min(backoff * 2, config.maxBackoff);
+        }
+        else if (consecutiveTimeouts >= config.failureThreshold)
+        {
+            breakerOpen = true;
+            backoff = config.initialBackoff;
+        }
+        else
+        {
+            return;
+        }
+
+        backoffUntil = now + backoff;
+        spdlog::warn("GuardedGPUProbe: {} timed out {} time(s) in a row, backing off for {} ms",
+                     name,
+                     consecutiveTimeouts,
+                     backoff.count());
+    }
+};
+
+GuardedGPUProbe::GuardedGPUProbe(std::string name, std::unique_ptr<IGPUProbe> backend, GPUProbeGuardConfig config)
+    : m_Config(config), m_State(std::make_shared<State>())
+{
+    if (backend)
+    {
+        m_Capabilities = backend->capabilities();
+    }
+    m_State->backend = std::move(backend);
+    m_State->name = std::move(name);
+    m_Worker = std::jthread(workerLoop, m_State);
+}
+
+GuardedGPUProbe::~GuardedGPUProbe()
+{
+    bool stuck = false;
+    {
+        const std::scoped_lock lock(m_State->mutex);
+        m_State->stop = true;
+        stuck = m_State->busy;
+    }
+    m_State->wake.notify_all();
+
+    if (stuck)
+    {
+        // The worker holds its own reference to the state and releases the backend when the call returns
+        spdlog::warn("GuardedGPUProbe: {} is still inside a backend call, detaching its worker", m_State->name);
+        m_Worker.detach();
+    }
+}
+
+void GuardedGPUProbe::workerLoop(const std::shared_ptr<State>& state)
+{
+    std::unique_lock lock(state->mutex);
+    while (true)
+    {
+        state->wake.wait(lock, [&state] { return state->stop || state->hasCall; });
+        if (state->stop)
+        {
+            return;
+        }
+        state->hasCall = false;
+        const Call kind = state->call;
+        const std::uint64_t seq = state->callSeq;
+        lock.unlock();
+
+        std::vector<GPUInfo> gpus;
+        std::vector<GPUCounters> counters;
+        std::vector<ProcessGPUCounters> processCounters;
+        if (state->backend)
+        {
+            try
+            {
+                switch (kind)
+                {
+                case Call::Enumerate:
+                    gpus = state->backend->enumerateGPUs();
+                    break;
+                case Call::Counters:
+                    counters = state->backend->readGPUCounters();
+                    break;
+                case Call::ProcessCounters:
+                    processCounters = state->backend->readProcessGPUCounters();
+                    break;
+                }
+            }
+            catch (const std::exception& e)
+            {
+                spdlog::error("GuardedGPUProbe: {} failed: {}", state->name, e.what());
+            }
+        }
+
+        lock.lock();
+        state->busy = false;
+        if (seq != state->waitingSeq)
+        {
+            ++state->droppedResults; // The caller's deadline passed
+            continue;
+        }
+        state->gpus = std::move(gpus);
+        state->counters = std::move(counters);
+        state->processCounters = std::move(processCounters);
+        state->completedSeq = seq;
+        state->done.notify_all();
+    }
+}
+
+template<typename T>
+std::vector<T> GuardedGPUProbe::call(Call kind, std::vector<T> State::* result, std::chrono::milliseconds deadline)
+{
+    State& state = *m_State;
+    std::unique_lock lock(state.mutex);
+
+    const auto start = std::chrono::steady_clock::now();
+    if (state.breakerOpen && start < state.backoffUntil)
+    {
+        return {};
+    }
+    if (state.busy)
+    {
+        // Still stuck in an earlier call; do not queue behind it
+        state.recordTimeout(m_Config, start);
+        return {};
+    }
+
+    const std::uint64_t seq = ++state.callSeq;
+    state.call = kind;
+    state.hasCall = true;
+    state.busy = true;
+    state.waitingSeq = seq;
+    state.wake.notify_one();
+
+    if (!state.done.wait_until(lock, start + deadline, [&state, seq] { return state.completedSeq == seq; }))
+    {
+        state.waitingSeq = 0;
+        state.recordTimeout(m_Config, std::chrono::steady_clock::now());
+        return {};
+    }
+
+    state.lastCallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    state.consecutiveTimeouts = 0;
+    if (state.breakerOpen)
+    {
+        state.breakerOpen = false;
+        spdlog::info("GuardedGPUProbe: {} answered again, closing the circuit breaker", state.name);
+    }
+    return std::move(state.*result);
+}
+
+std::vector<GPUInfo> GuardedGPUProbe::enumerateGPUs()
+{
+    return call(Call::Enumerate, &State::gpus, m_Config.enumerateDeadline);
+}
+
+std::vector<GPUCounters> GuardedGPUProbe::readGPUCounters()
+{
+    return call(Call::Counters, &State::counters, m_Config.deadline);
+}
+
+std::vector<ProcessGPUCounters> GuardedGPUProbe::readProcessGPUCounters()
+{
+    return call(Call::ProcessCounters, &State::processCounters, m_Config.deadline);
+}
+
+GPUCapabilities GuardedGPUProbe::capabilities() const
+{
+    return m_Capabilities;
+}
+
+std::vector<GPUBackendHealth> GuardedGPUProbe::backendHealth() const
+{
+    return {health()};
+}
+
+GPUBackendHealth GuardedGPUProbe::health() const
+{
+    const std::scoped_lock lock(m_State->mutex);
+    const State& state = *m_State;
+
+    GPUBackendHealth health;
+    health.name = state.name;
+    health.consecutiveTimeouts = state.consecutiveTimeouts;
+    health.totalTimeouts = state.totalTimeouts;
+    health.droppedResults = state.droppedResults;
+    health.lastCallMs = state.lastCallMs;
+    if (state.breakerOpen)
+    {
+        health.state = GPUBackendState::Backoff;
+        const auto remaining = state.backoffUntil - std::chrono::steady_clock::now();
+        health.backoffRemainingSeconds = std::max(0.0, std::chrono::duration<double>(remaining).count());
+    }
+    else if (state.consecutiveTimeouts > 0)
+    {
+        health.state = GPUBackendState::Degraded;
+    }
+    return health;
+}
+
+} // namespace Platform
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "GPUTypes.h"
+#include "IGPUProbe.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Platform
+{
+
+/// Deadlines and circuit-breaker settings of a GuardedGPUProbe.
+struct GPUProbeGuardConfig
+{
+    std::chrono::milliseconds deadline{250};           // Per readGPUCounters / readProcessGPUCounters call
+    std::chrono::milliseconds enumerateDeadline{2000}; // enumerateGPUs() may load firmware tables
+    std::uint32_t failureThreshold = 3;                // Consecutive timeouts that open the breaker
+    std::chrono::milliseconds initialBackoff{5000};    // First backoff; doubles on every failed retry
+    std::chrono::milliseconds maxBackoff{60000};
+};
+
+/// Runs one vendor GPU backend on its own worker thread and bounds every call by a deadline.
+///
+/// Vendor libraries can block for seconds inside a wedged driver (NVML is the usual case).
+/// The caller waits at most the deadline; a result that arrives later is dropped. After
+/// failureThreshold consecutive timeouts the circuit breaker opens and calls return empty
+/// without touching the backend; once the backoff ends, one trial call decides whether it
+/// closes again or reopens with twice the backoff. While a call is still stuck in the
+/// backend, new calls fail at once instead of queueing behind it.
+///
+/// capabilities() is taken once at construction. If the worker is stuck at destruction it
+/// is detached and the backend is released when its call finally returns.
+class GuardedGPUProbe final : public IGPUProbe
+{
+  public:
+    GuardedGPUProbe(std::string name, std::unique_ptr<IGPUProbe> backend, GPUProbeGuardConfig config = {});
+    ~GuardedGPUProbe() override;
+
+    GuardedGPUProbe(const GuardedGPUProbe&) = delete;
+    GuardedGPUProbe& operator=(const GuardedGPUProbe&) = delete;
+    GuardedGPUProbe(GuardedGPUProbe&&) = delete;
+    GuardedGPUProbe& operator=(GuardedGPUProbe&&) = delete;
+
+    [[nodiscard]] std::vector<GPUInfo> enumerateGPUs() override;
+    [[nodiscard]] std::vector<GPUCounters> readGPUCounters() override;
+    [[nodiscard]] std::vector<ProcessGPUCounters> readProcessGPUCounters() override;
+    [[nodiscard]] GPUCapabilities capabilities() const override;
+    [[nodiscard]] std::vector<GPUBackendHealth> backendHealth() const override;
+
+    /// Health of this backend alone.
+    [[nodiscard]] GPUBackendHealth health() const;
+
+  private:
+    enum class Call : std::uint8_t
+    {
+        Enumerate,
+        Counters,
+        ProcessCounters,
+    };
+
+    struct State; // Shared with the worker, which may outlive this object
+
+    template<typename T> [[nodiscard]] std::vector<T> call(Call kind, std::vector<T> State::* result, std::chrono::milliseconds deadline);
+
+    static void workerLoop(const std::shared_ptr<State>& state);
+
+    GPUProbeGuardConfig m_Config;
+    GPUCapabilities m_Capabilities;
+    std::shared_ptr<State> m_State;
+    std::jthread m_Worker;
+};
+
+} // namespace Platform
@@ -31,6 +31,12 @@ class IGPUProbe
 
     // Capability reporting
     [[nodiscard]] virtual GPUCapabilities capabilities() const = 0;
+
+    // Health of the vendor backends behind this probe (thread-safe; empty if not tracked)
+    [[nodiscard]] virtual std::vector<GPUBackendHealth> backendHealth() const
+    {
+        return {};
+    }
 };
 
 } // namespace Platform
@@ -24,6 +24,15 @@ class IPowerProbe
 
     /// What this platform supports.
     [[nodiscard]] virtual PowerCapabilities capabilities() const = 0;
+
+    /// Whether a power supply changed since the last call (AC plugged or unplugged,
+    /// battery status flipped, supply added or removed). Cheap enough to call every
+    /// frame; true means read() (and capabilities()) should be re-queried now rather than
+    /// on the next refresh tick. Probes without change notification return false.
+    [[nodiscard]] virtual bool pollChanged()
+    {
+        return false;
+    }
 };
 
 } // namespace Platform
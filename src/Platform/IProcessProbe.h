@@ -2,6 +2,7 @@
 
 #include "ProcessTypes.h"
 
+#include <cstdint>
 #include <vector>
 
 namespace Platform
@@ -37,6 +38,16 @@ class IProcessProbe
     /// Total system memory in bytes.
     /// Used for calculating per-process memory%.
     [[nodiscard]] virtual uint64_t systemTotalMemory() const = 0;
+
+    /// Resident memory of one process per NUMA node, in KiB (indexed by node id).
+    /// Not part of enumerate(): the kernel walks the page tables to answer, so callers
+    /// should only ask for the processes they display.
+    /// Returns false if unsupported or the process could not be read.
+    [[nodiscard]] virtual bool readNumaResidency(std::int32_t pid, std::vector<std::uint64_t>& kibPerNode) = 0;
+
+    /// Cumulative CPU package energy counters (RAPL on Linux); empty if unsupported.
+    /// The domain splits each interval's energy by the CPU time processes used on each package.
+    [[nodiscard]] virtual EnergyCounters readEnergyCounters() = 0;
 };
 
 } // namespace Platform
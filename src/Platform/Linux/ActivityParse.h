@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Platform/SystemTypes.h"
+#include "ProcParse.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Platform
+{
+
+namespace ActivityParseDetail
+{
+
+[[nodiscard]] constexpr std::size_t slot(ActivityCounter counter) noexcept
+{
+    return static_cast<std::size_t>(counter);
+}
+
+// /proc/vmstat keys, listed in the order the kernel prints them; the scan stops once all are seen
+inline constexpr std::array<ProcParse::KeySlot, 8> VMSTAT_KEYS = {{
+    {.key = "pgpgin", .slot = slot(ActivityCounter::PageInKiB)},
+    {.key = "pgpgout", .slot = slot(ActivityCounter::PageOutKiB)},
+    {.key = "pswpin", .slot = slot(ActivityCounter::SwapInPages)},
+    {.key = "pswpout", .slot = slot(ActivityCounter::SwapOutPages)},
+    {.key = "pgfault", .slot = slot(ActivityCounter::PageFaults)},
+    {.key = "pgmajfault", .slot = slot(ActivityCounter::MajorFaults)},
+    {.key = "numa_pages_migrated", .slot = slot(ActivityCounter::NumaMigrations)},
+    {.key = "oom_kill", .slot = slot(ActivityCounter::OomKills)},
+}};
+
+// Slots of the /proc/stat scratch array used by parseProcStatActivity
+enum ProcStatSlot : std::uint8_t
+{
+    PROC_STAT_CTXT = 0,
+    PROC_STAT_PROCESSES,
+    PROC_STAT_RUNNING,
+    PROC_STAT_BLOCKED,
+    PROC_STAT_SLOT_COUNT,
+};
+
+inline constexpr std::array<ProcParse::KeySlot, PROC_STAT_SLOT_COUNT> PROC_STAT_KEYS = {{
+    {.key = "ctxt", .slot = PROC_STAT_CTXT},
+    {.key = "processes", .slot = PROC_STAT_PROCESSES},
+    {.key = "procs_running", .slot = PROC_STAT_RUNNING},
+    {.key = "procs_blocked", .slot = PROC_STAT_BLOCKED},
+}};
+
+} // namespace ActivityParseDetail
+
+/// Extract paging, swap, fault, OOM and NUMA migration totals from /proc/vmstat.
+///
+/// Format: one "name value" pair per line (~180 lines on current kernels).
+/// Counters missing from this kernel keep present[] == false.
+/// Returns false if none of the keys were found.
+[[nodiscard]] inline bool parseVmStat(std::string_view text, ActivityCounters& out) noexcept
+{
+    return ProcParse::scanKeyedValues(text, ActivityParseDetail::VMSTAT_KEYS, out.totals, out.present) > 0;
+}
+
+/// Extract ctxt, processes, procs_running and procs_blocked from /proc/stat text.
+///
+/// These lines follow the cpu and intr lines:
+///   ctxt 2412830913
+///   btime 1700000000
+///   processes 1234567
+///   procs_running 3
+///   procs_blocked 0
+/// Returns false if neither cumulative counter was found.
+[[nodiscard]] inline bool parseProcStatActivity(std::string_view text, ActivityCounters& out) noexcept
+{
+    using namespace ActivityParseDetail;
+
+    std::array<std::uint64_t, PROC_STAT_SLOT_COUNT> values{};
+    std::array<bool, PROC_STAT_SLOT_COUNT> found{};
+    (void) ProcParse::scanKeyedValues(text, PROC_STAT_KEYS, values, found);
+
+    out.totals[slot(ActivityCounter::ContextSwitches)] = values[PROC_STAT_CTXT];
+    out.present[slot(ActivityCounter::ContextSwitches)] = found[PROC_STAT_CTXT];
+    out.totals[slot(ActivityCounter::ProcessesCreated)] = values[PROC_STAT_PROCESSES];
+    out.present[slot(ActivityCounter::ProcessesCreated)] = found[PROC_STAT_PROCESSES];
+    out.procsRunning = values[PROC_STAT_RUNNING];
+    out.procsBlocked = values[PROC_STAT_BLOCKED];
+    out.hasProcCounts = found[PROC_STAT_RUNNING] && found[PROC_STAT_BLOCKED];
+    return found[PROC_STAT_CTXT] || found[PROC_STAT_PROCESSES];
+}
+
+/// Sum run-queue wait time and timeslice counts over the cpu lines of /proc/schedstat.
+///
+/// Format (version 15+; needs CONFIG_SCHEDSTATS):
+///   version 15
+///   timestamp 4295122464
+///   cpu0 0 0 1234 567 890 123 <run ns> <wait ns> <timeslices>
+///   domain0 ...
+/// The last three cpu fields come from sched_info and are updated even when the
+/// kernel.sched_schedstats sysctl is off. Older versions used a different layout
+/// and are rejected.
+[[nodiscard]] inline bool parseSchedStat(std::string_view text, ActivityCounters& out) noexcept
+{
+    constexpr std::uint32_t MIN_SCHEDSTAT_VERSION = 15;
+    constexpr std::size_t CPU_FIELD_COUNT = 9;
+    constexpr std::size_t WAIT_FIELD = 7;      // 0-based index of the run-delay field
+    constexpr std::size_t TIMESLICE_FIELD = 8; // 0-based index of the timeslice field
+
+    std::string_view line;
+    if (!ProcParse::nextLine(text, line) || ProcParse::nextToken(line) != "version")
+    {
+        return false;
+    }
+    std::uint32_t version = 0;
+    if (!ProcParse::nextInteger(line, version) || version < MIN_SCHEDSTAT_VERSION)
+    {
+        return false;
+    }
+
+    std::uint64_t waitNs = 0;
+    std::uint64_t timeslices = 0;
+    bool foundCpu = false;
+    while (ProcParse::nextLine(text, line))
+    {
+        const std::string_view label = ProcParse::nextToken(line);
+        if (!label.starts_with("cpu"))
+        {
+            continue;
+        }
+
+        std::array<std::uint64_t, CPU_FIELD_COUNT> fields{};
+        std::size_t parsed = 0;
+        while (parsed < fields.size() && ProcParse::nextInteger(line, fields[parsed]))
+        {
+            ++parsed;
+        }
+        if (parsed == fields.size())
+        {
+            waitNs += fields[WAIT_FIELD];
+            timeslices += fields[TIMESLICE_FIELD];
+            foundCpu = true;
+        }
+    }
+
+    if (foundCpu)
+    {
+        using ActivityParseDetail::slot;
+        out.totals[slot(ActivityCounter::RunqueueWaitNs)] = waitNs;
+        out.present[slot(ActivityCounter::RunqueueWaitNs)] = true;
+        out.totals[slot(ActivityCounter::Timeslices)] = timeslices;
+        out.present[slot(ActivityCounter::Timeslices)] = true;
+    }
+    return foundCpu;
+}
+
+} // namespace Platform
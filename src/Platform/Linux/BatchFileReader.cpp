@@ -0,0 +1,704 @@
+// Keep this translation unit parseable on non-Linux platforms (e.g. Windows clangd)
+// by compiling the implementation only when targeting Linux and required headers exist.
+#if defined(__linux__) && __has_include(<unistd.h>) && __has_include(<fcntl.h>)
+
+#include "BatchFileReader.h"
+
+#include "Platform/PlatformConfig.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if TASKSMACK_HAS_IO_URING
+#include <atomic>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+namespace Platform
+{
+
+namespace
+{
+
+// Same growth policy as ProcFile: most files fit in a page, a few need more
+constexpr std::size_t INITIAL_BUFFER_SIZE = 4096;
+constexpr std::size_t MAX_BUFFER_SIZE = 16 * 1024 * 1024;
+
+// Keeps the submission queue (three entries per file) well under the kernel's 32768 limit
+constexpr std::uint32_t MAX_QUEUE_DEPTH = 4096;
+
+} // namespace
+
+#if TASKSMACK_HAS_IO_URING
+
+/// Minimal io_uring instance driven through raw syscalls (no liburing dependency).
+/// Owns the mapped rings, the registered buffer slots and, optionally, the sparse
+/// fixed-file table that open -> read -> close chains install into.
+class BatchFileReader::Ring
+{
+  public:
+    enum class Op : std::uint64_t
+    {
+        Open = 0,
+        Read = 1,
+        Close = 2,
+    };
+
+    /// Set up a ring for @p depth files in flight. Returns null (after logging why) if
+    /// the kernel refuses io_uring or lacks the opcodes a batch needs.
+    [[nodiscard]] static std::unique_ptr<Ring> create(std::uint32_t depth, std::size_t slotSize, bool registerFiles);
+
+    ~Ring();
+
+    Ring(const Ring&) = delete;
+    Ring& operator=(const Ring&) = delete;
+    Ring(Ring&&) = delete;
+    Ring& operator=(Ring&&) = delete;
+
+    [[nodiscard]] bool fixedFiles() const noexcept
+    {
+        return m_FixedFiles;
+    }
+
+    [[nodiscard]] char* slot(std::uint32_t index) noexcept
+    {
+        return m_Buffers.data() + (static_cast<std::size_t>(index) * m_SlotSize);
+    }
+
+    [[nodiscard]] std::size_t slotSize() const noexcept
+    {
+        return m_SlotSize;
+    }
+
+    /// Queue an openat of @p path for slot @p index, linked to the read that follows.
+    void prepareOpen(std::uint32_t index, int dirFd, const char* path);
+
+    /// Queue a read of the whole slot from offset 0, hard-linked to a close of the same
+    /// file. @p fd is ignored with fixed files (the slot's table entry is used instead).
+    void prepareReadAndClose(std::uint32_t index, int fd);
+
+    /// Submit everything queued and wait for @p completions CQEs. Returns 0 or an errno.
+    [[nodiscard]] int submitAndWait(std::uint32_t completions);
+
+    /// SQEs the kernel did not accept before the last failed submitAndWait(). They sit at
+    /// the end of the queue, so the first (queued - unsubmitted) SQEs were submitted.
+    [[nodiscard]] std::uint32_t unsubmitted() const noexcept
+    {
+        return m_Pending;
+    }
+
+    /// Hand every available completion to @p onCompletion(index, op, result).
+    template<typename F> void drain(F&& onCompletion);
+
+  private:
+    Ring() = default;
+
+    [[nodiscard]] io_uring_sqe& nextSqe() noexcept;
+    [[nodiscard]] static std::uint64_t tag(std::uint32_t index, Op op) noexcept
+    {
+        return (static_cast<std::uint64_t>(index) << 2) | static_cast<std::uint64_t>(op);
+    }
+
+    int m_Fd = -1;
+    void* m_SqRing = MAP_FAILED;
+    std::size_t m_SqRingSize = 0;
+    void* m_CqRing = MAP_FAILED; // Same mapping as m_SqRing with IORING_FEAT_SINGLE_MMAP
+    std::size_t m_CqRingSize = 0;
+    io_uring_sqe* m_Sqes = nullptr;
+    std::size_t m_SqesSize = 0;
+
+    unsigned* m_SqTail = nullptr;
+    unsigned m_SqMask = 0;
+    unsigned* m_SqArray = nullptr;
+    unsigned* m_CqHead = nullptr;
+    unsigned* m_CqTail = nullptr;
+    unsigned m_CqMask = 0;
+    io_uring_cqe* m_Cqes = nullptr;
+
+    unsigned m_LocalTail = 0; // SQEs written but not yet published to the kernel
+    std::uint32_t m_Pending = 0;
+
+    std::vector<char> m_Buffers;
+    std::size_t m_SlotSize = 0;
+    bool m_FixedBuffers = false;
+    bool m_FixedFiles = false;
+};
+
+namespace
+{
+
+[[nodiscard]] int ioUringSetup(unsigned entries, io_uring_params* params) noexcept
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+[[nodiscard]] int ioUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) noexcept
+{
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+}
+
+[[nodiscard]] int ioUringRegister(int fd, unsigned opcode, const void* arg, unsigned count) noexcept
+{
+    return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, count));
+}
+
+[[nodiscard]] void* mapRing(int fd, std::size_t size, off_t offset) noexcept
+{
+    return ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+}
+
+template<typename T> [[nodiscard]] T* ringField(void* ring, std::uint32_t offset) noexcept
+{
+    return reinterpret_cast<T*>(static_cast<char*>(ring) + offset); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+/// Whether the kernel implements every opcode a batch uses (IORING_REGISTER_PROBE, 5.6+).
+[[nodiscard]] bool supportsBatchOpcodes(int ringFd)
+{
+    constexpr std::size_t PROBE_OPS = 256;
+    std::vector<std::byte> storage(sizeof(io_uring_probe) + (PROBE_OPS * sizeof(io_uring_probe_op)));
+    auto* probe = reinterpret_cast<io_uring_probe*>(storage.data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (ioUringRegister(ringFd, IORING_REGISTER_PROBE, probe, PROBE_OPS) < 0)
+    {
+        return false;
+    }
+
+    const auto supported = [probe](unsigned opcode)
+    { return opcode <= probe->last_op && (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED) != 0; };
+    return supported(IORING_OP_OPENAT) && supported(IORING_OP_READ) && supported(IORING_OP_READ_FIXED) && supported(IORING_OP_CLOSE);
+}
+
+} // namespace
+
+std::unique_ptr<BatchFileReader::Ring> BatchFileReader::Ring::create(std::uint32_t depth, std::size_t slotSize, bool registerFiles)
+{
+    io_uring_params params{};
+    const int fd = ioUringSetup(depth * 3, &params);
+    if (fd < 0)
+    {
+        // EPERM: io_uring_disabled sysctl or a seccomp filter (the container default); ENOSYS: not built in
+        spdlog::info("BatchFileReader: io_uring unavailable ({}), using synchronous reads", std::strerror(errno));
+        return nullptr;
+    }
+
+    std::unique_ptr<Ring> ring(new Ring());
+    ring->m_Fd = fd;
+
+    if (!supportsBatchOpcodes(fd))
+    {
+        spdlog::info("BatchFileReader: kernel io_uring lacks openat/read/close, using synchronous reads");
+        return nullptr;
+    }
+
+    ring->m_SqRingSize = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+    ring->m_CqRingSize = params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe));
+    const bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMmap)
+    {
+        ring->m_SqRingSize = std::max(ring->m_SqRingSize, ring->m_CqRingSize);
+    }
+
+    ring->m_SqRing = mapRing(fd, ring->m_SqRingSize, IORING_OFF_SQ_RING);
+    if (ring->m_SqRing == MAP_FAILED)
+    {
+        spdlog::warn("BatchFileReader: mapping the io_uring submission queue failed: {}", std::strerror(errno));
+        return nullptr;
+    }
+    if (singleMmap)
+    {
+        ring->m_CqRing = ring->m_SqRing;
+    }
+    else
+    {
+        ring->m_CqRing = mapRing(fd, ring->m_CqRingSize, IORING_OFF_CQ_RING);
+        if (ring->m_CqRing == MAP_FAILED)
+        {
+            spdlog::warn("BatchFileReader: mapping the io_uring completion queue failed: {}", std::strerror(errno));
+            return nullptr;
+        }
+    }
+
+    ring->m_SqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = mapRing(fd, ring->m_SqesSize, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+    {
+        spdlog::warn("BatchFileReader: mapping the io_uring SQE array failed: {}", std::strerror(errno));
+        return nullptr;
+    }
+    ring->m_Sqes = static_cast<io_uring_sqe*>(sqes);
+
+    ring->m_SqTail = ringField<unsigned>(ring->m_SqRing, params.sq_off.tail);
+    ring->m_SqMask = *ringField<unsigned>(ring->m_SqRing, params.sq_off.ring_mask);
+    ring->m_SqArray = ringField<unsigned>(ring->m_SqRing, params.sq_off.array);
+    ring->m_CqHead = ringField<unsigned>(ring->m_CqRing, params.cq_off.head);
+    ring->m_CqTail = ringField<unsigned>(ring->m_CqRing, params.cq_off.tail);
+    ring->m_CqMask = *ringField<unsigned>(ring->m_CqRing, params.cq_off.ring_mask);
+    ring->m_Cqes = ringField<io_uring_cqe>(ring->m_CqRing, params.cq_off.cqes);
+    ring->m_LocalTail = *ring->m_SqTail;
+
+    ring->m_SlotSize = slotSize;
+    ring->m_Buffers.resize(static_cast<std::size_t>(depth) * slotSize);
+
+    // Registered buffers skip the per-read page pinning; RLIMIT_MEMLOCK can refuse them, and plain reads still work
+    const iovec bufferRegion{.iov_base = ring->m_Buffers.data(), .iov_len = ring->m_Buffers.size()};
+    ring->m_FixedBuffers = ioUringRegister(fd, IORING_REGISTER_BUFFERS, &bufferRegion, 1) == 0;
+
+#ifdef IORING_FEAT_CQE_SKIP
+    // Direct-descriptor open/close landed in 5.15; CQE_SKIP (5.17) is the nearest feature bit that implies it
+    if (registerFiles && (params.features & IORING_FEAT_CQE_SKIP) != 0)
+    {
+        const std::vector<int> sparseTable(depth, -1);
+        ring->m_FixedFiles = ioUringRegister(fd, IORING_REGISTER_FILES, sparseTable.data(), depth) == 0;
+    }
+#else
+    (void) registerFiles;
+#endif
+
+    spdlog::debug("BatchFileReader: io_uring ready (depth {}, registered buffers: {}, registered files: {})",
+                  depth,
+                  ring->m_FixedBuffers,
+                  ring->m_FixedFiles);
+    return ring;
+}
+
+BatchFileReader::Ring::~Ring()
+{
+    if (m_Sqes != nullptr)
+    {
+        ::munmap(m_Sqes, m_SqesSize);
+    }
+    if (m_CqRing != MAP_FAILED && m_CqRing != m_SqRing)
+    {
+        ::munmap(m_CqRing, m_CqRingSize);
+    }
+    if (m_SqRing != MAP_FAILED)
+    {
+        ::munmap(m_SqRing, m_SqRingSize);
+    }
+    if (m_Fd >= 0)
+    {
+        // Closing the ring cancels anything still in flight and drops the registered buffers and files
+        ::close(m_Fd);
+    }
+}
+
+io_uring_sqe& BatchFileReader::Ring::nextSqe() noexcept
+{
+    const unsigned index = m_LocalTail & m_SqMask;
+    io_uring_sqe& sqe = m_Sqes[index];
+    sqe = io_uring_sqe{};
+    m_SqArray[index] = index;
+    ++m_LocalTail;
+    ++m_Pending;
+    return sqe;
+}
+
+void BatchFileReader::Ring::prepareOpen(std::uint32_t index, int dirFd, const char* path)
+{
+    io_uring_sqe& sqe = nextSqe();
+    sqe.opcode = IORING_OP_OPENAT;
+    sqe.fd = dirFd;
+    sqe.addr = reinterpret_cast<std::uint64_t>(path); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    sqe.user_data = tag(index, Op::Open);
+#ifdef IORING_FEAT_CQE_SKIP
+    if (m_FixedFiles)
+    {
+        // Direct descriptors reject O_CLOEXEC; they never enter the fd table, so it would be meaningless anyway
+        sqe.open_flags = O_RDONLY;
+        sqe.file_index = index + 1;
+        sqe.flags = IOSQE_IO_LINK;
+        return;
+    }
+#endif
+    sqe.open_flags = O_RDONLY | O_CLOEXEC;
+}
+
+void BatchFileReader::Ring::prepareReadAndClose(std::uint32_t index, int fd)
+{
+    io_uring_sqe& read = nextSqe();
+    read.opcode = m_FixedBuffers ? IORING_OP_READ_FIXED : IORING_OP_READ;
+    read.fd = m_FixedFiles ? static_cast<int>(index) : fd;
+    read.addr = reinterpret_cast<std::uint64_t>(slot(index)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    read.len = static_cast<std::uint32_t>(m_SlotSize);
+    read.off = 0;
+    read.buf_index = 0;
+    read.user_data = tag(index, Op::Read);
+    // A hard link: procfs reads are nearly always short, and a short read would sever a soft link and skip the close
+    read.flags = IOSQE_IO_HARDLINK | (m_FixedFiles ? IOSQE_FIXED_FILE : 0);
+
+    io_uring_sqe& close = nextSqe();
+    close.opcode = IORING_OP_CLOSE;
+    close.user_data = tag(index, Op::Close);
+#ifdef IORING_FEAT_CQE_SKIP
+    if (m_FixedFiles)
+    {
+        close.file_index = index + 1;
+        return;
+    }
+#endif
+    close.fd = fd;
+}
+
+int BatchFileReader::Ring::submitAndWait(std::uint32_t completions)
+{
+    std::atomic_ref<unsigned>(*m_SqTail).store(m_LocalTail, std::memory_order_release);
+
+    std::uint32_t toSubmit = std::exchange(m_Pending, 0);
+    while (true)
+    {
+        if (s_EnterFaultHook != nullptr)
+        {
+            if (const int fault = s_EnterFaultHook(); fault != 0)
+            {
+                m_Pending = toSubmit;
+                return fault;
+            }
+        }
+
+        const int result = ioUringEnter(m_Fd, toSubmit, completions, IORING_ENTER_GETEVENTS);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            m_Pending = toSubmit;
+            return errno;
+        }
+
+        toSubmit -= std::min(toSubmit, static_cast<std::uint32_t>(result));
+        const unsigned ready = std::atomic_ref<unsigned>(*m_CqTail).load(std::memory_order_acquire) - *m_CqHead;
+        if (toSubmit == 0 && ready >= completions)
+        {
+            return 0;
+        }
+    }
+}
+
+template<typename F> void BatchFileReader::Ring::drain(F&& onCompletion)
+{
+    unsigned head = *m_CqHead;
+    const unsigned tail = std::atomic_ref<unsigned>(*m_CqTail).load(std::memory_order_acquire);
+    for (; head != tail; ++head)
+    {
+        const io_uring_cqe& cqe = m_Cqes[head & m_CqMask];
+        onCompletion(static_cast<std::uint32_t>(cqe.user_data >> 2), static_cast<Op>(cqe.user_data & 3), cqe.res);
+    }
+    std::atomic_ref<unsigned>(*m_CqHead).store(head, std::memory_order_release);
+}
+
+#else
+
+// Without the uapi header there is nothing to build the ring from; every batch is synchronous
+class BatchFileReader::Ring
+{
+};
+
+#endif // TASKSMACK_HAS_IO_URING
+
+BatchFileReader::EnterFaultHook BatchFileReader::s_EnterFaultHook = nullptr;
+
+BatchFileReader::BatchFileReader() : BatchFileReader(Options{})
+{
+}
+
+BatchFileReader::BatchFileReader(Options options) : m_Options(options)
+{
+    m_Options.queueDepth = std::clamp<std::uint32_t>(m_Options.queueDepth, 1, MAX_QUEUE_DEPTH);
+    m_Options.slotSize = std::max<std::size_t>(m_Options.slotSize, 64);
+
+#if TASKSMACK_HAS_IO_URING
+    if (m_Options.useIoUring)
+    {
+        m_Ring = Ring::create(m_Options.queueDepth, m_Options.slotSize, m_Options.registerFiles);
+    }
+#endif
+}
+
+BatchFileReader::~BatchFileReader() = default;
+
+BatchFileReader::Backend BatchFileReader::backend() const noexcept
+{
+    return m_Ring ? Backend::IoUring : Backend::Sync;
+}
+
+void BatchFileReader::setEnterFaultHook(EnterFaultHook hook) noexcept
+{
+    s_EnterFaultHook = hook;
+}
+
+bool BatchFileReader::usesRegisteredFiles() const noexcept
+{
+#if TASKSMACK_HAS_IO_URING
+    return m_Ring && m_Ring->fixedFiles();
+#else
+    return false;
+#endif
+}
+
+std::size_t BatchFileReader::add(int dirFd, std::string_view path)
+{
+    m_Entries.push_back(Entry{.dirFd = dirFd, .pathOffset = m_Paths.size()});
+    m_Paths.append(path);
+    m_Paths.push_back('\0');
+    return m_Entries.size() - 1;
+}
+
+void BatchFileReader::clear() noexcept
+{
+    m_Entries.clear();
+    m_Paths.clear();
+    m_Data.clear();
+}
+
+std::string_view BatchFileReader::result(std::size_t index) const noexcept
+{
+    if (index >= m_Entries.size())
+    {
+        return {};
+    }
+    const Entry& entry = m_Entries[index];
+    return entry.length == 0 ? std::string_view{} : std::string_view(m_Data.data() + entry.dataOffset, entry.length);
+}
+
+int BatchFileReader::error(std::size_t index) const noexcept
+{
+    return index < m_Entries.size() ? m_Entries[index].error : EINVAL;
+}
+
+void BatchFileReader::submit()
+{
+    ++m_Stats.batches;
+    m_Stats.files += m_Entries.size();
+    m_Data.clear();
+    for (auto& entry : m_Entries)
+    {
+        entry.length = 0;
+        entry.error = 0;
+    }
+
+    std::size_t next = 0;
+    if (m_Ring)
+    {
+        next = submitRing();
+    }
+    for (; next < m_Entries.size(); ++next)
+    {
+        readSync(m_Entries[next]);
+    }
+}
+
+std::size_t BatchFileReader::submitRing()
+{
+#if TASKSMACK_HAS_IO_URING
+    Ring& ring = *m_Ring;
+    std::vector<int> fds;
+    std::vector<std::uint32_t> chained; // Entries whose read+close went into the second enter, in queue order
+    std::vector<std::uint32_t> overflowed;
+
+    for (std::size_t first = 0; first < m_Entries.size(); first += m_Options.queueDepth)
+    {
+        const auto count = static_cast<std::uint32_t>(std::min<std::size_t>(m_Options.queueDepth, m_Entries.size() - first));
+        auto entryAt = [&](std::uint32_t index) -> Entry& { return m_Entries[first + index]; };
+        overflowed.clear();
+
+        const auto onCompletion = [&](std::uint32_t index, Ring::Op op, int res)
+        {
+            Entry& entry = entryAt(index);
+            if (op == Ring::Op::Open)
+            {
+                if (res < 0)
+                {
+                    entry.error = -res;
+                }
+                else if (!ring.fixedFiles())
+                {
+                    fds[index] = res;
+                }
+            }
+            else if (op == Ring::Op::Read)
+            {
+                if (res < 0)
+                {
+                    // A failed open cancels the rest of its chain; keep the open's errno
+                    if (entry.error == 0 && res != -ECANCELED)
+                    {
+                        entry.error = -res;
+                    }
+                }
+                else if (static_cast<std::size_t>(res) == ring.slotSize())
+                {
+                    overflowed.push_back(index);
+                }
+                else
+                {
+                    appendResult(entry, ring.slot(index), static_cast<std::size_t>(res));
+                }
+            }
+            else if (!ring.fixedFiles())
+            {
+                fds[index] = -1; // The chain's close ran (or was cancelled with its open): nothing left to close
+            }
+        };
+
+        int status = 0;
+        if (ring.fixedFiles())
+        {
+            // One enter per chunk: open -> read -> close chains through the fixed-file slots
+            for (std::uint32_t index = 0; index < count; ++index)
+            {
+                ring.prepareOpen(index, entryAt(index).dirFd, m_Paths.c_str() + entryAt(index).pathOffset);
+                ring.prepareReadAndClose(index, -1);
+            }
+            status = ring.submitAndWait(count * 3);
+            ++m_Stats.syscalls;
+            if (status == 0)
+            {
+                ring.drain(onCompletion);
+            }
+        }
+        else
+        {
+            // Without fixed files the read needs the descriptor the open returned: opens in one enter, then read+close
+            fds.assign(count, -1);
+            for (std::uint32_t index = 0; index < count; ++index)
+            {
+                ring.prepareOpen(index, entryAt(index).dirFd, m_Paths.c_str() + entryAt(index).pathOffset);
+            }
+            status = ring.submitAndWait(count);
+            ++m_Stats.syscalls;
+            // Even after a failed enter: any open that did run holds a descriptor
+            ring.drain(onCompletion);
+            if (status == 0)
+            {
+                chained.clear();
+                for (std::uint32_t index = 0; index < count; ++index)
+                {
+                    if (fds[index] >= 0)
+                    {
+                        ring.prepareReadAndClose(index, fds[index]);
+                        chained.push_back(index);
+                    }
+                }
+                if (!chained.empty())
+                {
+                    const auto queued = static_cast<std::uint32_t>(chained.size() * 2);
+                    status = ring.submitAndWait(queued);
+                    ++m_Stats.syscalls;
+                    if (status != 0)
+                    {
+                        // Chains the kernel accepted close their own descriptor; only the rest are still ours
+                        const std::uint32_t accepted = (queued - ring.unsubmitted()) / 2;
+                        for (std::uint32_t chain = 0; chain < accepted; ++chain)
+                        {
+                            fds[chained[chain]] = -1;
+                        }
+                    }
+                    ring.drain(onCompletion);
+                }
+            }
+
+            if (status != 0)
+            {
+                for (int& fd : fds)
+                {
+                    if (fd >= 0)
+                    {
+                        ::close(fd);
+                        ++m_Stats.syscalls;
+                        fd = -1;
+                    }
+                }
+            }
+        }
+
+        if (status != 0)
+        {
+            // Typically a seccomp filter that allows io_uring_setup but not io_uring_enter
+            spdlog::warn("BatchFileReader: io_uring submission failed ({}), switching to synchronous reads", std::strerror(status));
+            m_Ring.reset();
+            return first;
+        }
+
+        for (const std::uint32_t index : overflowed)
+        {
+            ++m_Stats.slotOverflows;
+            readSync(entryAt(index));
+        }
+    }
+#endif
+    return m_Entries.size();
+}
+
+void BatchFileReader::readSync(Entry& entry)
+{
+    entry.length = 0;
+    entry.error = 0;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) - POSIX openat() is variadic
+    const int fd = ::openat(entry.dirFd, m_Paths.c_str() + entry.pathOffset, O_RDONLY | O_CLOEXEC);
+    ++m_Stats.syscalls;
+    if (fd < 0)
+    {
+        entry.error = errno;
+        return;
+    }
+
+    if (m_ScratchBuffer.empty())
+    {
+        m_ScratchBuffer.resize(INITIAL_BUFFER_SIZE);
+    }
+
+    while (true)
+    {
+        const ssize_t bytesRead = ::pread(fd, m_ScratchBuffer.data(), m_ScratchBuffer.size(), 0);
+        ++m_Stats.syscalls;
+        if (bytesRead < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            entry.error = errno;
+            break;
+        }
+
+        const auto length = static_cast<std::size_t>(bytesRead);
+        if (length < m_ScratchBuffer.size() || m_ScratchBuffer.size() >= MAX_BUFFER_SIZE)
+        {
+            appendResult(entry, m_ScratchBuffer.data(), length);
+            break;
+        }
+        m_ScratchBuffer.resize(m_ScratchBuffer.size() * 2);
+    }
+
+    ::close(fd);
+    ++m_Stats.syscalls;
+}
+
+void BatchFileReader::appendResult(Entry& entry, const char* data, std::size_t length)
+{
+    entry.dataOffset = m_Data.size();
+    entry.length = length;
+    m_Data.insert(m_Data.end(), data, data + length);
+}
+
+} // namespace Platform
+
+#endif // __linux__ && __has_include(<unistd.h>) && __has_include(<fcntl.h>)
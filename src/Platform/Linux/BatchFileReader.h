@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Platform
+{
+
+/// Reads many small procfs/sysfs files as one batch.
+///
+/// Callers queue reads with add() (paths relative to a directory descriptor, so a probe
+/// opens /proc once and queues "1234/stat"), run them with submit(), then pick up each
+/// file's contents with result(). A typical probe builds one batch per tick.
+///
+/// When io_uring is available each file becomes a linked open -> read -> close chain and
+/// a whole batch (up to the queue depth) is one io_uring_enter() call. Reads land in
+/// registered buffers; with registered files the chain opens straight into a fixed-file
+/// slot, so no descriptor is ever installed in the process table. If io_uring is missing,
+/// disabled (kernel.io_uring_disabled) or blocked by seccomp, the same batch is read
+/// synchronously with openat/pread/close. A file that fills its buffer slot is re-read
+/// synchronously with a growing buffer, so results are never truncated.
+///
+/// Not thread-safe: each probe owns its reader.
+class BatchFileReader
+{
+  public:
+    enum class Backend : std::uint8_t
+    {
+        Sync,
+        IoUring,
+    };
+
+    struct Options
+    {
+        std::uint32_t queueDepth = 256; // Files in flight per io_uring_enter()
+        std::size_t slotSize = 4096;    // Registered buffer bytes per in-flight file
+        bool registerFiles = true;      // Open into fixed-file slots instead of the fd table
+        bool useIoUring = true;         // false forces the synchronous path
+    };
+
+    /// Counters for benchmarks and diagnostics; cumulative over the reader's lifetime.
+    struct Stats
+    {
+        std::uint64_t batches = 0;
+        std::uint64_t files = 0;
+        std::uint64_t syscalls = 0;      // io_uring_enter() plus every synchronous open/read/close
+        std::uint64_t slotOverflows = 0; // Files re-read synchronously because they filled a slot
+    };
+
+    BatchFileReader();
+    explicit BatchFileReader(Options options);
+    ~BatchFileReader();
+
+    BatchFileReader(const BatchFileReader&) = delete;
+    BatchFileReader& operator=(const BatchFileReader&) = delete;
+    BatchFileReader(BatchFileReader&&) = delete;
+    BatchFileReader& operator=(BatchFileReader&&) = delete;
+
+    [[nodiscard]] Backend backend() const noexcept;
+
+    /// Whether io_uring chains open into fixed-file slots (false on the synchronous path).
+    [[nodiscard]] bool usesRegisteredFiles() const noexcept;
+
+    /// Queue a read of @p path, relative to @p dirFd (AT_FDCWD for the working directory).
+    /// Returns the index to pass to result() and error() after submit().
+    std::size_t add(int dirFd, std::string_view path);
+
+    /// Number of queued reads.
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_Entries.size();
+    }
+
+    /// Read every queued file. Results stay valid until clear() or the next add().
+    void submit();
+
+    /// Contents of read @p index; empty if it failed (see error()).
+    [[nodiscard]] std::string_view result(std::size_t index) const noexcept;
+
+    /// errno of a failed read (ENOENT when the process exited, EACCES, ...), or 0.
+    [[nodiscard]] int error(std::size_t index) const noexcept;
+
+    /// Forget all queued reads and results, keeping the buffers for the next batch.
+    void clear() noexcept;
+
+    [[nodiscard]] const Stats& stats() const noexcept
+    {
+        return m_Stats;
+    }
+
+    /// Test seam: when set, consulted before every io_uring_enter(). A nonzero return
+    /// fails that enter with the returned errno instead of calling into the kernel.
+    using EnterFaultHook = int (*)();
+    static void setEnterFaultHook(EnterFaultHook hook) noexcept;
+
+  private:
+    struct Entry
+    {
+        int dirFd = -1;
+        std::size_t pathOffset = 0; // NUL-terminated path in m_Paths
+        std::size_t dataOffset = 0; // Contents in m_Data
+        std::size_t length = 0;
+        int error = 0;
+    };
+
+    class Ring;
+
+    /// Run the batch through io_uring, one chunk of queueDepth files at a time. Returns the
+    /// index of the first entry left unread; on an io_uring failure the ring is dropped and
+    /// the caller finishes synchronously from there.
+    [[nodiscard]] std::size_t submitRing();
+    void readSync(Entry& entry);
+    void appendResult(Entry& entry, const char* data, std::size_t length);
+
+    Options m_Options;
+    std::unique_ptr<Ring> m_Ring; // Null on the synchronous path
+    std::vector<Entry> m_Entries;
+    std::string m_Paths;
+    std::vector<char> m_Data;
+    std::vector<char> m_ScratchBuffer; // Growing buffer for synchronous reads
+    Stats m_Stats;
+
+    static EnterFaultHook s_EnterFaultHook;
+};
+
+} // namespace Platform
@@ -0,0 +1,83 @@
+// Keep this translation unit parseable on non-Linux platforms (e.g. Windows clangd)
+// by compiling the implementation only when targeting Linux and required headers exist.
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "CpuFreqReader.h"
+
+#include "ProcParse.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Platform
+{
+
+CpuFreqReader::CpuFreqReader(std::string cpuRoot) : m_CpuRoot(std::move(cpuRoot))
+{
+}
+
+void CpuFreqReader::open(Entry& entry, std::uint32_t cpuId) const
+{
+    const std::string dir = m_CpuRoot + "/cpu" + std::to_string(cpuId) + "/cpufreq/";
+
+    // scaling_cur_freq is world-readable; cpuinfo_cur_freq (hardware-reported) is often root-only
+    entry.file = ProcFile(dir + "scaling_cur_freq");
+    if (!entry.file.isOpen())
+    {
+        entry.file = ProcFile(dir + "cpuinfo_cur_freq");
+    }
+    entry.attempted = true;
+}
+
+void CpuFreqReader::read(const std::vector<std::uint32_t>& cpuIds, std::vector<std::uint32_t>& outMHz)
+{
+    ++m_Generation;
+    outMHz.assign(cpuIds.size(), 0);
+
+    for (std::size_t i = 0; i < cpuIds.size(); ++i)
+    {
+        const std::uint32_t cpuId = cpuIds[i];
+        if (cpuId >= m_Entries.size())
+        {
+            m_Entries.resize(static_cast<std::size_t>(cpuId) + 1);
+        }
+
+        Entry& entry = m_Entries[cpuId];
+
+        // A CPU missing from the previous tick was offline; its cpufreq directory was
+        // removed and recreated, so the old descriptor is stale.
+        if (entry.lastSeen + 1 != m_Generation)
+        {
+            entry.attempted = false;
+        }
+        entry.lastSeen = m_Generation;
+
+        if (!entry.attempted)
+        {
+            open(entry, cpuId);
+        }
+        if (!entry.file.isOpen())
+        {
+            continue;
+        }
+
+        std::string_view text = entry.file.read();
+        std::uint64_t freqKHz = 0;
+        if (ProcParse::nextInteger(text, freqKHz))
+        {
+            outMHz[i] = static_cast<std::uint32_t>(freqKHz / 1000);
+        }
+        else
+        {
+            entry.attempted = false; // Retry the open next tick
+        }
+    }
+}
+
+} // namespace Platform
+
+#endif
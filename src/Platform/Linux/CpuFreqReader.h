@@ -0,0 +1,46 @@
+#pragma once
+
+#include "ProcFile.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Platform
+{
+
+/// Per-core current frequency reader for Linux cpufreq.
+///
+/// Keeps one persistent descriptor per logical CPU on
+/// <cpuRoot>/cpuN/cpufreq/scaling_cur_freq (falling back to cpuinfo_cur_freq) and
+/// re-reads it with pread() every tick, so sampling 100+ cores costs one syscall per
+/// core instead of open/read/close.
+///
+/// Descriptors are opened lazily the first time a CPU id is requested and reopened
+/// after a CPU has been absent (offlining removes its cpufreq directory).
+/// Not thread-safe; LinuxSystemProbe serializes access with its file mutex.
+class CpuFreqReader
+{
+  public:
+    explicit CpuFreqReader(std::string cpuRoot = "/sys/devices/system/cpu");
+
+    /// Read current frequency (MHz) for each id in @p cpuIds into @p outMHz
+    /// (resized to match; 0 where cpufreq is unavailable).
+    void read(const std::vector<std::uint32_t>& cpuIds, std::vector<std::uint32_t>& outMHz);
+
+  private:
+    struct Entry
+    {
+        ProcFile file;
+        bool attempted = false;     // Open was tried (success or not)
+        std::uint64_t lastSeen = 0; // read() generation that last requested this CPU
+    };
+
+    void open(Entry& entry, std::uint32_t cpuId) const;
+
+    std::string m_CpuRoot;
+    std::vector<Entry> m_Entries; // Indexed by logical CPU id
+    std::uint64_t m_Generation = 0;
+};
+
+} // namespace Platform
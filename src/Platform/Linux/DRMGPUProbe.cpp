@@ -15,7 +15,7 @@ namespace Platform
 
 namespace Fs = std::filesystem;
 
-DRMGPUProbe::DRMGPUProbe()
+DRMGPUProbe::DRMGPUProbe(const SystemRoots& roots) : m_DrmPath(roots.sysPath("class/drm"))
 {
     // Must call initialize() in the body, not the initializer list,
     // because initialize() uses m_Cards which must be constructed first
@@ -50,14 +50,13 @@ bool DRMGPUProbe::initialize()
     return !m_Cards.empty();
 }
 
-std::vector<DRMGPUProbe::DRMCard> DRMGPUProbe::discoverDRMCards()
+std::vector<DRMGPUProbe::DRMCard> DRMGPUProbe::discoverDRMCards() const
 {
     std::vector<DRMCard> cards;
 
-    const std::string drmPath = "/sys/class/drm";
-    if (!Fs::exists(drmPath))
+    if (!Fs::exists(m_DrmPath))
     {
-        spdlog::debug("DRMGPUProbe: /sys/class/drm not found");
+        spdlog::debug("DRMGPUProbe: {} not found", m_DrmPath);
         return cards;
     }
 
@@ -69,7 +68,7 @@ std::vector<DRMGPUProbe::DRMCard> DRMGPUProbe::discoverDRMCards()
     };
 
     // Iterate over /sys/class/drm/card* entries
-    for (const auto& entry : Fs::directory_iterator(drmPath))
+    for (const auto& entry : Fs::directory_iterator(m_DrmPath))
     {
         const std::string cardName = entry.path().filename().string();
 
@@ -343,9 +342,8 @@ std::vector<GPUCounters> DRMGPUProbe::readGPUCounters()
 
 std::vector<ProcessGPUCounters> DRMGPUProbe::readProcessGPUCounters()
 {
-    // Per-process GPU metrics are not exposed via DRM sysfs for Intel
-    // Would require fdinfo parsing or DRM client stats (kernel 5.19+)
-    // Not in scope for Phase 5
+    // Per-process GPU metrics are not exposed via DRM sysfs. LinuxGPUProbe reads them from
+    // DRM client stats in /proc/<pid>/fdinfo (DrmClientStats), which covers amdgpu too
     return {};
 }
 
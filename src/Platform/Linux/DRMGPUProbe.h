@@ -2,6 +2,7 @@
 
 #include "Platform/GPUTypes.h"
 #include "Platform/IGPUProbe.h"
+#include "SystemRoots.h"
 
 #include <string>
 #include <vector>
@@ -15,7 +16,7 @@ namespace Platform
 class DRMGPUProbe : public IGPUProbe
 {
   public:
-    DRMGPUProbe();
+    explicit DRMGPUProbe(const SystemRoots& roots = {});
     ~DRMGPUProbe() override = default;
 
     // Rule of 5
@@ -47,7 +48,7 @@ class DRMGPUProbe : public IGPUProbe
     };
 
     bool initialize();
-    [[nodiscard]] static std::vector<DRMCard> discoverDRMCards();
+    [[nodiscard]] std::vector<DRMCard> discoverDRMCards() const;
     [[nodiscard]] static bool isIntelGPU(const DRMCard& card);
     [[nodiscard]] static std::string readSysfsString(const std::string& path);
     [[nodiscard]] static uint64_t readSysfsUint64(const std::string& path);
@@ -55,6 +56,7 @@ class DRMGPUProbe : public IGPUProbe
     [[nodiscard]] static std::string getVendorName(const std::string& vendorId);
     [[nodiscard]] GPUInfo cardToGPUInfo(const DRMCard& card) const;
 
+    std::string m_DrmPath; // <sys>/class/drm
     bool m_Available{false};
     std::vector<DRMCard> m_Cards;
 };
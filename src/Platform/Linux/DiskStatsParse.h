@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Platform/StorageTypes.h"
+#include "ProcParse.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Platform
+{
+
+namespace DiskStatsParseDetail
+{
+
+// Counter fields after "major minor name", in kernel order (Documentation/admin-guide/iostats.rst)
+enum DiskStatsField : std::uint8_t
+{
+    DISK_READS = 0,
+    DISK_READS_MERGED,
+    DISK_READ_SECTORS,
+    DISK_READ_TIME_MS,
+    DISK_WRITES,
+    DISK_WRITES_MERGED,
+    DISK_WRITE_SECTORS,
+    DISK_WRITE_TIME_MS,
+    DISK_IN_FLIGHT,
+    DISK_IO_TIME_MS,
+    DISK_WEIGHTED_IO_TIME_MS,
+    DISK_DISCARDS, // 4.18+
+    DISK_DISCARDS_MERGED,
+    DISK_DISCARD_SECTORS,
+    DISK_DISCARD_TIME_MS,
+    DISK_FLUSHES, // 5.5+
+    DISK_FLUSH_TIME_MS,
+    DISK_FIELD_COUNT,
+};
+
+inline constexpr std::size_t DISK_MIN_FIELDS = DISK_WEIGHTED_IO_TIME_MS + 1; // 2.6.25+ layout
+
+} // namespace DiskStatsParseDetail
+
+/// Parse one /proc/diskstats line without allocating.
+///
+/// Format:
+///    259       0 nvme0n1 1634 0 109946 263 3226 1567 91874 1740 0 1512 2362 0 0 0 0 147 358
+///   major minor name     reads merged sectors ms writes merged sectors ms inflight io_ms weighted_ms
+///                        [discards merged sectors ms [flushes ms]]
+/// On success @p name views into @p line and every counter of @p out except deviceName,
+/// sectorSize and isPhysicalDevice is overwritten. Discard and flush fields are only
+/// present (and hasDiscardStats / hasFlushStats only set) on kernels that report them.
+/// Returns false if the line has fewer than the 11 classic counters.
+[[nodiscard]] inline bool parseDiskStatsLine(std::string_view line, std::string_view& name, DiskCounters& out) noexcept
+{
+    using namespace DiskStatsParseDetail;
+
+    std::uint32_t major = 0;
+    std::uint32_t minor = 0;
+    if (!ProcParse::nextInteger(line, major) || !ProcParse::nextInteger(line, minor))
+    {
+        return false;
+    }
+    name = ProcParse::nextToken(line);
+    if (name.empty())
+    {
+        return false;
+    }
+
+    std::array<std::uint64_t, DISK_FIELD_COUNT> fields{};
+    std::size_t count = 0;
+    while (count < fields.size() && ProcParse::nextInteger(line, fields[count]))
+    {
+        ++count;
+    }
+    if (count < DISK_MIN_FIELDS)
+    {
+        return false;
+    }
+
+    out.readsCompleted = fields[DISK_READS];
+    out.readsMerged = fields[DISK_READS_MERGED];
+    out.readSectors = fields[DISK_READ_SECTORS];
+    out.readTimeMs = fields[DISK_READ_TIME_MS];
+    out.writesCompleted = fields[DISK_WRITES];
+    out.writesMerged = fields[DISK_WRITES_MERGED];
+    out.writeSectors = fields[DISK_WRITE_SECTORS];
+    out.writeTimeMs = fields[DISK_WRITE_TIME_MS];
+    out.ioInFlight = fields[DISK_IN_FLIGHT];
+    out.ioTimeMs = fields[DISK_IO_TIME_MS];
+    out.weightedIoTimeMs = fields[DISK_WEIGHTED_IO_TIME_MS];
+
+    out.hasDiscardStats = count > DISK_DISCARD_TIME_MS;
+    out.discardsCompleted = fields[DISK_DISCARDS];
+    out.discardsMerged = fields[DISK_DISCARDS_MERGED];
+    out.discardSectors = fields[DISK_DISCARD_SECTORS];
+    out.discardTimeMs = fields[DISK_DISCARD_TIME_MS];
+
+    out.hasFlushStats = count > DISK_FLUSH_TIME_MS;
+    out.flushesCompleted = fields[DISK_FLUSHES];
+    out.flushTimeMs = fields[DISK_FLUSH_TIME_MS];
+    return true;
+}
+
+} // namespace Platform
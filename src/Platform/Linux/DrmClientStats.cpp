@@ -0,0 +1,296 @@
+// Keep this translation unit parseable on non-Linux platforms (e.g. Windows clangd)
+// by compiling the implementation only when targeting Linux and required headers exist.
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "DrmClientStats.h"
+
+#include "DrmFdinfoParse.h"
+#include "Platform/GPUTypes.h"
+#include "ProcParse.h"
+#include "SharedFdTable.h"
+#include "SystemRoots.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Platform
+{
+
+namespace
+{
+
+/// Queue "<pid>/fdinfo/<fd>" relative to /proc; the reader copies the path.
+void queueFdinfo(BatchFileReader& reader, int procDirFd, std::int32_t pid, std::int32_t fd)
+{
+    std::array<char, 48> path{};
+    (void) reader.add(procDirFd, ProcParse::formatPidPath(path, pid, "fdinfo/", fd));
+}
+
+} // namespace
+
+DrmClientStats::DrmClientStats(const SystemRoots& roots)
+    : m_ProcRoot(roots.proc), m_Available(detectSupportedCard(roots))
+{
+    if (!m_Available)
+    {
+        spdlog::debug("DrmClientStats: no i915/xe/amdgpu device, per-process DRM stats disabled");
+        return;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) - POSIX open() is variadic
+    m_ProcDirFd = ::open(m_ProcRoot.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (m_ProcDirFd < 0)
+    {
+        spdlog::warn("DrmClientStats: failed to open {}", m_ProcRoot);
+        m_Available = false;
+    }
+}
+
+DrmClientStats::~DrmClientStats()
+{
+    if (m_ProcDirFd >= 0)
+    {
+        ::close(m_ProcDirFd);
+    }
+}
+
+bool DrmClientStats::isSupportedDriver(std::string_view driver) noexcept
+{
+    return driver == "i915" || driver == "xe" || driver == "amdgpu";
+}
+
+bool DrmClientStats::detectSupportedCard(const SystemRoots& roots)
+{
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(roots.sysPath("class/drm"), ec))
+    {
+        const std::string name = entry.path().filename().string();
+        if (!name.starts_with("card") || name.contains('-'))
+        {
+            continue; // Connectors (card0-DP-1) and render nodes share the device of their card
+        }
+
+        const auto driver = std::filesystem::read_symlink(entry.path() / "device" / "driver", ec);
+        if (!ec && isSupportedDriver(driver.filename().string()))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+DrmClientStats::EngineClass DrmClientStats::classifyEngine(std::string_view name) noexcept
+{
+    // i915: render, copy, video, video-enhance, compute
+    // xe: rcs, bcs, vcs, vecs, ccs
+    // amdgpu: gfx, compute, dma, dec, enc, enc_1, jpeg, vpe
+    if (name == "render" || name == "gfx" || name == "rcs")
+    {
+        return EngineClass::Render;
+    }
+    if (name == "compute" || name == "ccs")
+    {
+        return EngineClass::Compute;
+    }
+    if (name == "copy" || name == "bcs" || name == "dma")
+    {
+        return EngineClass::Copy;
+    }
+    // The i915/xe video engines do both encode and decode; they are reported as decode
+    if (name == "video" || name == "vcs" || name == "dec" || name == "jpeg")
+    {
+        return EngineClass::VideoDecode;
+    }
+    if (name.starts_with("enc"))
+    {
+        return EngineClass::VideoEncode;
+    }
+    if (name == "video-enhance" || name == "vecs" || name == "vpe")
+    {
+        return EngineClass::VideoEnhance;
+    }
+    return EngineClass::Other;
+}
+
+std::string_view DrmClientStats::engineClassName(EngineClass engineClass) noexcept
+{
+    switch (engineClass)
+    {
+    case EngineClass::Render:
+        return "3D";
+    case EngineClass::Compute:
+        return "Compute";
+    case EngineClass::Copy:
+        return "Copy";
+    case EngineClass::VideoDecode:
+        return "Video Decode";
+    case EngineClass::VideoEncode:
+        return "Video Encode";
+    case EngineClass::VideoEnhance:
+        return "Video Enhance";
+    case EngineClass::Other:
+    case EngineClass::Count:
+        break;
+    }
+    return "Other";
+}
+
+double DrmClientStats::updateEngine(EngineState& state,
+                                    const DrmEngineUsage& usage,
+                                    bool hasPrevious,
+                                    std::chrono::nanoseconds elapsed) noexcept
+{
+    double percent = 0.0;
+    if (hasPrevious)
+    {
+        const double capacity = static_cast<double>(usage.capacity);
+        if (usage.hasCycles)
+        {
+            // xe: busy cycles over elapsed GPU timestamp cycles
+            if (usage.cycles >= state.cycles && usage.totalCycles > state.totalCycles)
+            {
+                percent = 100.0 * static_cast<double>(usage.cycles - state.cycles) /
+                          (static_cast<double>(usage.totalCycles - state.totalCycles) * capacity);
+            }
+        }
+        else if (usage.busyNs >= state.busyNs && elapsed.count() > 0)
+        {
+            percent = 100.0 * static_cast<double>(usage.busyNs - state.busyNs) / (static_cast<double>(elapsed.count()) * capacity);
+        }
+    }
+
+    state.busyNs = usage.busyNs;
+    state.cycles = usage.cycles;
+    state.totalCycles = usage.totalCycles;
+    return std::clamp(percent, 0.0, 100.0);
+}
+
+std::vector<ProcessGPUCounters> DrmClientStats::sample()
+{
+    return sample(std::chrono::steady_clock::now());
+}
+
+std::vector<ProcessGPUCounters> DrmClientStats::sample(std::chrono::steady_clock::time_point now)
+{
+    std::vector<ProcessGPUCounters> result;
+    if (!m_Available)
+    {
+        return result;
+    }
+
+    const auto fdTable = SharedFdTable::instance(m_ProcRoot).read(m_FdTableConsumer);
+
+    m_Reader.clear();
+    for (const auto& drmFd : fdTable->drmFds)
+    {
+        queueFdinfo(m_Reader, m_ProcDirFd, drmFd.pid, drmFd.fd);
+    }
+    m_Reader.submit();
+
+    ++m_Generation;
+    m_ClassUtil.clear();
+
+    for (std::size_t i = 0; i < fdTable->drmFds.size(); ++i)
+    {
+        const std::int32_t pid = fdTable->drmFds[i].pid;
+        if (!parseDrmFdinfo(m_Reader.result(i), m_Fdinfo) || !isSupportedDriver(m_Fdinfo.driver))
+        {
+            continue; // Closed since the walk, or not a client of an Intel/AMD device
+        }
+
+        const std::string_view gpuId = m_Fdinfo.pdev.empty() ? m_Fdinfo.driver : m_Fdinfo.pdev;
+        m_Key.assign(gpuId);
+        m_Key.push_back('/');
+        std::array<char, 24> clientId{};
+        m_Key.append(clientId.data(), std::to_chars(clientId.data(), clientId.data() + clientId.size(), m_Fdinfo.clientId).ptr);
+
+        const auto [it, inserted] = m_Clients.try_emplace(m_Key);
+        ClientState& client = it->second;
+        if (client.lastSeen == m_Generation)
+        {
+            continue; // Shared client, already counted for an earlier fd
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - client.sampleTime);
+        client.lastSeen = m_Generation;
+        client.sampleTime = now;
+
+        // Entries of one process are adjacent (the walk goes PID by PID)
+        auto entry = std::find_if(result.rbegin(),
+                                  result.rend(),
+                                  [&](const ProcessGPUCounters& counters) { return counters.pid != pid || counters.gpuId == gpuId; });
+        if (entry == result.rend() || entry->pid != pid)
+        {
+            auto& counters = result.emplace_back();
+            counters.pid = pid;
+            counters.gpuId = gpuId;
+            counters.gpuName.assign(m_Fdinfo.driver);
+            if (!m_Fdinfo.pdev.empty())
+            {
+                counters.gpuName.push_back(' ');
+                counters.gpuName.append(m_Fdinfo.pdev);
+            }
+            m_ClassUtil.push_back({});
+            entry = result.rbegin();
+        }
+        auto& classUtil = m_ClassUtil[static_cast<std::size_t>(result.rend() - entry) - 1];
+        entry->gpuMemoryBytes += m_Fdinfo.memoryBytes;
+
+        for (const auto& usage : m_Fdinfo.engines)
+        {
+            if (!usage.hasBusyNs && !usage.hasCycles)
+            {
+                continue; // Only a capacity line
+            }
+
+            auto state = std::find_if(client.engines.begin(),
+                                      client.engines.end(),
+                                      [&](const EngineState& engine) { return engine.name == usage.name; });
+            const bool hasPrevious = !inserted && state != client.engines.end();
+            if (state == client.engines.end())
+            {
+                state = client.engines.insert(client.engines.end(), EngineState{.name = std::string(usage.name)});
+            }
+
+            classUtil[static_cast<std::size_t>(classifyEngine(usage.name))] += updateEngine(*state, usage, hasPrevious, elapsed);
+        }
+    }
+
+    std::erase_if(m_Clients, [this](const auto& client) { return client.second.lastSeen != m_Generation; });
+
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+        auto& counters = result[i];
+        for (std::size_t engineClass = 0; engineClass < ENGINE_CLASS_COUNT; ++engineClass)
+        {
+            const double percent = std::min(m_ClassUtil[i][engineClass], 100.0);
+            if (percent <= 0.0)
+            {
+                continue;
+            }
+            counters.gpuUtilPercent = std::max(counters.gpuUtilPercent, percent);
+            counters.activeEngines.emplace_back(engineClassName(static_cast<EngineClass>(engineClass)));
+        }
+        counters.decoderUtilPercent = std::min(m_ClassUtil[i][static_cast<std::size_t>(EngineClass::VideoDecode)], 100.0);
+        counters.encoderUtilPercent = std::min(m_ClassUtil[i][static_cast<std::size_t>(EngineClass::VideoEncode)], 100.0);
+    }
+
+    return result;
+}
+
+} // namespace Platform
+
+#endif
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "BatchFileReader.h"
+#include "DrmFdinfoParse.h"
+#include "Platform/GPUTypes.h"
+#include "SharedFdTable.h"
+#include "SystemRoots.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Platform
+{
+
+/// Per-process GPU usage of Intel (i915, xe) and AMD (amdgpu) GPUs from DRM client stats.
+///
+/// Since kernel 5.19 every open DRM device fd publishes its client's cumulative engine
+/// busy time and memory in /proc/<pid>/fdinfo/<fd>. Each sample takes the DRM fds from
+/// the shared fd-table walk (SharedFdTable), reads all their fdinfo files as one
+/// BatchFileReader batch and turns busy-time deltas into utilization percentages.
+///
+/// A client (one drm-client-id on one device) can be reachable through several fds: dup()
+/// within a process, or an fd inherited across fork(). It is counted once, for the first
+/// process in walk order that holds it. Clients of other drivers (nvidia-drm, which NVML
+/// already covers) are ignored.
+///
+/// Not thread-safe; LinuxGPUProbe owns one instance.
+class DrmClientStats
+{
+  public:
+    explicit DrmClientStats(const SystemRoots& roots = {});
+    ~DrmClientStats();
+
+    DrmClientStats(const DrmClientStats&) = delete;
+    DrmClientStats& operator=(const DrmClientStats&) = delete;
+    DrmClientStats(DrmClientStats&&) = delete;
+    DrmClientStats& operator=(DrmClientStats&&) = delete;
+
+    /// Whether <sys>/class/drm has a card bound to a supported driver.
+    [[nodiscard]] bool isAvailable() const noexcept
+    {
+        return m_Available;
+    }
+
+    /// One entry per (process, GPU) with a DRM client. Utilization covers the time since
+    /// the previous sample; a client's first sample reports memory only.
+    [[nodiscard]] std::vector<ProcessGPUCounters> sample();
+
+    /// As sample(), with the sample time supplied by the caller (tests use a fixed clock).
+    [[nodiscard]] std::vector<ProcessGPUCounters> sample(std::chrono::steady_clock::time_point now);
+
+    /// Whether @p driver (drm-driver value) is one this collector reports.
+    [[nodiscard]] static bool isSupportedDriver(std::string_view driver) noexcept;
+
+  private:
+    /// Engine classes reported per process; names follow ProcessGPUCounters::activeEngines.
+    enum class EngineClass : std::uint8_t
+    {
+        Render,
+        Compute,
+        Copy,
+        VideoDecode,
+        VideoEncode,
+        VideoEnhance,
+        Other,
+        Count,
+    };
+    static constexpr auto ENGINE_CLASS_COUNT = static_cast<std::size_t>(EngineClass::Count);
+
+    struct EngineState
+    {
+        std::string name;
+        std::uint64_t busyNs = 0;
+        std::uint64_t cycles = 0;
+        std::uint64_t totalCycles = 0;
+    };
+
+    struct ClientState
+    {
+        std::vector<EngineState> engines;
+        std::chrono::steady_clock::time_point sampleTime;
+        std::uint64_t lastSeen = 0; // sample() generation
+    };
+
+    [[nodiscard]] static EngineClass classifyEngine(std::string_view name) noexcept;
+    [[nodiscard]] static std::string_view engineClassName(EngineClass engineClass) noexcept;
+
+    /// Utilization of @p usage since @p state was recorded, then record @p usage into it.
+    [[nodiscard]] static double updateEngine(EngineState& state,
+                                             const DrmEngineUsage& usage,
+                                             bool hasPrevious,
+                                             std::chrono::nanoseconds elapsed) noexcept;
+
+    [[nodiscard]] static bool detectSupportedCard(const SystemRoots& roots);
+
+    std::string m_ProcRoot;
+    int m_ProcDirFd = -1; // fdinfo reads are relative to it
+    bool m_Available = false;
+
+    SharedFdTable::Consumer m_FdTableConsumer;
+    BatchFileReader m_Reader;
+    DrmFdinfo m_Fdinfo; // Parse buffer reused for every fd
+    std::string m_Key;  // "<pdev>/<client-id>" scratch
+
+    std::unordered_map<std::string, ClientState> m_Clients;
+    std::uint64_t m_Generation = 0;
+
+    // Per-class utilization of each entry of the result being built (parallel to it)
+    std::vector<std::array<double, ENGINE_CLASS_COUNT>> m_ClassUtil;
+};
+
+} // namespace Platform
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "ProcParse.h"
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Platform
+{
+
+/// Usage of one engine by one DRM client, from its drm-engine-* / drm-cycles-* keys.
+struct DrmEngineUsage
+{
+    std::string_view name;         // "render", "gfx", "rcs", ... (views into the fdinfo text)
+    std::uint64_t busyNs = 0;      // drm-engine-<name>: cumulative busy time
+    std::uint64_t cycles = 0;      // drm-cycles-<name>: busy GPU timestamp cycles (xe)
+    std::uint64_t totalCycles = 0; // drm-total-cycles-<name>: elapsed GPU timestamp cycles (xe)
+    std::uint32_t capacity = 1;    // drm-engine-capacity-<name>: engines of this class
+    bool hasBusyNs = false;
+    bool hasCycles = false;
+};
+
+/// The DRM client stats of one /proc/<pid>/fdinfo/<fd> (kernel drm-usage-stats).
+struct DrmFdinfo
+{
+    std::string_view driver; // drm-driver: i915, xe, amdgpu, ...
+    std::string_view pdev;   // drm-pdev: PCI address, e.g. 0000:00:02.0
+    std::uint64_t clientId = 0;
+    bool hasClientId = false;
+    std::uint64_t memoryBytes = 0;       // Sum of drm-memory-<region>
+    std::vector<DrmEngineUsage> engines; // Capacity is kept across parses, so reuse one DrmFdinfo
+};
+
+namespace DrmFdinfoDetail
+{
+
+/// Bytes from a drm-memory value such as "1024 KiB" (units: none, KiB, MiB, GiB).
+[[nodiscard]] inline bool parseMemory(std::string_view value, std::uint64_t& bytes) noexcept
+{
+    std::uint64_t amount = 0;
+    if (!ProcParse::nextInteger(value, amount))
+    {
+        return false;
+    }
+    const std::string_view unit = ProcParse::nextToken(value);
+    if (unit == "KiB")
+    {
+        amount *= 1024ULL;
+    }
+    else if (unit == "MiB")
+    {
+        amount *= 1024ULL * 1024ULL;
+    }
+    else if (unit == "GiB")
+    {
+        amount *= 1024ULL * 1024ULL * 1024ULL;
+    }
+    bytes = amount;
+    return true;
+}
+
+[[nodiscard]] inline DrmEngineUsage& engine(DrmFdinfo& out, std::string_view name)
+{
+    for (auto& usage : out.engines)
+    {
+        if (usage.name == name)
+        {
+            return usage;
+        }
+    }
+    return out.engines.emplace_back(DrmEngineUsage{.name = name});
+}
+
+} // namespace DrmFdinfoDetail
+
+/// Parse the drm-* keys of an fdinfo file.
+///
+/// Format (after the generic pos/flags/mnt_id/ino lines), one "key:\tvalue" per line:
+///   drm-driver:     i915
+///   drm-pdev:       0000:00:02.0
+///   drm-client-id:  7
+///   drm-engine-render:  25662044495 ns
+///   drm-engine-capacity-video:  2
+///   drm-cycles-rcs: 28257900
+///   drm-total-cycles-rcs:   7655183225
+///   drm-memory-vram:    1024 KiB
+///
+/// String views in @p out point into @p text. Returns false if the fd is not a DRM client
+/// (no drm-client-id), which is also the case on kernels without DRM client stats.
+[[nodiscard]] inline bool parseDrmFdinfo(std::string_view text, DrmFdinfo& out)
+{
+    out.driver = {};
+    out.pdev = {};
+    out.clientId = 0;
+    out.hasClientId = false;
+    out.memoryBytes = 0;
+    out.engines.clear();
+
+    std::string_view line;
+    while (ProcParse::nextLine(text, line))
+    {
+        if (!line.starts_with("drm-"))
+        {
+            continue;
+        }
+        const std::size_t colon = line.find(':');
+        if (colon == std::string_view::npos)
+        {
+            continue;
+        }
+        const std::string_view key = line.substr(4, colon - 4);
+        std::string_view value = line.substr(colon + 1);
+        ProcParse::skipSpaces(value);
+
+        if (key == "driver")
+        {
+            out.driver = ProcParse::trimRight(value);
+        }
+        else if (key == "pdev")
+        {
+            out.pdev = ProcParse::trimRight(value);
+        }
+        else if (key == "client-id")
+        {
+            out.hasClientId = ProcParse::nextInteger(value, out.clientId);
+        }
+        else if (key.starts_with("engine-capacity-"))
+        {
+            std::uint32_t capacity = 0;
+            if (ProcParse::nextInteger(value, capacity) && capacity > 0)
+            {
+                DrmFdinfoDetail::engine(out, key.substr(16)).capacity = capacity;
+            }
+        }
+        else if (key.starts_with("engine-"))
+        {
+            std::uint64_t busyNs = 0;
+            if (ProcParse::nextInteger(value, busyNs))
+            {
+                auto& usage = DrmFdinfoDetail::engine(out, key.substr(7));
+                usage.busyNs = busyNs;
+                usage.hasBusyNs = true;
+            }
+        }
+        else if (key.starts_with("cycles-"))
+        {
+            std::uint64_t cycles = 0;
+            if (ProcParse::nextInteger(value, cycles))
+            {
+                auto& usage = DrmFdinfoDetail::engine(out, key.substr(7));
+                usage.cycles = cycles;
+                usage.hasCycles = true;
+            }
+        }
+        else if (key.starts_with("total-cycles-"))
+        {
+            std::uint64_t totalCycles = 0;
+            if (ProcParse::nextInteger(value, totalCycles))
+            {
+                DrmFdinfoDetail::engine(out, key.substr(13)).totalCycles = totalCycles;
+            }
+        }
+        else if (key.starts_with("memory-"))
+        {
+            std::uint64_t bytes = 0;
+            if (DrmFdinfoDetail::parseMemory(value, bytes))
+            {
+                out.memoryBytes += bytes;
+            }
+        }
+    }
+
+    return out.hasClientId;
+}
+
+} // namespace Platform
@@ -14,15 +14,28 @@
 #include "Platform/IProcessActions.h"
 #include "Platform/IProcessProbe.h"
 #include "Platform/ISystemProbe.h"
+#include "SystemRoots.h"
 
 #include <memory>
 
 namespace Platform
 {
 
+namespace
+{
+
+/// procfs/sysfs roots for every probe, read from the environment once per process.
+[[nodiscard]] const SystemRoots& systemRoots()
+{
+    static const SystemRoots roots = SystemRoots::fromEnvironment();
+    return roots;
+}
+
+} // namespace
+
 std::unique_ptr<IProcessProbe> makeProcessProbe()
 {
-    return std::make_unique<LinuxProcessProbe>();
+    return std::make_unique<LinuxProcessProbe>(systemRoots());
 }
 
 std::unique_ptr<IProcessActions> makeProcessActions()
@@ -32,12 +45,12 @@ std::unique_ptr<IProcessActions> makeProcessActions()
 
 std::unique_ptr<ISystemProbe> makeSystemProbe()
 {
-    return std::make_unique<LinuxSystemProbe>();
+    return std::make_unique<LinuxSystemProbe>(systemRoots());
 }
 
 std::unique_ptr<IDiskProbe> makeDiskProbe()
 {
-    return std::make_unique<LinuxDiskProbe>();
+    return std::make_unique<LinuxDiskProbe>(systemRoots());
 }
 
 std::unique_ptr<IPathProvider> makePathProvider()
@@ -47,12 +60,12 @@ std::unique_ptr<IPathProvider> makePathProvider()
 
 std::unique_ptr<IPowerProbe> makePowerProbe()
 {
-    return std::make_unique<LinuxPowerProbe>();
+    return std::make_unique<LinuxPowerProbe>(systemRoots());
 }
 
 std::unique_ptr<IGPUProbe> makeGPUProbe()
 {
-    return std::make_unique<LinuxGPUProbe>();
+    return std::make_unique<LinuxGPUProbe>(systemRoots());
 }
 
 } // namespace Platform
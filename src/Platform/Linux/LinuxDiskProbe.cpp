@@ -4,25 +4,25 @@
 
 #include "LinuxDiskProbe.h"
 
+#include "DiskStatsParse.h"
 #include "Platform/StorageTypes.h"
+#include "ProcParse.h"
 
 #include <spdlog/spdlog.h>
 
 #include <cctype>
-#include <cstdint>
-#include <fstream>
-#include <sstream>
-#include <string>
+#include <string_view>
 
 namespace Platform
 {
 
-LinuxDiskProbe::LinuxDiskProbe()
+LinuxDiskProbe::LinuxDiskProbe(const SystemRoots& roots)
+    : m_DiskStatsFile(roots.procPath("diskstats")), m_MountTable(roots.procPath("self/mountinfo"), roots.sysPath("dev/block"))
 {
     spdlog::debug("LinuxDiskProbe: initialized");
 }
 
-bool LinuxDiskProbe::shouldIncludeDevice(const std::string& deviceName)
+bool LinuxDiskProbe::shouldIncludeDevice(std::string_view deviceName)
 {
     // Filter out loop devices, ram disks, and partitions for a cleaner view
     // Users can still see partitions by checking detailed device info if needed
@@ -61,72 +61,41 @@ bool LinuxDiskProbe::shouldIncludeDevice(const std::string& deviceName)
 SystemDiskCounters LinuxDiskProbe::read()
 {
     SystemDiskCounters result;
+    m_MountTable.read(result.mounts);
 
-    std::ifstream diskstats("/proc/diskstats");
-    if (!diskstats.is_open())
+    if (!m_DiskStatsFile.isOpen())
     {
-        spdlog::warn("LinuxDiskProbe: Failed to open /proc/diskstats");
+        if (!m_WarnedUnavailable)
+        {
+            spdlog::warn("LinuxDiskProbe: Failed to open /proc/diskstats");
+            m_WarnedUnavailable = true;
+        }
         return result;
     }
 
-    std::string line;
-    while (std::getline(diskstats, line))
-    {
-        std::istringstream iss(line);
-
-        // /proc/diskstats format (Linux kernel 2.6+):
-        // major minor device_name reads_completed reads_merged sectors_read time_reading
-        // writes_completed writes_merged sectors_written time_writing
-        // io_in_progress time_io weighted_time_io
-        // (Plus additional fields in newer kernels that we ignore)
-
-        int major = 0;
-        int minor = 0;
-        std::string deviceName;
-        uint64_t readsCompleted = 0;
-        uint64_t readsMerged = 0; // Not used but must be read
-        uint64_t sectorsRead = 0;
-        uint64_t timeReading = 0;
-        uint64_t writesCompleted = 0;
-        uint64_t writesMerged = 0; // Not used but must be read
-        uint64_t sectorsWritten = 0;
-        uint64_t timeWriting = 0;
-        uint64_t ioInProgress = 0;
-        uint64_t timeIo = 0;
-        uint64_t weightedTimeIo = 0;
-
-        iss >> major >> minor >> deviceName >> readsCompleted >> readsMerged >> sectorsRead >> timeReading >> writesCompleted >>
-            writesMerged >> sectorsWritten >> timeWriting >> ioInProgress >> timeIo >> weightedTimeIo;
-
-        if (iss.fail())
-        {
-            // Line didn't parse correctly, skip it
-            continue;
-        }
+    // Hosts with hundreds of block devices: one pread, views into the buffer, and a
+    // std::string only for devices that pass the filter
+    std::string_view text = m_DiskStatsFile.read();
+    result.disks.reserve(m_LastDiskCount);
+
+    DiskCounters disk;
+    disk.sectorSize = 512;        // diskstats always counts 512-byte sectors, whatever the device's block size
+    disk.isPhysicalDevice = true; // Filtered devices are considered "physical" for our purposes
 
-        // Filter devices
-        if (!shouldIncludeDevice(deviceName))
+    std::string_view line;
+    std::string_view deviceName;
+    while (ProcParse::nextLine(text, line))
+    {
+        if (!parseDiskStatsLine(line, deviceName, disk) || !shouldIncludeDevice(deviceName))
         {
             continue;
         }
 
-        DiskCounters disk;
-        disk.deviceName = deviceName;
-        disk.readsCompleted = readsCompleted;
-        disk.readSectors = sectorsRead;
-        disk.readTimeMs = timeReading;
-        disk.writesCompleted = writesCompleted;
-        disk.writeSectors = sectorsWritten;
-        disk.writeTimeMs = timeWriting;
-        disk.ioInProgressMs = ioInProgress;
-        disk.ioTimeMs = timeIo;
-        disk.weightedIoTimeMs = weightedTimeIo;
-        disk.sectorSize = 512;        // Linux typically reports in 512-byte sectors
-        disk.isPhysicalDevice = true; // Filtered devices are considered "physical" for our purposes
-
+        disk.deviceName.assign(deviceName);
         result.disks.push_back(disk);
     }
 
+    m_LastDiskCount = result.disks.size();
     return result;
 }
 
@@ -138,6 +107,7 @@ DiskCapabilities LinuxDiskProbe::capabilities() const
     caps.hasIoTime = true;
     caps.hasDeviceInfo = true;
     caps.canFilterPhysical = true;
+    caps.hasMountStats = m_MountTable.isAvailable();
     return caps;
 }
 
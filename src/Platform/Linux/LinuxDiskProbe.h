@@ -1,16 +1,24 @@
 #pragma once
 
+#include "MountTable.h"
 #include "Platform/IDiskProbe.h"
+#include "ProcFile.h"
+#include "SystemRoots.h"
+
+#include <cstddef>
+#include <string_view>
 
 namespace Platform
 {
 
 /// Linux implementation of IDiskProbe.
-/// Reads disk I/O metrics from /proc/diskstats.
+/// Reads disk I/O metrics from /proc/diskstats through a persistent ProcFile handle,
+/// parsing each line in place (see DiskStatsParse.h), and mounted filesystem
+/// capacity through MountTable.
 class LinuxDiskProbe : public IDiskProbe
 {
   public:
-    LinuxDiskProbe();
+    explicit LinuxDiskProbe(const SystemRoots& roots = {});
     ~LinuxDiskProbe() override = default;
 
     LinuxDiskProbe(const LinuxDiskProbe&) = delete;
@@ -22,7 +30,12 @@ class LinuxDiskProbe : public IDiskProbe
     [[nodiscard]] DiskCapabilities capabilities() const override;
 
   private:
-    [[nodiscard]] static bool shouldIncludeDevice(const std::string& deviceName);
+    [[nodiscard]] static bool shouldIncludeDevice(std::string_view deviceName);
+
+    ProcFile m_DiskStatsFile;
+    MountTable m_MountTable;
+    std::size_t m_LastDiskCount = 0; // Reserve hint for the next read()
+    bool m_WarnedUnavailable = false;
 };
 
 } // namespace Platform
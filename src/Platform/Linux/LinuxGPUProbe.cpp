@@ -1,38 +1,68 @@
 #include "LinuxGPUProbe.h"
 
 #include "DRMGPUProbe.h"
+#include "DrmClientStats.h"
 #include "NVMLGPUProbe.h"
 #include "Platform/GPUTypes.h"
+#include "Platform/GuardedGPUProbe.h"
 #include "ROCmGPUProbe.h"
 
 #include <spdlog/spdlog.h>
 
 #include <cstddef>
+#include <future>
+#include <initializer_list>
+#include <iterator>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Platform
 {
 
-LinuxGPUProbe::LinuxGPUProbe()
-    : m_NVMLProbe(std::make_unique<NVMLGPUProbe>()),
-      m_DRMProbe(std::make_unique<DRMGPUProbe>()),
-      m_ROCmProbe(std::make_unique<ROCmGPUProbe>())
+namespace
 {
+
+/// Wrap @p backend in a guard if it found its library or device.
+template<typename Backend> std::unique_ptr<GuardedGPUProbe> guardIfAvailable(const char* name, std::unique_ptr<Backend> backend)
+{
+    if (!backend->isAvailable())
+    {
+        return nullptr;
+    }
+    return std::make_unique<GuardedGPUProbe>(name, std::move(backend));
+}
+
+} // namespace
+
+LinuxGPUProbe::LinuxGPUProbe(const SystemRoots& roots)
+{
+    // Backends are independent (two dlopens and a sysfs walk): discover them in parallel
+    auto nvml = std::async(std::launch::async, [] { return guardIfAvailable("NVML", std::make_unique<NVMLGPUProbe>()); });
+    auto rocm = std::async(std::launch::async, [] { return guardIfAvailable("ROCm", std::make_unique<ROCmGPUProbe>()); });
+    m_DRMProbe = guardIfAvailable("DRM", std::make_unique<DRMGPUProbe>(roots));
+    m_DrmClients = std::make_unique<DrmClientStats>(roots);
+    m_NVMLProbe = nvml.get();
+    m_ROCmProbe = rocm.get();
+
     std::vector<std::string> probes;
-    if (m_NVMLProbe->isAvailable())
+    if (m_NVMLProbe)
     {
         probes.emplace_back("NVML");
     }
-    if (m_DRMProbe->isAvailable())
+    if (m_DRMProbe)
     {
         probes.emplace_back("DRM");
     }
-    if (m_ROCmProbe->isAvailable())
+    if (m_ROCmProbe)
     {
         probes.emplace_back("ROCm");
     }
+    if (m_DrmClients->isAvailable())
+    {
+        probes.emplace_back("DRM fdinfo");
+    }
 
     std::string probeSummary = probes.empty() ? "None" : "";
     for (std::size_t i = 0; i < probes.size(); ++i)
@@ -54,21 +84,21 @@ std::vector<GPUInfo> LinuxGPUProbe::enumerateGPUs()
     std::vector<GPUInfo> gpus;
 
     // Phase 4: Try NVML first (NVIDIA)
-    if (m_NVMLProbe && m_NVMLProbe->isAvailable())
+    if (m_NVMLProbe)
     {
         auto nvmlGPUs = m_NVMLProbe->enumerateGPUs();
         gpus.insert(gpus.end(), nvmlGPUs.begin(), nvmlGPUs.end());
     }
 
     // Phase 5: Try DRM (Intel)
-    if (m_DRMProbe && m_DRMProbe->isAvailable())
+    if (m_DRMProbe)
     {
         auto drmGPUs = m_DRMProbe->enumerateGPUs();
         gpus.insert(gpus.end(), drmGPUs.begin(), drmGPUs.end());
     }
 
     // Phase 6: Try ROCm (AMD)
-    if (m_ROCmProbe && m_ROCmProbe->isAvailable())
+    if (m_ROCmProbe)
     {
         auto rocmGPUs = m_ROCmProbe->enumerateGPUs();
         gpus.insert(gpus.end(), rocmGPUs.begin(), rocmGPUs.end());
@@ -87,21 +117,21 @@ std::vector<GPUCounters> LinuxGPUProbe::readGPUCounters()
     std::vector<GPUCounters> counters;
 
     // Phase 4: NVML metrics for NVIDIA GPUs
-    if (m_NVMLProbe && m_NVMLProbe->isAvailable())
+    if (m_NVMLProbe)
     {
         auto nvmlCounters = m_NVMLProbe->readGPUCounters();
         counters.insert(counters.end(), nvmlCounters.begin(), nvmlCounters.end());
     }
 
     // Phase 5: DRM metrics for Intel GPUs
-    if (m_DRMProbe && m_DRMProbe->isAvailable())
+    if (m_DRMProbe)
     {
         auto drmCounters = m_DRMProbe->readGPUCounters();
         counters.insert(counters.end(), drmCounters.begin(), drmCounters.end());
     }
 
     // Phase 6: ROCm metrics for AMD GPUs
-    if (m_ROCmProbe && m_ROCmProbe->isAvailable())
+    if (m_ROCmProbe)
     {
         auto rocmCounters = m_ROCmProbe->readGPUCounters();
         counters.insert(counters.end(), rocmCounters.begin(), rocmCounters.end());
@@ -115,20 +145,26 @@ std::vector<ProcessGPUCounters> LinuxGPUProbe::readProcessGPUCounters()
     std::vector<ProcessGPUCounters> counters;
 
     // Phase 4: NVML per-process metrics for NVIDIA
-    if (m_NVMLProbe && m_NVMLProbe->isAvailable())
+    if (m_NVMLProbe)
     {
         auto nvmlCounters = m_NVMLProbe->readProcessGPUCounters();
         counters.insert(counters.end(), nvmlCounters.begin(), nvmlCounters.end());
     }
 
-    // Phase 5: DRM per-process metrics (not available via sysfs)
     // Phase 6: ROCm per-process metrics (not available via ROCm SMI)
-    if (m_ROCmProbe && m_ROCmProbe->isAvailable())
+    if (m_ROCmProbe)
     {
         auto rocmCounters = m_ROCmProbe->readProcessGPUCounters();
         counters.insert(counters.end(), rocmCounters.begin(), rocmCounters.end());
     }
 
+    // Intel and AMD per-process metrics from DRM client stats (fdinfo, kernel 5.19+)
+    if (m_DrmClients && m_DrmClients->isAvailable())
+    {
+        auto drmCounters = m_DrmClients->sample();
+        counters.insert(counters.end(), std::make_move_iterator(drmCounters.begin()), std::make_move_iterator(drmCounters.end()));
+    }
+
     return counters;
 }
 
@@ -137,7 +173,7 @@ GPUCapabilities LinuxGPUProbe::capabilities() const
     GPUCapabilities caps{};
 
     // Phase 4: NVML capabilities
-    if (m_NVMLProbe && m_NVMLProbe->isAvailable())
+    if (m_NVMLProbe)
     {
         auto nvmlCaps = m_NVMLProbe->capabilities();
 
@@ -154,7 +190,7 @@ GPUCapabilities LinuxGPUProbe::capabilities() const
     }
 
     // Phase 5: DRM capabilities (Intel)
-    if (m_DRMProbe && m_DRMProbe->isAvailable())
+    if (m_DRMProbe)
     {
         auto drmCaps = m_DRMProbe->capabilities();
 
@@ -171,7 +207,7 @@ GPUCapabilities LinuxGPUProbe::capabilities() const
     }
 
     // Phase 6: ROCm capabilities (AMD)
-    if (m_ROCmProbe && m_ROCmProbe->isAvailable())
+    if (m_ROCmProbe)
     {
         auto rocmCaps = m_ROCmProbe->capabilities();
 
@@ -187,7 +223,26 @@ GPUCapabilities LinuxGPUProbe::capabilities() const
         caps.supportsMultiGPU = caps.supportsMultiGPU || rocmCaps.supportsMultiGPU;
     }
 
+    // Per-process utilization and memory from DRM fdinfo (Intel and AMD)
+    if (m_DrmClients && m_DrmClients->isAvailable())
+    {
+        caps.hasPerProcessMetrics = true;
+    }
+
     return caps;
 }
 
+std::vector<GPUBackendHealth> LinuxGPUProbe::backendHealth() const
+{
+    std::vector<GPUBackendHealth> health;
+    for (const auto* backend : {m_NVMLProbe.get(), m_DRMProbe.get(), m_ROCmProbe.get()})
+    {
+        if (backend != nullptr)
+        {
+            health.push_back(backend->health());
+        }
+    }
+    return health;
+}
+
 } // namespace Platform
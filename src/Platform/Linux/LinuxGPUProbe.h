@@ -2,6 +2,7 @@
 
 #include "Platform/GPUTypes.h"
 #include "Platform/IGPUProbe.h"
+#include "SystemRoots.h"
 
 #include <memory>
 #include <vector>
@@ -9,18 +10,21 @@
 namespace Platform
 {
 
-class NVMLGPUProbe;
-class DRMGPUProbe;
-class ROCmGPUProbe;
+class GuardedGPUProbe;
+class DrmClientStats;
 
 /// Composite Linux GPU probe that delegates to vendor-specific probes.
 /// Phase 4: Uses NVML for NVIDIA GPUs
 /// Phase 5: Uses DRM for Intel GPUs
 /// Phase 6: Uses ROCm for AMD GPUs
+/// Per-process usage of Intel and AMD GPUs comes from DRM fdinfo (DrmClientStats).
+///
+/// Each available vendor backend runs behind a GuardedGPUProbe, so a wedged driver costs
+/// at most one deadline per call and then only its own backend is backed off.
 class LinuxGPUProbe : public IGPUProbe
 {
   public:
-    LinuxGPUProbe();
+    explicit LinuxGPUProbe(const SystemRoots& roots = {});
     ~LinuxGPUProbe() override;
 
     // Rule of 5
@@ -33,11 +37,14 @@ class LinuxGPUProbe : public IGPUProbe
     [[nodiscard]] std::vector<GPUCounters> readGPUCounters() override;
     [[nodiscard]] std::vector<ProcessGPUCounters> readProcessGPUCounters() override;
     [[nodiscard]] GPUCapabilities capabilities() const override;
+    [[nodiscard]] std::vector<GPUBackendHealth> backendHealth() const override;
 
   private:
-    std::unique_ptr<NVMLGPUProbe> m_NVMLProbe;
-    std::unique_ptr<DRMGPUProbe> m_DRMProbe;
-    std::unique_ptr<ROCmGPUProbe> m_ROCmProbe;
+    // Null when the vendor library or device is not available
+    std::unique_ptr<GuardedGPUProbe> m_NVMLProbe;
+    std::unique_ptr<GuardedGPUProbe> m_DRMProbe;
+    std::unique_ptr<GuardedGPUProbe> m_ROCmProbe;
+    std::unique_ptr<DrmClientStats> m_DrmClients;
 };
 
 } // namespace Platform
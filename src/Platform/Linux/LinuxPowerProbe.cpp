@@ -5,14 +5,19 @@
 #include "LinuxPowerProbe.h"
 
 #include "Platform/PowerTypes.h"
+#include "ProcParse.h"
+#include "UeventMonitor.h"
 
 #include <spdlog/spdlog.h>
 
-#include <charconv>
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
-#include <fstream>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -23,22 +28,10 @@ namespace Platform
 namespace
 {
 
-constexpr const char* POWER_SUPPLY_PATH = "/sys/class/power_supply";
+constexpr double MICRO = 1000000.0;               // µWh -> Wh, µW -> W
+constexpr double MICRO_SQUARED = 1000000000000.0; // µAh * µV -> Wh, µA * µV -> W
 
-[[nodiscard]] bool isBatteryDevice(const std::string& devicePath)
-{
-    std::ifstream typeFile(devicePath + "/type");
-    if (!typeFile.is_open())
-    {
-        return false;
-    }
-
-    std::string type;
-    std::getline(typeFile, type);
-    return type == "Battery";
-}
-
-[[nodiscard]] BatteryState parseBatteryState(const std::string& status)
+[[nodiscard]] BatteryState parseBatteryState(std::string_view status)
 {
     if (status == "Charging")
     {
@@ -59,97 +52,207 @@ constexpr const char* POWER_SUPPLY_PATH = "/sys/class/power_supply";
     return BatteryState::Unknown;
 }
 
-} // namespace
+/// Trimmed contents of a small sysfs attribute (empty if unreadable).
+[[nodiscard]] std::string readAttribute(const std::filesystem::path& path)
+{
+    ProcFile file(path.string());
+    return std::string(ProcParse::trimRight(file.read()));
+}
 
-LinuxPowerProbe::LinuxPowerProbe()
+/// Re-read an integer attribute through its persistent handle.
+template<typename T> [[nodiscard]] T readInteger(ProcFile& file, T fallback)
 {
-    discoverBatteries();
-    spdlog::debug("LinuxPowerProbe: found {} batteries", m_BatteryPaths.size());
+    std::string_view text = file.read();
+    T value{};
+    return ProcParse::nextInteger(text, value) ? value : fallback;
 }
 
-void LinuxPowerProbe::discoverBatteries()
+/// Magnitude of a rate attribute; some drivers report current_now/power_now signed.
+[[nodiscard]] double readMagnitude(ProcFile& file)
 {
-    namespace Fs = std::filesystem;
+    const auto value = readInteger<std::int64_t>(file, 0);
+    return static_cast<double>(value < 0 ? -value : value);
+}
 
-    std::error_code ec;
-    if (!Fs::exists(POWER_SUPPLY_PATH, ec) || !Fs::is_directory(POWER_SUPPLY_PATH, ec))
+/// Open @p name, or @p fallbackName if @p name does not exist. Returns true if the fallback was used.
+bool openEither(ProcFile& file, const std::filesystem::path& dir, const char* name, const char* fallbackName)
+{
+    file = ProcFile((dir / name).string());
+    if (file.isOpen())
     {
-        spdlog::debug("LinuxPowerProbe: {} not found or not a directory", POWER_SUPPLY_PATH);
-        m_Capabilities.hasBattery = false;
-        return;
+        return false;
     }
+    file = ProcFile((dir / fallbackName).string());
+    return file.isOpen();
+}
 
-    // Collect all battery paths, then sort to prefer real batteries over peripherals
-    std::vector<std::string> primaryBatteries;    // BAT*, CMB*, etc.
-    std::vector<std::string> peripheralBatteries; // hidpp_battery_*, wacom_*, etc.
+} // namespace
 
-    for (const auto& entry : Fs::directory_iterator(POWER_SUPPLY_PATH, ec))
+LinuxPowerProbe::LinuxPowerProbe(const SystemRoots& roots, std::chrono::milliseconds rescanInterval)
+    : m_PowerSupplyPath(roots.sysPath("class/power_supply")), m_RescanInterval(rescanInterval)
+{
+    // Kernel uevents describe the running kernel's sysfs; a captured or host-mounted tree
+    // elsewhere relies on the rescan interval alone
+    if (roots.isDefault())
     {
-        if (!entry.is_directory(ec))
+        auto uevents = std::make_unique<UeventMonitor>("power_supply");
+        if (uevents->isAvailable())
         {
-            continue;
+            m_Uevents = std::move(uevents);
         }
+    }
+
+    discoverSupplies();
+    spdlog::debug("LinuxPowerProbe: battery={}, {} AC supplies, uevents={}", m_Capabilities.hasBattery, m_AcOnline.size(), hasUevents());
+}
+
+LinuxPowerProbe::~LinuxPowerProbe() = default;
+LinuxPowerProbe::LinuxPowerProbe(LinuxPowerProbe&&) noexcept = default;
+LinuxPowerProbe& LinuxPowerProbe::operator=(LinuxPowerProbe&&) noexcept = default;
+
+bool LinuxPowerProbe::hasUevents() const noexcept
+{
+    return m_Uevents != nullptr;
+}
+
+void LinuxPowerProbe::discoverSupplies()
+{
+    namespace Fs = std::filesystem;
+
+    ++m_ScanCount;
+    m_LastScan = std::chrono::steady_clock::now();
+    m_RescanPending = false;
+    m_Battery.reset();
+    m_AcOnline.clear();
+    m_Capabilities = {};
+
+    // Prefer real batteries over peripherals; name order keeps BAT0 ahead of BAT1
+    std::vector<Fs::path> primaryBatteries;    // BAT*, CMB*, etc.
+    std::vector<Fs::path> peripheralBatteries; // hidpp_battery_*, wacom_*, etc.
 
-        const auto devicePath = entry.path().string();
-        if (isBatteryDevice(devicePath))
+    std::error_code ec;
+    for (const auto& entry : Fs::directory_iterator(m_PowerSupplyPath, ec))
+    {
+        const std::string type = readAttribute(entry.path() / "type");
+        if (type == "Mains" || type == "USB")
         {
-            const auto deviceName = entry.path().filename().string();
-            // Primary system batteries typically start with BAT, CMB (ThinkPad), or similar
-            if (deviceName.starts_with("BAT") || deviceName.starts_with("CMB"))
-            {
-                primaryBatteries.push_back(devicePath);
-                spdlog::debug("LinuxPowerProbe: discovered primary battery at {}", devicePath);
-            }
-            else
+            ProcFile online((entry.path() / "online").string());
+            if (online.isOpen())
             {
-                peripheralBatteries.push_back(devicePath);
-                spdlog::debug("LinuxPowerProbe: discovered peripheral battery at {}", devicePath);
+                m_AcOnline.push_back(std::move(online));
             }
+            continue;
+        }
+        if (type != "Battery")
+        {
+            continue;
         }
-    }
 
-    // Prefer primary batteries, then peripherals
-    m_BatteryPaths = std::move(primaryBatteries);
-    m_BatteryPaths.insert(m_BatteryPaths.end(), peripheralBatteries.begin(), peripheralBatteries.end());
+        const auto deviceName = entry.path().filename().string();
+        // Primary system batteries typically start with BAT, CMB (ThinkPad), or similar
+        if (deviceName.starts_with("BAT") || deviceName.starts_with("CMB"))
+        {
+            primaryBatteries.push_back(entry.path());
+        }
+        else
+        {
+            peripheralBatteries.push_back(entry.path());
+        }
+    }
 
     if (ec)
     {
-        spdlog::warn("LinuxPowerProbe: error iterating {}: {}", POWER_SUPPLY_PATH, ec.message());
+        spdlog::debug("LinuxPowerProbe: cannot iterate {}: {}", m_PowerSupplyPath, ec.message());
     }
 
-    // Set capabilities based on discovery
-    m_Capabilities.hasBattery = !m_BatteryPaths.empty();
-    if (m_Capabilities.hasBattery)
+    std::ranges::sort(primaryBatteries);
+    std::ranges::sort(peripheralBatteries);
+    const auto& candidates = primaryBatteries.empty() ? peripheralBatteries : primaryBatteries;
+    if (candidates.empty())
     {
-        // Probe the first (primary) battery to determine available fields
-        const auto& batteryPath = m_BatteryPaths[0];
-        m_Capabilities.hasChargePercent = Fs::exists(batteryPath + "/capacity", ec);
-        m_Capabilities.hasChargeCapacity = Fs::exists(batteryPath + "/energy_now", ec) || Fs::exists(batteryPath + "/charge_now", ec);
-        m_Capabilities.hasPowerRate = Fs::exists(batteryPath + "/power_now", ec) || Fs::exists(batteryPath + "/current_now", ec);
-        m_Capabilities.hasVoltage = Fs::exists(batteryPath + "/voltage_now", ec);
-        m_Capabilities.hasTechnology = Fs::exists(batteryPath + "/technology", ec);
-        m_Capabilities.hasCycleCount = Fs::exists(batteryPath + "/cycle_count", ec);
-        m_Capabilities.hasHealthPercent =
-            Fs::exists(batteryPath + "/energy_full", ec) && Fs::exists(batteryPath + "/energy_full_design", ec);
-        m_Capabilities.hasTimeEstimates = false; // Linux doesn't provide time estimates directly
+        return;
     }
+
+    // For simplicity, report the first battery (most systems have one)
+    // Future: aggregate multiple batteries
+    const Fs::path& dir = candidates.front();
+    Battery& battery = m_Battery.emplace();
+    battery.name = dir.filename().string();
+    battery.status = ProcFile((dir / "status").string());
+    battery.capacity = ProcFile((dir / "capacity").string());
+    battery.usesCharge = openEither(battery.chargeNow, dir, "energy_now", "charge_now");
+    battery.chargeFull = ProcFile((dir / (battery.usesCharge ? "charge_full" : "energy_full")).string());
+    battery.chargeDesign = ProcFile((dir / (battery.usesCharge ? "charge_full_design" : "energy_full_design")).string());
+    battery.usesCurrent = openEither(battery.rate, dir, "power_now", "current_now");
+    battery.voltage = ProcFile((dir / "voltage_now").string());
+    battery.cycleCount = ProcFile((dir / "cycle_count").string());
+    battery.technology = readAttribute(dir / "technology");
+    battery.model = readAttribute(dir / "model_name");
+    battery.manufacturer = readAttribute(dir / "manufacturer");
+
+    m_Capabilities.hasBattery = true;
+    m_Capabilities.hasChargePercent = battery.capacity.isOpen();
+    m_Capabilities.hasChargeCapacity = battery.chargeNow.isOpen();
+    m_Capabilities.hasPowerRate = battery.rate.isOpen();
+    m_Capabilities.hasVoltage = battery.voltage.isOpen();
+    m_Capabilities.hasTechnology = !battery.technology.empty();
+    m_Capabilities.hasCycleCount = battery.cycleCount.isOpen();
+    m_Capabilities.hasHealthPercent = battery.chargeFull.isOpen() && battery.chargeDesign.isOpen();
+    m_Capabilities.hasTimeEstimates = false; // Linux doesn't provide time estimates directly
+
+    spdlog::debug("LinuxPowerProbe: reporting battery {} ({} primary, {} peripheral)",
+                  battery.name,
+                  primaryBatteries.size(),
+                  peripheralBatteries.size());
+}
+
+bool LinuxPowerProbe::pollChanged()
+{
+    if (!m_Uevents)
+    {
+        return false;
+    }
+
+    std::vector<Uevent> events;
+    if (m_Uevents->poll(events) == 0)
+    {
+        return false;
+    }
+
+    for (const auto& event : events)
+    {
+        // "change" is a status update on a known supply (AC online, battery charging);
+        // anything else may add or remove one, and an overrun loses track entirely
+        if (event.action != UeventAction::Change || event.devPath.empty())
+        {
+            m_RescanPending = true;
+        }
+    }
+    return true;
 }
 
 PowerCounters LinuxPowerProbe::read()
 {
+    if (m_RescanPending || std::chrono::steady_clock::now() - m_LastScan >= m_RescanInterval)
+    {
+        discoverSupplies();
+    }
+
     PowerCounters counters;
+    const auto acOnline = readAcOnline();
 
-    if (m_BatteryPaths.empty())
+    if (!m_Battery)
     {
         counters.state = BatteryState::NotPresent;
-        counters.isOnAc = true; // Assume on AC if no battery
+        counters.isOnAc = acOnline.value_or(true); // Assume on AC if no battery
         return counters;
     }
 
-    // For simplicity, read from the first battery (most systems have one)
-    // Future: aggregate multiple batteries
-    readBattery(counters, m_BatteryPaths[0]);
-
+    readBattery(counters, *m_Battery);
+    if (acOnline)
+    {
+        counters.isOnAc = *acOnline;
+    }
     return counters;
 }
 
@@ -158,104 +261,91 @@ PowerCapabilities LinuxPowerProbe::capabilities() const
     return m_Capabilities;
 }
 
-void LinuxPowerProbe::readBattery(PowerCounters& counters, const std::string& batteryPath) const
+std::optional<bool> LinuxPowerProbe::readAcOnline()
 {
-    // Read battery state
-    const auto status = readSysfsFile(batteryPath + "/status");
-    counters.state = parseBatteryState(status);
+    std::optional<bool> result;
+    for (auto& online : m_AcOnline)
+    {
+        const int value = readInteger(online, -1);
+        if (value >= 0)
+        {
+            result = result.value_or(false) || value > 0;
+        }
+    }
+    return result;
+}
+
+void LinuxPowerProbe::readBattery(PowerCounters& counters, Battery& battery)
+{
+    // Read battery state; mains "online" overrides isOnAc when the host has an AC supply
+    counters.state = parseBatteryState(ProcParse::trimRight(battery.status.read()));
     counters.isOnAc = (counters.state == BatteryState::Charging || counters.state == BatteryState::Full);
 
     // Read charge percentage
     if (m_Capabilities.hasChargePercent)
     {
-        counters.chargePercent = readSysfsInt(batteryPath + "/capacity", -1);
+        counters.chargePercent = readInteger(battery.capacity, -1);
     }
 
-    // Read charge capacity (energy or charge, in µWh or µAh)
-    // Convert to Wh for consistency
+    // voltage_now is needed to convert charge_* (µAh) and current_now (µA) to Wh and W
+    const auto voltageUv = readInteger<std::uint64_t>(battery.voltage, 0);
+
+    // Read charge capacity (energy in µWh, or charge in µAh); convert to Wh for consistency
     if (m_Capabilities.hasChargeCapacity)
     {
-        // Try energy first (Wh)
-        if (std::filesystem::exists(batteryPath + "/energy_now"))
+        const auto chargeNow = static_cast<double>(readInteger<std::uint64_t>(battery.chargeNow, 0));
+        const auto chargeFull = static_cast<double>(readInteger<std::uint64_t>(battery.chargeFull, 0));
+        const auto chargeDesign = static_cast<double>(readInteger<std::uint64_t>(battery.chargeDesign, 0));
+        if (!battery.usesCharge)
         {
-            counters.chargeNowWh = static_cast<double>(readSysfsUInt64(batteryPath + "/energy_now")) / 1000000.0; // µWh to Wh
-            counters.chargeFullWh = static_cast<double>(readSysfsUInt64(batteryPath + "/energy_full")) / 1000000.0;
-            counters.chargeDesignWh = static_cast<double>(readSysfsUInt64(batteryPath + "/energy_full_design")) / 1000000.0;
+            counters.chargeNowWh = chargeNow / MICRO;
+            counters.chargeFullWh = chargeFull / MICRO;
+            counters.chargeDesignWh = chargeDesign / MICRO;
         }
-        // Fall back to charge (Ah) - need voltage to convert to Wh
-        else if (std::filesystem::exists(batteryPath + "/charge_now"))
+        else if (voltageUv > 0)
         {
-            const auto chargeNowUah = readSysfsUInt64(batteryPath + "/charge_now");
-            const auto chargeFullUah = readSysfsUInt64(batteryPath + "/charge_full");
-            const auto chargeDesignUah = readSysfsUInt64(batteryPath + "/charge_full_design");
-            const auto voltageUv = readSysfsUInt64(batteryPath + "/voltage_now", 0);
-
-            if (voltageUv > 0)
-            {
-                // Convert µAh * µV = pWh, then to Wh
-                // Cast to double to prevent overflow before division
-                counters.chargeNowWh = (static_cast<double>(chargeNowUah) * static_cast<double>(voltageUv)) / 1000000000000.0;
-                counters.chargeFullWh = (static_cast<double>(chargeFullUah) * static_cast<double>(voltageUv)) / 1000000000000.0;
-                counters.chargeDesignWh = (static_cast<double>(chargeDesignUah) * static_cast<double>(voltageUv)) / 1000000000000.0;
-            }
+            // µAh * µV = pWh; cast to double first to prevent overflow
+            const auto voltage = static_cast<double>(voltageUv);
+            counters.chargeNowWh = (chargeNow * voltage) / MICRO_SQUARED;
+            counters.chargeFullWh = (chargeFull * voltage) / MICRO_SQUARED;
+            counters.chargeDesignWh = (chargeDesign * voltage) / MICRO_SQUARED;
         }
     }
 
-    // Read power rate
+    // Read power rate (power_now in µW, or current_now in µA times voltage)
     if (m_Capabilities.hasPowerRate)
     {
-        // Try power_now first (µW)
-        if (std::filesystem::exists(batteryPath + "/power_now"))
+        const double rate = readMagnitude(battery.rate);
+        if (!battery.usesCurrent)
         {
-            const auto powerUw = readSysfsUInt64(batteryPath + "/power_now");
-            counters.powerNowW = static_cast<double>(powerUw) / 1000000.0; // µW to W
-
-            // Negate if charging (power going in)
-            if (counters.state == BatteryState::Charging)
-            {
-                counters.powerNowW = -counters.powerNowW;
-            }
+            counters.powerNowW = rate / MICRO;
         }
-        // Fall back to current_now (µA) - need voltage
-        else if (std::filesystem::exists(batteryPath + "/current_now"))
+        else if (voltageUv > 0)
         {
-            const auto currentUa = readSysfsUInt64(batteryPath + "/current_now");
-            const auto voltageUv = readSysfsUInt64(batteryPath + "/voltage_now", 0);
+            counters.powerNowW = (rate * static_cast<double>(voltageUv)) / MICRO_SQUARED;
+        }
 
-            if (voltageUv > 0)
-            {
-                // µA * µV = pW, then to W
-                // Cast to double to prevent overflow before division
-                counters.powerNowW = (static_cast<double>(currentUa) * static_cast<double>(voltageUv)) / 1000000000000.0;
-
-                if (counters.state == BatteryState::Charging)
-                {
-                    counters.powerNowW = -counters.powerNowW;
-                }
-            }
+        // Negate if charging (power going in)
+        if (counters.state == BatteryState::Charging)
+        {
+            counters.powerNowW = -counters.powerNowW;
         }
     }
 
     // Read voltage
     if (m_Capabilities.hasVoltage)
     {
-        counters.voltageNowMv = readSysfsUInt64(batteryPath + "/voltage_now") / 1000; // µV to mV
+        counters.voltageNowMv = voltageUv / 1000; // µV to mV
     }
 
-    // Read technology
-    if (m_Capabilities.hasTechnology)
-    {
-        counters.technology = readSysfsFile(batteryPath + "/technology");
-    }
-
-    // Read model/manufacturer
-    counters.model = readSysfsFile(batteryPath + "/model_name");
-    counters.manufacturer = readSysfsFile(batteryPath + "/manufacturer");
+    counters.technology = battery.technology;
+    counters.model = battery.model;
+    counters.manufacturer = battery.manufacturer;
 
     // Read cycle count
     if (m_Capabilities.hasCycleCount)
     {
-        counters.cycleCount = readSysfsUInt64(batteryPath + "/cycle_count");
+        counters.cycleCount = readInteger<std::uint64_t>(battery.cycleCount, 0);
     }
 
     // Calculate health percentage
@@ -278,75 +368,6 @@ void LinuxPowerProbe::readBattery(PowerCounters& counters, const std::string& ba
     }
 }
 
-std::string LinuxPowerProbe::readSysfsFile(const std::string& path)
-{
-    std::ifstream file(path);
-    if (!file.is_open())
-    {
-        return "";
-    }
-
-    std::string value;
-    std::getline(file, value);
-
-    // Trim whitespace efficiently
-    if (!value.empty())
-    {
-        // Trim trailing whitespace
-        const auto lastNonWs = value.find_last_not_of(" \n\r\t");
-        if (lastNonWs == std::string::npos)
-        {
-            return ""; // String contains only whitespace
-        }
-        value.resize(lastNonWs + 1);
-
-        // Trim leading spaces
-        const auto firstNonSpace = value.find_first_not_of(' ');
-        if (firstNonSpace != std::string::npos && firstNonSpace > 0)
-        {
-            value.erase(0, firstNonSpace);
-        }
-    }
-
-    return value;
-}
-
-std::uint64_t LinuxPowerProbe::readSysfsUInt64(const std::string& path, std::uint64_t fallback)
-{
-    const auto str = readSysfsFile(path);
-    if (str.empty())
-    {
-        return fallback;
-    }
-
-    std::uint64_t value = 0;
-    const auto result = std::from_chars(str.data(), str.data() + str.size(), value);
-    if (result.ec != std::errc{})
-    {
-        return fallback;
-    }
-
-    return value;
-}
-
-int LinuxPowerProbe::readSysfsInt(const std::string& path, int fallback)
-{
-    const auto str = readSysfsFile(path);
-    if (str.empty())
-    {
-        return fallback;
-    }
-
-    int value = 0;
-    const auto result = std::from_chars(str.data(), str.data() + str.size(), value);
-    if (result.ec != std::errc{})
-    {
-        return fallback;
-    }
-
-    return value;
-}
-
 } // namespace Platform
 
 #endif // defined(__linux__) && __has_include(<unistd.h>)
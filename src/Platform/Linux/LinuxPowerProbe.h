@@ -1,38 +1,94 @@
 #pragma once
 
 #include "Platform/IPowerProbe.h"
+#include "ProcFile.h"
+#include "SystemRoots.h"
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 namespace Platform
 {
 
+class UeventMonitor;
+
 /// Linux implementation of IPowerProbe.
 /// Reads power/battery metrics from /sys/class/power_supply.
+///
+/// Supplies are discovered once and every attribute read per tick goes through a
+/// persistent ProcFile handle, so a tick is a handful of pread() calls with no
+/// directory walk, open() or exists() check. Which attributes a battery reports
+/// (energy_* vs charge_*, power_now vs current_now) is decided at discovery.
+///
+/// The supply list is rescanned when a power_supply add/remove uevent arrives, and at
+/// most once per rescan interval as a backstop for hosts where uevents are not
+/// delivered (containers, non-default SystemRoots). pollChanged() reports AC
+/// plug/unplug and battery status uevents as they happen.
+///
+/// Not thread-safe; SystemModel calls read() and pollChanged() from the same thread.
 class LinuxPowerProbe : public IPowerProbe
 {
   public:
-    LinuxPowerProbe();
-    ~LinuxPowerProbe() override = default;
+    static constexpr std::chrono::milliseconds DEFAULT_RESCAN_INTERVAL{30000};
+
+    explicit LinuxPowerProbe(const SystemRoots& roots = {}, std::chrono::milliseconds rescanInterval = DEFAULT_RESCAN_INTERVAL);
+    ~LinuxPowerProbe() override;
 
     LinuxPowerProbe(const LinuxPowerProbe&) = delete;
     LinuxPowerProbe& operator=(const LinuxPowerProbe&) = delete;
-    LinuxPowerProbe(LinuxPowerProbe&&) = default;
-    LinuxPowerProbe& operator=(LinuxPowerProbe&&) = default;
+    LinuxPowerProbe(LinuxPowerProbe&&) noexcept;
+    LinuxPowerProbe& operator=(LinuxPowerProbe&&) noexcept;
 
     [[nodiscard]] PowerCounters read() override;
     [[nodiscard]] PowerCapabilities capabilities() const override;
+    [[nodiscard]] bool pollChanged() override;
+
+    /// Whether supply changes arrive as uevents (false: rescan interval only).
+    [[nodiscard]] bool hasUevents() const noexcept;
+
+    /// Number of times the power_supply directory has been scanned (for tests and diagnostics).
+    [[nodiscard]] std::uint64_t scanCount() const noexcept
+    {
+        return m_ScanCount;
+    }
 
   private:
-    void discoverBatteries();
-    void readBattery(PowerCounters& counters, const std::string& batteryPath) const;
-    [[nodiscard]] static std::string readSysfsFile(const std::string& path);
-    [[nodiscard]] static std::uint64_t readSysfsUInt64(const std::string& path, std::uint64_t fallback = 0);
-    [[nodiscard]] static int readSysfsInt(const std::string& path, int fallback = -1);
+    /// Open attribute handles of the battery being reported
+    struct Battery
+    {
+        std::string name;
+        ProcFile status;
+        ProcFile capacity;
+        ProcFile chargeNow;    // energy_now (µWh), or charge_now (µAh) if usesCharge
+        ProcFile chargeFull;   // energy_full / charge_full
+        ProcFile chargeDesign; // energy_full_design / charge_full_design
+        ProcFile rate;         // power_now (µW), or current_now (µA) if usesCurrent
+        ProcFile voltage;      // voltage_now (µV)
+        ProcFile cycleCount;
+        bool usesCharge = false;
+        bool usesCurrent = false;
+        std::string technology; // Static attributes are read once at discovery
+        std::string model;
+        std::string manufacturer;
+    };
+
+    void discoverSupplies();
+    void readBattery(PowerCounters& counters, Battery& battery);
+    [[nodiscard]] std::optional<bool> readAcOnline();
 
-    std::vector<std::string> m_BatteryPaths; // Paths like "/sys/class/power_supply/BAT0"
+    std::string m_PowerSupplyPath; // <sys>/class/power_supply
+    std::chrono::milliseconds m_RescanInterval;
+    std::chrono::steady_clock::time_point m_LastScan;
+    std::unique_ptr<UeventMonitor> m_Uevents; // Null when watching a non-default sys root
+    std::optional<Battery> m_Battery;         // Primary battery (BAT*/CMB* preferred over peripherals)
+    std::vector<ProcFile> m_AcOnline;         // "online" of each Mains/USB supply
     PowerCapabilities m_Capabilities;
+    std::uint64_t m_ScanCount = 0;
+    bool m_RescanPending = false;
 };
 
 } // namespace Platform
@@ -10,24 +10,29 @@
 #include "NetlinkSocketStats.h"
 #endif
 
+#include "NumaParse.h"
 #include "Platform/ProcessTypes.h"
+#include "PressureParse.h"
+#include "ProcParse.h"
+#include "SharedFdTable.h"
+#include "SharedProcStat.h"
+#include "SystemRoots.h"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <charconv>
 #include <concepts>
 #include <cstdint>
 #include <cstdio>
-#include <exception>
 #include <filesystem>
 #include <fstream>
 #include <ios>
 #include <limits>
 #include <memory>
 #include <mutex>
-#include <sstream>
 #include <string>
 #include <string_view>
 #include <system_error>
@@ -36,8 +41,8 @@
 #include <utility>
 #include <vector>
 
+#include <fcntl.h>
 #include <pwd.h>
-#include <sched.h>
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -127,11 +132,69 @@ std::mutex& getUsernameCacheMutex()
     return username;
 }
 
+// Per-process files read every enumerate(), in the order they are queued for each PID
+enum class PidFile : std::size_t
+{
+    Stat,
+    Statm,
+    Status,
+    Cmdline,
+    Cgroup,
+    Io, // Only queued when /proc/<pid>/io is readable
+};
+
+// Freezer slots of a process in m_ProcessFreezerSlots
+constexpr std::size_t FREEZER_V2 = 0; // <cgroup v2 root><path>/cgroup.freeze
+constexpr std::size_t FREEZER_V1 = 1; // <sys>/fs/cgroup/freezer<path>/freezer.state
+
+/// Whether a freezer file reports the cgroup frozen: "1" in v2 cgroup.freeze,
+/// FROZEN or FREEZING in v1 freezer.state
+[[nodiscard]] bool isFrozen(std::string_view state) noexcept
+{
+    state = ProcParse::trimRight(state);
+    return state == "1" || state == "FROZEN" || state == "FREEZING";
+}
+
+/// Low 64 CPUs of a Cpus_allowed mask ("ff", or comma-separated 32-bit hex groups,
+/// most significant first, on larger machines)
+[[nodiscard]] std::uint64_t parseCpusAllowed(std::string_view text) noexcept
+{
+    text.remove_prefix(std::min(text.find_first_not_of(" \t"), text.size()));
+    text = ProcParse::trimRight(text);
+    std::uint64_t mask = 0;
+    int bits = 0;
+    while (!text.empty() && bits < 64)
+    {
+        const auto comma = text.rfind(',');
+        const std::string_view group = text.substr(comma == std::string_view::npos ? 0 : comma + 1);
+        std::uint32_t value = 0;
+        if (std::from_chars(group.data(), group.data() + group.size(), value, 16).ec != std::errc{})
+        {
+            return 0;
+        }
+        mask |= static_cast<std::uint64_t>(value) << bits;
+        bits += 32;
+        text = comma == std::string_view::npos ? std::string_view{} : text.substr(0, comma);
+    }
+    return mask;
+}
+
 } // namespace
 
-LinuxProcessProbe::LinuxProcessProbe()
-    : m_TicksPerSecond(sysconf(_SC_CLK_TCK)), m_PageSize(toU64PositiveOr(sysconf(_SC_PAGESIZE), 4096ULL)), m_BootTimeEpoch(readBootTime())
+LinuxProcessProbe::LinuxProcessProbe(SystemRoots roots)
+    : m_Roots(std::move(roots)), m_TicksPerSecond(sysconf(_SC_CLK_TCK)), m_PageSize(toU64PositiveOr(sysconf(_SC_PAGESIZE), 4096ULL)),
+      m_Rapl(m_Roots.sysPath("class/powercap"), m_Roots.sysPath("devices/system/cpu")),
+      m_FreezerReader(BatchFileReader::Options{.queueDepth = 64, .slotSize = 64}) // A tick reads a few dozen one-word files
 {
+    m_BootTimeEpoch = readBootTime();
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) - POSIX open() is variadic
+    m_ProcDirFd = ::open(m_Roots.proc.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (m_ProcDirFd < 0)
+    {
+        spdlog::warn("Failed to open {}: process enumeration will be empty", m_Roots.proc);
+    }
+
     if (m_TicksPerSecond <= 0)
     {
         m_TicksPerSecond = 100; // Common default
@@ -143,15 +206,12 @@ LinuxProcessProbe::LinuxProcessProbe()
         spdlog::warn("Failed to read boot time from /proc/stat");
     }
 
-    // Detect and initialize power monitoring if available
-    m_HasPowerCap = detectPowerCap();
-    if (m_HasPowerCap)
-    {
-        spdlog::info("Power monitoring available via RAPL at: {}", m_PowerCapPath);
-    }
-    else
+    m_HasNumaMaps = (access(m_Roots.procPath("self/numa_maps").c_str(), R_OK) == 0);
+
+    m_CgroupV2Root = detectCgroupV2Root();
+    if (m_CgroupV2Root.empty())
     {
-        spdlog::debug("Power monitoring not available (RAPL not found)");
+        spdlog::debug("Per-cgroup pressure not available (no cgroup v2 hierarchy)");
     }
 
 #if TASKSMACK_HAS_NETLINK_SOCKET_STATS
@@ -169,14 +229,22 @@ LinuxProcessProbe::LinuxProcessProbe()
 #endif
 }
 
+LinuxProcessProbe::~LinuxProcessProbe()
+{
+    if (m_ProcDirFd >= 0)
+    {
+        ::close(m_ProcDirFd);
+    }
+}
+
 std::vector<ProcessCounters> LinuxProcessProbe::enumerate()
 {
-    std::vector<ProcessCounters> processes;
-    processes.reserve(500); // Reasonable initial size
+    const std::scoped_lock lock(m_EnumerateMutex);
 
-    const std::filesystem::path procPath("/proc");
+    const std::filesystem::path procPath(m_Roots.proc);
     std::error_code errorCode;
 
+    m_Pids.clear();
     for (const auto& entry : std::filesystem::directory_iterator(procPath, errorCode))
     {
         if (!entry.is_directory())
@@ -193,51 +261,88 @@ std::vector<ProcessCounters> LinuxProcessProbe::enumerate()
         {
             continue;
         }
+        m_Pids.push_back(pid);
+    }
+
+    if (errorCode)
+    {
+        spdlog::warn("Error iterating {}: {}", m_Roots.proc, errorCode.message());
+    }
+
+    // Only attempt I/O counters if we know they're readable
+    // Use std::call_once for thread-safe lazy initialization; relaxed ordering is sufficient
+    std::call_once(m_IoCountersCheckFlag,
+                   [this]() { m_IoCountersAvailable.store(checkIoCountersAvailability(), std::memory_order_relaxed); });
+    const bool readIo = m_IoCountersAvailable.load(std::memory_order_relaxed);
+    const std::size_t filesPerPid = static_cast<std::size_t>(readIo ? PidFile::Io : PidFile::Cgroup) + 1;
+
+    // One batch for every per-process file this tick; a process that exits meanwhile just fails its reads
+    m_Reader.clear();
+    for (const int32_t pid : m_Pids)
+    {
+        queueProcessFile(pid, "stat");
+        queueProcessFile(pid, "statm");
+        queueProcessFile(pid, "status");
+        queueProcessFile(pid, "cmdline");
+        queueProcessFile(pid, "cgroup");
+        if (readIo)
+        {
+            queueProcessFile(pid, "io");
+        }
+    }
+    m_Reader.submit();
+
+    // Open fds and socket owners come from one fd-table walk shared with the GPU probe
+    const auto fdTable = SharedFdTable::instance(m_Roots.proc).read(m_FdTableConsumer);
+
+    std::vector<ProcessCounters> processes;
+    processes.reserve(m_Pids.size());
+    m_FreezerReader.clear();
+    m_FreezerSlots.clear();
+    m_ProcessFreezerSlots.clear();
+
+    for (std::size_t i = 0; i < m_Pids.size(); ++i)
+    {
+        const int32_t pid = m_Pids[i];
+        const auto file = [&](PidFile which) { return m_Reader.result((i * filesPerPid) + static_cast<std::size_t>(which)); };
 
         ProcessCounters counters{};
-        if (!parseProcessStat(pid, counters))
+        if (!parseProcessStat(pid, file(PidFile::Stat), counters))
         {
             spdlog::debug("Failed to parse /proc/{}/stat", pid);
             continue;
         }
 
-        parseProcessStatm(pid, counters);
-        parseProcessStatus(pid, counters);
-        parseProcessCmdline(pid, counters);
-        // CPU affinity is always safe to query; failures zero the mask
-        parseProcessAffinity(pid, counters);
+        parseProcessStatm(file(PidFile::Statm), counters);
+        parseProcessStatus(file(PidFile::Status), counters);
+        parseProcessCmdline(file(PidFile::Cmdline), counters);
+        parseProcessCgroup(file(PidFile::Cgroup), counters);
 
-        // Count open file descriptors (may fail for some processes due to permissions)
-        countProcessFds(pid, counters);
+        // Open file descriptors (absent when /proc/[pid]/fd is not readable)
+        if (const auto fds = fdTable->fdCounts.find(pid); fds != fdTable->fdCounts.end())
+        {
+            counters.handleCount = fds->second;
+        }
 
-        // Only attempt I/O counters if we know they're readable
-        // Use std::call_once for thread-safe lazy initialization; relaxed ordering is sufficient
-        std::call_once(m_IoCountersCheckFlag,
-                       [this]() { m_IoCountersAvailable.store(checkIoCountersAvailability(), std::memory_order_relaxed); });
-        if (m_IoCountersAvailable.load(std::memory_order_relaxed))
+        if (readIo)
         {
-            parseProcessIo(pid, counters);
+            parseProcessIo(file(PidFile::Io), counters);
         }
-        counters.status = getProcessStatus(pid); // Get cgroup freezer status
         processes.push_back(std::move(counters));
     }
 
-    if (errorCode)
-    {
-        spdlog::warn("Error iterating /proc: {}", errorCode.message());
-    }
+    applyFreezerState(processes);
 
-    // Attribute energy to processes if power monitoring is available
-    if (m_HasPowerCap)
+    if (!m_CgroupV2Root.empty())
     {
-        attributeEnergyToProcesses(processes);
+        attributeCgroupPressure(processes);
     }
 
 #if TASKSMACK_HAS_NETLINK_SOCKET_STATS
     // Attribute network bytes to processes if socket stats are available
     if (m_HasNetworkCounters && m_SocketStats)
     {
-        attributeNetworkToProcesses(processes);
+        attributeNetworkToProcesses(processes, fdTable->socketOwners);
     }
 #endif
 
@@ -256,6 +361,8 @@ ProcessCapabilities LinuxProcessProbe::capabilities() const
     const bool hasNetworkCounters = false;
 #endif
 
+    const bool hasCgroupPressure = !m_CgroupV2Root.empty(); // From <cgroup>/cpu.pressure
+
     return ProcessCapabilities{.hasIoCounters = m_IoCountersAvailable.load(std::memory_order_acquire),
                                .hasThreadCount = true,
                                .hasHandleCount = true, // Can count FDs in /proc/[pid]/fd
@@ -266,10 +373,12 @@ ProcessCapabilities LinuxProcessProbe::capabilities() const
                                .hasNice = true,       // From /proc/[pid]/stat
                                .hasPageFaults = true, // From /proc/[pid]/stat (minflt + majflt)
                                .hasPeakRss = false,
-                               .hasCpuAffinity = true,                   // From sched_getaffinity
+                               .hasCpuAffinity = true,                   // From /proc/[pid]/status Cpus_allowed
                                .hasNetworkCounters = hasNetworkCounters, // From Netlink INET_DIAG (if available)
-                               .hasPowerUsage = m_HasPowerCap,           // Available if RAPL is detected
-                               .hasStatus = true};                       // From cgroup freezer state
+                               .hasPowerUsage = m_Rapl.isAvailable(),    // RAPL package energy, attributed by the domain
+                               .hasStatus = true,                        // From cgroup freezer state
+                               .hasCgroupPressure = hasCgroupPressure,
+                               .hasNumaResidency = m_HasNumaMaps}; // From /proc/[pid]/numa_maps, on demand
 }
 
 uint64_t LinuxProcessProbe::totalCpuTime() const
@@ -282,22 +391,34 @@ long LinuxProcessProbe::ticksPerSecond() const
     return m_TicksPerSecond;
 }
 
-bool LinuxProcessProbe::parseProcessStat(int32_t pid, ProcessCounters& counters) const
+bool LinuxProcessProbe::readNumaResidency(int32_t pid, std::vector<uint64_t>& kibPerNode)
 {
-    // Format: /proc/[pid]/stat
-    // Fields: pid (comm) state ppid pgrp session tty_nr tpgid flags
-    //         minflt cminflt majflt cmajflt utime stime cutime cstime
-    //         priority nice num_threads itrealvalue starttime vsize rss ...
-
-    const std::filesystem::path statPath = std::filesystem::path("/proc") / std::to_string(pid) / "stat";
-    std::ifstream statFile(statPath);
-    if (!statFile.is_open())
+    kibPerNode.clear();
+    if (!m_HasNumaMaps)
     {
         return false;
     }
 
-    std::string line;
-    if (!std::getline(statFile, line))
+    // One-shot read: unlike the per-tick files this is only requested for a handful of visible rows
+    ProcFile numaMaps(m_Roots.procPath(std::to_string(pid) + "/numa_maps"));
+    return numaMaps.isOpen() && parseNumaMaps(numaMaps.read(), kibPerNode);
+}
+
+void LinuxProcessProbe::queueProcessFile(int32_t pid, std::string_view file)
+{
+    std::array<char, 64> path{};
+    (void) m_Reader.add(m_ProcDirFd, ProcParse::formatPidPath(path, pid, file)); // The reader copies the path
+}
+
+bool LinuxProcessProbe::parseProcessStat(int32_t pid, std::string_view text, ProcessCounters& counters) const
+{
+    // Format: /proc/[pid]/stat
+    // Fields: pid (comm) state ppid pgrp session tty_nr tpgid flags
+    //         minflt cminflt majflt cmajflt utime stime cutime cstime
+    //         priority nice num_threads itrealvalue starttime vsize rss rsslim ... exit_signal processor ...
+
+    std::string_view line;
+    if (!ProcParse::nextLine(text, line))
     {
         return false;
     }
@@ -307,7 +428,7 @@ bool LinuxProcessProbe::parseProcessStat(int32_t pid, ProcessCounters& counters)
     const auto nameStart = line.find('(');
     const auto nameEnd = line.rfind(')');
 
-    if (nameStart == std::string::npos || nameEnd == std::string::npos || nameEnd <= nameStart)
+    if (nameStart == std::string_view::npos || nameEnd == std::string_view::npos || nameEnd <= nameStart)
     {
         return false;
     }
@@ -316,9 +437,9 @@ bool LinuxProcessProbe::parseProcessStat(int32_t pid, ProcessCounters& counters)
     counters.name = line.substr(nameStart + 1, nameEnd - nameStart - 1);
 
     // Parse fields after the name
-    std::istringstream fieldStream(line.substr(nameEnd + 2)); // Skip ") "
+    std::string_view fields = line.substr(nameEnd + 1);
 
-    std::string stateStr;
+    const std::string_view stateStr = ProcParse::nextToken(fields);
     int32_t parentPid = 0;
     int32_t pgrp = 0;
     int32_t session = 0;
@@ -341,14 +462,18 @@ bool LinuxProcessProbe::parseProcessStat(int32_t pid, ProcessCounters& counters)
     uint64_t vsize = 0;
     int64_t rss = 0;
 
+    using ProcParse::nextInteger;
     // clang-format off
-    fieldStream >> stateStr >> parentPid >> pgrp >> session >> ttyNr >> tpgid
-                >> flags >> minflt >> cminflt >> majflt >> cmajflt
-                >> utime >> stime >> cutime >> cstime >> priority >> nice
-                >> numThreads >> itrealvalue >> starttime >> vsize >> rss;
+    const bool parsed = nextInteger(fields, parentPid) && nextInteger(fields, pgrp) && nextInteger(fields, session)
+                     && nextInteger(fields, ttyNr) && nextInteger(fields, tpgid) && nextInteger(fields, flags)
+                     && nextInteger(fields, minflt) && nextInteger(fields, cminflt) && nextInteger(fields, majflt)
+                     && nextInteger(fields, cmajflt) && nextInteger(fields, utime) && nextInteger(fields, stime)
+                     && nextInteger(fields, cutime) && nextInteger(fields, cstime) && nextInteger(fields, priority)
+                     && nextInteger(fields, nice) && nextInteger(fields, numThreads) && nextInteger(fields, itrealvalue)
+                     && nextInteger(fields, starttime) && nextInteger(fields, vsize) && nextInteger(fields, rss);
     // clang-format on
 
-    if (fieldStream.fail())
+    if (!parsed)
     {
         return false;
     }
@@ -384,27 +509,32 @@ bool LinuxProcessProbe::parseProcessStat(int32_t pid, ProcessCounters& counters)
     counters.nice = clampToI32(nice);
     counters.pageFaultCount = minflt + majflt; // Total page faults (minor + major)
 
+    // processor (field 39) follows rsslim through exit_signal; older kernels may end earlier
+    constexpr int FIELDS_BEFORE_PROCESSOR = 14;
+    bool hasProcessor = true;
+    for (int field = 0; field < FIELDS_BEFORE_PROCESSOR && hasProcessor; ++field)
+    {
+        hasProcessor = !ProcParse::nextToken(fields).empty();
+    }
+    int32_t processor = -1;
+    if (hasProcessor && nextInteger(fields, processor))
+    {
+        counters.lastCpu = processor;
+    }
+
     return true;
 }
 
-void LinuxProcessProbe::parseProcessStatm(int32_t pid, ProcessCounters& counters) const
+void LinuxProcessProbe::parseProcessStatm(std::string_view text, ProcessCounters& counters) const
 {
     // Format: /proc/[pid]/statm
     // Fields: size resident shared text lib data dt (all in pages)
 
-    const std::filesystem::path statmPath = std::filesystem::path("/proc") / std::to_string(pid) / "statm";
-    std::ifstream statmFile(statmPath);
-    if (!statmFile.is_open())
-    {
-        return;
-    }
-
     uint64_t size = 0;
     uint64_t resident = 0;
     uint64_t shared = 0;
 
-    statmFile >> size >> resident >> shared;
-    if (!statmFile.fail())
+    if (ProcParse::nextInteger(text, size) && ProcParse::nextInteger(text, resident) && ProcParse::nextInteger(text, shared))
     {
         // statm gives more accurate RSS, update if available
         counters.rssBytes = resident * m_PageSize;
@@ -412,56 +542,60 @@ void LinuxProcessProbe::parseProcessStatm(int32_t pid, ProcessCounters& counters
     }
 }
 
-void LinuxProcessProbe::parseProcessStatus(int32_t pid, ProcessCounters& counters)
+void LinuxProcessProbe::parseProcessStatus(std::string_view text, ProcessCounters& counters)
 {
-    // Read /proc/[pid]/status for UID (owner) information
+    // /proc/[pid]/status holds UID (owner) information and the CPU affinity mask
     // Format is key:value pairs, one per line
     // We need: Uid: <real> <effective> <saved> <filesystem>
+    //          Cpus_allowed: <hex mask> (the main thread's sched_getaffinity mask, without the syscall)
 
-    const std::filesystem::path statusPath = std::filesystem::path("/proc") / std::to_string(pid) / "status";
-    std::ifstream statusFile(statusPath);
-    if (!statusFile.is_open())
+    constexpr std::string_view uidPrefix = "Uid:";
+    constexpr std::string_view cpusAllowedPrefix = "Cpus_allowed:";
+    counters.cpuAffinityMask = 0; // Stays 0 (not available) if the file is unreadable
+    std::string_view line;
+    while (ProcParse::nextLine(text, line))
     {
-        return;
-    }
-
-    std::string line;
-    while (std::getline(statusFile, line))
-    {
-        // Look for "Uid:" line
-        if (line.starts_with("Uid:"))
+        if (line.starts_with(uidPrefix))
         {
-            std::istringstream iss(line.substr(4)); // Skip "Uid:"
+            line.remove_prefix(uidPrefix.size());
             uid_t realUid = 0;
-            iss >> realUid;
-            if (!iss.fail())
+            if (ProcParse::nextInteger(line, realUid))
             {
                 counters.user = getUsername(realUid);
             }
-            break;
+        }
+        else if (line.starts_with(cpusAllowedPrefix))
+        {
+            line.remove_prefix(cpusAllowedPrefix.size());
+            counters.cpuAffinityMask = parseCpusAllowed(line);
+            break; // Follows Uid
         }
     }
 }
 
-void LinuxProcessProbe::parseProcessCmdline(int32_t pid, ProcessCounters& counters)
+void LinuxProcessProbe::parseProcessCmdline(std::string_view text, ProcessCounters& counters)
 {
     // Format: /proc/[pid]/cmdline
     // Arguments are separated by null bytes
 
-    const std::filesystem::path cmdlinePath = std::filesystem::path("/proc") / std::to_string(pid) / "cmdline";
-    std::ifstream cmdlineFile(cmdlinePath, std::ios::binary);
-    if (!cmdlineFile.is_open())
+    const auto nextArg = [&text]()
     {
-        return;
-    }
+        const auto separator = text.find('\0');
+        const std::string_view arg = text.substr(0, separator);
+        text.remove_prefix(separator == std::string_view::npos ? text.size() : separator + 1);
+        return arg;
+    };
 
-    std::string cmdline;
-    std::getline(cmdlineFile, cmdline, '\0');
+    std::string cmdline(nextArg());
 
-    // Read remaining arguments
-    std::string arg;
-    while (std::getline(cmdlineFile, arg, '\0') && !arg.empty())
+    // Remaining arguments, up to the first empty one
+    while (!text.empty())
     {
+        const std::string_view arg = nextArg();
+        if (arg.empty())
+        {
+            break;
+        }
         cmdline += ' ';
         cmdline += arg;
     }
@@ -477,37 +611,7 @@ void LinuxProcessProbe::parseProcessCmdline(int32_t pid, ProcessCounters& counte
     }
 }
 
-void LinuxProcessProbe::parseProcessAffinity(int32_t pid, ProcessCounters& counters)
-{
-    // Use sched_getaffinity to read CPU affinity mask for the process
-    // This returns which CPU cores the process is allowed to run on
-
-    cpu_set_t cpuSet;
-    CPU_ZERO(&cpuSet);
-
-    // sched_getaffinity returns the affinity for the main thread of the process
-    if (sched_getaffinity(pid, sizeof(cpu_set_t), &cpuSet) == 0)
-    {
-        // Convert cpu_set_t to a bitmask that fits in uint64_t
-        // This limits us to 64 cores, which is reasonable for most systems
-        std::uint64_t mask = 0;
-        for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu)
-        {
-            if (CPU_ISSET(static_cast<size_t>(cpu), &cpuSet) != 0)
-            {
-                mask |= (1ULL << cpu);
-            }
-        }
-        counters.cpuAffinityMask = mask;
-    }
-    else
-    {
-        // If sched_getaffinity fails (e.g., permission denied), set mask to 0
-        counters.cpuAffinityMask = 0;
-    }
-}
-
-void LinuxProcessProbe::parseProcessIo(int32_t pid, ProcessCounters& counters)
+void LinuxProcessProbe::parseProcessIo(std::string_view text, ProcessCounters& counters)
 {
     // Format: /proc/[pid]/io
     // Key-value pairs, one per line:
@@ -520,175 +624,209 @@ void LinuxProcessProbe::parseProcessIo(int32_t pid, ProcessCounters& counters)
     // cancelled_write_bytes: <bytes>
     //
     // Note: This file requires CAP_DAC_READ_SEARCH capability or running as root,
-    // or being the owner of the process. If we can't read it, we silently skip
-    // (capabilities() already reports hasIoCounters = false by default).
+    // or being the owner of the process. If we can't read it the batch reports an
+    // error, the text is empty and we silently skip (capabilities() already reports
+    // hasIoCounters = false by default).
 
-    const std::filesystem::path ioPath = std::filesystem::path("/proc") / std::to_string(pid) / "io";
-    std::ifstream ioFile(ioPath);
-    if (!ioFile.is_open())
-    {
-        // Common case: insufficient permissions, just return
-        return;
-    }
+    constexpr std::string_view readPrefix = "read_bytes:";
+    constexpr std::string_view writePrefix = "write_bytes:";
 
-    std::string line;
-    while (std::getline(ioFile, line))
+    std::string_view line;
+    while (ProcParse::nextLine(text, line))
     {
-        constexpr std::string_view readPrefix = "read_bytes:";
-        constexpr std::string_view writePrefix = "write_bytes:";
-
         if (line.starts_with(readPrefix))
         {
-            std::istringstream iss(line.substr(readPrefix.length()));
-            uint64_t readBytes = 0;
-            iss >> readBytes;
-            if (!iss.fail())
-            {
-                counters.readBytes = readBytes;
-            }
+            line.remove_prefix(readPrefix.size());
+            (void) ProcParse::nextInteger(line, counters.readBytes);
         }
         else if (line.starts_with(writePrefix))
         {
-            std::istringstream iss(line.substr(writePrefix.length()));
-            uint64_t writeBytes = 0;
-            iss >> writeBytes;
-            if (!iss.fail())
-            {
-                counters.writeBytes = writeBytes;
-            }
+            line.remove_prefix(writePrefix.size());
+            (void) ProcParse::nextInteger(line, counters.writeBytes);
         }
     }
 }
 
-void LinuxProcessProbe::countProcessFds(int32_t pid, ProcessCounters& counters)
+bool LinuxProcessProbe::checkIoCountersAvailability() const
 {
-    // Count entries in /proc/[pid]/fd directory.
-    // Each entry is a symlink to an open file descriptor.
-    // Note: May fail due to permissions (needs same user or root).
+    // Check if we can read /proc/self/io to determine I/O counter availability.
+    // This file requires CAP_DAC_READ_SEARCH capability or root privileges,
+    // or being the owner of the target process.
+    const std::ifstream selfIo(m_Roots.procPath("self/io"));
+    return selfIo.is_open();
+}
 
-    const std::filesystem::path fdPath = std::filesystem::path("/proc") / std::to_string(pid) / "fd";
+void LinuxProcessProbe::parseProcessCgroup(std::string_view text, ProcessCounters& counters)
+{
+    // Format: /proc/[pid]/cgroup
+    // hierarchy-ID:controllers:cgroup-path, one line per hierarchy ("0::/path" for the v2 hierarchy)
 
-    int32_t count = 0;
-    try
+    std::array<std::size_t, 2> slots = {NO_FREEZER_SLOT, NO_FREEZER_SLOT};
+    std::string_view line;
+    while (ProcParse::nextLine(text, line))
     {
-        // Don't use error_code variant because errors during iteration
-        // (not just construction) won't be captured in it. Rely on exceptions.
-        for (const auto& entry : std::filesystem::directory_iterator(fdPath))
+        const auto firstColon = line.find(':');
+        const auto secondColon = line.find(':', firstColon + 1);
+        if (firstColon == std::string_view::npos || secondColon == std::string_view::npos)
+        {
+            continue;
+        }
+
+        const std::string_view controllers = line.substr(firstColon + 1, secondColon - firstColon - 1);
+        const std::string_view cgroupSubPath = line.substr(secondColon + 1);
+        if (!cgroupSubPath.starts_with('/'))
+        {
+            continue;
+        }
+
+        if (line.starts_with("0::"))
+        {
+            counters.cgroupPath = cgroupSubPath;
+            // The root cgroup cannot be frozen and has no cgroup.freeze
+            if (!m_CgroupV2Root.empty() && cgroupSubPath != "/")
+            {
+                m_FreezerPath.assign(m_CgroupV2Root).append(cgroupSubPath).append("/cgroup.freeze");
+                slots[FREEZER_V2] = queueFreezerFile(m_FreezerPath);
+            }
+        }
+        else if (controllers.contains("freezer"))
         {
-            (void) entry; // We just count entries
-            ++count;
+            m_FreezerPath.assign(m_Roots.sysPath("fs/cgroup/freezer")).append(cgroupSubPath).append("/freezer.state");
+            slots[FREEZER_V1] = queueFreezerFile(m_FreezerPath);
         }
-        // Only set if we successfully enumerated the directory
-        counters.handleCount = count;
     }
-    catch (const std::exception& ex)
+    m_ProcessFreezerSlots.push_back(slots);
+}
+
+std::size_t LinuxProcessProbe::queueFreezerFile(const std::string& path)
+{
+    if (const auto it = m_FreezerSlots.find(path); it != m_FreezerSlots.end())
     {
-        // Permission errors and other exceptional situations - leave handleCount at 0
-        spdlog::debug("LinuxProcessProbe: failed to enumerate FDs for pid {} at {}: {}", pid, fdPath.string(), ex.what());
+        return it->second;
     }
+    const std::size_t slot = m_FreezerReader.add(AT_FDCWD, path);
+    m_FreezerSlots.emplace(path, slot);
+    return slot;
 }
 
-bool LinuxProcessProbe::checkIoCountersAvailability()
+void LinuxProcessProbe::applyFreezerState(std::vector<ProcessCounters>& processes)
 {
-    // Check if we can read /proc/self/io to determine I/O counter availability.
-    // This file requires CAP_DAC_READ_SEARCH capability or root privileges,
-    // or being the owner of the target process.
-    const std::ifstream selfIo("/proc/self/io");
-    return selfIo.is_open();
+    if (m_FreezerReader.size() > 0)
+    {
+        m_FreezerReader.submit();
+    }
+
+    for (std::size_t i = 0; i < processes.size(); ++i)
+    {
+        for (const std::size_t slot : m_ProcessFreezerSlots[i])
+        {
+            if (slot != NO_FREEZER_SLOT && isFrozen(m_FreezerReader.result(slot)))
+            {
+                processes[i].status = "Suspended";
+                break;
+            }
+        }
+    }
 }
 
-std::string LinuxProcessProbe::getProcessStatus(int32_t pid)
+std::string LinuxProcessProbe::detectCgroupV2Root() const
 {
-    // Try cgroup v2 first: freezer.state
-    const std::filesystem::path cgroupV2FreezerPath = std::filesystem::path("/sys/fs/cgroup") / std::to_string(pid) / "freezer.state";
-    std::ifstream freezerStateV2(cgroupV2FreezerPath);
-    if (freezerStateV2.is_open())
+    // Pure v2 mounts the unified hierarchy at /sys/fs/cgroup; hybrid setups put it
+    // under /sys/fs/cgroup/unified next to the v1 controllers.
+    for (const char* relative : {"fs/cgroup", "fs/cgroup/unified"})
     {
-        std::string state;
-        freezerStateV2 >> state;
-        if (state == "FROZEN" || state == "FREEZING")
+        std::string root = m_Roots.sysPath(relative);
+        std::error_code ec;
+        if (std::filesystem::exists(std::filesystem::path(root) / "cgroup.controllers", ec))
         {
-            return "Suspended";
+            return root;
         }
     }
+    return {};
+}
+
+void LinuxProcessProbe::attributeCgroupPressure(std::vector<ProcessCounters>& processes)
+{
+    const std::uint64_t generation = ++m_CgroupPressureGeneration;
 
-    // Fallback to cgroup v1 freezer hierarchy
-    // /proc/[pid]/cgroup lists all cgroups for the process
-    const std::filesystem::path cgroupPath = std::filesystem::path("/proc") / std::to_string(pid) / "cgroup";
-    std::ifstream cgroupFile(cgroupPath);
-    if (cgroupFile.is_open())
+    for (auto& proc : processes)
     {
-        std::string line;
-        while (std::getline(cgroupFile, line))
+        if (proc.cgroupPath.empty())
         {
-            // Format: hierarchy-ID:controllers:cgroup-path
-            const auto firstColon = line.find(':');
-            const auto secondColon = line.find(':', firstColon + 1);
-            if (firstColon != std::string::npos && secondColon != std::string::npos)
-            {
-                const std::string controllers = line.substr(firstColon + 1, secondColon - firstColon - 1);
-                const std::string cgroupSubPath = line.substr(secondColon + 1);
+            continue;
+        }
 
-                // Check if this line has the freezer controller
-                if (controllers.contains("freezer"))
+        auto [it, inserted] = m_CgroupPressure.try_emplace(proc.cgroupPath);
+        CgroupPressureEntry& entry = it->second;
+        if (inserted)
+        {
+            entry.file = ProcFile(m_CgroupV2Root + proc.cgroupPath + "/cpu.pressure");
+        }
+
+        if (entry.lastSeen != generation)
+        {
+            entry.lastSeen = generation;
+            if (!entry.file.isOpen() || !parsePressure(entry.file.read(), entry.counters))
+            {
+                // A cgroup removed and recreated under the same path leaves a dead descriptor;
+                // reopen so the next tick sees the new one.
+                if (entry.file.isOpen())
                 {
-                    // Build path: /sys/fs/cgroup/freezer/<cgroup-path>/freezer.state
-                    // Skip if cgroupSubPath is empty or doesn't start with /
-                    if (!cgroupSubPath.empty() && cgroupSubPath[0] == '/')
-                    {
-                        const std::filesystem::path freezePathV1 =
-                            std::filesystem::path("/sys/fs/cgroup/freezer") / cgroupSubPath.substr(1) / "freezer.state";
-                        std::ifstream freezeFileV1(freezePathV1);
-                        if (freezeFileV1.is_open())
-                        {
-                            std::string state;
-                            freezeFileV1 >> state;
-                            if (state == "FROZEN" || state == "FREEZING")
-                            {
-                                return "Suspended";
-                            }
-                        }
-                    }
+                    entry.file = ProcFile(m_CgroupV2Root + proc.cgroupPath + "/cpu.pressure");
                 }
+                entry.counters = PressureCounters{};
             }
         }
+
+        if (entry.counters.available)
+        {
+            proc.hasCgroupCpuPressure = true;
+            proc.cgroupCpuSomeStallUs = entry.counters.someTotalUs;
+            proc.cgroupCpuFullStallUs = entry.counters.fullTotalUs;
+        }
     }
 
-    // No special status
-    return {};
+    std::erase_if(m_CgroupPressure, [generation](const auto& kv) { return kv.second.lastSeen != generation; });
 }
-uint64_t LinuxProcessProbe::readTotalCpuTime()
+uint64_t LinuxProcessProbe::readTotalCpuTime() const
 {
     // Format: /proc/stat
     // First line: cpu user nice system idle iowait irq softirq steal guest guest_nice
+    //
+    // LinuxSystemProbe reads the same file in the same tick; SharedProcStat hands us its
+    // snapshot instead of reading /proc/stat a second time.
 
-    std::ifstream statFile("/proc/stat");
-    if (!statFile.is_open())
+    const auto statText = SharedProcStat::instance(m_Roots.proc).read(m_ProcStatConsumer);
+    if (!statText)
     {
-        spdlog::warn("Failed to open /proc/stat");
+        spdlog::warn("Failed to read /proc/stat");
         return 0;
     }
 
-    std::string cpuLabel;
-    uint64_t user = 0;
-    uint64_t nice = 0;
-    uint64_t system = 0;
-    uint64_t idle = 0;
-    uint64_t iowait = 0;
-    uint64_t irq = 0;
-    uint64_t softirq = 0;
-    uint64_t steal = 0;
-
-    statFile >> cpuLabel >> user >> nice >> system >> idle >> iowait >> irq >> softirq >> steal;
-
-    if (statFile.fail() || cpuLabel != "cpu")
+    std::string_view line;
+    std::string_view text = *statText;
+    if (!ProcParse::nextLine(text, line) || ProcParse::nextToken(line) != "cpu")
     {
         spdlog::warn("Failed to parse /proc/stat");
         return 0;
     }
 
-    // Total CPU time = all fields combined
-    return user + nice + system + idle + iowait + irq + softirq + steal;
+    // Total CPU time = user + nice + system + idle + iowait + irq + softirq + steal
+    // (guest time is already included in user/nice)
+    constexpr int FIELD_COUNT = 8;
+    uint64_t total = 0;
+    for (int i = 0; i < FIELD_COUNT; ++i)
+    {
+        uint64_t value = 0;
+        if (!ProcParse::nextInteger(line, value))
+        {
+            spdlog::warn("Failed to parse /proc/stat");
+            return 0;
+        }
+        total += value;
+    }
+
+    return total;
 }
 
 uint64_t LinuxProcessProbe::readBootTime()
@@ -696,23 +834,22 @@ uint64_t LinuxProcessProbe::readBootTime()
     // Format: /proc/stat contains a line: btime <epoch_seconds>
     // btime is the time the system booted in seconds since Unix epoch
 
-    std::ifstream statFile("/proc/stat");
-    if (!statFile.is_open())
+    const auto statText = SharedProcStat::instance(m_Roots.proc).read(m_ProcStatConsumer);
+    if (!statText)
     {
         spdlog::warn("Failed to open /proc/stat for boot time");
         return 0;
     }
 
-    std::string line;
-    while (std::getline(statFile, line))
+    std::string_view text = *statText;
+    std::string_view line;
+    while (ProcParse::nextLine(text, line))
     {
         if (line.starts_with("btime "))
         {
+            line.remove_prefix(6); // Skip "btime "
             uint64_t bootTime = 0;
-            const char* begin = line.data() + 6; // Skip "btime "
-            const char* const end = line.data() + line.size();
-            auto result = std::from_chars(begin, end, bootTime);
-            if (result.ec == std::errc{})
+            if (ProcParse::nextInteger(line, bootTime))
             {
                 return bootTime;
             }
@@ -725,10 +862,10 @@ uint64_t LinuxProcessProbe::readBootTime()
 
 uint64_t LinuxProcessProbe::systemTotalMemory() const
 {
-    std::ifstream meminfo("/proc/meminfo");
+    std::ifstream meminfo(m_Roots.procPath("meminfo"));
     if (!meminfo.is_open())
     {
-        spdlog::error("Failed to open /proc/meminfo");
+        spdlog::error("Failed to open {}/meminfo", m_Roots.proc);
         return 0;
     }
 
@@ -764,114 +901,20 @@ uint64_t LinuxProcessProbe::systemTotalMemory() const
     return 0;
 }
 
-bool LinuxProcessProbe::detectPowerCap()
-{
-    // Try to find Intel RAPL package energy file
-    // Common paths: /sys/class/powercap/intel-rapl/intel-rapl:0/energy_uj
-    const std::vector<std::string> possiblePaths = {
-        "/sys/class/powercap/intel-rapl/intel-rapl:0/energy_uj",
-        "/sys/class/powercap/intel-rapl:0/energy_uj",
-    };
-
-    for (const auto& path : possiblePaths)
-    {
-        const std::ifstream file(path);
-        if (file.good())
-        {
-            m_PowerCapPath = path;
-            return true;
-        }
-    }
-
-    // Try to enumerate powercap directory
-    std::error_code ec;
-    const std::filesystem::path powercapDir("/sys/class/powercap");
-    if (std::filesystem::exists(powercapDir, ec) && std::filesystem::is_directory(powercapDir, ec))
-    {
-        for (const auto& entry : std::filesystem::directory_iterator(powercapDir, ec))
-        {
-            if (entry.is_directory() && entry.path().filename().string().starts_with("intel-rapl"))
-            {
-                std::filesystem::path energyFile = entry.path() / "energy_uj";
-                if (std::filesystem::exists(energyFile, ec))
-                {
-                    m_PowerCapPath = energyFile.string();
-                    return true;
-                }
-
-                // Try package:0 subdirectory
-                const std::filesystem::path packageDir = entry.path() / "intel-rapl:0";
-                energyFile = packageDir / "energy_uj";
-                if (std::filesystem::exists(energyFile, ec))
-                {
-                    m_PowerCapPath = energyFile.string();
-                    return true;
-                }
-            }
-        }
-    }
-
-    return false;
-}
-
-uint64_t LinuxProcessProbe::readSystemEnergy() const
-{
-    if (m_PowerCapPath.empty())
-    {
-        return 0;
-    }
-
-    std::ifstream file(m_PowerCapPath);
-    if (!file.is_open())
-    {
-        return 0;
-    }
-
-    uint64_t energyUj = 0;
-    file >> energyUj;
-
-    if (file.fail())
-    {
-        return 0;
-    }
-
-    return energyUj; // Already in microjoules
-}
-
-void LinuxProcessProbe::attributeEnergyToProcesses(std::vector<ProcessCounters>& processes) const
+EnergyCounters LinuxProcessProbe::readEnergyCounters()
 {
-    // Read system-wide energy
-    const uint64_t systemEnergy = readSystemEnergy();
-    if (systemEnergy == 0)
-    {
-        return;
-    }
-
-    // Calculate total CPU time across all processes
-    uint64_t totalProcessCpuTime = 0;
-    for (const auto& proc : processes)
-    {
-        totalProcessCpuTime += (proc.userTime + proc.systemTime);
-    }
-
-    // Avoid division by zero
-    if (totalProcessCpuTime == 0)
-    {
-        return;
-    }
-
-    // Attribute energy proportionally based on CPU usage
-    // This is an approximation: energy per process = systemEnergy * (processCpuTime / totalCpuTime)
-    for (auto& proc : processes)
+    EnergyCounters counters;
+    if (m_Rapl.isAvailable())
     {
-        const uint64_t processCpuTime = proc.userTime + proc.systemTime;
-        const double cpuProportion = static_cast<double>(processCpuTime) / static_cast<double>(totalProcessCpuTime);
-        proc.energyMicrojoules = static_cast<uint64_t>(static_cast<double>(systemEnergy) * cpuProportion);
+        const std::scoped_lock lock(m_EnumerateMutex);
+        m_Rapl.read(counters);
     }
+    return counters;
 }
 
 #if TASKSMACK_HAS_NETLINK_SOCKET_STATS
-void LinuxProcessProbe::attributeNetworkToProcesses(std::vector<ProcessCounters>& processes) const
+void LinuxProcessProbe::attributeNetworkToProcesses(std::vector<ProcessCounters>& processes,
+                                                    const std::unordered_map<std::uint64_t, std::int32_t>& inodeToPid) const
 {
     if (!m_SocketStats)
     {
@@ -885,11 +928,6 @@ void LinuxProcessProbe::attributeNetworkToProcesses(std::vector<ProcessCounters>
         return;
     }
 
-    // Build inode-to-PID mapping by scanning /proc/[pid]/fd/*
-    // TODO: Consider caching this mapping with a TTL to reduce /proc scanning overhead
-    //       on systems with many processes. Current approach scans on each enumerate()
-    //       call (~1Hz) which may add latency on systems with thousands of processes.
-    const std::unordered_map<std::uint64_t, std::int32_t> inodeToPid = buildInodeToPidMap();
     if (inodeToPid.empty())
     {
         return;
@@ -1,26 +1,44 @@
 #pragma once
 
+#include "BatchFileReader.h"
 #include "Platform/IProcessProbe.h"
 #include "Platform/PlatformConfig.h"
+#include "Platform/SystemTypes.h"
+#include "ProcFile.h"
+#include "RaplEnergyReader.h"
+#include "SharedFdTable.h"
+#include "SharedProcStat.h"
+#include "SystemRoots.h"
 
 #if TASKSMACK_HAS_NETLINK_SOCKET_STATS
 #include "Platform/Linux/NetlinkSocketStats.h"
 #endif
 
+#include <array>
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace Platform
 {
 
 /// Linux implementation of IProcessProbe.
-/// Reads from /proc filesystem.
+/// Reads from /proc filesystem. Each enumerate() queues the per-process files of every
+/// PID (stat, statm, status, cmdline, cgroup and, if readable, io) into one BatchFileReader
+/// batch relative to a /proc directory descriptor, then parses the results in place. The
+/// freezer state of every distinct cgroup goes into a second, much smaller batch.
+/// All procfs and sysfs paths resolve against the SystemRoots given at construction.
 class LinuxProcessProbe : public IProcessProbe
 {
   public:
-    LinuxProcessProbe();
-    ~LinuxProcessProbe() override = default;
+    explicit LinuxProcessProbe(SystemRoots roots = {});
+    ~LinuxProcessProbe() override;
 
     LinuxProcessProbe(const LinuxProcessProbe&) = delete;
     LinuxProcessProbe& operator=(const LinuxProcessProbe&) = delete;
@@ -33,15 +51,57 @@ class LinuxProcessProbe : public IProcessProbe
     [[nodiscard]] uint64_t totalCpuTime() const override;
     [[nodiscard]] long ticksPerSecond() const override;
     [[nodiscard]] uint64_t systemTotalMemory() const override;
+    [[nodiscard]] bool readNumaResidency(int32_t pid, std::vector<uint64_t>& kibPerNode) override;
+    [[nodiscard]] EnergyCounters readEnergyCounters() override;
 
   private:
+    SystemRoots m_Roots;
     long m_TicksPerSecond;
     uint64_t m_PageSize;
+    RaplEnergyReader m_Rapl; // Persistent energy_uj descriptors of the package zones
     uint64_t m_BootTimeEpoch = 0;                            // System boot time (Unix epoch seconds)
     mutable std::once_flag m_IoCountersCheckFlag;            // Thread-safe one-time initialization
     mutable std::atomic<bool> m_IoCountersAvailable = false; // Cached capability check (atomic for thread-safe read)
-    bool m_HasPowerCap = false;
-    std::string m_PowerCapPath;
+    bool m_HasNumaMaps = false; // /proc/<pid>/numa_maps exists (CONFIG_NUMA)
+
+    // enumerate() reuses the batch reader, PID list and cgroup pressure cache, readEnergyCounters() the RAPL
+    // descriptors; concurrent callers are serialized
+    std::mutex m_EnumerateMutex;
+    int m_ProcDirFd = -1; // Open /proc directory; per-process reads are relative to it
+    BatchFileReader m_Reader;
+    std::vector<int32_t> m_Pids;
+
+    // cgroup v2 mount point ("/sys/fs/cgroup" or the hybrid "/sys/fs/cgroup/unified");
+    // empty if the host has no unified hierarchy.
+    std::string m_CgroupV2Root;
+
+    // Persistent cpu.pressure handles, keyed by cgroup path. Each cgroup is read once per
+    // enumerate() no matter how many processes it holds; entries for cgroups that no
+    // longer contain any process are dropped.
+    struct CgroupPressureEntry
+    {
+        ProcFile file;
+        PressureCounters counters;
+        std::uint64_t lastSeen = 0; // enumerate() generation
+    };
+    std::unordered_map<std::string, CgroupPressureEntry> m_CgroupPressure;
+    std::uint64_t m_CgroupPressureGeneration = 0;
+
+    // Freezer state files (cgroup v2 cgroup.freeze, v1 freezer.state) of this tick's cgroups.
+    // Each file is queued once however many processes share the cgroup; m_ProcessFreezerSlots
+    // holds, per enumerated process, its v2 and v1 slots in m_FreezerReader (NO_FREEZER_SLOT if none).
+    static constexpr std::size_t NO_FREEZER_SLOT = static_cast<std::size_t>(-1);
+    BatchFileReader m_FreezerReader;
+    std::unordered_map<std::string, std::size_t> m_FreezerSlots;
+    std::vector<std::array<std::size_t, 2>> m_ProcessFreezerSlots;
+    std::string m_FreezerPath; // Scratch for building lookup keys without allocating
+
+    // Cursor into the /proc/stat snapshot shared with LinuxSystemProbe.
+    // Only touched under SharedProcStat's internal lock.
+    mutable SharedProcStat::Consumer m_ProcStatConsumer;
+
+    // Cursor into the fd-table walk shared with the GPU probe's DRM client stats
+    SharedFdTable::Consumer m_FdTableConsumer;
 
 #if TASKSMACK_HAS_NETLINK_SOCKET_STATS
     // Per-process network monitoring via Netlink INET_DIAG
@@ -49,51 +109,54 @@ class LinuxProcessProbe : public IProcessProbe
     bool m_HasNetworkCounters = false;
 #endif
 
-    /// Parse /proc/[pid]/stat for a single process
-    [[nodiscard]] bool parseProcessStat(int32_t pid, ProcessCounters& counters) const;
+    /// Queue /proc/[pid]/<file> on the batch reader
+    void queueProcessFile(int32_t pid, std::string_view file);
 
-    /// Parse /proc/[pid]/statm for memory info
-    void parseProcessStatm(int32_t pid, ProcessCounters& counters) const;
+    /// Parse the contents of /proc/[pid]/stat for a single process
+    [[nodiscard]] bool parseProcessStat(int32_t pid, std::string_view text, ProcessCounters& counters) const;
 
-    /// Parse /proc/[pid]/status for owner (UID) info
-    static void parseProcessStatus(int32_t pid, ProcessCounters& counters);
+    /// Parse the contents of /proc/[pid]/statm for memory info
+    void parseProcessStatm(std::string_view text, ProcessCounters& counters) const;
 
-    /// Parse /proc/[pid]/cmdline for full command line
-    static void parseProcessCmdline(int32_t pid, ProcessCounters& counters);
+    /// Parse the contents of /proc/[pid]/status for owner (UID) and CPU affinity (Cpus_allowed)
+    static void parseProcessStatus(std::string_view text, ProcessCounters& counters);
 
-    /// Parse CPU affinity mask for a process using sched_getaffinity
-    static void parseProcessAffinity(int32_t pid, ProcessCounters& counters);
+    /// Parse the contents of /proc/[pid]/cmdline for full command line
+    static void parseProcessCmdline(std::string_view text, ProcessCounters& counters);
 
-    /// Parse /proc/[pid]/io for I/O counters (requires permissions)
-    static void parseProcessIo(int32_t pid, ProcessCounters& counters);
-
-    /// Count file descriptors in /proc/[pid]/fd (may fail due to permissions)
-    static void countProcessFds(int32_t pid, ProcessCounters& counters);
+    /// Parse the contents of /proc/[pid]/io for I/O counters (requires permissions)
+    static void parseProcessIo(std::string_view text, ProcessCounters& counters);
 
     /// Check if we can read I/O counters (checks own process)
-    [[nodiscard]] static bool checkIoCountersAvailability();
+    [[nodiscard]] bool checkIoCountersAvailability() const;
 
-    /// Get process status from cgroups (Suspended state detection)
-    [[nodiscard]] static std::string getProcessStatus(int32_t pid);
+    /// Parse the contents of /proc/[pid]/cgroup: the v2 path ("0::" entry) goes to
+    /// counters.cgroupPath, and the freezer files to check are queued on m_FreezerReader.
+    void parseProcessCgroup(std::string_view text, ProcessCounters& counters);
 
-    /// Read total CPU time from /proc/stat
-    [[nodiscard]] static uint64_t readTotalCpuTime();
+    /// Queue @p path on m_FreezerReader unless this tick already has; returns its slot
+    [[nodiscard]] std::size_t queueFreezerFile(const std::string& path);
 
-    /// Read system boot time from /proc/stat (returns Unix epoch seconds, 0 if unavailable)
-    [[nodiscard]] static uint64_t readBootTime();
+    /// Read the queued freezer files and mark processes in frozen cgroups "Suspended"
+    void applyFreezerState(std::vector<ProcessCounters>& processes);
 
-    /// Check if RAPL powercap is available and find the path
-    [[nodiscard]] bool detectPowerCap();
+    /// Locate the cgroup v2 mount point (empty if unavailable)
+    [[nodiscard]] std::string detectCgroupV2Root() const;
 
-    /// Read system-wide energy from RAPL (returns microjoules, 0 if unavailable)
-    [[nodiscard]] uint64_t readSystemEnergy() const;
+    /// Fill per-process cgroup CPU pressure totals from each cgroup's cpu.pressure
+    void attributeCgroupPressure(std::vector<ProcessCounters>& processes);
 
-    /// Attribute system energy to processes based on CPU usage
-    void attributeEnergyToProcesses(std::vector<ProcessCounters>& processes) const;
+    /// Read total CPU time from the shared /proc/stat snapshot
+    [[nodiscard]] uint64_t readTotalCpuTime() const;
+
+    /// Read system boot time from /proc/stat (returns Unix epoch seconds, 0 if unavailable)
+    [[nodiscard]] uint64_t readBootTime();
 
 #if TASKSMACK_HAS_NETLINK_SOCKET_STATS
-    /// Attribute network bytes to processes using Netlink socket stats
-    void attributeNetworkToProcesses(std::vector<ProcessCounters>& processes) const;
+    /// Attribute network bytes to processes using Netlink socket stats and the socket
+    /// owners found by the fd-table walk
+    void attributeNetworkToProcesses(std::vector<ProcessCounters>& processes,
+                                     const std::unordered_map<std::uint64_t, std::int32_t>& inodeToPid) const;
 #endif
 };
 
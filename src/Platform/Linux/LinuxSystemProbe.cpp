@@ -5,7 +5,12 @@
 #include "LinuxSystemProbe.h"
 
 #include "Domain/SamplingConfig.h"
+#include "ActivityParse.h"
 #include "Platform/SystemTypes.h"
+#include "PressureParse.h"
+#include "ProcParse.h"
+#include "SharedProcStat.h"
+#include "SystemRoots.h"
 
 #include <spdlog/spdlog.h>
 
@@ -15,9 +20,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <fstream>
+#include <memory>
 #include <mutex>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
@@ -53,8 +59,13 @@ template<std::integral T> [[nodiscard]] constexpr auto checkedPositiveToSizeT(T
 
 } // namespace
 
-LinuxSystemProbe::LinuxSystemProbe()
-    : m_TicksPerSecond(sysconf(_SC_CLK_TCK)), m_NumCores(checkedPositiveToSizeT(sysconf(_SC_NPROCESSORS_ONLN), 1U))
+LinuxSystemProbe::LinuxSystemProbe(SystemRoots roots)
+    : m_Roots(std::move(roots)), m_TicksPerSecond(sysconf(_SC_CLK_TCK)),
+      m_NumCores(checkedPositiveToSizeT(sysconf(_SC_NPROCESSORS_ONLN), 1U)), m_MemInfoFile(m_Roots.procPath("meminfo")),
+      m_UptimeFile(m_Roots.procPath("uptime")), m_LoadAvgFile(m_Roots.procPath("loadavg")), m_NetDevFile(m_Roots.procPath("net/dev")),
+      m_CpuOnlineFile(m_Roots.sysPath("devices/system/cpu/online")), m_CpuFreqReader(m_Roots.sysPath("devices/system/cpu")),
+      m_VmStatFile(m_Roots.procPath("vmstat")), m_SchedStatFile(m_Roots.procPath("schedstat")),
+      m_NumaReader(m_Roots.sysPath("devices/system/node"))
 {
     if (m_TicksPerSecond <= 0)
     {
@@ -74,7 +85,7 @@ LinuxSystemProbe::LinuxSystemProbe()
     }
 
     // Read CPU model from /proc/cpuinfo (cached)
-    std::ifstream cpuInfo("/proc/cpuinfo");
+    std::ifstream cpuInfo(m_Roots.procPath("cpuinfo"));
     if (cpuInfo.is_open())
     {
         std::string line;
@@ -101,18 +112,95 @@ LinuxSystemProbe::LinuxSystemProbe()
         m_CpuModel = "Unknown CPU";
     }
 
+    if (!m_MemInfoFile.isOpen())
+    {
+        spdlog::warn("Failed to open /proc/meminfo");
+    }
+    // rtnetlink reports the running kernel's interfaces; a captured or host-mounted tree
+    // elsewhere must come from its own net/dev
+    if (m_Roots.isDefault())
+    {
+        auto linkStats = std::make_unique<NetlinkLinkStats>();
+        if (linkStats->isAvailable())
+        {
+            m_LinkStats = std::move(linkStats);
+        }
+    }
+    if (!m_LinkStats)
+    {
+        spdlog::debug("LinuxSystemProbe: rtnetlink unavailable or roots not default, using net/dev for interface stats");
+        if (!m_NetDevFile.isOpen())
+        {
+            spdlog::warn("Failed to open {}", m_Roots.procPath("net/dev"));
+        }
+    }
+
+    // PSI needs CONFIG_PSI (and psi=1 on kernels built with PSI_DEFAULT_DISABLED);
+    // irq pressure additionally needs CONFIG_IRQ_TIME_ACCOUNTING (6.1+).
+    constexpr std::array<const char*, PRESSURE_RESOURCE_COUNT> pressurePaths = {
+        "pressure/cpu", "pressure/memory", "pressure/io", "pressure/irq"};
+    for (std::size_t i = 0; i < pressurePaths.size(); ++i)
+    {
+        m_PressureFiles[i] = ProcFile(m_Roots.procPath(pressurePaths[i]));
+        m_HasPressure = m_HasPressure || m_PressureFiles[i].isOpen();
+    }
+    if (!m_HasPressure)
+    {
+        spdlog::debug("LinuxSystemProbe: pressure stall information not available");
+    }
+
+    if (!m_VmStatFile.isOpen())
+    {
+        spdlog::debug("LinuxSystemProbe: /proc/vmstat not available");
+    }
+    if (m_SchedStatFile.isOpen())
+    {
+        // Only the v15+ cpu line layout is understood; don't re-read an unsupported file every tick
+        SystemCounters probeCounters;
+        if (!parseSchedStat(m_SchedStatFile.read(), probeCounters.activity))
+        {
+            spdlog::debug("LinuxSystemProbe: unsupported /proc/schedstat format, run-queue wait unavailable");
+            m_SchedStatFile = ProcFile();
+        }
+    }
+
     spdlog::debug("LinuxSystemProbe: {} cores, {} ticks/sec, host={}, cpu={}", m_NumCores, m_TicksPerSecond, m_Hostname, m_CpuModel);
 }
 
 SystemCounters LinuxSystemProbe::read()
 {
     SystemCounters counters;
-    readCpuCounters(counters);
-    readMemoryCounters(counters);
-    readUptime(counters);
-    readLoadAvg(counters);
-    readCpuFreq(counters);
-    readNetworkCounters(counters);
+
+    {
+        const std::scoped_lock lock(m_FilesMutex);
+
+        // Online set is read every tick so hotplugged/offlined CPUs are reflected immediately.
+        // An unreadable or malformed list leaves the mask empty (trust /proc/stat alone).
+        if (!ProcParse::parseIdList(m_CpuOnlineFile.read(), m_CpuOnlineMask))
+        {
+            m_CpuOnlineMask.clear();
+        }
+
+        if (const auto procStat = SharedProcStat::instance(m_Roots.proc).read(m_ProcStatConsumer))
+        {
+            parseCpuCounters(*procStat, m_CpuOnlineMask, counters);
+            (void) parseProcStatActivity(*procStat, counters.activity);
+        }
+        else
+        {
+            spdlog::warn("Failed to read /proc/stat");
+        }
+
+        parseMemoryCounters(m_MemInfoFile.read(), counters);
+        parseUptime(m_UptimeFile.read(), counters);
+        parseLoadAvg(m_LoadAvgFile.read(), counters);
+        readNetworkCounters(counters);
+        readCpuFreq(counters);
+        readPressure(counters);
+        readActivity(counters);
+        m_NumaReader.read(counters.numaNodes);
+    }
+
     readStaticInfo(counters);
     return counters;
 }
@@ -127,7 +215,10 @@ SystemCapabilities LinuxSystemProbe::capabilities() const
                               .hasSteal = true,
                               .hasLoadAvg = true,
                               .hasCpuFreq = true,
-                              .hasNetworkCounters = true};
+                              .hasNetworkCounters = true,
+                              .hasPressure = m_HasPressure,
+                              .hasActivity = m_VmStatFile.isOpen(),
+                              .hasNuma = m_NumaReader.isAvailable()};
 }
 
 long LinuxSystemProbe::ticksPerSecond() const
@@ -135,24 +226,17 @@ long LinuxSystemProbe::ticksPerSecond() const
     return m_TicksPerSecond;
 }
 
-void LinuxSystemProbe::readCpuCounters(SystemCounters& counters)
+void LinuxSystemProbe::parseCpuCounters(std::string_view statText, const std::vector<std::uint8_t>& onlineMask, SystemCounters& counters)
 {
     // Format: /proc/stat
     // cpu  user nice system idle iowait irq softirq steal guest guest_nice
     // cpu0 user nice system idle iowait irq softirq steal guest guest_nice
     // cpu1 ...
 
-    std::ifstream statFile("/proc/stat");
-    if (!statFile.is_open())
-    {
-        spdlog::warn("Failed to open /proc/stat");
-        return;
-    }
-
-    std::string line;
     bool foundTotal = false;
 
-    while (std::getline(statFile, line))
+    std::string_view line;
+    while (ProcParse::nextLine(statText, line))
     {
         if (!line.starts_with("cpu"))
         {
@@ -160,18 +244,25 @@ void LinuxSystemProbe::readCpuCounters(SystemCounters& counters)
             break;
         }
 
-        std::istringstream iss(line);
-        std::string label;
-        iss >> label;
+        const std::string_view label = ProcParse::nextToken(line);
 
+        // Older kernels may not have all fields; missing trailing fields stay zero.
         CpuCounters cpu{};
-        iss >> cpu.user >> cpu.nice >> cpu.system >> cpu.idle >> cpu.iowait >> cpu.irq >> cpu.softirq >> cpu.steal >> cpu.guest >>
-            cpu.guestNice;
-
-        if (iss.fail())
+        for (uint64_t* field : {&cpu.user,
+                                &cpu.nice,
+                                &cpu.system,
+                                &cpu.idle,
+                                &cpu.iowait,
+                                &cpu.irq,
+                                &cpu.softirq,
+                                &cpu.steal,
+                                &cpu.guest,
+                                &cpu.guestNice})
         {
-            // Older kernels may not have all fields, that's OK
-            // Just reset the stream and try with fewer fields
+            if (!ProcParse::nextInteger(line, *field))
+            {
+                break;
+            }
         }
 
         if (label == "cpu")
@@ -180,10 +271,25 @@ void LinuxSystemProbe::readCpuCounters(SystemCounters& counters)
             counters.cpuTotal = cpu;
             foundTotal = true;
         }
-        else if (label.size() > 3)
+        else
         {
-            // Per-core line (cpu0, cpu1, etc.)
+            // Per-core line (cpu0, cpu1, etc.). Offline CPUs have no line, so the suffix
+            // (not the line position) identifies the core.
+            std::string_view suffix = label.substr(3);
+            uint32_t cpuId = 0;
+            if (!ProcParse::nextInteger(suffix, cpuId))
+            {
+                continue;
+            }
+
+            // Skip CPUs that went offline between the two reads.
+            if (!onlineMask.empty() && (cpuId >= onlineMask.size() || onlineMask[cpuId] == 0))
+            {
+                continue;
+            }
+
             counters.cpuPerCore.push_back(cpu);
+            counters.cpuPerCoreIds.push_back(cpuId);
         }
     }
 
@@ -193,7 +299,7 @@ void LinuxSystemProbe::readCpuCounters(SystemCounters& counters)
     }
 }
 
-void LinuxSystemProbe::readMemoryCounters(SystemCounters& counters)
+void LinuxSystemProbe::parseMemoryCounters(std::string_view memInfoText, SystemCounters& counters)
 {
     // Format: /proc/meminfo
     // MemTotal:       16384000 kB
@@ -205,78 +311,52 @@ void LinuxSystemProbe::readMemoryCounters(SystemCounters& counters)
     // SwapFree:        2097152 kB
     // ...
 
-    std::ifstream memFile("/proc/meminfo");
-    if (!memFile.is_open())
-    {
-        spdlog::warn("Failed to open /proc/meminfo");
-        return;
-    }
+    // Convert from kB to bytes
+    constexpr uint64_t KB = 1024;
 
-    std::string line;
-    while (std::getline(memFile, line))
+    struct MemInfoField
     {
-        std::istringstream iss(line);
-        std::string key;
-        uint64_t value = 0;
-        std::string unit;
-
-        iss >> key >> value >> unit;
-
-        // Remove trailing colon from key
-        if (!key.empty() && key.back() == ':')
-        {
-            key.pop_back();
-        }
-
-        // Convert from kB to bytes
-        constexpr uint64_t KB = 1024;
-
-        if (key == "MemTotal")
-        {
-            counters.memory.totalBytes = value * KB;
-        }
-        else if (key == "MemFree")
-        {
-            counters.memory.freeBytes = value * KB;
-        }
-        else if (key == "MemAvailable")
-        {
-            counters.memory.availableBytes = value * KB;
-        }
-        else if (key == "Buffers")
-        {
-            counters.memory.buffersBytes = value * KB;
-        }
-        else if (key == "Cached")
-        {
-            counters.memory.cachedBytes = value * KB;
-        }
-        else if (key == "SwapTotal")
-        {
-            counters.memory.swapTotalBytes = value * KB;
-        }
-        else if (key == "SwapFree")
+        std::string_view key;
+        uint64_t MemoryCounters::* target;
+    };
+    static constexpr std::array<MemInfoField, 7> FIELDS = {{
+        {.key = "MemTotal:", .target = &MemoryCounters::totalBytes},
+        {.key = "MemFree:", .target = &MemoryCounters::freeBytes},
+        {.key = "MemAvailable:", .target = &MemoryCounters::availableBytes},
+        {.key = "Buffers:", .target = &MemoryCounters::buffersBytes},
+        {.key = "Cached:", .target = &MemoryCounters::cachedBytes},
+        {.key = "SwapTotal:", .target = &MemoryCounters::swapTotalBytes},
+        {.key = "SwapFree:", .target = &MemoryCounters::swapFreeBytes},
+    }};
+
+    std::size_t found = 0;
+    std::string_view line;
+    while (found < FIELDS.size() && ProcParse::nextLine(memInfoText, line))
+    {
+        const std::string_view key = ProcParse::nextToken(line);
+        for (const auto& field : FIELDS)
         {
-            counters.memory.swapFreeBytes = value * KB;
+            if (key == field.key)
+            {
+                uint64_t value = 0;
+                if (ProcParse::nextInteger(line, value))
+                {
+                    counters.memory.*field.target = value * KB;
+                }
+                ++found;
+                break;
+            }
         }
     }
 }
 
-void LinuxSystemProbe::readUptime(SystemCounters& counters)
+void LinuxSystemProbe::parseUptime(std::string_view uptimeText, SystemCounters& counters)
 {
     // Format: /proc/uptime
     // uptime_seconds idle_seconds
 
-    std::ifstream uptimeFile("/proc/uptime");
-    if (!uptimeFile.is_open())
-    {
-        return;
-    }
-
     double uptimeSeconds = 0.0;
-    uptimeFile >> uptimeSeconds;
-
-    if (!uptimeFile.fail())
+    if (ProcParse::nextDecimal(uptimeText, uptimeSeconds))
     {
         counters.uptimeSeconds = static_cast<uint64_t>(uptimeSeconds);
     }
@@ -289,51 +369,129 @@ void LinuxSystemProbe::readStaticInfo(SystemCounters& counters) const
     counters.cpuCoreCount = m_NumCores;
 }
 
-void LinuxSystemProbe::readLoadAvg(SystemCounters& counters)
+void LinuxSystemProbe::parseLoadAvg(std::string_view loadAvgText, SystemCounters& counters)
 {
     // Format: /proc/loadavg
     // 0.31 0.65 0.97 1/330 12345
     // load1 load5 load15 running/total lastpid
 
-    std::ifstream loadFile("/proc/loadavg");
-    if (!loadFile.is_open())
+    double load1 = 0.0;
+    double load5 = 0.0;
+    double load15 = 0.0;
+    if (ProcParse::nextDecimal(loadAvgText, load1) && ProcParse::nextDecimal(loadAvgText, load5) &&
+        ProcParse::nextDecimal(loadAvgText, load15))
     {
-        return;
+        counters.loadAvg1 = load1;
+        counters.loadAvg5 = load5;
+        counters.loadAvg15 = load15;
     }
+}
 
-    loadFile >> counters.loadAvg1 >> counters.loadAvg5 >> counters.loadAvg15;
+void LinuxSystemProbe::readPressure(SystemCounters& counters)
+{
+    for (std::size_t i = 0; i < m_PressureFiles.size(); ++i)
+    {
+        if (m_PressureFiles[i].isOpen())
+        {
+            // A failed parse leaves the resource marked unavailable for this tick
+            (void) parsePressure(m_PressureFiles[i].read(), counters.pressure[i]);
+        }
+    }
+}
+
+void LinuxSystemProbe::readActivity(SystemCounters& counters)
+{
+    if (m_VmStatFile.isOpen())
+    {
+        (void) parseVmStat(m_VmStatFile.read(), counters.activity);
+    }
+    if (m_SchedStatFile.isOpen())
+    {
+        (void) parseSchedStat(m_SchedStatFile.read(), counters.activity);
+    }
 }
 
 void LinuxSystemProbe::readCpuFreq(SystemCounters& counters)
 {
-    // Try to read current CPU frequency from scaling driver
-    // /sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq (in kHz)
-    std::ifstream freqFile("/sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq");
-    if (freqFile.is_open())
-    {
-        uint64_t freqKHz = 0;
-        freqFile >> freqKHz;
-        if (!freqFile.fail())
+    // /sys/devices/system/cpu/cpuN/cpufreq/scaling_cur_freq (kHz), one persistent fd per core
+    m_CpuFreqReader.read(counters.cpuPerCoreIds, counters.cpuPerCoreFreqMHz);
+
+    uint64_t sumMHz = 0;
+    uint64_t reporting = 0;
+    for (const uint32_t freqMHz : counters.cpuPerCoreFreqMHz)
+    {
+        if (freqMHz > 0)
         {
-            counters.cpuFreqMHz = freqKHz / 1000;
-            return;
+            sumMHz += freqMHz;
+            ++reporting;
         }
     }
 
-    // Fallback: try cpuinfo_cur_freq
-    std::ifstream cpuInfoFreq("/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_cur_freq");
-    if (cpuInfoFreq.is_open())
+    if (reporting > 0)
     {
-        uint64_t freqKHz = 0;
-        cpuInfoFreq >> freqKHz;
-        if (!cpuInfoFreq.fail())
+        counters.cpuFreqMHz = sumMHz / reporting;
+    }
+}
+
+void LinuxSystemProbe::readNetworkCounters(SystemCounters& counters)
+{
+    if (!readNetworkCountersNetlink(counters))
+    {
+        readNetworkCountersProcNetDev(m_NetDevFile.read(), counters);
+    }
+
+    // Clean up cache entries for interfaces that no longer exist
+    // (e.g., USB network adapters unplugged, VMs/containers destroyed)
+    std::vector<std::string> currentInterfaces;
+    currentInterfaces.reserve(counters.networkInterfaces.size());
+    for (const auto& iface : counters.networkInterfaces)
+    {
+        currentInterfaces.push_back(iface.name);
+    }
+    cleanupStaleInterfaceCacheEntries(currentInterfaces);
+}
+
+bool LinuxSystemProbe::readNetworkCountersNetlink(SystemCounters& counters)
+{
+    if (!m_LinkStats || !m_LinkStats->query(m_LinkStatsBuffer))
+    {
+        return false;
+    }
+
+    uint64_t totalRxBytes = 0;
+    uint64_t totalTxBytes = 0;
+    counters.networkInterfaces.reserve(m_LinkStatsBuffer.size());
+
+    for (auto& link : m_LinkStatsBuffer)
+    {
+        // Skip loopback - it's internal traffic
+        if (link.isLoopback)
         {
-            counters.cpuFreqMHz = freqKHz / 1000;
+            continue;
         }
+
+        totalRxBytes += link.rxBytes;
+        totalTxBytes += link.txBytes;
+
+        SystemCounters::InterfaceCounters ifaceCounters;
+        ifaceCounters.displayName = link.name; // Linux: use system name as display name
+        ifaceCounters.name = std::move(link.name);
+        ifaceCounters.rxBytes = link.rxBytes;
+        ifaceCounters.txBytes = link.txBytes;
+        ifaceCounters.isUp = link.isUp;
+        ifaceCounters.linkSpeedMbps = getInterfaceLinkSpeed(ifaceCounters.name, ifaceCounters.isUp);
+        ifaceCounters.ifIndex = link.ifIndex;
+        ifaceCounters.mtu = link.mtu;
+        ifaceCounters.kind = std::move(link.kind);
+        counters.networkInterfaces.push_back(std::move(ifaceCounters));
     }
+
+    counters.netRxBytes = totalRxBytes;
+    counters.netTxBytes = totalTxBytes;
+    return true;
 }
 
-void LinuxSystemProbe::readNetworkCounters(SystemCounters& counters)
+void LinuxSystemProbe::readNetworkCountersProcNetDev(std::string_view netDevText, SystemCounters& counters)
 {
     // Format: /proc/net/dev
     // Inter-|   Receive                                                |  Transmit
@@ -341,41 +499,36 @@ void LinuxSystemProbe::readNetworkCounters(SystemCounters& counters)
     //     lo: 1234567   12345    0    0    0     0          0         0  1234567   12345    0    0    0     0       0          0
     //   eth0: 9876543   98765    0    0    0     0          0         0  5432109   54321    0    0    0     0       0          0
 
-    std::ifstream netFile("/proc/net/dev");
-    if (!netFile.is_open())
+    if (netDevText.empty())
     {
-        spdlog::warn("Failed to open /proc/net/dev");
         return;
     }
 
     uint64_t totalRxBytes = 0;
     uint64_t totalTxBytes = 0;
 
-    std::string line;
+    std::string_view line;
     // Skip first two header lines
-    std::getline(netFile, line);
-    std::getline(netFile, line);
+    (void) ProcParse::nextLine(netDevText, line);
+    (void) ProcParse::nextLine(netDevText, line);
 
-    while (std::getline(netFile, line))
+    while (ProcParse::nextLine(netDevText, line))
     {
         // Find the colon separator between interface name and stats
-        auto colonPos = line.find(':');
-        if (colonPos == std::string::npos)
+        const auto colonPos = line.find(':');
+        if (colonPos == std::string_view::npos)
         {
             continue;
         }
 
         // Extract interface name (trimmed)
-        std::string iface = line.substr(0, colonPos);
-        // Trim leading/trailing whitespace
-        auto start = iface.find_first_not_of(" \t");
-        if (start == std::string::npos)
+        std::string_view nameField = line.substr(0, colonPos);
+        const std::string_view iface = ProcParse::nextToken(nameField);
+        if (iface.empty())
         {
             // Interface name is all whitespace; skip this line
             continue;
         }
-        auto end = iface.find_last_not_of(" \t");
-        iface = iface.substr(start, (end - start) + 1);
 
         // Skip loopback interface - it's internal traffic
         if (iface == "lo")
@@ -383,22 +536,23 @@ void LinuxSystemProbe::readNetworkCounters(SystemCounters& counters)
             continue;
         }
 
-        // Parse the stats after the colon
-        std::istringstream iss(line.substr(colonPos + 1));
-        uint64_t rxBytes = 0;
-        uint64_t rxPackets = 0;
-        uint64_t rxErrs = 0;
-        uint64_t rxDrop = 0;
-        uint64_t rxFifo = 0;
-        uint64_t rxFrame = 0;
-        uint64_t rxCompressed = 0;
-        uint64_t rxMulticast = 0;
-        uint64_t txBytes = 0;
-
-        iss >> rxBytes >> rxPackets >> rxErrs >> rxDrop >> rxFifo >> rxFrame >> rxCompressed >> rxMulticast >> txBytes;
-
-        if (!iss.fail())
+        // Parse the stats after the colon: 8 receive fields, then transmit bytes
+        std::string_view stats = line.substr(colonPos + 1);
+        std::array<uint64_t, 9> fields{};
+        bool parsed = true;
+        for (auto& field : fields)
         {
+            if (!ProcParse::nextInteger(stats, field))
+            {
+                parsed = false;
+                break;
+            }
+        }
+
+        if (parsed)
+        {
+            const uint64_t rxBytes = fields[0];
+            const uint64_t txBytes = fields[8];
             totalRxBytes += rxBytes;
             totalTxBytes += txBytes;
 
@@ -408,24 +562,14 @@ void LinuxSystemProbe::readNetworkCounters(SystemCounters& counters)
             ifaceCounters.displayName = iface; // Linux: use system name as display name
             ifaceCounters.rxBytes = rxBytes;
             ifaceCounters.txBytes = txBytes;
-            ifaceCounters.isUp = readInterfaceOperState(iface);
-            ifaceCounters.linkSpeedMbps = getInterfaceLinkSpeed(iface, ifaceCounters.isUp);
+            ifaceCounters.isUp = readInterfaceOperState(ifaceCounters.name);
+            ifaceCounters.linkSpeedMbps = getInterfaceLinkSpeed(ifaceCounters.name, ifaceCounters.isUp);
             counters.networkInterfaces.push_back(std::move(ifaceCounters));
         }
     }
 
     counters.netRxBytes = totalRxBytes;
     counters.netTxBytes = totalTxBytes;
-
-    // Clean up cache entries for interfaces that no longer exist
-    // (e.g., USB network adapters unplugged, VMs/containers destroyed)
-    std::vector<std::string> currentInterfaces;
-    currentInterfaces.reserve(counters.networkInterfaces.size());
-    for (const auto& iface : counters.networkInterfaces)
-    {
-        currentInterfaces.push_back(iface.name);
-    }
-    cleanupStaleInterfaceCacheEntries(currentInterfaces);
 }
 
 void LinuxSystemProbe::cleanupStaleInterfaceCacheEntries(const std::vector<std::string>& currentInterfaces)
@@ -493,11 +637,11 @@ uint64_t LinuxSystemProbe::getInterfaceLinkSpeed(const std::string& ifaceName, b
     return newSpeed;
 }
 
-uint64_t LinuxSystemProbe::readInterfaceLinkSpeedFromSysfs(const std::string& ifaceName)
+uint64_t LinuxSystemProbe::readInterfaceLinkSpeedFromSysfs(const std::string& ifaceName) const
 {
     // Read link speed from /sys/class/net/<iface>/speed (in Mbps)
     // Returns 0 if unavailable (e.g., virtual interfaces, down interfaces)
-    const std::string speedPath = "/sys/class/net/" + ifaceName + "/speed";
+    const std::string speedPath = m_Roots.sysPath("class/net/" + ifaceName + "/speed");
     std::ifstream speedFile(speedPath);
     if (!speedFile.is_open())
     {
@@ -516,11 +660,11 @@ uint64_t LinuxSystemProbe::readInterfaceLinkSpeedFromSysfs(const std::string& if
     return static_cast<uint64_t>(speedMbps);
 }
 
-bool LinuxSystemProbe::readInterfaceOperState(const std::string& ifaceName)
+bool LinuxSystemProbe::readInterfaceOperState(const std::string& ifaceName) const
 {
     // Read operational state from /sys/class/net/<iface>/operstate
     // Returns true if "up", false otherwise (down, unknown, etc.)
-    const std::string operstatePath = "/sys/class/net/" + ifaceName + "/operstate";
+    const std::string operstatePath = m_Roots.sysPath("class/net/" + ifaceName + "/operstate");
     std::ifstream operstateFile(operstatePath);
     if (!operstateFile.is_open())
     {
@@ -1,11 +1,21 @@
 #pragma once
 
+#include "CpuFreqReader.h"
+#include "NetlinkLinkStats.h"
+#include "NumaNodeReader.h"
 #include "Platform/ISystemProbe.h"
+#include "ProcFile.h"
+#include "SharedProcStat.h"
+#include "SystemRoots.h"
 
+#include <array>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -13,11 +23,18 @@ namespace Platform
 {
 
 /// Linux implementation of ISystemProbe.
-/// Reads system metrics from /proc/stat, /proc/meminfo, /proc/uptime.
+/// Reads system metrics from /proc/stat, /proc/meminfo, /proc/uptime, /proc/pressure/*,
+/// /proc/vmstat, /proc/schedstat, per-core cpufreq attributes and per-NUMA-node sysfs files.
+/// Interface statistics come from an rtnetlink RTM_GETLINK dump, falling back to
+/// /proc/net/dev if netlink is unavailable. Non-default roots always use <proc>/net/dev,
+/// since netlink describes the running kernel's network namespace.
+/// The seq files are opened once and re-read with pread() every tick; /proc/stat is
+/// shared with LinuxProcessProbe through SharedProcStat. procfs and sysfs paths resolve
+/// against the SystemRoots given at construction.
 class LinuxSystemProbe : public ISystemProbe
 {
   public:
-    LinuxSystemProbe();
+    explicit LinuxSystemProbe(SystemRoots roots = {});
     ~LinuxSystemProbe() override = default;
 
     // Non-copyable, non-movable (contains mutex)
@@ -31,18 +48,28 @@ class LinuxSystemProbe : public ISystemProbe
     [[nodiscard]] long ticksPerSecond() const override;
 
   private:
-    static void readCpuCounters(SystemCounters& counters);
-    static void readMemoryCounters(SystemCounters& counters);
-    static void readUptime(SystemCounters& counters);
-    static void readLoadAvg(SystemCounters& counters);
-    static void readCpuFreq(SystemCounters& counters);
-
-    /// Read network-related counters (bytes, packets, etc.) from /proc/net/dev.
-    /// Unlike the other read* helpers, this method is non-static because it
-    /// uses m_InterfaceCache to cache per-interface link speed and state in
-    /// order to avoid repeated sysfs reads. The other helpers are stateless
-    /// and remain static.
+    /// Parse cpu/cpuN lines. Per-core entries are tagged with their logical CPU id;
+    /// if @p onlineMask is non-empty, cores it marks offline are skipped.
+    static void parseCpuCounters(std::string_view statText, const std::vector<std::uint8_t>& onlineMask, SystemCounters& counters);
+    static void parseMemoryCounters(std::string_view memInfoText, SystemCounters& counters);
+    static void parseUptime(std::string_view uptimeText, SystemCounters& counters);
+    static void parseLoadAvg(std::string_view loadAvgText, SystemCounters& counters);
+    /// Per-core frequencies for the cores in counters.cpuPerCoreIds (caller holds m_FilesMutex).
+    void readCpuFreq(SystemCounters& counters);
+    /// PSI totals from /proc/pressure/{cpu,memory,io,irq} (caller holds m_FilesMutex).
+    void readPressure(SystemCounters& counters);
+    /// Scheduler/paging counters from /proc/vmstat and /proc/schedstat (caller holds m_FilesMutex).
+    /// The /proc/stat part is parsed from the shared snapshot in read().
+    void readActivity(SystemCounters& counters);
+
+    /// Per-interface and total network counters (caller holds m_FilesMutex).
+    /// Uses the rtnetlink dump when available and /proc/net/dev otherwise; either way
+    /// link speed comes from m_InterfaceCache so sysfs is only touched on TTL expiry.
     void readNetworkCounters(SystemCounters& counters);
+    /// Fill counters from an RTM_GETLINK dump. Returns false if the dump failed.
+    [[nodiscard]] bool readNetworkCountersNetlink(SystemCounters& counters);
+    /// Fallback: parse /proc/net/dev text (oper state then needs one sysfs read per interface).
+    void readNetworkCountersProcNetDev(std::string_view netDevText, SystemCounters& counters);
     void readStaticInfo(SystemCounters& counters) const;
 
     /// Get interface link speed (returns 0 if unavailable).
@@ -51,16 +78,17 @@ class LinuxSystemProbe : public ISystemProbe
     /// @param isUp Current operational state (for detecting down→up transitions)
     [[nodiscard]] uint64_t getInterfaceLinkSpeed(const std::string& ifaceName, bool isUp);
 
-    /// Read interface operational state from sysfs (up/down/unknown).
-    [[nodiscard]] static bool readInterfaceOperState(const std::string& ifaceName);
+    /// Read interface operational state from sysfs (up/down/unknown). /proc/net/dev fallback only.
+    [[nodiscard]] bool readInterfaceOperState(const std::string& ifaceName) const;
 
     /// Read link speed directly from sysfs (uncached).
-    [[nodiscard]] static uint64_t readInterfaceLinkSpeedFromSysfs(const std::string& ifaceName);
+    [[nodiscard]] uint64_t readInterfaceLinkSpeedFromSysfs(const std::string& ifaceName) const;
 
     /// Remove cache entries for interfaces that no longer exist.
     /// @param currentInterfaces Vector of interface names seen in current enumeration
     void cleanupStaleInterfaceCacheEntries(const std::vector<std::string>& currentInterfaces);
 
+    SystemRoots m_Roots;
     long m_TicksPerSecond;
     std::size_t m_NumCores;
 
@@ -68,6 +96,25 @@ class LinuxSystemProbe : public ISystemProbe
     std::string m_Hostname;
     std::string m_CpuModel;
 
+    // Persistent handles to the per-tick seq files. ProcFile buffers are reused across
+    // reads and are not thread-safe, so read() holds m_FilesMutex while using them.
+    std::mutex m_FilesMutex;
+    ProcFile m_MemInfoFile;
+    ProcFile m_UptimeFile;
+    ProcFile m_LoadAvgFile;
+    ProcFile m_NetDevFile;
+    std::unique_ptr<NetlinkLinkStats> m_LinkStats; // Null for non-default roots or without rtnetlink
+    std::vector<LinkStats> m_LinkStatsBuffer; // Reused across dumps
+    ProcFile m_CpuOnlineFile;
+    std::vector<std::uint8_t> m_CpuOnlineMask; // Indexed by logical CPU id, refreshed every read()
+    CpuFreqReader m_CpuFreqReader;
+    std::array<ProcFile, PRESSURE_RESOURCE_COUNT> m_PressureFiles; // Indexed by PressureResource
+    bool m_HasPressure = false;
+    ProcFile m_VmStatFile;
+    ProcFile m_SchedStatFile; // Needs CONFIG_SCHEDSTATS; closed if the format is unsupported
+    NumaNodeReader m_NumaReader;
+    SharedProcStat::Consumer m_ProcStatConsumer;
+
     // Optimization cache for network interface properties.
     // NOTE: This is NOT semantic state - the probe contract remains stateless (raw counters).
     // This is analogous to m_Hostname and m_CpuModel above: caching values that rarely change
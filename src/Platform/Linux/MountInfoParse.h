@@ -0,0 +1,127 @@
+#pragma once
+
+#include "ProcParse.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Platform
+{
+
+/// Fields of one /proc/<pid>/mountinfo line, as views into the line.
+struct MountInfoFields
+{
+    std::uint32_t major = 0;
+    std::uint32_t minor = 0;
+    std::string_view root;       // Path within the filesystem that forms the mount's root
+    std::string_view mountPoint; // Still octal-escaped; see unescapeMountPath()
+    std::string_view options;    // Per-mount options ("rw,relatime")
+    std::string_view fsType;
+    std::string_view source;
+};
+
+namespace MountInfoParseDetail
+{
+
+// Kernel and user-space filesystems with no meaningful capacity. squashfs is listed because
+// snap and AppImage mounts are read-only images that always read 100% full.
+inline constexpr std::array<std::string_view, 24> PSEUDO_FILESYSTEMS = {
+    "autofs",   "binfmt_misc", "bpf",        "cgroup",    "cgroup2",  "configfs", "debugfs", "devpts",
+    "devtmpfs", "efivarfs",    "fusectl",    "hugetlbfs", "mqueue",   "nsfs",     "proc",    "pstore",
+    "ramfs",    "rpc_pipefs",  "securityfs", "selinuxfs", "squashfs", "sysfs",    "tracefs", "fuse.portal",
+};
+
+// statvfs() on these can block indefinitely when the server is unreachable
+inline constexpr std::array<std::string_view, 9> NETWORK_FILESYSTEMS = {
+    "nfs", "nfs4", "cifs", "smb3", "smbfs", "ceph", "glusterfs", "fuse.sshfs", "9p",
+};
+
+} // namespace MountInfoParseDetail
+
+/// Parse one mountinfo line.
+///
+/// Format (proc(5)):
+///   36 35 98:0 /mnt1 /mnt/parent rw,noatime master:1 - ext3 /dev/root rw,errors=continue
+///   (1)(2)(3)   (4)   (5)         (6)      (7...)    (8)(9)   (10)      (11)
+/// Optional fields (7) run up to the lone "-" separator. Returns false if the line is malformed.
+[[nodiscard]] inline bool parseMountInfoLine(std::string_view line, MountInfoFields& out) noexcept
+{
+    std::uint32_t id = 0;
+    if (!ProcParse::nextInteger(line, id) || !ProcParse::nextInteger(line, id))
+    {
+        return false;
+    }
+
+    std::string_view devField = ProcParse::nextToken(line);
+    if (!ProcParse::nextInteger(devField, out.major) || devField.empty() || devField.front() != ':')
+    {
+        return false;
+    }
+    devField.remove_prefix(1);
+    if (!ProcParse::nextInteger(devField, out.minor))
+    {
+        return false;
+    }
+
+    out.root = ProcParse::nextToken(line);
+    out.mountPoint = ProcParse::nextToken(line);
+    out.options = ProcParse::nextToken(line);
+
+    for (std::string_view token = ProcParse::nextToken(line); token != "-"; token = ProcParse::nextToken(line))
+    {
+        if (token.empty())
+        {
+            return false;
+        }
+    }
+
+    out.fsType = ProcParse::nextToken(line);
+    out.source = ProcParse::nextToken(line);
+    return !out.mountPoint.empty() && !out.fsType.empty();
+}
+
+/// Decode the octal escapes the kernel applies to mountinfo paths (\040 space, \011 tab,
+/// \012 newline, \134 backslash).
+[[nodiscard]] inline std::string unescapeMountPath(std::string_view path)
+{
+    std::string out;
+    out.reserve(path.size());
+    for (std::size_t i = 0; i < path.size(); ++i)
+    {
+        const bool isEscape = path[i] == '\\' && i + 3 < path.size() &&
+                              std::ranges::all_of(path.substr(i + 1, 3), [](char c) { return c >= '0' && c <= '7'; });
+        if (isEscape)
+        {
+            out.push_back(static_cast<char>(((path[i + 1] - '0') << 6) | ((path[i + 2] - '0') << 3) | (path[i + 3] - '0')));
+            i += 3;
+        }
+        else
+        {
+            out.push_back(path[i]);
+        }
+    }
+    return out;
+}
+
+/// Whether a mount with this option string is read-only.
+[[nodiscard]] inline bool isReadOnlyMount(std::string_view options) noexcept
+{
+    return options == "ro" || options.starts_with("ro,");
+}
+
+/// Whether @p fsType has no capacity worth reporting (procfs, cgroup, ...).
+[[nodiscard]] inline bool isPseudoFilesystem(std::string_view fsType) noexcept
+{
+    return std::ranges::find(MountInfoParseDetail::PSEUDO_FILESYSTEMS, fsType) != MountInfoParseDetail::PSEUDO_FILESYSTEMS.end();
+}
+
+/// Whether @p fsType is network-backed, where statvfs() may hang.
+[[nodiscard]] inline bool isNetworkFilesystem(std::string_view fsType) noexcept
+{
+    return std::ranges::find(MountInfoParseDetail::NETWORK_FILESYSTEMS, fsType) != MountInfoParseDetail::NETWORK_FILESYSTEMS.end();
+}
+
+} // namespace Platform
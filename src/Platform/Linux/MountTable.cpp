@@ -0,0 +1,199 @@
+// Keep this translation unit parseable on non-Linux platforms (e.g. Windows clangd)
+// by compiling the implementation only when targeting Linux and required headers exist.
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "MountTable.h"
+
+#include "MountInfoParse.h"
+#include "ProcParse.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <poll.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <sys/sysmacros.h>
+
+namespace Platform
+{
+
+namespace
+{
+
+namespace fs = std::filesystem;
+
+// dm-crypt on LVM on a partition is three levels deep; anything deeper is treated as unknown
+constexpr int MAX_STACK_DEPTH = 4;
+
+/// Follow a resolved /sys/devices/.../block/<dev> directory to the whole disk beneath it:
+/// a partition's parent, or the first underlying device of a device-mapper or md volume.
+[[nodiscard]] std::string wholeDiskName(const fs::path& devDir, int depth = 0)
+{
+    std::error_code ec;
+    if (fs::exists(devDir / "partition", ec))
+    {
+        return devDir.parent_path().filename().string();
+    }
+
+    if (depth < MAX_STACK_DEPTH)
+    {
+        for (const auto& entry : fs::directory_iterator(devDir / "slaves", ec))
+        {
+            std::error_code slaveEc;
+            const fs::path slave = fs::canonical(entry.path(), slaveEc);
+            if (!slaveEc)
+            {
+                return wholeDiskName(slave, depth + 1);
+            }
+        }
+    }
+
+    return devDir.filename().string();
+}
+
+[[nodiscard]] std::uint64_t deviceKey(std::uint32_t major, std::uint32_t minor) noexcept
+{
+    return (static_cast<std::uint64_t>(major) << 32) | minor;
+}
+
+} // namespace
+
+MountTable::MountTable(std::string mountInfoPath, std::string sysDevBlockRoot, std::chrono::milliseconds capacityInterval)
+    : m_MountInfo(std::move(mountInfoPath)), m_SysDevBlockRoot(std::move(sysDevBlockRoot)), m_CapacityInterval(capacityInterval)
+{
+}
+
+void MountTable::read(std::vector<MountCounters>& out)
+{
+    out.clear();
+    if (!isAvailable())
+    {
+        return;
+    }
+
+    // The descriptor only signals changes made after it was opened, so the first read always parses
+    if (m_ParseCount == 0 || tableChanged())
+    {
+        parseTable();
+        m_CapacityDue = true;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (m_CapacityDue || now - m_LastCapacityRefresh >= m_CapacityInterval)
+    {
+        refreshCapacity();
+        m_LastCapacityRefresh = now;
+        m_CapacityDue = false;
+    }
+
+    out = m_Mounts;
+}
+
+bool MountTable::tableChanged() const
+{
+    // Zero timeout: this only asks whether the namespace's mount event counter moved since the last poll
+    pollfd pfd{.fd = m_MountInfo.fd(), .events = POLLPRI, .revents = 0};
+    return ::poll(&pfd, 1, 0) > 0 && (pfd.revents & (POLLPRI | POLLERR)) != 0;
+}
+
+void MountTable::parseTable()
+{
+    std::string_view text = m_MountInfo.read();
+
+    std::vector<MountCounters> mounts;
+    mounts.reserve(m_Mounts.size());
+    std::vector<std::uint64_t> seenDevices;
+
+    std::string_view line;
+    MountInfoFields fields;
+    while (ProcParse::nextLine(text, line))
+    {
+        if (!parseMountInfoLine(line, fields) || isPseudoFilesystem(fields.fsType) || isNetworkFilesystem(fields.fsType))
+        {
+            continue;
+        }
+
+        // Bind mounts and btrfs subvolumes repeat a device; the first (outermost) mount represents it
+        const std::uint64_t key = deviceKey(fields.major, fields.minor);
+        if (std::ranges::find(seenDevices, key) != seenDevices.end())
+        {
+            continue;
+        }
+        seenDevices.push_back(key);
+
+        MountCounters mount;
+        mount.mountPoint = unescapeMountPath(fields.mountPoint);
+        mount.fsType.assign(fields.fsType);
+        mount.source = unescapeMountPath(fields.source);
+        mount.readOnly = isReadOnlyMount(fields.options);
+        resolveDevice(fields.major, fields.minor, mount);
+        mounts.push_back(std::move(mount));
+    }
+
+    m_Mounts = std::move(mounts);
+    ++m_ParseCount;
+    spdlog::debug("MountTable: parsed {} filesystems from {}", m_Mounts.size(), m_MountInfo.path());
+}
+
+void MountTable::refreshCapacity()
+{
+    ++m_CapacitySequence;
+    for (auto& mount : m_Mounts)
+    {
+        struct statvfs vfs{};
+        if (::statvfs(mount.mountPoint.c_str(), &vfs) != 0)
+        {
+            continue; // Keep the previous values; the mount may be going away
+        }
+
+        const std::uint64_t fragmentSize = vfs.f_frsize != 0 ? vfs.f_frsize : vfs.f_bsize;
+        mount.totalBytes = static_cast<std::uint64_t>(vfs.f_blocks) * fragmentSize;
+        mount.freeBytes = static_cast<std::uint64_t>(vfs.f_bfree) * fragmentSize;
+        mount.availBytes = static_cast<std::uint64_t>(vfs.f_bavail) * fragmentSize;
+        mount.totalInodes = vfs.f_files;
+        mount.freeInodes = vfs.f_ffree;
+        mount.capacitySequence = m_CapacitySequence;
+        mount.hasCapacity = true;
+    }
+}
+
+void MountTable::resolveDevice(std::uint32_t major, std::uint32_t minor, MountCounters& mount) const
+{
+    // btrfs (and other multi-device filesystems) report an anonymous 0:N device; the source names the real one
+    if (major == 0 && mount.source.starts_with("/dev/"))
+    {
+        struct stat st{};
+        if (::stat(mount.source.c_str(), &st) == 0 && S_ISBLK(st.st_mode))
+        {
+            major = ::major(st.st_rdev);
+            minor = ::minor(st.st_rdev);
+        }
+    }
+    if (major == 0)
+    {
+        return; // tmpfs, overlay and other virtual filesystems
+    }
+
+    std::error_code ec;
+    const fs::path devDir = fs::canonical(m_SysDevBlockRoot + "/" + std::format("{}:{}", major, minor), ec);
+    if (ec)
+    {
+        return;
+    }
+    mount.deviceName = devDir.filename().string();
+    mount.diskName = wholeDiskName(devDir);
+}
+
+} // namespace Platform
+
+#endif // __linux__ && __has_include(<unistd.h>)
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Platform/StorageTypes.h"
+#include "ProcFile.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Platform
+{
+
+/// Mounted-filesystem collector for Linux.
+///
+/// The mount table (/proc/self/mountinfo) is parsed once and then only when poll() on
+/// its descriptor reports POLLPRI, which the kernel raises on every mount, unmount or
+/// remount; a steady-state tick costs one zero-timeout poll(). Pseudo filesystems,
+/// network filesystems (statvfs can hang on a dead server) and bind mounts of an
+/// already-listed device are skipped. Each mount is mapped through /sys/dev/block to
+/// its block device and the whole disk behind it, so capacity can be shown next to
+/// the disk's I/O counters.
+///
+/// Capacity (statvfs) is refreshed at most once per capacity interval and whenever the
+/// mount table changes. Not thread-safe; LinuxDiskProbe owns one instance.
+class MountTable
+{
+  public:
+    static constexpr std::chrono::milliseconds DEFAULT_CAPACITY_INTERVAL{10000};
+
+    explicit MountTable(std::string mountInfoPath = "/proc/self/mountinfo",
+                        std::string sysDevBlockRoot = "/sys/dev/block",
+                        std::chrono::milliseconds capacityInterval = DEFAULT_CAPACITY_INTERVAL);
+
+    /// Whether the mount table could be opened.
+    [[nodiscard]] bool isAvailable() const noexcept
+    {
+        return m_MountInfo.isOpen();
+    }
+
+    /// Refresh what is due and copy the current mounts into @p out.
+    void read(std::vector<MountCounters>& out);
+
+    /// Number of times the mount table has been parsed (for tests and diagnostics).
+    [[nodiscard]] std::uint64_t parseCount() const noexcept
+    {
+        return m_ParseCount;
+    }
+
+  private:
+    [[nodiscard]] bool tableChanged() const;
+    void parseTable();
+    void refreshCapacity();
+    void resolveDevice(std::uint32_t major, std::uint32_t minor, MountCounters& mount) const;
+
+    ProcFile m_MountInfo;
+    std::string m_SysDevBlockRoot;
+    std::chrono::milliseconds m_CapacityInterval;
+    std::chrono::steady_clock::time_point m_LastCapacityRefresh;
+    std::vector<MountCounters> m_Mounts;
+    std::uint64_t m_ParseCount = 0;
+    std::uint64_t m_CapacitySequence = 0;
+    bool m_CapacityDue = true;
+};
+
+} // namespace Platform
@@ -5,9 +5,14 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -73,6 +78,27 @@ enum nvmlPcieUtilCounter_t : unsigned int
     NVML_PCIE_UTIL_RX_BYTES = 1,
     NVML_PCIE_UTIL_COUNT = 2
 };
+
+enum nvmlSamplingType_t : unsigned int
+{
+    NVML_TOTAL_POWER_SAMPLES = 0,
+    NVML_GPU_UTILIZATION_SAMPLES = 1,
+    NVML_MEMORY_UTILIZATION_SAMPLES = 2,
+    NVML_ENC_UTILIZATION_SAMPLES = 3,
+    NVML_DEC_UTILIZATION_SAMPLES = 4,
+    NVML_PROCESSOR_CLK_SAMPLES = 5,
+    NVML_MEMORY_CLK_SAMPLES = 6
+};
+
+enum nvmlValueType_t : unsigned int
+{
+    NVML_VALUE_TYPE_DOUBLE = 0,
+    NVML_VALUE_TYPE_UNSIGNED_INT = 1,
+    NVML_VALUE_TYPE_UNSIGNED_LONG = 2,
+    NVML_VALUE_TYPE_UNSIGNED_LONG_LONG = 3,
+    NVML_VALUE_TYPE_SIGNED_LONG_LONG = 4,
+    NVML_VALUE_TYPE_SIGNED_INT = 5
+};
 // NOLINTEND(performance-enum-size,cppcoreguidelines-use-enum-class,readability-identifier-naming)
 
 // NVML buffer size constants
@@ -100,8 +126,67 @@ struct nvmlProcessInfo_t
     unsigned int gpuInstanceId;
     unsigned int computeInstanceId;
 };
+
+union nvmlValue_t
+{
+    double dVal;
+    int siVal;
+    unsigned int uiVal;
+    unsigned long ulVal;
+    unsigned long long ullVal;
+    signed long long sllVal;
+};
+
+struct nvmlSample_t
+{
+    unsigned long long timeStamp; // CPU timestamp in microseconds
+    nvmlValue_t sampleValue;
+};
+
+struct nvmlProcessUtilizationSample_t
+{
+    unsigned int pid;
+    unsigned long long timeStamp; // CPU timestamp in microseconds
+    unsigned int smUtil;
+    unsigned int memUtil;
+    unsigned int encUtil;
+    unsigned int decUtil;
+};
 // NOLINTEND(readability-identifier-naming)
 
+// NOLINTBEGIN(cppcoreguidelines-pro-type-union-access) - the value type tag selects the member
+[[nodiscard]] double sampleToDouble(nvmlValueType_t type, const nvmlValue_t& value)
+{
+    switch (type)
+    {
+    case NVML_VALUE_TYPE_DOUBLE:
+        return value.dVal;
+    case NVML_VALUE_TYPE_UNSIGNED_INT:
+        return static_cast<double>(value.uiVal);
+    case NVML_VALUE_TYPE_UNSIGNED_LONG:
+        return static_cast<double>(value.ulVal);
+    case NVML_VALUE_TYPE_UNSIGNED_LONG_LONG:
+        return static_cast<double>(value.ullVal);
+    case NVML_VALUE_TYPE_SIGNED_LONG_LONG:
+        return static_cast<double>(value.sllVal);
+    case NVML_VALUE_TYPE_SIGNED_INT:
+        return static_cast<double>(value.siVal);
+    }
+    return 0.0;
+}
+// NOLINTEND(cppcoreguidelines-pro-type-union-access)
+
+void addEngine(std::vector<std::string>& engines, std::string_view engine)
+{
+    if (std::ranges::find(engines, engine) == engines.end())
+    {
+        engines.emplace_back(engine);
+    }
+}
+
+// Processes may start between the size query and the read
+constexpr std::size_t PROCESS_BUFFER_SLACK = 8;
+
 } // anonymous namespace
 
 namespace Platform
@@ -109,10 +194,30 @@ namespace Platform
 
 struct NVMLGPUProbe::Impl
 {
+    /// Per-device state kept across calls; the buffers are reused so steady-state sampling does not allocate.
+    struct Device
+    {
+        nvmlDevice_t handle = nullptr;
+        std::string id; // UUID, or "nvidia-<index>" if NVML cannot report one
+
+        // Newest sample timestamps already consumed (NVML CPU timestamps, microseconds)
+        unsigned long long lastUtilizationTimestamp = 0;
+        unsigned long long lastProcessTimestamp = 0;
+
+        std::vector<nvmlSample_t> utilizationSamples;
+        std::vector<nvmlProcessUtilizationSample_t> processSamples;
+        std::vector<nvmlProcessInfo_t> processInfos;
+        std::vector<ProcessGPUCounters> processes; // From the last running-process listing
+    };
+
+    NVMLProbeOptions options;
     void* nvmlHandle = nullptr;
     bool initialized = false;
     std::uint32_t deviceCount = 0;
-    std::vector<nvmlDevice_t> devices;
+    std::vector<Device> devices;
+
+    bool hasProcessList = false;
+    std::chrono::steady_clock::time_point lastProcessList;
 
     // NVML function pointers
     nvmlReturn_t (*nvmlInit_v2)() = nullptr;
@@ -133,9 +238,27 @@ struct NVMLGPUProbe::Impl
     nvmlReturn_t (*nvmlDeviceGetGraphicsRunningProcesses)(nvmlDevice_t, unsigned int*, nvmlProcessInfo_t*) = nullptr;
     const char* (*nvmlErrorString)(nvmlReturn_t) = nullptr;
 
+    // Optional: sample-buffer APIs (null on drivers that lack them)
+    nvmlReturn_t (*nvmlDeviceGetSamples)(
+        nvmlDevice_t, nvmlSamplingType_t, unsigned long long, nvmlValueType_t*, unsigned int*, nvmlSample_t*) = nullptr;
+    nvmlReturn_t (*nvmlDeviceGetProcessUtilization)(nvmlDevice_t, nvmlProcessUtilizationSample_t*, unsigned int*, unsigned long long) =
+        nullptr;
+
     bool loadNVML();
     void unloadNVML();
     [[nodiscard]] std::string getNVMLError(nvmlReturn_t result) const;
+
+    /// Mean GPU utilization over the samples recorded since the last call; nullopt if none.
+    [[nodiscard]] std::optional<double> averageUtilization(Device& device) const;
+
+    /// Re-list the device's running compute and graphics processes into device.processes.
+    void listProcesses(Device& device) const;
+    void appendRunningProcesses(Device& device,
+                                nvmlReturn_t (*query)(nvmlDevice_t, unsigned int*, nvmlProcessInfo_t*),
+                                std::string_view engine) const;
+
+    /// Fold the per-process samples recorded since the last call into @p counters (the device's entries).
+    void applyProcessUtilization(Device& device, std::vector<ProcessGPUCounters>& counters, std::size_t first) const;
 };
 
 bool NVMLGPUProbe::Impl::loadNVML()
@@ -146,10 +269,10 @@ bool NVMLGPUProbe::Impl::loadNVML()
     }
 
     // Try to load libnvidia-ml.so (dynamic loading for graceful fallback)
-    nvmlHandle = dlopen("libnvidia-ml.so.1", RTLD_NOW);
+    nvmlHandle = dlopen(options.libraryPath.empty() ? "libnvidia-ml.so.1" : options.libraryPath.c_str(), RTLD_NOW);
     if (nvmlHandle == nullptr)
     {
-        nvmlHandle = dlopen("libnvidia-ml.so", RTLD_NOW);
+        nvmlHandle = options.libraryPath.empty() ? dlopen("libnvidia-ml.so", RTLD_NOW) : nullptr;
         if (nvmlHandle == nullptr)
         {
             // NOLINTNEXTLINE(concurrency-mt-unsafe) - dlerror() is called during single-threaded initialization
@@ -190,6 +313,14 @@ bool NVMLGPUProbe::Impl::loadNVML()
 
 #undef LOAD_NVML_FUNC
 
+    nvmlDeviceGetSamples = reinterpret_cast<decltype(nvmlDeviceGetSamples)>(dlsym(nvmlHandle, "nvmlDeviceGetSamples"));
+    nvmlDeviceGetProcessUtilization =
+        reinterpret_cast<decltype(nvmlDeviceGetProcessUtilization)>(dlsym(nvmlHandle, "nvmlDeviceGetProcessUtilization"));
+    if (nvmlDeviceGetSamples == nullptr || nvmlDeviceGetProcessUtilization == nullptr)
+    {
+        spdlog::info("NVMLGPUProbe: Sample buffer APIs unavailable, using point utilization reads");
+    }
+
     // Initialize NVML
     auto result = nvmlInit_v2();
     if (result != NVML_SUCCESS)
@@ -209,15 +340,27 @@ bool NVMLGPUProbe::Impl::loadNVML()
         return false;
     }
 
-    // Get device handles
+    // Get device handles; the UUID is fixed for the device's lifetime, so read it once
     devices.resize(deviceCount);
     for (std::uint32_t i = 0; i < deviceCount; ++i)
     {
-        result = nvmlDeviceGetHandleByIndex_v2(i, &devices[i]);
+        auto& device = devices[i];
+        result = nvmlDeviceGetHandleByIndex_v2(i, &device.handle);
         if (result != NVML_SUCCESS)
         {
             spdlog::warn("NVMLGPUProbe: Failed to get handle for GPU {} - {}", i, getNVMLError(result));
         }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays) - C API buffer
+        char uuid[NVML_DEVICE_UUID_BUFFER_SIZE]{};
+        if (nvmlDeviceGetUUID(device.handle, uuid, sizeof(uuid)) == NVML_SUCCESS)
+        {
+            device.id = uuid;
+        }
+        else
+        {
+            device.id = "nvidia-" + std::to_string(i);
+        }
     }
 
     initialized = true;
@@ -241,6 +384,7 @@ void NVMLGPUProbe::Impl::unloadNVML()
     initialized = false;
     deviceCount = 0;
     devices.clear();
+    hasProcessList = false;
 }
 
 std::string NVMLGPUProbe::Impl::getNVMLError(nvmlReturn_t result) const
@@ -256,9 +400,168 @@ std::string NVMLGPUProbe::Impl::getNVMLError(nvmlReturn_t result) const
     return "Unknown NVML error";
 }
 
+std::optional<double> NVMLGPUProbe::Impl::averageUtilization(Device& device) const
+{
+    if (nvmlDeviceGetSamples == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    nvmlValueType_t valueType{};
+    auto sampleCount = static_cast<unsigned int>(device.utilizationSamples.size());
+    if (sampleCount == 0)
+    {
+        // First call: NVML reports the size of its sample buffer when given none
+        if (nvmlDeviceGetSamples(device.handle, NVML_GPU_UTILIZATION_SAMPLES, 0, &valueType, &sampleCount, nullptr) != NVML_SUCCESS ||
+            sampleCount == 0)
+        {
+            return std::nullopt;
+        }
+        device.utilizationSamples.resize(sampleCount);
+    }
+
+    // NVML_ERROR_NOT_FOUND: no sample newer than the last one consumed
+    const auto result = nvmlDeviceGetSamples(device.handle,
+                                             NVML_GPU_UTILIZATION_SAMPLES,
+                                             device.lastUtilizationTimestamp,
+                                             &valueType,
+                                             &sampleCount,
+                                             device.utilizationSamples.data());
+    if (result != NVML_SUCCESS || sampleCount == 0)
+    {
+        return std::nullopt;
+    }
+
+    double sum = 0.0;
+    const auto samples = std::span(device.utilizationSamples).first(std::min<std::size_t>(sampleCount, device.utilizationSamples.size()));
+    for (const auto& sample : samples)
+    {
+        sum += sampleToDouble(valueType, sample.sampleValue);
+        device.lastUtilizationTimestamp = std::max(device.lastUtilizationTimestamp, sample.timeStamp);
+    }
+    return sum / static_cast<double>(samples.size());
+}
+
+void NVMLGPUProbe::Impl::listProcesses(Device& device) const
+{
+    device.processes.clear();
+    appendRunningProcesses(device, nvmlDeviceGetComputeRunningProcesses, "Compute");
+    appendRunningProcesses(device, nvmlDeviceGetGraphicsRunningProcesses, "3D");
+}
+
+void NVMLGPUProbe::Impl::appendRunningProcesses(Device& device,
+                                                 nvmlReturn_t (*query)(nvmlDevice_t, unsigned int*, nvmlProcessInfo_t*),
+                                                 std::string_view engine) const
+{
+    auto count = static_cast<unsigned int>(device.processInfos.size());
+    auto result = query(device.handle, &count, device.processInfos.empty() ? nullptr : device.processInfos.data());
+    if (result == NVML_ERROR_INSUFFICIENT_SIZE)
+    {
+        // count now holds the number of running processes; grow once and retry
+        device.processInfos.resize(count + PROCESS_BUFFER_SLACK);
+        count = static_cast<unsigned int>(device.processInfos.size());
+        result = query(device.handle, &count, device.processInfos.data());
+    }
+    if (result != NVML_SUCCESS)
+    {
+        return;
+    }
+
+    for (const auto& proc : std::span(device.processInfos).first(std::min<std::size_t>(count, device.processInfos.size())))
+    {
+        const auto pid = static_cast<std::int32_t>(proc.pid);
+        auto it = std::ranges::find(device.processes, pid, &ProcessGPUCounters::pid);
+        if (it == device.processes.end())
+        {
+            auto& counter = device.processes.emplace_back();
+            counter.pid = pid;
+            counter.gpuId = device.id;
+            it = device.processes.end() - 1;
+        }
+        // A process in both lists reports the same allocation twice
+        it->gpuMemoryBytes = std::max(it->gpuMemoryBytes, static_cast<std::uint64_t>(proc.usedGpuMemory));
+        addEngine(it->activeEngines, engine);
+    }
+}
+
+void NVMLGPUProbe::Impl::applyProcessUtilization(Device& device, std::vector<ProcessGPUCounters>& counters, std::size_t first) const
+{
+    if (nvmlDeviceGetProcessUtilization == nullptr)
+    {
+        return;
+    }
+
+    auto count = static_cast<unsigned int>(device.processSamples.size());
+    auto result = nvmlDeviceGetProcessUtilization(
+        device.handle, device.processSamples.empty() ? nullptr : device.processSamples.data(), &count, device.lastProcessTimestamp);
+    if (result == NVML_ERROR_INSUFFICIENT_SIZE)
+    {
+        device.processSamples.resize(count + PROCESS_BUFFER_SLACK);
+        count = static_cast<unsigned int>(device.processSamples.size());
+        result = nvmlDeviceGetProcessUtilization(device.handle, device.processSamples.data(), &count, device.lastProcessTimestamp);
+    }
+    // NVML_ERROR_NOT_FOUND: no process ran on the GPU since the last call, so every process is idle
+    if (result != NVML_SUCCESS)
+    {
+        return;
+    }
+
+    // Several samples per PID when the interval spans several NVML sampling periods: average them
+    auto samples = std::span(device.processSamples).first(std::min<std::size_t>(count, device.processSamples.size()));
+    std::ranges::sort(samples, {}, &nvmlProcessUtilizationSample_t::pid);
+    for (auto group = samples.begin(); group != samples.end();)
+    {
+        const auto groupEnd =
+            std::ranges::find_if(group, samples.end(), [pid = group->pid](const auto& sample) { return sample.pid != pid; });
+        const auto groupSize = static_cast<double>(groupEnd - group);
+
+        double sm = 0.0;
+        double enc = 0.0;
+        double dec = 0.0;
+        for (auto sample = group; sample != groupEnd; ++sample)
+        {
+            sm += sample->smUtil;
+            enc += sample->encUtil;
+            dec += sample->decUtil;
+            device.lastProcessTimestamp = std::max(device.lastProcessTimestamp, sample->timeStamp);
+        }
+
+        const auto pid = static_cast<std::int32_t>(group->pid);
+        const auto deviceCounters = std::span(counters).subspan(first);
+        auto it = std::ranges::find(deviceCounters, pid, &ProcessGPUCounters::pid);
+        ProcessGPUCounters* counter = nullptr;
+        if (it != deviceCounters.end())
+        {
+            counter = &*it;
+        }
+        else
+        {
+            // Started after the last process listing; memory follows with the next listing
+            counter = &counters.emplace_back();
+            counter->pid = pid;
+            counter->gpuId = device.id;
+        }
+
+        counter->gpuUtilPercent = sm / groupSize;
+        counter->encoderUtilPercent = enc / groupSize;
+        counter->decoderUtilPercent = dec / groupSize;
+        if (counter->encoderUtilPercent > 0.0)
+        {
+            addEngine(counter->activeEngines, "Video Encode");
+        }
+        if (counter->decoderUtilPercent > 0.0)
+        {
+            addEngine(counter->activeEngines, "Video Decode");
+        }
+
+        group = groupEnd;
+    }
+}
+
 // Constructor
-NVMLGPUProbe::NVMLGPUProbe() : m_Impl(std::make_unique<Impl>())
+NVMLGPUProbe::NVMLGPUProbe(NVMLProbeOptions options) : m_Impl(std::make_unique<Impl>())
 {
+    m_Impl->options = std::move(options);
     m_Impl->loadNVML();
 }
 
@@ -288,7 +591,7 @@ std::vector<GPUInfo> NVMLGPUProbe::enumerateGPUs()
 
     for (std::uint32_t i = 0; i < m_Impl->deviceCount; ++i)
     {
-        nvmlDevice_t device = m_Impl->devices[i];
+        nvmlDevice_t device = m_Impl->devices[i].handle;
 
         GPUInfo info;
         info.deviceIndex = i;
@@ -304,19 +607,7 @@ std::vector<GPUInfo> NVMLGPUProbe::enumerateGPUs()
             info.name = name;
         }
 
-        // Get UUID as ID
-        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays) - C API buffer
-        char uuid[NVML_DEVICE_UUID_BUFFER_SIZE]{};
-        result = m_Impl->nvmlDeviceGetUUID(device, uuid, sizeof(uuid));
-        if (result == NVML_SUCCESS)
-        {
-            info.id = uuid;
-        }
-        else
-        {
-            // Fallback to index-based ID
-            info.id = "nvidia-" + std::to_string(i);
-        }
+        info.id = m_Impl->devices[i].id;
 
         gpus.push_back(std::move(info));
     }
@@ -334,27 +625,15 @@ std::vector<GPUCounters> NVMLGPUProbe::readGPUCounters()
     std::vector<GPUCounters> counters;
     counters.reserve(m_Impl->deviceCount);
 
-    for (std::uint32_t i = 0; i < m_Impl->deviceCount; ++i)
+    for (auto& state : m_Impl->devices)
     {
-        nvmlDevice_t device = m_Impl->devices[i];
+        nvmlDevice_t device = state.handle;
         GPUCounters counter;
-
-        // Get UUID as GPU ID
-        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays) - C API buffer
-        char uuid[NVML_DEVICE_UUID_BUFFER_SIZE]{};
-        auto result = m_Impl->nvmlDeviceGetUUID(device, uuid, sizeof(uuid));
-        if (result == NVML_SUCCESS)
-        {
-            counter.gpuId = uuid;
-        }
-        else
-        {
-            counter.gpuId = "nvidia-" + std::to_string(i);
-        }
+        counter.gpuId = state.id;
 
         // Memory info
         nvmlMemory_t memInfo{};
-        result = m_Impl->nvmlDeviceGetMemoryInfo(device, &memInfo);
+        auto result = m_Impl->nvmlDeviceGetMemoryInfo(device, &memInfo);
         if (result == NVML_SUCCESS)
         {
             counter.memoryUsedBytes = memInfo.used;
@@ -362,12 +641,19 @@ std::vector<GPUCounters> NVMLGPUProbe::readGPUCounters()
             // Note: memoryUtilPercent is computed in Domain layer from raw bytes
         }
 
-        // Utilization
-        nvmlUtilization_t util{};
-        result = m_Impl->nvmlDeviceGetUtilizationRates(device, &util);
-        if (result == NVML_SUCCESS)
+        // Utilization: mean of the samples since the last read, else the driver's point value
+        if (const auto average = m_Impl->averageUtilization(state))
         {
-            counter.utilizationPercent = static_cast<double>(util.gpu);
+            counter.utilizationPercent = *average;
+        }
+        else
+        {
+            nvmlUtilization_t util{};
+            result = m_Impl->nvmlDeviceGetUtilizationRates(device, &util);
+            if (result == NVML_SUCCESS)
+            {
+                counter.utilizationPercent = static_cast<double>(util.gpu);
+            }
         }
 
         // Temperature
@@ -444,81 +730,25 @@ std::vector<ProcessGPUCounters> NVMLGPUProbe::readProcessGPUCounters()
         return {};
     }
 
-    std::vector<ProcessGPUCounters> allCounters;
-
-    for (std::uint32_t i = 0; i < m_Impl->deviceCount; ++i)
+    const auto now = std::chrono::steady_clock::now();
+    const bool listDue = !m_Impl->hasProcessList || now - m_Impl->lastProcessList >= m_Impl->options.processListInterval;
+    if (listDue)
     {
-        nvmlDevice_t device = m_Impl->devices[i];
-
-        // Get UUID as GPU ID
-        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays) - C API buffer
-        char uuid[NVML_DEVICE_UUID_BUFFER_SIZE]{};
-        std::string gpuId;
-        auto result = m_Impl->nvmlDeviceGetUUID(device, uuid, sizeof(uuid));
-        if (result == NVML_SUCCESS)
-        {
-            gpuId = uuid;
-        }
-        else
-        {
-            gpuId = "nvidia-" + std::to_string(i);
-        }
+        m_Impl->hasProcessList = true;
+        m_Impl->lastProcessList = now;
+    }
 
-        // Query compute processes
-        unsigned int computeCount = 0;
-        result = m_Impl->nvmlDeviceGetComputeRunningProcesses(device, &computeCount, nullptr);
-        if (result == NVML_SUCCESS && computeCount > 0)
+    std::vector<ProcessGPUCounters> allCounters;
+    for (auto& device : m_Impl->devices)
+    {
+        if (listDue)
         {
-            std::vector<nvmlProcessInfo_t> computeProcesses(computeCount);
-            result = m_Impl->nvmlDeviceGetComputeRunningProcesses(device, &computeCount, computeProcesses.data());
-            if (result == NVML_SUCCESS)
-            {
-                for (const auto& proc : computeProcesses)
-                {
-                    ProcessGPUCounters counter;
-                    counter.pid = static_cast<std::int32_t>(proc.pid);
-                    counter.gpuId = gpuId;
-                    counter.gpuMemoryBytes = proc.usedGpuMemory;
-                    counter.activeEngines.emplace_back("Compute");
-                    allCounters.push_back(std::move(counter));
-                }
-            }
+            m_Impl->listProcesses(device);
         }
 
-        // Query graphics processes
-        unsigned int graphicsCount = 0;
-        result = m_Impl->nvmlDeviceGetGraphicsRunningProcesses(device, &graphicsCount, nullptr);
-        if (result == NVML_SUCCESS && graphicsCount > 0)
-        {
-            std::vector<nvmlProcessInfo_t> graphicsProcesses(graphicsCount);
-            result = m_Impl->nvmlDeviceGetGraphicsRunningProcesses(device, &graphicsCount, graphicsProcesses.data());
-            if (result == NVML_SUCCESS)
-            {
-                for (const auto& proc : graphicsProcesses)
-                {
-                    // Check if we already have this process from compute list
-                    auto it = std::ranges::find_if(allCounters,
-                                                   [&proc, &gpuId](const ProcessGPUCounters& c)
-                                                   { return std::cmp_equal(c.pid, proc.pid) && c.gpuId == gpuId; });
-
-                    if (it != allCounters.end())
-                    {
-                        // Merge: add graphics engine
-                        it->activeEngines.emplace_back("3D");
-                        it->gpuMemoryBytes = std::max(it->gpuMemoryBytes, static_cast<std::uint64_t>(proc.usedGpuMemory));
-                    }
-                    else
-                    {
-                        ProcessGPUCounters counter;
-                        counter.pid = static_cast<std::int32_t>(proc.pid);
-                        counter.gpuId = gpuId;
-                        counter.gpuMemoryBytes = proc.usedGpuMemory;
-                        counter.activeEngines.emplace_back("3D");
-                        allCounters.push_back(std::move(counter));
-                    }
-                }
-            }
-        }
+        const std::size_t first = allCounters.size();
+        allCounters.insert(allCounters.end(), device.processes.begin(), device.processes.end());
+        m_Impl->applyProcessUtilization(device, allCounters, first);
     }
 
     return allCounters;
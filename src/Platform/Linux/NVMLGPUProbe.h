@@ -3,6 +3,7 @@
 #include "Platform/GPUTypes.h"
 #include "Platform/IGPUProbe.h"
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -10,13 +11,29 @@
 namespace Platform
 {
 
+/// Where NVMLGPUProbe loads NVML from and how often it lists running processes.
+struct NVMLProbeOptions
+{
+    std::string libraryPath; // Empty: libnvidia-ml.so.1, then libnvidia-ml.so
+
+    /// Running-process lists (PIDs, memory) change slowly and cost a driver round trip per
+    /// device, so they are refreshed at this cadence; utilization samples are read every call.
+    std::chrono::milliseconds processListInterval{2000};
+};
+
 /// NVML-based GPU probe for NVIDIA GPUs on Linux.
 /// Uses NVIDIA Management Library (NVML) for comprehensive GPU metrics.
 /// Supports dynamic loading of libnvidia-ml.so for graceful degradation.
+///
+/// GPU and per-process utilization come from NVML's sample buffers
+/// (nvmlDeviceGetSamples, nvmlDeviceGetProcessUtilization): each call passes the newest
+/// timestamp seen per device and averages only the samples recorded since, which covers
+/// the whole interval instead of one point read. Drivers without these entry points fall
+/// back to nvmlDeviceGetUtilizationRates and report no per-process utilization.
 class NVMLGPUProbe final : public IGPUProbe
 {
   public:
-    NVMLGPUProbe();
+    explicit NVMLGPUProbe(NVMLProbeOptions options = {});
     ~NVMLGPUProbe() override;
 
     // Rule of 5: Delete copy/move operations
@@ -0,0 +1,271 @@
+// Only compile on Linux with required headers
+#if defined(__linux__) && __has_include(<linux/rtnetlink.h>) && __has_include(<linux/if_link.h>)
+
+#include "NetlinkLinkStats.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN(misc-include-cleaner) - POSIX/Linux headers: include-cleaner lacks mappings for ssize_t, IFF_*, IF_OPER_*
+#include <linux/if.h>
+#include <linux/if_link.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+#include <unistd.h>
+// NOLINTEND(misc-include-cleaner)
+
+namespace Platform
+{
+
+namespace
+{
+
+// Dump replies are batched by the kernel into chunks of up to ~32KB; 64KB leaves headroom
+constexpr std::size_t NETLINK_BUFFER_SIZE = 65536;
+
+struct GetLinkRequest
+{
+    nlmsghdr nlh;
+    ifinfomsg ifm;
+};
+
+static_assert(sizeof(GetLinkRequest) == NLMSG_LENGTH(sizeof(ifinfomsg)), "GetLinkRequest must match the netlink wire layout");
+
+[[nodiscard]] std::string errnoMessage(int errnum)
+{
+    return std::system_category().message(errnum);
+}
+
+/// Copy an attribute payload into a zeroed struct. IFLA_STATS64 is only 4-byte aligned
+/// and newer kernels append fields, so neither a cast nor an exact size check is safe.
+template<typename T> void copyAttribute(const rtattr* rta, T& out)
+{
+    out = T{};
+    std::memcpy(&out, RTA_DATA(rta), std::min<std::size_t>(RTA_PAYLOAD(rta), sizeof(T)));
+}
+
+} // namespace
+
+NetlinkLinkStats::NetlinkLinkStats() : m_Buffer(NETLINK_BUFFER_SIZE / sizeof(std::uint32_t))
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer) - conditional initialization
+    m_Socket = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (m_Socket < 0)
+    {
+        spdlog::debug("Failed to create NETLINK_ROUTE socket: {}", errnoMessage(errno));
+        return;
+    }
+
+    sockaddr_nl addr{};
+    addr.nl_family = AF_NETLINK;
+    addr.nl_pid = 0;    // Let kernel assign PID
+    addr.nl_groups = 0; // No multicast groups
+
+    if (bind(m_Socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0)
+    {
+        spdlog::debug("Failed to bind NETLINK_ROUTE socket: {}", errnoMessage(errno));
+        const int oldSocket = m_Socket;
+        m_Socket = -1;
+        close(oldSocket);
+        return;
+    }
+
+    m_Available = true;
+}
+
+NetlinkLinkStats::~NetlinkLinkStats() noexcept
+{
+    if (m_Socket >= 0)
+    {
+        const int oldSocket = m_Socket;
+        m_Socket = -1;
+        close(oldSocket);
+    }
+}
+
+bool NetlinkLinkStats::query(std::vector<LinkStats>& out)
+{
+    out.clear();
+    if (!m_Available || m_Socket < 0)
+    {
+        return false;
+    }
+
+    GetLinkRequest req{};
+    req.nlh.nlmsg_len = sizeof(req);
+    req.nlh.nlmsg_type = RTM_GETLINK;
+    req.nlh.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    req.nlh.nlmsg_seq = ++m_Sequence;
+    req.ifm.ifi_family = AF_UNSPEC;
+
+    if (send(m_Socket, &req, sizeof(req), 0) < 0)
+    {
+        spdlog::debug("Failed to send RTM_GETLINK request: {}", errnoMessage(errno));
+        return false;
+    }
+
+    auto* buffer = reinterpret_cast<char*>(m_Buffer.data());
+    const std::size_t bufferSize = m_Buffer.size() * sizeof(std::uint32_t);
+
+    while (true)
+    {
+        // NOLINTNEXTLINE(misc-include-cleaner) - ssize_t POSIX false positive
+        const ssize_t len = recv(m_Socket, buffer, bufferSize, 0);
+        if (len < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            spdlog::debug("Failed to receive RTM_GETLINK response: {}", errnoMessage(errno));
+            return false;
+        }
+        if (len == 0)
+        {
+            return false;
+        }
+
+        // Suppress alignment warning - buffer is uint32_t-backed and kernel
+        // netlink protocol guarantees proper alignment of messages
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wcast-align"
+        auto remainingLen = static_cast<std::size_t>(len);
+        for (auto* nlh = reinterpret_cast<nlmsghdr*>(buffer); NLMSG_OK(nlh, remainingLen); nlh = NLMSG_NEXT(nlh, remainingLen))
+        {
+            // Leftovers from an earlier dump that was abandoned part-way
+            if (nlh->nlmsg_seq != m_Sequence)
+            {
+                continue;
+            }
+
+            if (nlh->nlmsg_type == NLMSG_DONE)
+            {
+                if ((nlh->nlmsg_flags & NLM_F_DUMP_INTR) != 0)
+                {
+                    // Link table changed mid-dump; counters are still valid, the set may be one tick stale
+                    spdlog::debug("RTM_GETLINK dump interrupted by a concurrent link change");
+                }
+                return true;
+            }
+
+            if (nlh->nlmsg_type == NLMSG_ERROR)
+            {
+                const auto* err = static_cast<const nlmsgerr*>(NLMSG_DATA(nlh));
+                spdlog::debug("RTM_GETLINK dump failed: {}", errnoMessage(-err->error));
+                return false;
+            }
+
+            if (nlh->nlmsg_type == RTM_NEWLINK)
+            {
+                LinkStats link;
+                if (parseLinkMessage(NLMSG_DATA(nlh), NLMSG_PAYLOAD(nlh, 0), link))
+                {
+                    out.push_back(std::move(link));
+                }
+            }
+        }
+#pragma clang diagnostic pop
+    }
+}
+
+bool NetlinkLinkStats::parseLinkMessage(const void* payload, std::size_t len, LinkStats& out)
+{
+    if (len < NLMSG_ALIGN(sizeof(ifinfomsg)))
+    {
+        return false;
+    }
+
+    const auto* ifm = static_cast<const ifinfomsg*>(payload);
+    out = LinkStats{};
+    out.ifIndex = static_cast<std::uint32_t>(ifm->ifi_index);
+    out.isLoopback = (ifm->ifi_flags & IFF_LOOPBACK) != 0;
+
+    bool hasStats64 = false;
+    std::size_t attrLen = len - NLMSG_ALIGN(sizeof(ifinfomsg));
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wcast-align"
+    const auto* attrStart = reinterpret_cast<const char*>(ifm) + NLMSG_ALIGN(sizeof(ifinfomsg));
+    for (const auto* rta = reinterpret_cast<const rtattr*>(attrStart); RTA_OK(rta, attrLen); rta = RTA_NEXT(rta, attrLen))
+    {
+        switch (rta->rta_type)
+        {
+        case IFLA_IFNAME:
+        {
+            // NUL-terminated, but don't trust the terminator to be inside the payload
+            const auto* name = static_cast<const char*>(RTA_DATA(rta));
+            out.name.assign(name, strnlen(name, RTA_PAYLOAD(rta)));
+            break;
+        }
+        case IFLA_LINKINFO:
+        {
+            // Nested: IFLA_INFO_KIND names the rtnl_link_ops driver; physical NICs carry no IFLA_LINKINFO
+            std::size_t infoLen = RTA_PAYLOAD(rta);
+            for (const auto* info = static_cast<const rtattr*>(RTA_DATA(rta)); RTA_OK(info, infoLen); info = RTA_NEXT(info, infoLen))
+            {
+                if (info->rta_type == IFLA_INFO_KIND)
+                {
+                    const auto* kind = static_cast<const char*>(RTA_DATA(info));
+                    out.kind.assign(kind, strnlen(kind, RTA_PAYLOAD(info)));
+                    break;
+                }
+            }
+            break;
+        }
+        case IFLA_MTU:
+            copyAttribute(rta, out.mtu);
+            break;
+        case IFLA_OPERSTATE:
+        {
+            std::uint8_t operState = IF_OPER_UNKNOWN;
+            copyAttribute(rta, operState);
+            out.isUp = (operState == IF_OPER_UP);
+            break;
+        }
+        case IFLA_STATS64:
+        {
+            rtnl_link_stats64 stats{};
+            copyAttribute(rta, stats);
+            out.rxBytes = stats.rx_bytes;
+            out.txBytes = stats.tx_bytes;
+            out.rxPackets = stats.rx_packets;
+            out.txPackets = stats.tx_packets;
+            hasStats64 = true;
+            break;
+        }
+        case IFLA_STATS:
+            // 32-bit counters wrap quickly; only used if the kernel omits IFLA_STATS64
+            if (!hasStats64)
+            {
+                rtnl_link_stats stats{};
+                copyAttribute(rta, stats);
+                out.rxBytes = stats.rx_bytes;
+                out.txBytes = stats.tx_bytes;
+                out.rxPackets = stats.rx_packets;
+                out.txPackets = stats.tx_packets;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+#pragma clang diagnostic pop
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    return !out.name.empty();
+}
+
+} // namespace Platform
+
+#endif // __linux__ && headers available
@@ -3,16 +3,16 @@
 
 #include "NetlinkSocketStats.h"
 
+#include "SharedFdTable.h"
+
 #include <spdlog/spdlog.h>
 
 #include <array>
 #include <cerrno>
-#include <charconv>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <filesystem>
 #include <format>
 #include <limits>
 #include <mutex>
@@ -25,7 +25,6 @@
 #include <vector>
 
 // NOLINTBEGIN(misc-include-cleaner) - POSIX/Linux headers: include-cleaner lacks mappings for ssize_t, strerror_r, IPPROTO_*
-#include <dirent.h>
 #include <linux/inet_diag.h>
 #include <linux/netlink.h>
 #include <linux/rtnetlink.h>
@@ -402,88 +401,9 @@ void NetlinkSocketStats::parseSocketMessage(const void* msg, std::size_t len, st
     parseSocketMessageImpl(msg, len, results);
 }
 
-std::unordered_map<std::uint64_t, std::int32_t> buildInodeToPidMap()
+std::unordered_map<std::uint64_t, std::int32_t> buildInodeToPidMap(const std::string& procRoot)
 {
-    std::unordered_map<std::uint64_t, std::int32_t> inodeToPid;
-    inodeToPid.reserve(1024); // Pre-allocate for typical system
-
-    const std::filesystem::path procPath("/proc");
-    std::error_code errorCode;
-
-    for (const auto& procEntry : std::filesystem::directory_iterator(procPath, errorCode))
-    {
-        if (!procEntry.is_directory())
-        {
-            continue;
-        }
-
-        // Check if directory name is a PID (numeric)
-        const std::string& pidStr = procEntry.path().filename().string();
-        std::int32_t pid = 0;
-        auto result = std::from_chars(pidStr.data(), (pidStr.data() + pidStr.size()), pid);
-        if (result.ec != std::errc{} || pid <= 0)
-        {
-            continue;
-        }
-
-        // Scan /proc/[pid]/fd/ for socket symlinks
-        const std::filesystem::path fdPath = procEntry.path() / "fd";
-
-        // Use opendir/readdir for efficiency (avoid exception overhead)
-        DIR* fdDir = opendir(fdPath.c_str());
-        if (fdDir == nullptr)
-        {
-            continue; // Permission denied or process exited
-        }
-
-        std::array<char, 256> linkTarget{};
-
-        // NOLINTNEXTLINE(concurrency-mt-unsafe) - readdir is safe here: single DIR* per thread
-        while (const struct dirent* entry = readdir(fdDir))
-        {
-            // Skip . and ..
-            if (entry->d_name[0] == '.')
-            {
-                continue;
-            }
-
-            // Read the symlink target
-            // Use std::filesystem::path operator/ for efficient path construction
-            const std::filesystem::path fdFilePath = fdPath / entry->d_name;
-            const ssize_t linkLen = readlink(fdFilePath.c_str(), linkTarget.data(), linkTarget.size() - 1);
-            if (linkLen <= 0)
-            {
-                continue;
-            }
-            linkTarget[static_cast<std::size_t>(linkLen)] = '\0';
-
-            // Check if it's a socket: "socket:[inode]"
-            const std::string_view target(linkTarget.data(), static_cast<std::size_t>(linkLen));
-            if (!target.starts_with("socket:["))
-            {
-                continue;
-            }
-
-            // Extract inode number
-            const std::size_t start = 8; // Length of "socket:["
-            const std::size_t end = target.find(']', start);
-            if (end == std::string_view::npos)
-            {
-                continue;
-            }
-
-            std::uint64_t inode = 0;
-            auto parseResult = std::from_chars((target.data() + start), (target.data() + end), inode);
-            if (parseResult.ec == std::errc{} && inode != 0)
-            {
-                inodeToPid[inode] = pid;
-            }
-        }
-
-        closedir(fdDir);
-    }
-
-    return inodeToPid;
+    return walkFdTable(procRoot).socketOwners;
 }
 
 std::unordered_map<std::int32_t, std::pair<std::uint64_t, std::uint64_t>>
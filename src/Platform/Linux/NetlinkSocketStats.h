@@ -6,6 +6,7 @@
 #include <chrono>
 #include <cstdint>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -93,9 +94,10 @@ class NetlinkSocketStats
     static void parseSocketMessage(const void* msg, std::size_t len, std::vector<SocketStats>& results);
 };
 
-/// Build a mapping from socket inode to owning PID by scanning /proc/[pid]/fd/*
+/// Build a mapping from socket inode to owning PID by scanning <procRoot>/[pid]/fd/*
+/// (a one-off walkFdTable(); LinuxProcessProbe takes it from the shared walk instead).
 /// Returns map: inode -> PID
-[[nodiscard]] std::unordered_map<std::uint64_t, std::int32_t> buildInodeToPidMap();
+[[nodiscard]] std::unordered_map<std::uint64_t, std::int32_t> buildInodeToPidMap(const std::string& procRoot = "/proc");
 
 /// Aggregate socket stats by PID using the inode-to-PID mapping.
 /// Returns map: PID -> (totalBytesReceived, totalBytesSent)
@@ -0,0 +1,98 @@
+// Keep this translation unit parseable on non-Linux platforms (e.g. Windows clangd)
+// by compiling the implementation only when targeting Linux and required headers exist.
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "NumaNodeReader.h"
+
+#include "NumaParse.h"
+#include "ProcParse.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Platform
+{
+
+NumaNodeReader::NumaNodeReader(std::string nodeRoot) : m_NodeRoot(std::move(nodeRoot)), m_OnlineFile(m_NodeRoot + "/online")
+{
+}
+
+void NumaNodeReader::open(Entry& entry, std::uint32_t nodeId) const
+{
+    const std::string dir = m_NodeRoot + "/node" + std::to_string(nodeId) + "/";
+    entry.memInfo = ProcFile(dir + "meminfo");
+    entry.numaStat = ProcFile(dir + "numastat");
+    entry.cpuList = ProcFile(dir + "cpulist");
+    entry.attempted = true;
+}
+
+void NumaNodeReader::read(std::vector<NumaNodeCounters>& out)
+{
+    out.clear();
+    if (!m_OnlineFile.isOpen() || !ProcParse::parseIdList(m_OnlineFile.read(), m_OnlineMask))
+    {
+        return;
+    }
+
+    ++m_Generation;
+    if (m_Entries.size() < m_OnlineMask.size())
+    {
+        m_Entries.resize(m_OnlineMask.size());
+    }
+
+    for (std::size_t id = 0; id < m_OnlineMask.size(); ++id)
+    {
+        if (m_OnlineMask[id] == 0)
+        {
+            continue;
+        }
+
+        const auto nodeId = static_cast<std::uint32_t>(id);
+        Entry& entry = m_Entries[id];
+
+        // Offline since the last tick: the node directory was recreated, the old descriptors are stale
+        if (entry.lastSeen + 1 != m_Generation)
+        {
+            entry.attempted = false;
+        }
+        entry.lastSeen = m_Generation;
+
+        if (!entry.attempted)
+        {
+            open(entry, nodeId);
+        }
+
+        NumaNodeCounters node;
+        node.nodeId = nodeId;
+        if (!entry.memInfo.isOpen() || !parseNodeMemInfo(entry.memInfo.read(), node))
+        {
+            entry.attempted = false; // Retry the open next tick
+            continue;
+        }
+        if (entry.numaStat.isOpen())
+        {
+            (void) parseNumaStat(entry.numaStat.read(), node);
+        }
+
+        // Memory-only nodes (CXL, HBM) have an empty cpulist
+        if (entry.cpuList.isOpen() && ProcParse::parseIdList(entry.cpuList.read(), m_CpuMask))
+        {
+            for (std::size_t cpu = 0; cpu < m_CpuMask.size(); ++cpu)
+            {
+                if (m_CpuMask[cpu] != 0)
+                {
+                    node.cpuIds.push_back(static_cast<std::uint32_t>(cpu));
+                }
+            }
+        }
+
+        out.push_back(std::move(node));
+    }
+}
+
+} // namespace Platform
+
+#endif
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Platform/SystemTypes.h"
+#include "ProcFile.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Platform
+{
+
+/// Per-NUMA-node reader for Linux sysfs.
+///
+/// Reads <nodeRoot>/online every tick and, for each online node, nodeN/meminfo,
+/// nodeN/numastat and nodeN/cpulist through persistent descriptors re-read with
+/// pread(), so a many-node host costs three syscalls per node per tick.
+///
+/// Descriptors are opened the first time a node is seen and reopened after the node
+/// has been offline (memory hot-remove deletes the node directory).
+/// Not thread-safe; LinuxSystemProbe serializes access with its file mutex.
+class NumaNodeReader
+{
+  public:
+    explicit NumaNodeReader(std::string nodeRoot = "/sys/devices/system/node");
+
+    /// Whether the kernel exposes NUMA topology (CONFIG_NUMA). Single-node hosts
+    /// still report one node.
+    [[nodiscard]] bool isAvailable() const noexcept
+    {
+        return m_OnlineFile.isOpen();
+    }
+
+    /// Fill @p out with one entry per online node, in ascending id order.
+    /// Leaves @p out empty if the node list cannot be read.
+    void read(std::vector<NumaNodeCounters>& out);
+
+  private:
+    struct Entry
+    {
+        ProcFile memInfo;
+        ProcFile numaStat;
+        ProcFile cpuList;
+        bool attempted = false;     // Open was tried (success or not)
+        std::uint64_t lastSeen = 0; // read() generation that last listed this node
+    };
+
+    void open(Entry& entry, std::uint32_t nodeId) const;
+
+    std::string m_NodeRoot;
+    ProcFile m_OnlineFile;
+    std::vector<std::uint8_t> m_OnlineMask; // Indexed by node id
+    std::vector<std::uint8_t> m_CpuMask;    // Scratch for cpulist parsing
+    std::vector<Entry> m_Entries;           // Indexed by node id
+    std::uint64_t m_Generation = 0;
+};
+
+} // namespace Platform
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "Platform/SystemTypes.h"
+#include "ProcParse.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Platform
+{
+
+namespace NumaParseDetail
+{
+
+// Slots of the scratch array used by parseNumaStat
+enum NumaStatSlot : std::uint8_t
+{
+    NUMA_STAT_HIT = 0,
+    NUMA_STAT_MISS,
+    NUMA_STAT_FOREIGN,
+    NUMA_STAT_LOCAL,
+    NUMA_STAT_OTHER,
+    NUMA_STAT_SLOT_COUNT,
+};
+
+inline constexpr std::array<ProcParse::KeySlot, NUMA_STAT_SLOT_COUNT> NUMA_STAT_KEYS = {{
+    {.key = "numa_hit", .slot = NUMA_STAT_HIT},
+    {.key = "numa_miss", .slot = NUMA_STAT_MISS},
+    {.key = "numa_foreign", .slot = NUMA_STAT_FOREIGN},
+    {.key = "local_node", .slot = NUMA_STAT_LOCAL},
+    {.key = "other_node", .slot = NUMA_STAT_OTHER},
+}};
+
+// Ids above this in numa_maps are treated as garbage (MAX_NUMNODES is 1024 on x86-64)
+inline constexpr std::uint32_t MAX_NODE_ID = 1023;
+
+} // namespace NumaParseDetail
+
+/// Extract MemTotal, MemFree and FilePages from a node's meminfo.
+///
+/// Format (/sys/devices/system/node/nodeN/meminfo):
+///   Node 0 MemTotal:       16314328 kB
+///   Node 0 MemFree:         9276812 kB
+///   Node 0 MemUsed:         7037516 kB
+///   ...
+///   Node 0 FilePages:       4431768 kB
+/// Returns false if MemTotal was not found.
+[[nodiscard]] inline bool parseNodeMemInfo(std::string_view text, NumaNodeCounters& out) noexcept
+{
+    constexpr std::uint64_t KB = 1024;
+    constexpr std::size_t WANTED_FIELDS = 3;
+
+    bool foundTotal = false;
+    std::size_t found = 0;
+    std::string_view line;
+    while (found < WANTED_FIELDS && ProcParse::nextLine(text, line))
+    {
+        // Skip the "Node N" prefix
+        (void) ProcParse::nextToken(line);
+        (void) ProcParse::nextToken(line);
+        const std::string_view key = ProcParse::nextToken(line);
+
+        std::uint64_t* target = nullptr;
+        if (key == "MemTotal:")
+        {
+            target = &out.memTotalBytes;
+            foundTotal = true;
+        }
+        else if (key == "MemFree:")
+        {
+            target = &out.memFreeBytes;
+        }
+        else if (key == "FilePages:")
+        {
+            target = &out.filePagesBytes;
+        }
+        else
+        {
+            continue;
+        }
+
+        std::uint64_t valueKb = 0;
+        if (ProcParse::nextInteger(line, valueKb))
+        {
+            *target = valueKb * KB;
+        }
+        ++found;
+    }
+    return foundTotal;
+}
+
+/// Extract the allocation counters from a node's numastat.
+///
+/// Format (/sys/devices/system/node/nodeN/numastat), cumulative pages:
+///   numa_hit 123456789
+///   numa_miss 0
+///   numa_foreign 0
+///   interleave_hit 12345
+///   local_node 123450000
+///   other_node 6789
+/// Returns false (hasNumaStat stays false) unless every counter was found.
+[[nodiscard]] inline bool parseNumaStat(std::string_view text, NumaNodeCounters& out) noexcept
+{
+    using namespace NumaParseDetail;
+
+    std::array<std::uint64_t, NUMA_STAT_SLOT_COUNT> values{};
+    std::array<bool, NUMA_STAT_SLOT_COUNT> found{};
+    if (ProcParse::scanKeyedValues(text, NUMA_STAT_KEYS, values, found) != NUMA_STAT_KEYS.size())
+    {
+        return false;
+    }
+
+    out.numaHit = values[NUMA_STAT_HIT];
+    out.numaMiss = values[NUMA_STAT_MISS];
+    out.numaForeign = values[NUMA_STAT_FOREIGN];
+    out.localNode = values[NUMA_STAT_LOCAL];
+    out.otherNode = values[NUMA_STAT_OTHER];
+    out.hasNumaStat = true;
+    return true;
+}
+
+/// Sum a process's resident memory per NUMA node from /proc/<pid>/numa_maps.
+///
+/// Format, one line per mapping:
+///   55d4c2a4e000 default file=/usr/bin/bash mapped=47 mapmax=2 N0=40 N1=7 kernelpagesize_kB=4
+///   7f2a10000000 bind:1 anon=512 dirty=512 N1=512 kernelpagesize_kB=2048
+/// Each Nx= count is in pages of that line's kernelpagesize_kB, so huge pages are
+/// weighted correctly. @p kibPerNode is indexed by node id and resized to cover the
+/// highest node seen. Returns false if no line reported resident pages.
+[[nodiscard]] inline bool parseNumaMaps(std::string_view text, std::vector<std::uint64_t>& kibPerNode)
+{
+    constexpr std::string_view PAGE_SIZE_KEY = "kernelpagesize_kB=";
+
+    std::ranges::fill(kibPerNode, std::uint64_t{0});
+    bool foundAny = false;
+
+    std::string_view line;
+    while (ProcParse::nextLine(text, line))
+    {
+        // The page size follows the node counts; look it up first so one pass over the tokens suffices
+        std::uint64_t pageKib = 4;
+        if (const auto pos = line.find(PAGE_SIZE_KEY); pos != std::string_view::npos)
+        {
+            std::string_view sizeField = line.substr(pos + PAGE_SIZE_KEY.size());
+            (void) ProcParse::nextInteger(sizeField, pageKib);
+        }
+
+        for (std::string_view token = ProcParse::nextToken(line); !token.empty(); token = ProcParse::nextToken(line))
+        {
+            if (token.size() < 4 || token.front() != 'N' || token[1] < '0' || token[1] > '9')
+            {
+                continue;
+            }
+
+            token.remove_prefix(1);
+            std::uint32_t nodeId = 0;
+            std::uint64_t pages = 0;
+            if (!ProcParse::nextInteger(token, nodeId) || nodeId > NumaParseDetail::MAX_NODE_ID || token.empty() || token.front() != '=')
+            {
+                continue;
+            }
+            token.remove_prefix(1);
+            if (!ProcParse::nextInteger(token, pages))
+            {
+                continue;
+            }
+
+            if (kibPerNode.size() <= nodeId)
+            {
+                kibPerNode.resize(static_cast<std::size_t>(nodeId) + 1, 0);
+            }
+            kibPerNode[nodeId] += pages * pageKib;
+            foundAny = true;
+        }
+    }
+    return foundAny;
+}
+
+} // namespace Platform
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Platform/SystemTypes.h"
+#include "ProcParse.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace Platform
+{
+
+/// Parse a PSI file (/proc/pressure/<resource> or <cgroup>/<resource>.pressure).
+///
+/// Format (one or two lines):
+///   some avg10=0.00 avg60=0.00 avg300=0.00 total=12345
+///   full avg10=0.00 avg60=0.00 avg300=0.00 total=0
+///
+/// Only the cumulative total= fields are kept; the avgN fields are the kernel's
+/// smoothed view and are recomputed from deltas by the domain instead.
+/// Returns false (and leaves @p out unavailable) if no line could be parsed.
+[[nodiscard]] inline bool parsePressure(std::string_view text, PressureCounters& out) noexcept
+{
+    out = PressureCounters{};
+
+    std::string_view line;
+    while (ProcParse::nextLine(text, line))
+    {
+        const std::string_view kind = ProcParse::nextToken(line);
+        const bool isSome = (kind == "some");
+        if (!isSome && kind != "full")
+        {
+            continue;
+        }
+
+        for (std::string_view field = ProcParse::nextToken(line); !field.empty(); field = ProcParse::nextToken(line))
+        {
+            if (!field.starts_with("total="))
+            {
+                continue;
+            }
+
+            field.remove_prefix(6);
+            std::uint64_t totalUs = 0;
+            if (!ProcParse::nextInteger(field, totalUs))
+            {
+                break;
+            }
+
+            if (isSome)
+            {
+                out.someTotalUs = totalUs;
+                out.hasSome = true;
+            }
+            else
+            {
+                out.fullTotalUs = totalUs;
+                out.hasFull = true;
+            }
+            break;
+        }
+    }
+
+    out.available = out.hasSome || out.hasFull;
+    return out.available;
+}
+
+} // namespace Platform
@@ -0,0 +1,104 @@
+// Keep this translation unit parseable on non-Linux platforms (e.g. Windows clangd)
+// by compiling the implementation only when targeting Linux and required headers exist.
+#if defined(__linux__) && __has_include(<unistd.h>) && __has_include(<fcntl.h>)
+
+#include "ProcFile.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Platform
+{
+
+namespace
+{
+
+// Most seq files fit in a page; larger ones (/proc/stat on many-core hosts,
+// /proc/net/dev with thousands of interfaces) grow the buffer on demand.
+constexpr std::size_t INITIAL_BUFFER_SIZE = 4096;
+constexpr std::size_t MAX_BUFFER_SIZE = 16 * 1024 * 1024;
+
+} // namespace
+
+ProcFile::ProcFile(std::string path) : m_Path(std::move(path))
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) - POSIX open() is variadic
+    m_Fd = ::open(m_Path.c_str(), O_RDONLY | O_CLOEXEC);
+}
+
+ProcFile::~ProcFile() noexcept
+{
+    close();
+}
+
+ProcFile::ProcFile(ProcFile&& other) noexcept
+    : m_Path(std::move(other.m_Path)), m_Fd(std::exchange(other.m_Fd, -1)), m_Buffer(std::move(other.m_Buffer))
+{
+}
+
+ProcFile& ProcFile::operator=(ProcFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        close();
+        m_Path = std::move(other.m_Path);
+        m_Fd = std::exchange(other.m_Fd, -1);
+        m_Buffer = std::move(other.m_Buffer);
+    }
+    return *this;
+}
+
+void ProcFile::close() noexcept
+{
+    if (m_Fd >= 0)
+    {
+        ::close(m_Fd);
+        m_Fd = -1;
+    }
+}
+
+std::string_view ProcFile::read()
+{
+    if (m_Fd < 0)
+    {
+        return {};
+    }
+
+    if (m_Buffer.empty())
+    {
+        m_Buffer.resize(INITIAL_BUFFER_SIZE);
+    }
+
+    while (true)
+    {
+        const ssize_t bytesRead = ::pread(m_Fd, m_Buffer.data(), m_Buffer.size(), 0);
+        if (bytesRead < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return {};
+        }
+
+        const auto length = static_cast<std::size_t>(bytesRead);
+        if (length < m_Buffer.size() || m_Buffer.size() >= MAX_BUFFER_SIZE)
+        {
+            return {m_Buffer.data(), length};
+        }
+
+        // Buffer was filled completely, so the file may be longer. Grow and re-read
+        // from offset 0 so the caller always sees one consistent kernel snapshot.
+        m_Buffer.resize(m_Buffer.size() * 2);
+    }
+}
+
+} // namespace Platform
+
+#endif
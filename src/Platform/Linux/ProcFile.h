@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Platform
+{
+
+/// Persistent read-only handle to a procfs/sysfs seq file.
+///
+/// The file is opened once and every read() re-reads it from offset 0 with pread()
+/// into a buffer that is reused across calls. This avoids the open/fstat/close and
+/// std::ifstream construction overhead of reopening small kernel files every tick.
+///
+/// Not thread-safe: callers that share a ProcFile across threads must serialize reads.
+class ProcFile
+{
+  public:
+    ProcFile() = default;
+
+    /// Open the file at @p path. Failure is not an error; isOpen() reports it.
+    explicit ProcFile(std::string path);
+
+    ~ProcFile() noexcept;
+
+    ProcFile(const ProcFile&) = delete;
+    ProcFile& operator=(const ProcFile&) = delete;
+    ProcFile(ProcFile&& other) noexcept;
+    ProcFile& operator=(ProcFile&& other) noexcept;
+
+    /// Whether the underlying file descriptor is valid.
+    [[nodiscard]] bool isOpen() const noexcept
+    {
+        return m_Fd >= 0;
+    }
+
+    [[nodiscard]] const std::string& path() const noexcept
+    {
+        return m_Path;
+    }
+
+    /// Underlying descriptor, for poll()-based change notification (mountinfo).
+    /// Still owned by this ProcFile; -1 if not open.
+    [[nodiscard]] int fd() const noexcept
+    {
+        return m_Fd;
+    }
+
+    /// Re-read the whole file from offset 0.
+    /// Returns a view into the internal buffer (valid until the next read()), or an
+    /// empty view if the file is not open or the read failed.
+    [[nodiscard]] std::string_view read();
+
+  private:
+    void close() noexcept;
+
+    std::string m_Path;
+    int m_Fd = -1;
+    std::vector<char> m_Buffer;
+};
+
+} // namespace Platform
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+/// Allocation-free scanning helpers for procfs/sysfs text.
+///
+/// All functions operate on a std::string_view cursor that is advanced past whatever
+/// was consumed, so a caller can walk a whole file (e.g. the buffer returned by
+/// ProcFile::read()) line by line and field by field without building strings or
+/// istringstreams.
+namespace Platform::ProcParse
+{
+
+/// Pop the next line (without the trailing '\n') from @p text.
+/// Returns false once @p text is exhausted.
+[[nodiscard]] inline bool nextLine(std::string_view& text, std::string_view& line) noexcept
+{
+    if (text.empty())
+    {
+        return false;
+    }
+
+    const auto newline = text.find('\n');
+    if (newline == std::string_view::npos)
+    {
+        line = text;
+        text = {};
+    }
+    else
+    {
+        line = text.substr(0, newline);
+        text.remove_prefix(newline + 1);
+    }
+    return true;
+}
+
+/// Skip leading spaces and tabs.
+inline void skipSpaces(std::string_view& sv) noexcept
+{
+    std::size_t pos = 0;
+    while (pos < sv.size() && (sv[pos] == ' ' || sv[pos] == '\t'))
+    {
+        ++pos;
+    }
+    sv.remove_prefix(pos);
+}
+
+/// Pop the next whitespace-delimited token (empty if none left).
+[[nodiscard]] inline std::string_view nextToken(std::string_view& sv) noexcept
+{
+    skipSpaces(sv);
+    std::size_t end = 0;
+    while (end < sv.size() && sv[end] != ' ' && sv[end] != '\t' && sv[end] != '\n')
+    {
+        ++end;
+    }
+    const std::string_view token = sv.substr(0, end);
+    sv.remove_prefix(end);
+    return token;
+}
+
+/// Parse the next integer field. Leaves @p out untouched and returns false on failure.
+template<std::integral T> [[nodiscard]] bool nextInteger(std::string_view& sv, T& out) noexcept
+{
+    skipSpaces(sv);
+    T value{};
+    const auto [ptr, ec] = std::from_chars(sv.data(), sv.data() + sv.size(), value);
+    if (ec != std::errc{})
+    {
+        return false;
+    }
+    sv.remove_prefix(static_cast<std::size_t>(ptr - sv.data()));
+    out = value;
+    return true;
+}
+
+/// Parse the next fixed-point decimal field such as "12345.67" or "0.31".
+/// procfs never emits exponents, so this avoids depending on floating-point from_chars.
+[[nodiscard]] inline bool nextDecimal(std::string_view& sv, double& out) noexcept
+{
+    std::uint64_t whole = 0;
+    if (!nextInteger(sv, whole))
+    {
+        return false;
+    }
+
+    double value = static_cast<double>(whole);
+    if (!sv.empty() && sv.front() == '.')
+    {
+        sv.remove_prefix(1);
+        double scale = 0.1;
+        while (!sv.empty() && sv.front() >= '0' && sv.front() <= '9')
+        {
+            value += scale * static_cast<double>(sv.front() - '0');
+            scale *= 0.1;
+            sv.remove_prefix(1);
+        }
+    }
+
+    out = value;
+    return true;
+}
+
+/// Strip trailing whitespace/newlines (sysfs attributes end in '\n').
+[[nodiscard]] inline std::string_view trimRight(std::string_view sv) noexcept
+{
+    while (!sv.empty() && (sv.back() == '\n' || sv.back() == ' ' || sv.back() == '\t' || sv.back() == '\r'))
+    {
+        sv.remove_suffix(1);
+    }
+    return sv;
+}
+
+/// Parse a kernel id list such as "0-3,8,10-11\n" (sysfs cpu/online, node cpulist)
+/// into a membership mask indexed by id: mask[id] == 1 for listed ids.
+/// The mask is resized to cover the highest id and reuses its capacity.
+/// Returns false (mask cleared) on malformed input or ids above MAX_LIST_ID.
+[[nodiscard]] inline bool parseIdList(std::string_view text, std::vector<std::uint8_t>& mask)
+{
+    constexpr std::uint32_t MAX_LIST_ID = 65535;
+
+    std::fill(mask.begin(), mask.end(), std::uint8_t{0});
+    text = trimRight(text);
+
+    while (!text.empty())
+    {
+        std::uint32_t first = 0;
+        if (!nextInteger(text, first) || first > MAX_LIST_ID)
+        {
+            mask.clear();
+            return false;
+        }
+
+        std::uint32_t last = first;
+        if (!text.empty() && text.front() == '-')
+        {
+            text.remove_prefix(1);
+            if (!nextInteger(text, last) || last < first || last > MAX_LIST_ID)
+            {
+                mask.clear();
+                return false;
+            }
+        }
+
+        if (mask.size() <= last)
+        {
+            mask.resize(static_cast<std::size_t>(last) + 1, 0);
+        }
+        std::fill(mask.begin() + static_cast<std::ptrdiff_t>(first), mask.begin() + static_cast<std::ptrdiff_t>(last) + 1, std::uint8_t{1});
+
+        if (!text.empty() && text.front() == ',')
+        {
+            text.remove_prefix(1);
+        }
+    }
+    return true;
+}
+
+/// One key to extract from a keyed procfs file and the output slot its value goes to.
+struct KeySlot
+{
+    std::string_view key;
+    std::size_t slot = 0;
+};
+
+/// Table-driven scan of "key value" lines (/proc/vmstat, the tail of /proc/stat).
+///
+/// Only lines whose first token matches a key in @p table have their value parsed; it is
+/// stored in values[slot] and found[slot] is set. Everything else is skipped after the key
+/// comparison. The scan stops as soon as every key in the table has been seen, so keys near
+/// the top of a long file cost nothing past their line. Slots not found are left untouched.
+/// Returns the number of keys found.
+[[nodiscard]] inline std::size_t
+scanKeyedValues(std::string_view text, std::span<const KeySlot> table, std::span<std::uint64_t> values, std::span<bool> found) noexcept
+{
+    std::size_t foundCount = 0;
+    std::string_view line;
+    while (foundCount < table.size() && nextLine(text, line))
+    {
+        const std::string_view key = nextToken(line);
+        for (const auto& entry : table)
+        {
+            if (key != entry.key)
+            {
+                continue;
+            }
+            std::uint64_t value = 0;
+            if (nextInteger(line, value) && entry.slot < values.size() && entry.slot < found.size())
+            {
+                values[entry.slot] = value;
+                found[entry.slot] = true;
+            }
+            ++foundCount;
+            break;
+        }
+    }
+    return foundCount;
+}
+
+/// Write "<pid>/<suffix>", followed by @p fd if it is non-negative, into @p buffer and
+/// NUL-terminate it (e.g. "1234/fdinfo/7" for suffix "fdinfo/"). Per-process paths
+/// relative to an open /proc directory are built on the stack this way instead of in a
+/// std::string per file. Returns the path without the NUL, or an empty view if it does not
+/// fit in @p buffer.
+[[nodiscard]] inline std::string_view
+formatPidPath(std::span<char> buffer, std::int32_t pid, std::string_view suffix, std::int32_t fd = -1) noexcept
+{
+    if (buffer.empty())
+    {
+        return {};
+    }
+    char* cursor = buffer.data();
+    char* const end = buffer.data() + buffer.size() - 1; // Room for the NUL
+
+    const auto pidResult = std::to_chars(cursor, end, pid);
+    if (pidResult.ec != std::errc{} || end - pidResult.ptr < static_cast<std::ptrdiff_t>(suffix.size() + 1))
+    {
+        return {};
+    }
+    cursor = pidResult.ptr;
+    *cursor++ = '/';
+    cursor = std::copy(suffix.begin(), suffix.end(), cursor);
+
+    if (fd >= 0)
+    {
+        const auto fdResult = std::to_chars(cursor, end, fd);
+        if (fdResult.ec != std::errc{})
+        {
+            return {};
+        }
+        cursor = fdResult.ptr;
+    }
+
+    *cursor = '\0';
+    return {buffer.data(), static_cast<std::size_t>(cursor - buffer.data())};
+}
+
+} // namespace Platform::ProcParse
@@ -0,0 +1,255 @@
+// Keep this translation unit parseable on non-Linux platforms (e.g. Windows clangd)
+// by compiling the implementation only when targeting Linux and required headers exist.
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "RaplEnergyReader.h"
+
+#include "ProcParse.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Platform
+{
+
+namespace
+{
+
+constexpr std::string_view ZONE_PREFIX = "intel-rapl:";
+
+/// Zone directory "intel-rapl:N" or subzone "intel-rapl:N:M".
+struct ZoneName
+{
+    std::uint32_t zone = 0;
+    bool isSubzone = false;
+};
+
+[[nodiscard]] std::optional<ZoneName> parseZoneName(std::string_view name)
+{
+    if (!name.starts_with(ZONE_PREFIX))
+    {
+        return std::nullopt;
+    }
+    name.remove_prefix(ZONE_PREFIX.size());
+
+    ZoneName result;
+    const auto [ptr, ec] = std::from_chars(name.data(), name.data() + name.size(), result.zone);
+    if (ec != std::errc{})
+    {
+        return std::nullopt;
+    }
+    name.remove_prefix(static_cast<std::size_t>(ptr - name.data()));
+    result.isSubzone = !name.empty();
+    return result;
+}
+
+/// Trimmed contents of a small sysfs attribute (empty if unreadable).
+[[nodiscard]] std::string readAttribute(const std::filesystem::path& path)
+{
+    ProcFile file(path.string());
+    return std::string(ProcParse::trimRight(file.read()));
+}
+
+/// Package index of a "package-N" (or "package-N-die-M") zone name.
+[[nodiscard]] std::optional<std::int32_t> parsePackageName(std::string_view name)
+{
+    constexpr std::string_view PACKAGE_PREFIX = "package-";
+    if (!name.starts_with(PACKAGE_PREFIX))
+    {
+        return std::nullopt;
+    }
+    name.remove_prefix(PACKAGE_PREFIX.size());
+    std::int32_t package = 0;
+    if (!ProcParse::nextInteger(name, package) || package < 0)
+    {
+        return std::nullopt;
+    }
+    return package;
+}
+
+[[nodiscard]] std::optional<EnergyDomain> parseSubzoneName(std::string_view name)
+{
+    if (name == "core")
+    {
+        return EnergyDomain::Core;
+    }
+    if (name == "uncore")
+    {
+        return EnergyDomain::Uncore;
+    }
+    if (name == "dram")
+    {
+        return EnergyDomain::Dram;
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+RaplEnergyReader::RaplEnergyReader(std::string powercapRoot, std::string cpuRoot)
+{
+    discoverZones(powercapRoot);
+    if (m_Zones.empty())
+    {
+        return;
+    }
+    readCpuPackages(cpuRoot);
+    spdlog::info("RAPL energy counters available: {} zone(s) under {}", m_Zones.size(), powercapRoot);
+}
+
+void RaplEnergyReader::discoverZones(const std::string& powercapRoot)
+{
+    struct Candidate
+    {
+        std::filesystem::path dir;
+        ZoneName zone;
+    };
+    std::vector<Candidate> candidates;
+
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(powercapRoot, ec))
+    {
+        if (const auto zone = parseZoneName(entry.path().filename().string()))
+        {
+            candidates.push_back({.dir = entry.path(), .zone = *zone});
+        }
+    }
+    if (candidates.empty())
+    {
+        spdlog::debug("RAPL powercap zones not found under {}", powercapRoot);
+        return;
+    }
+
+    // Subzones take the package of their parent zone, so resolve package zones first
+    std::ranges::sort(candidates, [](const Candidate& lhs, const Candidate& rhs) { return lhs.zone.isSubzone < rhs.zone.isSubzone; });
+    std::unordered_map<std::uint32_t, std::int32_t> zonePackage; // intel-rapl:N -> package index
+
+    std::size_t unreadable = 0;
+    for (const auto& candidate : candidates)
+    {
+        const std::string name = readAttribute(candidate.dir / "name");
+
+        EnergyZoneCounters counters;
+        if (candidate.zone.isSubzone)
+        {
+            const auto parent = zonePackage.find(candidate.zone.zone);
+            const auto domain = parseSubzoneName(name);
+            if (parent == zonePackage.end() || !domain)
+            {
+                continue; // Subzone of psys, or a domain we do not attribute
+            }
+            counters.package = parent->second;
+            counters.domain = *domain;
+        }
+        else
+        {
+            const auto package = parsePackageName(name);
+            if (!package)
+            {
+                continue; // psys: platform-wide, not tied to a package
+            }
+            zonePackage[candidate.zone.zone] = *package;
+            counters.package = *package;
+            counters.domain = EnergyDomain::Package;
+        }
+
+        const std::string range = readAttribute(candidate.dir / "max_energy_range_uj");
+        std::string_view rangeText = range;
+        (void) ProcParse::nextInteger(rangeText, counters.maxEnergyRangeMicrojoules);
+
+        Zone zone{.energy = ProcFile((candidate.dir / "energy_uj").string()), .counters = counters};
+        std::string_view energy = zone.energy.read();
+        if (!ProcParse::nextInteger(energy, zone.counters.energyMicrojoules))
+        {
+            ++unreadable;
+            continue;
+        }
+        m_Zones.push_back(std::move(zone));
+    }
+
+    if (unreadable > 0)
+    {
+        spdlog::debug("{} RAPL zone(s) not readable (energy_uj is root-only on this kernel)", unreadable);
+    }
+
+    std::ranges::stable_sort(m_Zones,
+                             [](const Zone& lhs, const Zone& rhs)
+                             {
+                                 if (lhs.counters.package != rhs.counters.package)
+                                 {
+                                     return lhs.counters.package < rhs.counters.package;
+                                 }
+                                 return lhs.counters.domain < rhs.counters.domain;
+                             });
+}
+
+void RaplEnergyReader::readCpuPackages(const std::string& cpuRoot)
+{
+    std::vector<std::uint8_t> present;
+    {
+        ProcFile presentFile(cpuRoot + "/present");
+        if (!ProcParse::parseIdList(presentFile.read(), present))
+        {
+            return;
+        }
+    }
+
+    // The kernel numbers RAPL packages in the order their first CPU comes up, i.e. by the
+    // rank of each physical_package_id in ascending CPU order
+    std::vector<std::int32_t> physicalIds; // Rank -> physical_package_id
+    m_CpuPackage.assign(present.size(), -1);
+    for (std::size_t cpu = 0; cpu < present.size(); ++cpu)
+    {
+        if (present[cpu] == 0)
+        {
+            continue;
+        }
+        const std::string attribute = readAttribute(cpuRoot + "/cpu" + std::to_string(cpu) + "/topology/physical_package_id");
+        std::string_view text = attribute;
+        std::int32_t physicalId = -1;
+        if (!ProcParse::nextInteger(text, physicalId) || physicalId < 0)
+        {
+            continue;
+        }
+        auto rank = std::ranges::find(physicalIds, physicalId);
+        if (rank == physicalIds.end())
+        {
+            physicalIds.push_back(physicalId);
+            rank = physicalIds.end() - 1;
+        }
+        m_CpuPackage[cpu] = static_cast<std::int32_t>(rank - physicalIds.begin());
+    }
+}
+
+void RaplEnergyReader::read(EnergyCounters& out)
+{
+    out.zones.resize(m_Zones.size());
+    for (std::size_t index = 0; index < m_Zones.size(); ++index)
+    {
+        Zone& zone = m_Zones[index];
+        std::string_view text = zone.energy.read();
+        std::uint64_t energy = 0;
+        if (ProcParse::nextInteger(text, energy))
+        {
+            zone.counters.energyMicrojoules = energy;
+        }
+        out.zones[index] = zone.counters;
+    }
+    out.cpuPackage = m_CpuPackage;
+}
+
+} // namespace Platform
+
+#endif
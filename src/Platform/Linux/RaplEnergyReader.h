@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Platform/ProcessTypes.h"
+#include "ProcFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Platform
+{
+
+/// CPU package energy reader for Linux RAPL powercap zones.
+///
+/// At construction walks <powercapRoot> for intel-rapl:N package zones and their
+/// intel-rapl:N:M subzones (core, uncore, dram), reads each zone's max_energy_range_uj and
+/// keeps its energy_uj open; read() re-reads them with pread(). Platform (psys) zones are
+/// skipped: they are not tied to a package. Zones whose energy_uj is not readable (root-only
+/// on kernels since 5.10) are left out.
+///
+/// Packages are numbered by the rank of their physical_package_id, which is how the kernel
+/// numbers "package-N" zones, so EnergyZoneCounters::package indexes cpuPackage directly.
+/// The CPU-to-package map is read once; CPUs hot-added later report -1.
+/// Not thread-safe; LinuxProcessProbe serializes access with its enumerate mutex.
+class RaplEnergyReader
+{
+  public:
+    explicit RaplEnergyReader(std::string powercapRoot = "/sys/class/powercap", std::string cpuRoot = "/sys/devices/system/cpu");
+
+    /// Whether at least one package zone is readable.
+    [[nodiscard]] bool isAvailable() const noexcept
+    {
+        return !m_Zones.empty();
+    }
+
+    [[nodiscard]] std::size_t zoneCount() const noexcept
+    {
+        return m_Zones.size();
+    }
+
+    /// Fill @p out with every zone's current counter and the CPU-to-package map.
+    /// A zone that fails to read keeps its last value, so its interval delta is 0.
+    void read(EnergyCounters& out);
+
+  private:
+    struct Zone
+    {
+        ProcFile energy;
+        EnergyZoneCounters counters;
+    };
+
+    void discoverZones(const std::string& powercapRoot);
+    void readCpuPackages(const std::string& cpuRoot);
+
+    std::vector<Zone> m_Zones;             // Package zones first, then subzones; order is stable
+    std::vector<std::int32_t> m_CpuPackage; // Indexed by logical CPU id
+};
+
+} // namespace Platform
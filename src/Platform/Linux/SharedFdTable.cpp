@@ -0,0 +1,217 @@
+// Keep this translation unit parseable on non-Linux platforms (e.g. Windows clangd)
+// by compiling the implementation only when targeting Linux and required headers exist.
+#if defined(__linux__) && __has_include(<dirent.h>) && __has_include(<unistd.h>)
+
+#include "SharedFdTable.h"
+
+#include "ProcParse.h"
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Platform
+{
+
+namespace
+{
+
+/// Parse a directory entry name as a non-negative integer (PID or fd number).
+[[nodiscard]] bool parseEntryNumber(const char* name, std::int32_t& out) noexcept
+{
+    const std::string_view text(name);
+    const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+    return ec == std::errc{} && ptr == text.data() + text.size() && out >= 0;
+}
+
+/// Record every fd of one process; a process whose fd/ cannot be opened is left out.
+void walkProcessFds(int procDirFd, std::int32_t pid, FdTable& table)
+{
+    std::array<char, 32> path{};
+    const std::string_view fdPath = ProcParse::formatPidPath(path, pid, "fd");
+    if (fdPath.empty())
+    {
+        return;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) - POSIX openat() is variadic
+    const int fdDirFd = ::openat(procDirFd, fdPath.data(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fdDirFd < 0)
+    {
+        return; // Permission denied or process exited
+    }
+
+    DIR* fdDir = ::fdopendir(fdDirFd); // Takes ownership of fdDirFd
+    if (fdDir == nullptr)
+    {
+        ::close(fdDirFd);
+        return;
+    }
+
+    std::array<char, 256> linkTarget{};
+    std::int32_t count = 0;
+
+    // NOLINTNEXTLINE(concurrency-mt-unsafe) - readdir is safe here: single DIR* per thread
+    while (const struct dirent* entry = ::readdir(fdDir))
+    {
+        std::int32_t fd = 0;
+        if (!parseEntryNumber(entry->d_name, fd))
+        {
+            continue; // "." and ".."
+        }
+        ++count;
+
+        const ssize_t linkLen = ::readlinkat(::dirfd(fdDir), entry->d_name, linkTarget.data(), linkTarget.size());
+        if (linkLen <= 0)
+        {
+            continue;
+        }
+        const std::string_view target(linkTarget.data(), static_cast<std::size_t>(linkLen));
+
+        if (target.starts_with("socket:["))
+        {
+            // "socket:[inode]"
+            const std::size_t start = 8;
+            const std::size_t end = target.find(']', start);
+            std::uint64_t inode = 0;
+            if (end != std::string_view::npos &&
+                std::from_chars(target.data() + start, target.data() + end, inode).ec == std::errc{} && inode != 0)
+            {
+                table.socketOwners[inode] = pid;
+            }
+        }
+        else if (target.starts_with("/dev/dri/"))
+        {
+            table.drmFds.push_back({.pid = pid, .fd = fd});
+        }
+    }
+
+    ::closedir(fdDir);
+    table.fdCounts[pid] = count;
+}
+
+} // namespace
+
+FdTable walkFdTable(const std::string& procRoot)
+{
+    FdTable table;
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) - POSIX open() is variadic
+    const int procDirFd = ::open(procRoot.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (procDirFd < 0)
+    {
+        return table;
+    }
+
+    // A second descriptor for readdir, so procDirFd stays usable for openat()
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) - POSIX open() is variadic
+    const int listFd = ::open(procRoot.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    DIR* procDir = listFd >= 0 ? ::fdopendir(listFd) : nullptr;
+    if (procDir == nullptr)
+    {
+        if (listFd >= 0)
+        {
+            ::close(listFd);
+        }
+        ::close(procDirFd);
+        return table;
+    }
+
+    table.fdCounts.reserve(1024);
+    table.socketOwners.reserve(1024); // Pre-allocate for typical system
+
+    // NOLINTNEXTLINE(concurrency-mt-unsafe) - readdir is safe here: single DIR* per thread
+    while (const struct dirent* entry = ::readdir(procDir))
+    {
+        std::int32_t pid = 0;
+        if (parseEntryNumber(entry->d_name, pid) && pid > 0)
+        {
+            walkProcessFds(procDirFd, pid, table);
+        }
+    }
+
+    ::closedir(procDir);
+    ::close(procDirFd);
+    return table;
+}
+
+SharedFdTable& SharedFdTable::instance(const std::string& procRoot)
+{
+    if (procRoot == "/proc")
+    {
+        static SharedFdTable hostInstance("/proc");
+        return hostInstance;
+    }
+
+    // Alternate roots (a host tree mounted into a container, test fixtures) get their own
+    // walker; entries live for the rest of the process like the host instance does.
+    static std::mutex rootsMutex;
+    static std::map<std::string, std::unique_ptr<SharedFdTable>, std::less<>> roots;
+    const std::scoped_lock lock(rootsMutex);
+    auto& slot = roots[procRoot];
+    if (!slot)
+    {
+        slot.reset(new SharedFdTable(procRoot));
+    }
+    return *slot;
+}
+
+SharedFdTable::SharedFdTable(std::string procRoot) : m_ProcRoot(std::move(procRoot))
+{
+}
+
+std::shared_ptr<const FdTable> SharedFdTable::read(Consumer& consumer)
+{
+    const auto start = std::chrono::steady_clock::now();
+    {
+        const std::scoped_lock lock(m_Mutex);
+        const bool fresh = m_Table && ((start - m_WalkTime) < SHARE_WINDOW);
+        const bool alreadySeen = (consumer.lastGeneration == m_Generation);
+        if (fresh && !alreadySeen)
+        {
+            consumer.lastGeneration = m_Generation;
+            return m_Table;
+        }
+    }
+
+    // Walk without the lock: the UI thread (process probe) and the GPU worker (DRM client
+    // stats) both call in, and neither should wait out the other's walk
+    auto table = std::make_shared<const FdTable>(walkFdTable(m_ProcRoot));
+
+    const std::scoped_lock lock(m_Mutex);
+    ++m_WalkCount;
+    // A walk that started later may have finished first; never replace it with an older one.
+    // The caller then keeps its own table and has not seen the published one.
+    if (!m_Table || start >= m_WalkTime)
+    {
+        m_Table = table;
+        m_WalkTime = start;
+        ++m_Generation;
+        consumer.lastGeneration = m_Generation;
+    }
+    return table;
+}
+
+std::uint64_t SharedFdTable::walkCount() const
+{
+    const std::scoped_lock lock(m_Mutex);
+    return m_WalkCount;
+}
+
+} // namespace Platform
+
+#endif
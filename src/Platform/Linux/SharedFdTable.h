@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Platform
+{
+
+/// What one pass over every <proc>/<pid>/fd directory found.
+///
+/// Every fd link is resolved once (readlinkat) and handed to whichever consumer cares:
+/// the process probe's handle counts and socket-to-PID map, and the DRM client
+/// collector's list of GPU device fds.
+struct FdTable
+{
+    /// An fd open on a DRM device node (/dev/dri/card*, /dev/dri/renderD*).
+    struct DrmFd
+    {
+        std::int32_t pid = 0;
+        std::int32_t fd = -1;
+    };
+
+    std::unordered_map<std::int32_t, std::int32_t> fdCounts;     // PID -> open fds (only PIDs whose fd/ was readable)
+    std::unordered_map<std::uint64_t, std::int32_t> socketOwners; // Socket inode -> owning PID
+    std::vector<DrmFd> drmFds;                                    // In walk order (PID, then fd)
+};
+
+/// Walk <procRoot>/<pid>/fd for every process once. Unreadable fd directories (other
+/// users' processes without CAP_SYS_PTRACE) and processes that exit mid-walk are skipped.
+[[nodiscard]] FdTable walkFdTable(const std::string& procRoot = "/proc");
+
+/// Process-wide fd-table walk shared by LinuxProcessProbe and DrmClientStats.
+///
+/// Both need every process's fd links each refresh; walking /proc/<pid>/fd costs a
+/// getdents plus one readlink per open fd, so the first consumer in a tick walks and
+/// later consumers reuse the result. A table is shared only if it is younger than
+/// SHARE_WINDOW and the requesting consumer has not already seen it, so a consumer that
+/// reads twice in a row always gets a fresh walk.
+class SharedFdTable
+{
+  public:
+    /// Tables older than this are never reused. One minimum refresh interval: the
+    /// process and GPU samplers run on their own timers, so a shorter window would
+    /// rarely let them share.
+    static constexpr auto SHARE_WINDOW = std::chrono::milliseconds(100);
+
+    /// Per-consumer cursor (one per probe instance).
+    struct Consumer
+    {
+        std::uint64_t lastGeneration = 0;
+    };
+
+    /// The shared walker for <procRoot> (one per proc root, see SystemRoots).
+    [[nodiscard]] static SharedFdTable& instance(const std::string& procRoot = "/proc");
+
+    ~SharedFdTable() = default;
+
+    SharedFdTable(const SharedFdTable&) = delete;
+    SharedFdTable& operator=(const SharedFdTable&) = delete;
+    SharedFdTable(SharedFdTable&&) = delete;
+    SharedFdTable& operator=(SharedFdTable&&) = delete;
+
+    /// The current table, walking /proc first if needed. The returned table is immutable
+    /// and stays valid after later walks replace it. Thread-safe; the walk itself runs
+    /// outside the lock, so a caller never blocks on another thread's walk.
+    [[nodiscard]] std::shared_ptr<const FdTable> read(Consumer& consumer);
+
+    /// Number of walks performed, published or not (for tests and diagnostics).
+    [[nodiscard]] std::uint64_t walkCount() const;
+
+  private:
+    explicit SharedFdTable(std::string procRoot);
+
+    mutable std::mutex m_Mutex; // Guards the published table below, never held during a walk
+    const std::string m_ProcRoot;
+    std::shared_ptr<const FdTable> m_Table;
+    std::chrono::steady_clock::time_point m_WalkTime;
+    std::uint64_t m_Generation = 0; // Published tables
+    std::uint64_t m_WalkCount = 0;
+};
+
+} // namespace Platform
@@ -0,0 +1,70 @@
+// Keep this translation unit parseable on non-Linux platforms (e.g. Windows clangd)
+// by compiling the implementation only when targeting Linux and required headers exist.
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "SharedProcStat.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Platform
+{
+
+SharedProcStat& SharedProcStat::instance(const std::string& procRoot)
+{
+    if (procRoot == "/proc")
+    {
+        static SharedProcStat hostInstance("/proc");
+        return hostInstance;
+    }
+
+    // Alternate roots (a host tree mounted into a container, test fixtures) get their own
+    // reader; entries live for the rest of the process like the host instance does.
+    static std::mutex rootsMutex;
+    static std::map<std::string, std::unique_ptr<SharedProcStat>, std::less<>> roots;
+    const std::scoped_lock lock(rootsMutex);
+    auto& slot = roots[procRoot];
+    if (!slot)
+    {
+        slot.reset(new SharedProcStat(procRoot));
+    }
+    return *slot;
+}
+
+SharedProcStat::SharedProcStat(const std::string& procRoot) : m_File(procRoot + "/stat")
+{
+}
+
+std::shared_ptr<const std::string> SharedProcStat::read(Consumer& consumer)
+{
+    const std::scoped_lock lock(m_Mutex);
+
+    const bool haveSnapshot = (m_Generation != 0) && m_Snapshot && !m_Snapshot->empty();
+    const bool alreadySeen = (consumer.lastGeneration == m_Generation);
+
+    if (!haveSnapshot || alreadySeen)
+    {
+        // Only this reader can hand out m_Snapshot, so a use count of 1 under the lock means
+        // every consumer has dropped the previous one and its buffer can be refilled
+        if (!m_Snapshot || m_Snapshot.use_count() != 1)
+        {
+            m_Snapshot = std::make_shared<std::string>();
+        }
+        m_Snapshot->assign(m_File.read());
+        ++m_Generation;
+    }
+
+    consumer.lastGeneration = m_Generation;
+    if (m_Snapshot->empty())
+    {
+        return nullptr;
+    }
+    return m_Snapshot;
+}
+
+} // namespace Platform
+
+#endif
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "ProcFile.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Platform
+{
+
+/// Process-wide /proc/stat reader shared by LinuxSystemProbe and LinuxProcessProbe.
+///
+/// Both probes need /proc/stat every refresh tick (per-core counters for the system
+/// view, the aggregate jiffies for per-process CPU%). Instead of each probe reopening
+/// and re-reading the file, they share one persistent handle and one snapshot:
+/// the first consumer in a tick reads the file, later consumers reuse those bytes.
+///
+/// Sharing is keyed on the snapshot generation, not on wall-clock time: a snapshot is
+/// handed to every consumer that has not seen it yet, and the first consumer to come
+/// back for a second one triggers the next read. The two probes refresh on their own
+/// timers, so a time window would rarely let them share; with generations, one read
+/// serves both per tick. A consumer that reads twice in a row always gets fresh data,
+/// so cumulative counters keep advancing between its reads, and a shared snapshot is at
+/// most one refresh of the other consumer old.
+class SharedProcStat
+{
+  public:
+    /// Per-consumer cursor (one per probe instance).
+    struct Consumer
+    {
+        std::uint64_t lastGeneration = 0;
+    };
+
+    /// The shared reader for <procRoot>/stat (one per proc root, see SystemRoots).
+    [[nodiscard]] static SharedProcStat& instance(const std::string& procRoot = "/proc");
+
+    ~SharedProcStat() = default;
+
+    SharedProcStat(const SharedProcStat&) = delete;
+    SharedProcStat& operator=(const SharedProcStat&) = delete;
+    SharedProcStat(SharedProcStat&&) = delete;
+    SharedProcStat& operator=(SharedProcStat&&) = delete;
+
+    /// The current /proc/stat snapshot, or null if /proc/stat could not be read.
+    /// The snapshot is immutable and shared, not copied; drop it once parsed so the
+    /// next read can reuse its buffer. Thread-safe.
+    [[nodiscard]] std::shared_ptr<const std::string> read(Consumer& consumer);
+
+  private:
+    explicit SharedProcStat(const std::string& procRoot);
+
+    std::mutex m_Mutex;
+    ProcFile m_File;
+    std::shared_ptr<std::string> m_Snapshot; // Rewritten in place when no consumer still holds it
+    std::uint64_t m_Generation = 0;
+};
+
+} // namespace Platform
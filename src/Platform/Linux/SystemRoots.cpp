@@ -0,0 +1,58 @@
+#include "SystemRoots.h"
+
+#include <spdlog/spdlog.h>
+
+// NOLINTNEXTLINE(misc-include-cleaner) - cstdlib provides secure_getenv when _GNU_SOURCE is defined
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+namespace Platform
+{
+
+namespace
+{
+
+/// Same lookup as LinuxPathProvider: secure_getenv ignores the environment in setuid programs.
+[[nodiscard]] const char* getEnvSafe(const char* name)
+{
+#if defined(__GLIBC__) && defined(_GNU_SOURCE)
+    // NOLINTNEXTLINE(misc-include-cleaner) - secure_getenv from cstdlib with _GNU_SOURCE, include-cleaner false positive
+    return secure_getenv(name);
+#else
+    // NOLINTNEXTLINE(concurrency-mt-unsafe) - fallback when secure_getenv unavailable
+    return std::getenv(name);
+#endif
+}
+
+void applyOverride(const char* variable, std::string& root)
+{
+    const char* value = getEnvSafe(variable);
+    if (value == nullptr || value[0] == '\0')
+    {
+        return;
+    }
+
+    std::string override(value);
+    while (override.size() > 1 && override.back() == '/')
+    {
+        override.pop_back();
+    }
+    root = std::move(override);
+}
+
+} // namespace
+
+SystemRoots SystemRoots::fromEnvironment()
+{
+    SystemRoots roots;
+    applyOverride(PROC_ROOT_ENV, roots.proc);
+    applyOverride(SYS_ROOT_ENV, roots.sys);
+    if (!roots.isDefault())
+    {
+        spdlog::info("Reading procfs from {} and sysfs from {}", roots.proc, roots.sys);
+    }
+    return roots;
+}
+
+} // namespace Platform
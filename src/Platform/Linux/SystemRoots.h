@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace Platform
+{
+
+/// Mount points of procfs and sysfs that every Linux probe resolves its paths against.
+///
+/// Probes take a SystemRoots at construction instead of hardcoding "/proc" and "/sys".
+/// This lets TaskSmack monitor a host from a sidecar container that mounts the host's
+/// trees elsewhere (TASKSMACK_PROC_ROOT=/host/proc), and lets tests and benchmarks point
+/// a probe at a synthetic or captured tree. Paths under "self" resolve inside the
+/// configured proc root as well, so a fixture tree supplies its own "self" entry.
+struct SystemRoots
+{
+    static constexpr const char* PROC_ROOT_ENV = "TASKSMACK_PROC_ROOT";
+    static constexpr const char* SYS_ROOT_ENV = "TASKSMACK_SYS_ROOT";
+
+    std::string proc = "/proc";
+    std::string sys = "/sys";
+
+    /// "<proc>/<relative>", e.g. procPath("meminfo").
+    [[nodiscard]] std::string procPath(std::string_view relative) const
+    {
+        return join(proc, relative);
+    }
+
+    /// "<sys>/<relative>", e.g. sysPath("class/net").
+    [[nodiscard]] std::string sysPath(std::string_view relative) const
+    {
+        return join(sys, relative);
+    }
+
+    /// Whether these are the running kernel's own /proc and /sys.
+    [[nodiscard]] bool isDefault() const noexcept
+    {
+        return proc == "/proc" && sys == "/sys";
+    }
+
+    /// Roots from TASKSMACK_PROC_ROOT and TASKSMACK_SYS_ROOT; unset or empty variables keep
+    /// the defaults. Trailing slashes are dropped.
+    [[nodiscard]] static SystemRoots fromEnvironment();
+
+  private:
+    [[nodiscard]] static std::string join(std::string_view root, std::string_view relative)
+    {
+        std::string path;
+        path.reserve(root.size() + 1 + relative.size());
+        path.append(root);
+        path.push_back('/');
+        path.append(relative);
+        return path;
+    }
+};
+
+} // namespace Platform
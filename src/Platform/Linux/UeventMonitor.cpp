@@ -0,0 +1,182 @@
+// Only compile on Linux with required headers
+#if defined(__linux__) && __has_include(<linux/netlink.h>)
+
+#include "UeventMonitor.h"
+
+#include <spdlog/spdlog.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+// NOLINTBEGIN(misc-include-cleaner) - POSIX/Linux headers: include-cleaner lacks mappings for ssize_t, MSG_*
+#include <linux/netlink.h>
+#include <sys/socket.h>
+#include <unistd.h>
+// NOLINTEND(misc-include-cleaner)
+
+namespace Platform
+{
+
+namespace
+{
+
+// The kernel caps a uevent's environment at UEVENT_BUFFER_SIZE (2048) plus the header line
+constexpr std::size_t UEVENT_BUFFER_SIZE = 8192;
+
+// Multicast group the kernel broadcasts uevents on (udevd re-broadcasts on group 2)
+constexpr std::uint32_t KERNEL_UEVENT_GROUP = 1;
+
+[[nodiscard]] std::string errnoMessage(int errnum)
+{
+    return std::system_category().message(errnum);
+}
+
+[[nodiscard]] UeventAction parseAction(std::string_view action)
+{
+    if (action == "add")
+    {
+        return UeventAction::Add;
+    }
+    if (action == "remove")
+    {
+        return UeventAction::Remove;
+    }
+    if (action == "change")
+    {
+        return UeventAction::Change;
+    }
+    return UeventAction::Other;
+}
+
+} // namespace
+
+UeventMonitor::UeventMonitor(std::string subsystem) : m_Subsystem(std::move(subsystem)), m_Buffer(UEVENT_BUFFER_SIZE)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer) - conditional initialization
+    m_Socket = socket(AF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC | SOCK_NONBLOCK, NETLINK_KOBJECT_UEVENT);
+    if (m_Socket < 0)
+    {
+        spdlog::debug("Failed to create NETLINK_KOBJECT_UEVENT socket: {}", errnoMessage(errno));
+        return;
+    }
+
+    sockaddr_nl addr{};
+    addr.nl_family = AF_NETLINK;
+    addr.nl_pid = 0; // Let kernel assign PID
+    addr.nl_groups = KERNEL_UEVENT_GROUP;
+
+    if (bind(m_Socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0)
+    {
+        spdlog::debug("Failed to bind NETLINK_KOBJECT_UEVENT socket: {}", errnoMessage(errno));
+        const int oldSocket = m_Socket;
+        m_Socket = -1;
+        close(oldSocket);
+        return;
+    }
+
+    spdlog::debug("UeventMonitor: listening for {} events", m_Subsystem);
+}
+
+UeventMonitor::~UeventMonitor() noexcept
+{
+    if (m_Socket >= 0)
+    {
+        const int oldSocket = m_Socket;
+        m_Socket = -1;
+        close(oldSocket);
+    }
+}
+
+std::size_t UeventMonitor::poll(std::vector<Uevent>& out)
+{
+    if (m_Socket < 0)
+    {
+        return 0;
+    }
+
+    const std::size_t before = out.size();
+    while (true)
+    {
+        sockaddr_nl sender{};
+        socklen_t senderLen = sizeof(sender);
+        const ssize_t len = recvfrom(m_Socket, m_Buffer.data(), m_Buffer.size(), 0, reinterpret_cast<sockaddr*>(&sender), &senderLen);
+        if (len < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == ENOBUFS)
+            {
+                // The socket overran while nobody was polling; report a devPath-less event so
+                // the caller rescans instead of trusting a partial event stream
+                out.push_back({.action = UeventAction::Other, .subsystem = m_Subsystem, .devPath = {}});
+                continue;
+            }
+            break; // EAGAIN: drained
+        }
+        if (sender.nl_pid != 0)
+        {
+            continue; // Only the kernel may send on the uevent group; drop anything spoofed
+        }
+
+        Uevent event;
+        if (parse(std::string_view(m_Buffer.data(), static_cast<std::size_t>(len)), event) && event.subsystem == m_Subsystem)
+        {
+            out.push_back(std::move(event));
+        }
+    }
+    return out.size() - before;
+}
+
+bool UeventMonitor::parse(std::string_view datagram, Uevent& out)
+{
+    out = Uevent{};
+
+    // Header "action@devpath"; udevd's re-broadcasts start with "libudev" instead
+    const std::size_t headerEnd = datagram.find('\0');
+    const std::string_view header = datagram.substr(0, headerEnd);
+    if (header.find('@') == std::string_view::npos || headerEnd == std::string_view::npos)
+    {
+        return false;
+    }
+    datagram.remove_prefix(headerEnd + 1);
+
+    while (!datagram.empty())
+    {
+        const std::size_t end = datagram.find('\0');
+        const std::string_view entry = datagram.substr(0, end);
+        datagram.remove_prefix(end == std::string_view::npos ? datagram.size() : end + 1);
+
+        const std::size_t equals = entry.find('=');
+        if (equals == std::string_view::npos)
+        {
+            continue;
+        }
+        const std::string_view key = entry.substr(0, equals);
+        const std::string_view value = entry.substr(equals + 1);
+        if (key == "ACTION")
+        {
+            out.action = parseAction(value);
+        }
+        else if (key == "SUBSYSTEM")
+        {
+            out.subsystem = value;
+        }
+        else if (key == "DEVPATH")
+        {
+            out.devPath = value;
+        }
+    }
+    return !out.subsystem.empty();
+}
+
+} // namespace Platform
+
+#endif // __linux__ && headers available
@@ -0,0 +1,76 @@
+#pragma once
+
+// Only compile on Linux with required headers
+#if defined(__linux__) && __has_include(<linux/netlink.h>)
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Platform
+{
+
+/// Kernel uevent action (the ACTION= key).
+enum class UeventAction : std::uint8_t
+{
+    Other = 0,
+    Add,
+    Remove,
+    Change
+};
+
+/// Fields of one kernel uevent that device probes act on
+struct Uevent
+{
+    UeventAction action = UeventAction::Other;
+    std::string subsystem; // SUBSYSTEM=, e.g. "power_supply"
+    std::string devPath;   // DEVPATH=, relative to /sys
+};
+
+/// Receives kernel device events on a NETLINK_KOBJECT_UEVENT socket.
+///
+/// This is the same multicast feed udev listens on, read directly so no libudev
+/// dependency is needed. The socket is non-blocking: poll() drains whatever arrived
+/// since the last call and returns immediately, so callers can check it every frame
+/// instead of re-walking sysfs to notice hotplug. Events are only delivered in the
+/// initial network namespace; in a container the socket opens but stays silent, so
+/// callers keep a slow rescan as a backstop.
+///
+/// Not thread-safe; LinuxPowerProbe owns one instance.
+class UeventMonitor
+{
+  public:
+    /// Open the socket and listen for events of @p subsystem (e.g. "power_supply").
+    explicit UeventMonitor(std::string subsystem);
+    ~UeventMonitor() noexcept;
+
+    UeventMonitor(const UeventMonitor&) = delete;
+    UeventMonitor& operator=(const UeventMonitor&) = delete;
+    UeventMonitor(UeventMonitor&&) = delete;
+    UeventMonitor& operator=(UeventMonitor&&) = delete;
+
+    /// Check if the NETLINK_KOBJECT_UEVENT socket was created and bound
+    [[nodiscard]] bool isAvailable() const noexcept
+    {
+        return m_Socket >= 0;
+    }
+
+    /// Append events of the monitored subsystem received since the last call to @p out.
+    /// Returns the number appended; never blocks.
+    std::size_t poll(std::vector<Uevent>& out);
+
+    /// Parse one datagram ("action@devpath\0KEY=value\0..."). Returns false if it is not a
+    /// kernel uevent (e.g. a udevd "libudev" message) or carries no SUBSYSTEM.
+    [[nodiscard]] static bool parse(std::string_view datagram, Uevent& out);
+
+  private:
+    int m_Socket = -1;          // Netlink socket file descriptor
+    std::string m_Subsystem;    // Events of other subsystems are dropped
+    std::vector<char> m_Buffer; // Receive buffer, reused across polls
+};
+
+} // namespace Platform
+
+#endif // __linux__ && headers available
@@ -14,3 +14,13 @@
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage) - required for #if conditional compilation
 #define TASKSMACK_HAS_NETLINK_SOCKET_STATS 0
 #endif
+
+// io_uring batched file reads (Linux only). Uses raw syscalls, so only the uapi header is needed;
+// whether the running kernel allows io_uring is decided at runtime by BatchFileReader.
+#if defined(__linux__) && __has_include(<linux/io_uring.h>) && __has_include(<sys/syscall.h>)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage) - required for #if conditional compilation
+#define TASKSMACK_HAS_IO_URING 1
+#else
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage) - required for #if conditional compilation
+#define TASKSMACK_HAS_IO_URING 0
+#endif
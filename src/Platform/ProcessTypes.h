@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace Platform
 {
@@ -39,15 +40,48 @@ struct ProcessCounters
     std::int32_t handleCount = 0;      // Open handles (Windows) or file descriptors (Linux)
     std::uint64_t pageFaultCount = 0;  // Total page faults (minor + major on Linux)
     std::uint64_t cpuAffinityMask = 0; // Bitmask of allowed CPU cores (0 = not available)
+    std::int32_t lastCpu = -1;         // Logical CPU the process last ran on (-1 = not available)
 
     // Network counters (cumulative bytes)
     std::uint64_t netSentBytes = 0;
     std::uint64_t netReceivedBytes = 0;
 
     // Power usage (optional, platform-dependent)
-    // On Windows: from PROCESS_POWER_THROTTLING_STATE
-    // On Linux: from powercap sysfs (per-package energy counters)
+    // On Windows: estimated by the probe from PROCESS_POWER_THROTTLING_STATE
+    // On Linux: left at 0; the domain attributes IProcessProbe::readEnergyCounters() instead
     std::uint64_t energyMicrojoules = 0; // Cumulative energy consumption in microjoules
+
+    // cgroup v2 membership and that cgroup's CPU pressure (Linux PSI, cpu.pressure).
+    // Totals are cumulative stall microseconds shared by every process in the cgroup.
+    std::string cgroupPath; // e.g. "/user.slice/user-1000.slice/session-2.scope" (empty if unknown)
+    bool hasCgroupCpuPressure = false;
+    std::uint64_t cgroupCpuSomeStallUs = 0;
+    std::uint64_t cgroupCpuFullStallUs = 0;
+};
+
+/// Energy domain of a CPU package (Linux RAPL powercap zone names).
+enum class EnergyDomain : std::uint8_t
+{
+    Package, // Whole package, including core and uncore
+    Core,    // CPU cores (part of Package)
+    Uncore,  // Integrated GPU and other uncore (part of Package)
+    Dram,    // Memory controller and DIMMs (outside Package)
+};
+
+/// One cumulative energy counter of a CPU package.
+struct EnergyZoneCounters
+{
+    std::int32_t package = 0; // Package index, as in EnergyCounters::cpuPackage
+    EnergyDomain domain = EnergyDomain::Package;
+    std::uint64_t energyMicrojoules = 0;         // Cumulative; wraps to 0 past maxEnergyRangeMicrojoules
+    std::uint64_t maxEnergyRangeMicrojoules = 0; // Wrap point (0 = unknown)
+};
+
+/// Raw CPU package energy counters, read right after enumerate().
+struct EnergyCounters
+{
+    std::vector<EnergyZoneCounters> zones; // Same order on every read
+    std::vector<std::int32_t> cpuPackage;  // Package index per logical CPU (-1 = unknown)
 };
 
 /// Reports what this platform's probe supports.
@@ -68,6 +102,8 @@ struct ProcessCapabilities
     bool hasNetworkCounters = false; // Whether per-process network counters are available
     bool hasPowerUsage = false;      // Whether power consumption metrics are available
     bool hasStatus = false;          // Whether process status (Suspended, Efficiency Mode) is available
+    bool hasCgroupPressure = false;  // Whether per-cgroup CPU pressure (PSI) is available
+    bool hasNumaResidency = false;   // Whether readNumaResidency() can report per-node memory
 };
 
 } // namespace Platform
@@ -13,24 +13,57 @@ struct DiskCounters
 {
     std::string deviceName;        // e.g., "sda", "nvme0n1", "C:"
     uint64_t readsCompleted = 0;   // Number of read operations completed
+    uint64_t readsMerged = 0;      // Adjacent reads merged before reaching the device
     uint64_t readSectors = 0;      // Number of sectors read
     uint64_t readTimeMs = 0;       // Time spent reading (milliseconds)
     uint64_t writesCompleted = 0;  // Number of write operations completed
+    uint64_t writesMerged = 0;     // Adjacent writes merged before reaching the device
     uint64_t writeSectors = 0;     // Number of sectors written
     uint64_t writeTimeMs = 0;      // Time spent writing (milliseconds)
-    uint64_t ioInProgressMs = 0;   // I/O operations currently in progress
+    uint64_t ioInFlight = 0;       // I/O requests currently in flight (a gauge, not a counter)
     uint64_t ioTimeMs = 0;         // Total time this device has been active (milliseconds)
-    uint64_t weightedIoTimeMs = 0; // Weighted time of I/O operations
+    uint64_t weightedIoTimeMs = 0; // Sum over requests of time in queue (ms); its rate is the average queue depth
+
+    // Discard (TRIM) and flush counters; Linux 4.18+ and 5.5+ respectively
+    bool hasDiscardStats = false;
+    bool hasFlushStats = false;
+    uint64_t discardsCompleted = 0;
+    uint64_t discardsMerged = 0;
+    uint64_t discardSectors = 0;
+    uint64_t discardTimeMs = 0;
+    uint64_t flushesCompleted = 0;
+    uint64_t flushTimeMs = 0;
 
     // Device info (may not be available on all platforms)
     uint64_t sectorSize = 512;    // Sector size in bytes (typically 512 or 4096)
     bool isPhysicalDevice = true; // False for loop devices, partitions on some systems
 };
 
+/// One mounted filesystem with its capacity counters (statvfs).
+/// Capacity fields are refreshed on a slower cadence than the I/O counters;
+/// capacitySequence changes each time they are re-read.
+struct MountCounters
+{
+    std::string mountPoint;        // e.g., "/", "/home"
+    std::string fsType;            // e.g., "ext4", "xfs", "tmpfs"
+    std::string source;            // Mount source, e.g., "/dev/nvme0n1p2", "tmpfs"
+    std::string deviceName;        // Block device backing the mount ("nvme0n1p2", "dm-0"); empty if virtual
+    std::string diskName;          // Whole disk whose I/O counters cover this mount ("nvme0n1"); empty if unknown
+    uint64_t totalBytes = 0;       // Filesystem size
+    uint64_t freeBytes = 0;        // Free, including blocks reserved for root
+    uint64_t availBytes = 0;       // Free to unprivileged users
+    uint64_t totalInodes = 0;      // 0 on filesystems that allocate inodes dynamically (btrfs)
+    uint64_t freeInodes = 0;       // Free inodes
+    uint64_t capacitySequence = 0; // Incremented on every capacity refresh
+    bool hasCapacity = false;      // statvfs has succeeded at least once
+    bool readOnly = false;         // Mounted read-only
+};
+
 /// Aggregate counters for all disks combined.
 struct SystemDiskCounters
 {
     std::vector<DiskCounters> disks;
+    std::vector<MountCounters> mounts; // Real (non-pseudo) filesystems, if the probe reports them
 
     /// Total reads across all disks
     [[nodiscard]] uint64_t totalReadsCompleted() const
@@ -85,6 +118,7 @@ struct DiskCapabilities
     bool hasIoTime = false;         // Can report time spent in I/O
     bool hasDeviceInfo = false;     // Can report device metadata (size, type)
     bool canFilterPhysical = false; // Can distinguish physical vs virtual devices
+    bool hasMountStats = false;     // Can report per-mount capacity and inodes
 };
 
 } // namespace Platform
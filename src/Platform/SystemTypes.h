@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -49,11 +50,89 @@ struct MemoryCounters
     uint64_t swapFreeBytes = 0;
 };
 
+/// Raw Pressure Stall Information counters for one resource (Linux PSI).
+/// Totals are cumulative stall time in microseconds; the domain turns deltas into
+/// stall percentages rather than using the kernel's exponentially smoothed averages.
+struct PressureCounters
+{
+    bool available = false;   // Resource file exists and parsed
+    bool hasSome = false;     // "some" line present (absent for irq)
+    bool hasFull = false;     // "full" line present (cpu gained it in 5.13)
+    uint64_t someTotalUs = 0; // Time at least one task was stalled on the resource
+    uint64_t fullTotalUs = 0; // Time all non-idle tasks were stalled simultaneously
+};
+
+/// Resources reported by PSI, used to index SystemCounters::pressure.
+enum class PressureResource : std::uint8_t
+{
+    Cpu = 0,
+    Memory,
+    Io,
+    Irq,
+};
+
+inline constexpr std::size_t PRESSURE_RESOURCE_COUNT = 4;
+
+/// Cumulative kernel activity counters, used to index ActivityCounters.
+/// Sources are Linux /proc/stat, /proc/vmstat and /proc/schedstat.
+enum class ActivityCounter : std::uint8_t
+{
+    ContextSwitches = 0, // /proc/stat ctxt
+    ProcessesCreated,    // /proc/stat processes (forks and clones since boot)
+    PageInKiB,           // /proc/vmstat pgpgin (KiB read from block devices)
+    PageOutKiB,          // /proc/vmstat pgpgout (KiB written to block devices)
+    SwapInPages,         // /proc/vmstat pswpin
+    SwapOutPages,        // /proc/vmstat pswpout
+    PageFaults,          // /proc/vmstat pgfault (minor + major)
+    MajorFaults,         // /proc/vmstat pgmajfault
+    OomKills,            // /proc/vmstat oom_kill (4.13+)
+    NumaMigrations,      // /proc/vmstat numa_pages_migrated (CONFIG_NUMA_BALANCING)
+    RunqueueWaitNs,      // /proc/schedstat: time runnable tasks spent waiting for a CPU, summed over CPUs
+    Timeslices,          // /proc/schedstat: timeslices run, summed over CPUs
+};
+
+inline constexpr std::size_t ACTIVITY_COUNTER_COUNT = 12;
+
+/// Raw kernel activity counters. Totals are cumulative since boot; the domain turns
+/// deltas into per-second rates.
+struct ActivityCounters
+{
+    std::array<uint64_t, ACTIVITY_COUNTER_COUNT> totals{}; // Indexed by ActivityCounter
+    std::array<bool, ACTIVITY_COUNTER_COUNT> present{};    // Counter reported by this kernel
+    uint64_t procsRunning = 0;                             // Runnable tasks right now (/proc/stat procs_running)
+    uint64_t procsBlocked = 0;                             // Tasks blocked on I/O right now (/proc/stat procs_blocked)
+    bool hasProcCounts = false;                            // procs_running/procs_blocked were found
+};
+
+/// Raw counters for one NUMA node (Linux /sys/devices/system/node/nodeN).
+/// Allocation counters are cumulative page counts since boot; the domain turns deltas
+/// into rates.
+struct NumaNodeCounters
+{
+    std::uint32_t nodeId = 0;
+    uint64_t memTotalBytes = 0;
+    uint64_t memFreeBytes = 0;
+    uint64_t filePagesBytes = 0; // Page cache resident on this node
+
+    bool hasNumaStat = false;
+    uint64_t numaHit = 0;     // Allocated here, as the allocating task intended
+    uint64_t numaMiss = 0;    // Allocated here although another node was preferred
+    uint64_t numaForeign = 0; // Intended for this node but allocated elsewhere
+    uint64_t localNode = 0;   // Allocated here by a task running on this node
+    uint64_t otherNode = 0;   // Allocated here by a task running on another node
+
+    std::vector<std::uint32_t> cpuIds; // Logical CPUs on this node (cpulist), online or not
+};
+
 /// Combined system counters snapshot.
 struct SystemCounters
 {
     CpuCounters cpuTotal;                // Aggregate across all cores
-    std::vector<CpuCounters> cpuPerCore; // Per-core (optional)
+    std::vector<CpuCounters> cpuPerCore; // Per-core (optional), online cores only
+    /// Logical CPU id of each cpuPerCore entry (parallel to cpuPerCore).
+    /// Empty means ids are the vector positions (probes without hotplug information).
+    /// With CPU hotplug the ids can have gaps, e.g. {0, 1, 3} while cpu2 is offline.
+    std::vector<std::uint32_t> cpuPerCoreIds;
     MemoryCounters memory;
 
     uint64_t uptimeSeconds = 0;
@@ -64,8 +143,20 @@ struct SystemCounters
     double loadAvg5 = 0.0;
     double loadAvg15 = 0.0;
 
-    // CPU frequency in MHz (current, may vary per-core)
+    // CPU frequency in MHz (current; average over cores that report one)
     uint64_t cpuFreqMHz = 0;
+    // Per-core current frequency in MHz, parallel to cpuPerCore (0 = unavailable).
+    // Empty if the probe has no per-core frequency source.
+    std::vector<std::uint32_t> cpuPerCoreFreqMHz;
+
+    // Pressure stall counters, indexed by PressureResource
+    std::array<PressureCounters, PRESSURE_RESOURCE_COUNT> pressure{};
+
+    // Scheduler, paging and fault counters
+    ActivityCounters activity;
+
+    // Online NUMA nodes in ascending id order (empty if the probe has no NUMA information)
+    std::vector<NumaNodeCounters> numaNodes;
 
     // Network counters (cumulative bytes across all interfaces)
     uint64_t netRxBytes = 0; // Total bytes received
@@ -80,6 +171,9 @@ struct SystemCounters
         uint64_t txBytes = 0;       // Cumulative bytes transmitted
         bool isUp = false;          // Interface operational status
         uint64_t linkSpeedMbps = 0; // Link speed in Mbps (0 if unknown)
+        uint32_t ifIndex = 0;       // OS interface index (0 if unknown)
+        uint32_t mtu = 0;           // MTU in bytes (0 if unknown)
+        std::string kind;           // Link driver kind ("veth", "bridge", ...); empty for NICs or if unknown
     };
     std::vector<InterfaceCounters> networkInterfaces;
 
@@ -101,6 +195,9 @@ struct SystemCapabilities
     bool hasLoadAvg = false;
     bool hasCpuFreq = false;
     bool hasNetworkCounters = false; // System-wide network byte counters
+    bool hasPressure = false;        // Pressure stall information (Linux PSI)
+    bool hasActivity = false;        // Scheduler/paging activity counters (Linux /proc/vmstat)
+    bool hasNuma = false;            // Per-NUMA-node memory, CPU and allocation counters
 };
 
 } // namespace Platform
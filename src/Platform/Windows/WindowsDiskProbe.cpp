@@ -198,7 +198,7 @@ SystemDiskCounters WindowsDiskProbe::read()
             disk.writesCompleted = 0;
             disk.writeSectors = 0;
             disk.writeTimeMs = 0;
-            disk.ioInProgressMs = 0;
+            disk.ioInFlight = 0;
             disk.ioTimeMs = 0;
             disk.weightedIoTimeMs = 0;
             disk.sectorSize = 512;
@@ -3,22 +3,44 @@
 #include "D3DKMTGPUProbe.h"
 #include "DXGIGPUProbe.h"
 #include "NVMLGPUProbe.h"
+#include "Platform/GuardedGPUProbe.h"
 
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <future>
+#include <memory>
 #include <ranges>
+#include <utility>
 
 namespace Platform
 {
 
+namespace
+{
+
+std::unique_ptr<GuardedGPUProbe> makeGuardedNVML()
+{
+    auto nvml = std::make_unique<NVMLGPUProbe>();
+    if (!nvml->isAvailable())
+    {
+        return nullptr;
+    }
+    return std::make_unique<GuardedGPUProbe>("NVML", std::move(nvml));
+}
+
+} // namespace
+
 WindowsGPUProbe::WindowsGPUProbe()
-    : m_DXGIProbe(std::make_unique<DXGIGPUProbe>()),
-      m_NVMLProbe(std::make_unique<NVMLGPUProbe>()),
-      m_D3DKMTProbe(std::make_unique<D3DKMTGPUProbe>())
 {
+    // Loading nvml.dll is the slow part; do it while DXGI and D3DKMT initialize here
+    auto nvml = std::async(std::launch::async, makeGuardedNVML);
+    m_DXGIProbe = std::make_unique<DXGIGPUProbe>();
+    m_D3DKMTProbe = std::make_unique<D3DKMTGPUProbe>();
+    m_NVMLProbe = nvml.get();
+
     std::string probeSummary = "DXGI";
-    if (m_NVMLProbe->isAvailable())
+    if (m_NVMLProbe)
     {
         probeSummary += " + NVML";
     }
@@ -39,7 +61,7 @@ std::vector<GPUInfo> WindowsGPUProbe::enumerateGPUs()
         auto gpus = m_DXGIProbe->enumerateGPUs();
 
         // If NVML is available, try to match NVIDIA GPUs for enhanced data
-        if (m_NVMLProbe && m_NVMLProbe->isAvailable())
+        if (m_NVMLProbe)
         {
             auto nvmlGPUs = m_NVMLProbe->enumerateGPUs();
 
@@ -88,7 +110,7 @@ std::vector<GPUCounters> WindowsGPUProbe::readGPUCounters()
     auto counters = m_DXGIProbe->readGPUCounters();
 
     // Merge NVML enhancements for NVIDIA GPUs
-    if (m_NVMLProbe && m_NVMLProbe->isAvailable())
+    if (m_NVMLProbe)
     {
         mergeNVMLEnhancements(counters);
     }
@@ -98,7 +120,7 @@ std::vector<GPUCounters> WindowsGPUProbe::readGPUCounters()
 
 void WindowsGPUProbe::mergeNVMLEnhancements(std::vector<GPUCounters>& dxgiCounters)
 {
-    if (!m_NVMLProbe || !m_NVMLProbe->isAvailable())
+    if (!m_NVMLProbe)
     {
         return;
     }
@@ -172,7 +194,7 @@ GPUCapabilities WindowsGPUProbe::capabilities() const
     }
 
     // Merge NVML capabilities (OR operation - if either supports, we support)
-    if (m_NVMLProbe && m_NVMLProbe->isAvailable())
+    if (m_NVMLProbe)
     {
         auto nvmlCaps = m_NVMLProbe->capabilities();
 
@@ -201,4 +223,13 @@ GPUCapabilities WindowsGPUProbe::capabilities() const
     return caps;
 }
 
+std::vector<GPUBackendHealth> WindowsGPUProbe::backendHealth() const
+{
+    if (!m_NVMLProbe)
+    {
+        return {};
+    }
+    return m_NVMLProbe->backendHealth();
+}
+
 } // namespace Platform
@@ -11,12 +11,13 @@ namespace Platform
 {
 
 class DXGIGPUProbe;
-class NVMLGPUProbe;
 class D3DKMTGPUProbe;
+class GuardedGPUProbe;
 
 /// Composite Windows GPU probe that delegates to vendor-specific probes.
 /// Phase 2: Uses DXGI for basic enumeration + NVML for NVIDIA enhancements
 /// Phase 3: Uses D3DKMT for per-process GPU metrics (all vendors)
+/// NVML runs behind a GuardedGPUProbe so a wedged NVIDIA driver cannot stall sampling.
 class WindowsGPUProbe : public IGPUProbe
 {
   public:
@@ -33,12 +34,13 @@ class WindowsGPUProbe : public IGPUProbe
     [[nodiscard]] std::vector<GPUCounters> readGPUCounters() override;
     [[nodiscard]] std::vector<ProcessGPUCounters> readProcessGPUCounters() override;
     [[nodiscard]] GPUCapabilities capabilities() const override;
+    [[nodiscard]] std::vector<GPUBackendHealth> backendHealth() const override;
 
   private:
     void mergeNVMLEnhancements(std::vector<GPUCounters>& dxgiCounters);
 
     std::unique_ptr<DXGIGPUProbe> m_DXGIProbe;
-    std::unique_ptr<NVMLGPUProbe> m_NVMLProbe;
+    std::unique_ptr<GuardedGPUProbe> m_NVMLProbe; // Null when NVML is not available
     std::unique_ptr<D3DKMTGPUProbe> m_D3DKMTProbe;
 
     // Map DXGI GPU index to NVML GPU index (for merging data)
@@ -583,6 +583,19 @@ uint64_t WindowsProcessProbe::systemTotalMemory() const
     return 0;
 }
 
+bool WindowsProcessProbe::readNumaResidency([[maybe_unused]] int32_t pid, std::vector<uint64_t>& kibPerNode)
+{
+    // Per-node working set needs QueryWorkingSetEx over every page; not worth it for a table column
+    kibPerNode.clear();
+    return false;
+}
+
+EnergyCounters WindowsProcessProbe::readEnergyCounters()
+{
+    // No package energy counters without a kernel driver; energy stays per process (energyMicrojoules)
+    return {};
+}
+
 bool WindowsProcessProbe::detectPowerMonitoring()
 {
     // On Windows, we use a simplified approach: check if we can read battery status
@@ -50,6 +50,8 @@ class WindowsProcessProbe : public IProcessProbe
     [[nodiscard]] uint64_t totalCpuTime() const override;
     [[nodiscard]] long ticksPerSecond() const override;
     [[nodiscard]] uint64_t systemTotalMemory() const override;
+    [[nodiscard]] bool readNumaResidency(int32_t pid, std::vector<uint64_t>& kibPerNode) override;
+    [[nodiscard]] EnergyCounters readEnergyCounters() override;
 
   private:
     bool m_HasPowerMonitoring = false;
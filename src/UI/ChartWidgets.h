@@ -16,6 +16,7 @@
 #include <functional>
 #include <limits>
 #include <optional>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -274,7 +275,7 @@ struct TimeAxisConfig
     double clampedOffset = 0.0;
 };
 
-inline TimeAxisConfig makeTimeAxisConfig(const std::vector<double>& timestamps, double maxHistorySeconds, double desiredOffsetSeconds)
+inline TimeAxisConfig makeTimeAxisConfig(std::span<const double> timestamps, double maxHistorySeconds, double desiredOffsetSeconds)
 {
     TimeAxisConfig cfg;
     cfg.xMin = -maxHistorySeconds;
@@ -296,7 +297,7 @@ inline TimeAxisConfig makeTimeAxisConfig(const std::vector<double>& timestamps,
     return cfg;
 }
 
-inline std::vector<float> buildTimeAxis(const std::vector<double>& timestamps, size_t desiredCount, double nowSeconds)
+inline std::vector<float> buildTimeAxis(std::span<const double> timestamps, size_t desiredCount, double nowSeconds)
 {
     const size_t n = std::min(desiredCount, timestamps.size());
     std::vector<float> timeData(n);
@@ -312,7 +313,7 @@ inline std::vector<float> buildTimeAxis(const std::vector<double>& timestamps, s
     return timeData;
 }
 
-inline std::vector<double> buildTimeAxisDoubles(const std::vector<double>& timestamps, size_t desiredCount, double nowSeconds)
+inline std::vector<double> buildTimeAxisDoubles(std::span<const double> timestamps, size_t desiredCount, double nowSeconds)
 {
     const size_t n = std::min(desiredCount, timestamps.size());
     std::vector<double> timeData(n);
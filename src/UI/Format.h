@@ -675,6 +675,29 @@ struct AlignedBytesParts
     return std::format("{}:{:02}", minutes, secs);
 }
 
+/// Coarse duration for projections ("45s", "12m", "3h 20m", "5d 4h").
+[[nodiscard]] inline auto formatDurationShort(double seconds) -> std::string
+{
+    const auto totalSecs = std::max(0LL, std::llround(seconds));
+    constexpr long long secondsPerDay = 24LL * 60LL * 60LL;
+    constexpr long long secondsPerHour = 60LL * 60LL;
+    constexpr long long secondsPerMinute = 60LL;
+
+    if (totalSecs >= secondsPerDay)
+    {
+        return std::format("{}d {}h", totalSecs / secondsPerDay, (totalSecs % secondsPerDay) / secondsPerHour);
+    }
+    if (totalSecs >= secondsPerHour)
+    {
+        return std::format("{}h {}m", totalSecs / secondsPerHour, (totalSecs % secondsPerHour) / secondsPerMinute);
+    }
+    if (totalSecs >= secondsPerMinute)
+    {
+        return std::format("{}m", totalSecs / secondsPerMinute);
+    }
+    return std::format("{}s", totalSecs);
+}
+
 [[nodiscard]] inline auto formatCpuAffinityMask(std::uint64_t mask) -> std::string
 {
     if (mask == 0)
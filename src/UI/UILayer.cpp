@@ -2,6 +2,7 @@
 
 #include "Core/Application.h"
 #include "Core/Layer.h"
+#include "Core/StartupTrace.h"
 #include "Platform/Factory.h"
 #include "UI/IconsFontAwesome6.h"
 #include "UI/Theme.h"
@@ -246,6 +247,7 @@ void UILayer::onAttach()
 
     // Pre-bake fonts for all size presets
     loadAllFonts();
+    Core::StartupTrace::get().mark("Font atlas");
 
     // Load themes from TOML files (built-ins)
     auto themesDir = getExecutableDir() / "assets" / "themes";
@@ -261,6 +263,7 @@ void UILayer::onAttach()
 
     // Apply default/fallback theme colors (user config will override later)
     Theme::get().applyImGuiStyle();
+    Core::StartupTrace::get().mark("Theme TOML");
 
     // When viewports are enabled we tweak WindowRounding/WindowBg so platform windows can look identical to regular ones
     // NOTE: This alpha override is required by ImGui for multi-viewport support - not a theme color
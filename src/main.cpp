@@ -7,6 +7,7 @@
 #include "App/ShellLayer.h"
 #include "App/UserConfig.h"
 #include "Core/Application.h"
+#include "Core/StartupTrace.h"
 #include "UI/UILayer.h"
 #include "version.h"
 
@@ -63,6 +64,9 @@ void initializeLocale()
 
 auto runApp() -> int
 {
+    auto& startupTrace = Core::StartupTrace::get();
+    startupTrace.begin();
+
     initializeLocale();
 
 // Required on Windows to see console output when launching from an IDE or debugger
@@ -136,9 +140,11 @@ auto runApp() -> int
     spdlog::debug("Built: {} {}", tasksmack::Version::BUILD_DATE, tasksmack::Version::BUILD_TIME);
 
     // Load user configuration early so we can apply window geometry before creating the GLFW window.
+    startupTrace.mark("Logging");
     auto& userConfig = App::UserConfig::get();
     userConfig.load();
     const auto& settings = userConfig.settings();
+    startupTrace.mark("User config");
 
     // Create application
     Core::ApplicationSpecification appSpec;
@@ -159,18 +165,22 @@ auto runApp() -> int
     {
         app.getWindow().maximize();
     }
+    startupTrace.mark("Window");
 
     // Push UI layer (initializes ImGui/ImPlot backends)
     app.pushLayer<UI::UILayer>();
+    startupTrace.mark("UI layer (ImGui backends)");
 
     // Push shell layer (docking workspace with panels)
     app.pushLayer<App::ShellLayer>();
+    startupTrace.mark("Shell layer (panels)");
 
     // About dialog layer (modal overlay)
     app.pushLayer<App::AboutLayer>();
 
     // Settings dialog layer (modal overlay)
     app.pushLayer<App::SettingsLayer>();
+    startupTrace.mark("Dialog layers");
 
     // Run the application
     app.run();
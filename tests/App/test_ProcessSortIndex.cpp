@@ -0,0 +1,140 @@
+/// @file test_ProcessSortIndex.cpp
+/// @brief Tests for App::ProcessSortIndex (cached filter + multi-column sort of process rows)
+///
+/// Tests cover:
+/// - Per-column comparators, including the GPU engine count/set ordering
+/// - Multi-column sort with tie-breaking and a stable PID fallback
+/// - Case-insensitive name filtering and the running count
+/// - Rebuilding only when the generation, filter or sort keys change
+
+#include "App/Panels/ProcessSortIndex.h"
+#include "App/ProcessColumnConfig.h"
+#include "Domain/GPUEngineMask.h"
+#include "Domain/ProcessSnapshot.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace App
+{
+namespace
+{
+
+Domain::ProcessSnapshot makeProcess(std::int32_t pid, const std::string& name, const std::string& user, double cpuPercent)
+{
+    Domain::ProcessSnapshot proc;
+    proc.pid = pid;
+    proc.name = name;
+    proc.user = user;
+    proc.cpuPercent = cpuPercent;
+    proc.displayState = "Sleeping";
+    return proc;
+}
+
+std::vector<std::int32_t> pidsInOrder(const ProcessSortIndex& index, const std::vector<Domain::ProcessSnapshot>& snapshots)
+{
+    std::vector<std::int32_t> pids;
+    for (const std::size_t i : index.indices())
+    {
+        pids.push_back(snapshots[i].pid);
+    }
+    return pids;
+}
+
+TEST(ProcessSortIndexTest, ComparatorsFollowColumnField)
+{
+    const auto low = makeProcess(1, "alpha", "root", 1.0);
+    const auto high = makeProcess(2, "Beta", "alice", 9.0);
+    EXPECT_LT(ProcessSort::compareColumn<ProcessColumn::CpuPercent>(low, high), 0);
+    EXPECT_GT(ProcessSort::compareColumn<ProcessColumn::User>(low, high), 0);
+    EXPECT_EQ(ProcessSort::compareColumn<ProcessColumn::Threads>(low, high), 0);
+
+    // Every column has an instantiated comparator in the dispatch tables
+    for (const ProcessColumn col : allProcessColumns())
+    {
+        EXPECT_NE(ProcessSort::COMPARE_TABLE[toIndex(col)], nullptr);
+        EXPECT_NE(ProcessSort::SORT_TABLE[toIndex(col)], nullptr);
+    }
+}
+
+TEST(ProcessSortIndexTest, GpuEngineSortsByEngineCountFirst)
+{
+    auto one = makeProcess(1, "a", "u", 0.0);
+    auto two = makeProcess(2, "b", "u", 0.0);
+    one.gpuEngines = Domain::GPUEngine::VideoEncode;
+    two.gpuEngines = Domain::GPUEngine::Render | Domain::GPUEngine::Compute;
+    EXPECT_LT(ProcessSort::compareColumn<ProcessColumn::GpuEngine>(one, two), 0);
+}
+
+TEST(ProcessSortIndexTest, SortsDescendingWithPidTieBreak)
+{
+    const std::vector<Domain::ProcessSnapshot> snapshots = {
+        makeProcess(30, "c", "u", 5.0), makeProcess(10, "a", "u", 5.0), makeProcess(20, "b", "u", 50.0)};
+    const std::vector<ProcessSortKey> keys = {{.column = ProcessColumn::CpuPercent, .ascending = false}};
+
+    ProcessSortIndex index;
+    ASSERT_TRUE(index.update(snapshots, 1, "", keys));
+    EXPECT_EQ(pidsInOrder(index, snapshots), (std::vector<std::int32_t>{20, 10, 30}));
+}
+
+TEST(ProcessSortIndexTest, SecondaryKeysBreakTies)
+{
+    const std::vector<Domain::ProcessSnapshot> snapshots = {makeProcess(1, "z", "bob", 1.0),
+                                                            makeProcess(2, "y", "alice", 2.0),
+                                                            makeProcess(3, "x", "bob", 3.0),
+                                                            makeProcess(4, "w", "alice", 0.5)};
+    const std::vector<ProcessSortKey> keys = {{.column = ProcessColumn::User, .ascending = true},
+                                              {.column = ProcessColumn::CpuPercent, .ascending = false}};
+
+    ProcessSortIndex index;
+    (void) index.update(snapshots, 1, "", keys);
+    EXPECT_EQ(pidsInOrder(index, snapshots), (std::vector<std::int32_t>{2, 4, 3, 1}));
+}
+
+TEST(ProcessSortIndexTest, FiltersByNameCaseInsensitively)
+{
+    std::vector<Domain::ProcessSnapshot> snapshots = {
+        makeProcess(1, "Firefox", "u", 0.0), makeProcess(2, "bash", "u", 0.0), makeProcess(3, "firefox-bin", "u", 0.0)};
+    snapshots[1].displayState = "Running";
+
+    ProcessSortIndex index;
+    (void) index.update(snapshots, 1, "FIRE", {});
+    EXPECT_EQ(pidsInOrder(index, snapshots), (std::vector<std::int32_t>{1, 3}));
+    EXPECT_EQ(index.runningCount(), 1U); // Counted before filtering
+
+    (void) index.update(snapshots, 1, "", {});
+    EXPECT_EQ(index.indices().size(), 3U);
+}
+
+TEST(ProcessSortIndexTest, RebuildsOnlyWhenInputsChange)
+{
+    std::vector<Domain::ProcessSnapshot> snapshots = {makeProcess(1, "a", "u", 1.0), makeProcess(2, "b", "u", 2.0)};
+    std::vector<ProcessSortKey> keys = {{.column = ProcessColumn::CpuPercent, .ascending = false}};
+
+    ProcessSortIndex index;
+    EXPECT_TRUE(index.update(snapshots, 7, "", keys));
+    EXPECT_FALSE(index.update(snapshots, 7, "", keys)); // Steady-state frame
+
+    keys[0].ascending = true;
+    EXPECT_TRUE(index.update(snapshots, 7, "", keys));
+    EXPECT_EQ(pidsInOrder(index, snapshots), (std::vector<std::int32_t>{1, 2}));
+
+    EXPECT_TRUE(index.update(snapshots, 7, "a", keys));
+    EXPECT_TRUE(index.update(snapshots, 7, "", keys));
+
+    // New values only take effect with a new data generation
+    snapshots[0].cpuPercent = 5.0;
+    EXPECT_FALSE(index.update(snapshots, 7, "", keys));
+    EXPECT_TRUE(index.update(snapshots, 8, "", keys));
+    EXPECT_EQ(pidsInOrder(index, snapshots), (std::vector<std::int32_t>{2, 1}));
+
+    index.invalidate();
+    EXPECT_TRUE(index.update(snapshots, 8, "", keys));
+}
+
+} // namespace
+} // namespace App
@@ -0,0 +1,163 @@
+/// @file test_StartupTrace.cpp
+/// @brief Tests for Core::StartupTrace
+///
+/// Tests cover:
+/// - Phase recording order and elapsed times
+/// - First-frame marking happens once
+/// - begin() restarts the timeline
+/// - Scope spans on background threads and the Chrome trace file
+/// - Deferred phases from several workers all reach the trace file
+
+#include "Core/StartupTrace.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+TEST(StartupTraceTest, RecordsPhasesInOrder)
+{
+    auto& trace = Core::StartupTrace::get();
+    trace.begin();
+    trace.mark("Window");
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    trace.mark("Shell layer");
+
+    // Consecutive marks tile the thread's timeline
+    const auto phases = trace.phases();
+    ASSERT_EQ(phases.size(), 2U);
+    EXPECT_EQ(phases[0].name, "Window");
+    EXPECT_EQ(phases[1].name, "Shell layer");
+    EXPECT_DOUBLE_EQ(phases[0].startMs, 0.0);
+    EXPECT_DOUBLE_EQ(phases[1].startMs, phases[0].startMs + phases[0].durationMs);
+    EXPECT_GE(phases[1].durationMs, 5.0);
+    EXPECT_EQ(phases[1].thread, 0U);
+}
+
+TEST(StartupTraceTest, FirstFrameIsMarkedOnce)
+{
+    auto& trace = Core::StartupTrace::get();
+    trace.begin();
+    EXPECT_FALSE(trace.firstFrameDone());
+
+    trace.markFirstFrame();
+    trace.markFirstFrame();
+    EXPECT_TRUE(trace.firstFrameDone());
+
+    // Deferred work after the first frame is still recorded
+    trace.mark("GPU backends");
+    const auto phases = trace.phases();
+    ASSERT_EQ(phases.size(), 2U);
+    EXPECT_EQ(phases[0].name, "First frame");
+    EXPECT_EQ(phases[1].name, "GPU backends");
+}
+
+TEST(StartupTraceTest, MarksFromOtherThreadsAreRecorded)
+{
+    auto& trace = Core::StartupTrace::get();
+    trace.begin();
+    std::thread worker([&trace] { trace.mark("Worker"); });
+    worker.join();
+
+    ASSERT_EQ(trace.phases().size(), 1U);
+    EXPECT_EQ(trace.phases()[0].name, "Worker");
+    EXPECT_EQ(trace.phases()[0].thread, 1U);
+}
+
+TEST(StartupTraceTest, ScopeTimesBackgroundWork)
+{
+    auto& trace = Core::StartupTrace::get();
+    trace.begin();
+    std::thread worker(
+        []
+        {
+            const Core::StartupTrace::Scope scope("Seed");
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        });
+    trace.mark("Attach");
+    worker.join();
+
+    const auto phases = trace.phases();
+    ASSERT_EQ(phases.size(), 2U);
+    const auto& seed = phases[0].name == "Seed" ? phases[0] : phases[1];
+    EXPECT_EQ(seed.name, "Seed");
+    EXPECT_GE(seed.durationMs, 5.0);
+    EXPECT_NE(seed.thread, 0U);
+}
+
+TEST(StartupTraceTest, ProfilingModeWritesChromeTrace)
+{
+    const auto path = std::filesystem::temp_directory_path() / "tasksmack_startup_trace_test.json";
+    std::filesystem::remove(path);
+
+    auto& trace = Core::StartupTrace::get();
+    trace.begin();
+    trace.setTraceFile(path);
+    trace.mark("Window \"main\"");
+    trace.markFirstFrame();
+    trace.mark("Deferred");
+    trace.setTraceFile({});
+
+    std::ifstream in(path);
+    const std::string json((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Window \\\"main\\\"\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"First frame\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"Deferred\""), std::string::npos);
+    std::filesystem::remove(path);
+}
+
+TEST(StartupTraceTest, DeferredPhasesFromWorkersAllReachTheTraceFile)
+{
+    const auto path = std::filesystem::temp_directory_path() / "tasksmack_startup_trace_workers.json";
+    std::filesystem::remove(path);
+
+    auto& trace = Core::StartupTrace::get();
+    trace.begin();
+    trace.setTraceFile(path);
+    trace.markFirstFrame();
+
+    constexpr int WORKERS = 4;
+    std::vector<std::thread> workers;
+    for (int i = 0; i < WORKERS; ++i)
+    {
+        workers.emplace_back([i]() { const Core::StartupTrace::Scope scope("Worker " + std::to_string(i)); });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    trace.setTraceFile({});
+
+    // Writes run outside the timeline lock but one at a time; the last one has every phase
+    std::ifstream in(path);
+    const std::string json((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    EXPECT_TRUE(json.ends_with("]}\n"));
+    for (int i = 0; i < WORKERS; ++i)
+    {
+        EXPECT_NE(json.find("\"name\":\"Worker " + std::to_string(i) + "\""), std::string::npos) << i;
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(StartupTraceTest, BeginRestartsTimeline)
+{
+    auto& trace = Core::StartupTrace::get();
+    trace.begin();
+    trace.mark("Old");
+    trace.markFirstFrame();
+
+    trace.begin();
+    EXPECT_TRUE(trace.phases().empty());
+    EXPECT_FALSE(trace.firstFrameDone());
+}
+
+} // namespace
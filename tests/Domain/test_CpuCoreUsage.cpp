@@ -0,0 +1,325 @@
+/// @file test_CpuCoreUsage.cpp
+/// @brief Tests for Domain::CpuCoreUsage (SoA per-core CPU computation)
+///
+/// Tests cover:
+/// - SoA transpose of probe counters
+/// - Percentages for known deltas (including non-multiple-of-4 core counts)
+/// - Zero-delta and backwards-counter handling
+/// - Slots keyed by logical CPU id (hotplug / offline cores)
+/// - Agreement with SystemModel's aggregate CPU calculation on random input
+
+#include "Domain/CpuCoreUsage.h"
+#include "Domain/SystemModel.h"
+#include "Mocks/MockProbes.h"
+#include "Platform/SystemTypes.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+using TestMocks::makeCpuCounters;
+
+namespace
+{
+
+Domain::CpuCoreUsage::UsageArrays computeFor(const std::vector<Platform::CpuCounters>& previous,
+                                             const std::vector<Platform::CpuCounters>& current)
+{
+    Domain::CpuCoreUsage::CounterArrays prev;
+    Domain::CpuCoreUsage::CounterArrays cur;
+    prev.assign(previous, {});
+    cur.assign(current, {});
+
+    Domain::CpuCoreUsage::UsageArrays usage;
+    Domain::CpuCoreUsage::compute(cur, prev, usage);
+    return usage;
+}
+
+} // namespace
+
+// =============================================================================
+// Layout
+// =============================================================================
+
+TEST(CpuCoreUsageTest, AssignTransposesCounters)
+{
+    Platform::CpuCounters core;
+    core.user = 1;
+    core.nice = 2;
+    core.system = 3;
+    core.idle = 4;
+    core.iowait = 5;
+    core.irq = 6;
+    core.softirq = 7;
+    core.steal = 8;
+    core.guest = 9;
+    core.guestNice = 10;
+
+    Domain::CpuCoreUsage::CounterArrays arrays;
+    arrays.assign({Platform::CpuCounters{}, core}, {});
+
+    ASSERT_EQ(arrays.size(), 2U);
+    EXPECT_EQ(arrays.user[1], 1U);
+    EXPECT_EQ(arrays.nice[1], 2U);
+    EXPECT_EQ(arrays.system[1], 3U);
+    EXPECT_EQ(arrays.idle[1], 4U);
+    EXPECT_EQ(arrays.iowait[1], 5U);
+    EXPECT_EQ(arrays.irq[1], 6U);
+    EXPECT_EQ(arrays.softirq[1], 7U);
+    EXPECT_EQ(arrays.steal[1], 8U);
+    EXPECT_EQ(arrays.guest[1], 9U);
+    EXPECT_EQ(arrays.guestNice[1], 10U);
+
+    EXPECT_EQ(arrays.online[0], 1U);
+    EXPECT_EQ(arrays.online[1], 1U);
+
+    // Fewer cores never shrinks the slots; missing slots are marked offline
+    arrays.assign({core}, {});
+    EXPECT_EQ(arrays.size(), 2U);
+    EXPECT_EQ(arrays.online[0], 1U);
+    EXPECT_EQ(arrays.online[1], 0U);
+}
+
+TEST(CpuCoreUsageTest, AssignPlacesCoresByLogicalId)
+{
+    const auto core = makeCpuCounters(7, 0, 0, 0);
+
+    // cpu2 offline: /proc/stat lists cpu0, cpu1, cpu3
+    Domain::CpuCoreUsage::CounterArrays arrays;
+    arrays.assign({core, core, core}, {0, 1, 3});
+
+    ASSERT_EQ(arrays.size(), 4U);
+    EXPECT_EQ(arrays.online[2], 0U);
+    EXPECT_EQ(arrays.online[3], 1U);
+    EXPECT_EQ(arrays.user[3], 7U);
+}
+
+// =============================================================================
+// Percentages
+// =============================================================================
+
+TEST(CpuCoreUsageTest, ComputesKnownPercentagesAcrossVectorTail)
+{
+    // 7 cores: one full 4-wide block plus a 3-core tail
+    std::vector<Platform::CpuCounters> previous;
+    std::vector<Platform::CpuCounters> current;
+    for (std::uint64_t i = 0; i < 7; ++i)
+    {
+        previous.push_back(makeCpuCounters(1000, 0, 1000, 1000));
+        // Busy = (i * 10)% split evenly between user and system
+        const std::uint64_t busy = i * 10;
+        current.push_back(makeCpuCounters(1000 + (busy / 2), 0, 1000 + (busy / 2), 1000 + (100 - busy)));
+    }
+
+    const auto usage = computeFor(previous, current);
+    ASSERT_EQ(usage.size(), 7U);
+    for (std::size_t i = 0; i < 7; ++i)
+    {
+        const double busy = static_cast<double>(i) * 10.0;
+        EXPECT_NEAR(usage.totalPercent[i], busy, 1e-9) << "core " << i;
+        EXPECT_NEAR(usage.userPercent[i], busy / 2.0, 1e-9) << "core " << i;
+        EXPECT_NEAR(usage.systemPercent[i], busy / 2.0, 1e-9) << "core " << i;
+        EXPECT_NEAR(usage.idlePercent[i], 100.0 - busy, 1e-9) << "core " << i;
+    }
+}
+
+TEST(CpuCoreUsageTest, UserIncludesNiceAndIowaitStealReported)
+{
+    Platform::CpuCounters prev{};
+    Platform::CpuCounters cur{};
+    cur.user = 10;
+    cur.nice = 10;
+    cur.system = 10;
+    cur.idle = 50;
+    cur.iowait = 10;
+    cur.steal = 10;
+
+    const auto usage = computeFor({prev, prev, prev, prev, prev}, {cur, cur, cur, cur, cur});
+    for (std::size_t i = 0; i < usage.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(usage.userPercent[i], 20.0);
+        EXPECT_DOUBLE_EQ(usage.systemPercent[i], 10.0);
+        EXPECT_DOUBLE_EQ(usage.idlePercent[i], 50.0);
+        EXPECT_DOUBLE_EQ(usage.iowaitPercent[i], 10.0);
+        EXPECT_DOUBLE_EQ(usage.stealPercent[i], 10.0);
+        EXPECT_DOUBLE_EQ(usage.totalPercent[i], 50.0);
+    }
+}
+
+TEST(CpuCoreUsageTest, ZeroDeltaReportsZero)
+{
+    const std::vector<Platform::CpuCounters> same(8, makeCpuCounters(100, 0, 100, 100));
+    const auto usage = computeFor(same, same);
+
+    ASSERT_EQ(usage.size(), 8U);
+    for (std::size_t i = 0; i < usage.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(usage.totalPercent[i], 0.0);
+        EXPECT_DOUBLE_EQ(usage.idlePercent[i], 0.0);
+    }
+}
+
+TEST(CpuCoreUsageTest, BackwardsCounterContributesZero)
+{
+    // Per-CPU iowait can decrease between reads; it must not wrap to a huge delta
+    Platform::CpuCounters prev = makeCpuCounters(100, 0, 100, 100);
+    prev.iowait = 500;
+    Platform::CpuCounters cur = makeCpuCounters(150, 0, 100, 150);
+    cur.iowait = 400;
+
+    const std::vector<Platform::CpuCounters> previous(5, prev);
+    const std::vector<Platform::CpuCounters> current(5, cur);
+    const auto usage = computeFor(previous, current);
+
+    for (std::size_t i = 0; i < usage.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(usage.iowaitPercent[i], 0.0);
+        EXPECT_DOUBLE_EQ(usage.userPercent[i], 50.0);
+        EXPECT_DOUBLE_EQ(usage.totalPercent[i], 50.0);
+    }
+}
+
+TEST(CpuCoreUsageTest, NewlyOnlineCoresReportZeroUntilSecondSample)
+{
+    const std::vector<Platform::CpuCounters> previous(3, makeCpuCounters(0, 0, 0, 0));
+    const std::vector<Platform::CpuCounters> current(6, makeCpuCounters(10, 0, 0, 10));
+
+    const auto usage = computeFor(previous, current);
+    ASSERT_EQ(usage.size(), 6U);
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_DOUBLE_EQ(usage.totalPercent[i], 50.0);
+    }
+    for (std::size_t i = 3; i < 6; ++i)
+    {
+        EXPECT_DOUBLE_EQ(usage.totalPercent[i], 0.0);
+        EXPECT_EQ(usage.online[i], 1U);
+    }
+}
+
+TEST(CpuCoreUsageTest, OfflineCoreDoesNotShiftOthers)
+{
+    // 9 slots so the offline core lands inside a full 4-wide block
+    std::vector<Platform::CpuCounters> previous;
+    std::vector<std::uint32_t> previousIds;
+    std::vector<Platform::CpuCounters> current;
+    std::vector<std::uint32_t> currentIds;
+    for (std::uint32_t id = 0; id < 9; ++id)
+    {
+        previous.push_back(makeCpuCounters(0, 0, 0, 0));
+        previousIds.push_back(id);
+        if (id == 2)
+        {
+            continue; // cpu2 goes offline
+        }
+        // Core N is N*10% busy
+        current.push_back(makeCpuCounters(id * 10, 0, 0, 100 - (id * 10)));
+        currentIds.push_back(id);
+    }
+
+    Domain::CpuCoreUsage::CounterArrays prev;
+    Domain::CpuCoreUsage::CounterArrays cur;
+    prev.assign(previous, previousIds);
+    cur.assign(current, currentIds);
+
+    Domain::CpuCoreUsage::UsageArrays usage;
+    Domain::CpuCoreUsage::compute(cur, prev, usage);
+
+    ASSERT_EQ(usage.size(), 9U);
+    EXPECT_EQ(usage.online[2], 0U);
+    EXPECT_DOUBLE_EQ(usage.totalPercent[2], 0.0);
+    EXPECT_DOUBLE_EQ(usage.idlePercent[2], 0.0);
+    for (std::uint32_t id = 0; id < 9; ++id)
+    {
+        if (id != 2)
+        {
+            EXPECT_NEAR(usage.totalPercent[id], id * 10.0, 1e-9) << "core " << id;
+            EXPECT_EQ(usage.online[id], 1U);
+        }
+    }
+}
+
+TEST(CpuCoreUsageTest, ToCpuUsageCopiesAllFields)
+{
+    Domain::CpuCoreUsage::UsageArrays usage;
+    usage.resize(1);
+    usage.totalPercent[0] = 1.0;
+    usage.userPercent[0] = 2.0;
+    usage.systemPercent[0] = 3.0;
+    usage.idlePercent[0] = 4.0;
+    usage.iowaitPercent[0] = 5.0;
+    usage.stealPercent[0] = 6.0;
+
+    std::vector<Domain::CpuUsage> out;
+    Domain::CpuCoreUsage::toCpuUsage(usage, out);
+
+    ASSERT_EQ(out.size(), 1U);
+    EXPECT_DOUBLE_EQ(out[0].totalPercent, 1.0);
+    EXPECT_DOUBLE_EQ(out[0].userPercent, 2.0);
+    EXPECT_DOUBLE_EQ(out[0].systemPercent, 3.0);
+    EXPECT_DOUBLE_EQ(out[0].idlePercent, 4.0);
+    EXPECT_DOUBLE_EQ(out[0].iowaitPercent, 5.0);
+    EXPECT_DOUBLE_EQ(out[0].stealPercent, 6.0);
+}
+
+// =============================================================================
+// Agreement with SystemModel aggregate calculation
+// =============================================================================
+
+TEST(CpuCoreUsageTest, MatchesAggregateCalculationOnRandomInput)
+{
+    // Feed each random core as the aggregate of a SystemModel and compare with the
+    // per-core SoA result for the same counters.
+    std::mt19937_64 rng(1234);
+    std::uniform_int_distribution<std::uint64_t> base(0, 1'000'000);
+    std::uniform_int_distribution<std::uint64_t> step(0, 500);
+
+    constexpr std::size_t CORE_COUNT = 37;
+    std::vector<Platform::CpuCounters> previous(CORE_COUNT);
+    std::vector<Platform::CpuCounters> current(CORE_COUNT);
+    for (std::size_t i = 0; i < CORE_COUNT; ++i)
+    {
+        auto& p = previous[i];
+        auto& c = current[i];
+        for (auto [pf, cf] : {std::pair{&p.user, &c.user},
+                              std::pair{&p.nice, &c.nice},
+                              std::pair{&p.system, &c.system},
+                              std::pair{&p.idle, &c.idle},
+                              std::pair{&p.iowait, &c.iowait},
+                              std::pair{&p.irq, &c.irq},
+                              std::pair{&p.softirq, &c.softirq},
+                              std::pair{&p.steal, &c.steal},
+                              std::pair{&p.guest, &c.guest},
+                              std::pair{&p.guestNice, &c.guestNice}})
+        {
+            *pf = base(rng);
+            *cf = *pf + step(rng);
+        }
+    }
+
+    const auto usage = computeFor(previous, current);
+    ASSERT_EQ(usage.size(), CORE_COUNT);
+
+    for (std::size_t i = 0; i < CORE_COUNT; ++i)
+    {
+        Domain::SystemModel model(nullptr);
+        Platform::SystemCounters first;
+        first.cpuTotal = previous[i];
+        Platform::SystemCounters second;
+        second.cpuTotal = current[i];
+        model.updateFromCounters(first, 0.0);
+        model.updateFromCounters(second, 1.0);
+        const auto expected = model.snapshot().cpuTotal;
+
+        EXPECT_NEAR(usage.totalPercent[i], expected.totalPercent, 1e-9) << "core " << i;
+        EXPECT_NEAR(usage.userPercent[i], expected.userPercent, 1e-9) << "core " << i;
+        EXPECT_NEAR(usage.systemPercent[i], expected.systemPercent, 1e-9) << "core " << i;
+        EXPECT_NEAR(usage.idlePercent[i], expected.idlePercent, 1e-9) << "core " << i;
+        EXPECT_NEAR(usage.iowaitPercent[i], expected.iowaitPercent, 1e-9) << "core " << i;
+        EXPECT_NEAR(usage.stealPercent[i], expected.stealPercent, 1e-9) << "core " << i;
+    }
+}
@@ -0,0 +1,178 @@
+/// @file test_EnergyAttribution.cpp
+/// @brief Tests for Domain::EnergyAttribution (per-interval package energy split by CPU time)
+///
+/// Tests cover:
+/// - Baseline-only first interval and zone layout changes
+/// - RAPL counter wraparound at max_energy_range_uj
+/// - Per-package attribution on multi-package hosts, including DRAM energy
+/// - Single-package hosts charging processes with an unknown CPU
+/// - ProcessModel using package counters instead of cumulative CPU time
+
+#include "Domain/EnergyAttribution.h"
+#include "Domain/ProcessModel.h"
+#include "Mocks/MockProbes.h"
+#include "Platform/ProcessTypes.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using Domain::EnergyAttribution;
+using Platform::EnergyDomain;
+
+Platform::EnergyZoneCounters zone(std::int32_t package, EnergyDomain domain, std::uint64_t energyUj, std::uint64_t maxRangeUj = 0)
+{
+    return {.package = package, .domain = domain, .energyMicrojoules = energyUj, .maxEnergyRangeMicrojoules = maxRangeUj};
+}
+
+} // namespace
+
+TEST(EnergyAttributionTest, CounterDeltaHandlesWrap)
+{
+    EXPECT_EQ(EnergyAttribution::counterDelta(100, 250, 1000), 150U);
+    EXPECT_EQ(EnergyAttribution::counterDelta(900, 50, 1000), 150U);
+    // Going backwards without a known range is a reset, not energy
+    EXPECT_EQ(EnergyAttribution::counterDelta(900, 50, 0), 0U);
+}
+
+TEST(EnergyAttributionTest, FirstIntervalOnlyRecordsBaseline)
+{
+    EnergyAttribution energy;
+    energy.beginInterval({.zones = {zone(0, EnergyDomain::Package, 5'000'000)}, .cpuPackage = {0}}, 1.0);
+    EXPECT_FALSE(energy.hasInterval());
+    EXPECT_TRUE(energy.packagePower().empty());
+
+    const std::size_t package = energy.packageOf(0);
+    energy.addCpuTime(package, 10);
+    EXPECT_DOUBLE_EQ(energy.watts(package, 10), 0.0);
+}
+
+TEST(EnergyAttributionTest, SplitsIntervalEnergyByIntervalCpuTime)
+{
+    EnergyAttribution energy;
+    energy.beginInterval({.zones = {zone(0, EnergyDomain::Package, 1'000'000)}, .cpuPackage = {0, 0}}, 1.0);
+    // 20 J over 2 s on the package = 10 W
+    energy.beginInterval({.zones = {zone(0, EnergyDomain::Package, 21'000'000)}, .cpuPackage = {0, 0}}, 2.0);
+    ASSERT_TRUE(energy.hasInterval());
+
+    const std::size_t package = energy.packageOf(1);
+    energy.addCpuTime(package, 30);
+    energy.addCpuTime(package, 10);
+
+    EXPECT_DOUBLE_EQ(energy.watts(package, 30), 7.5);
+    EXPECT_DOUBLE_EQ(energy.watts(package, 10), 2.5);
+    EXPECT_DOUBLE_EQ(energy.watts(package, 0), 0.0);
+}
+
+TEST(EnergyAttributionTest, WrappedCounterStillAttributesEnergy)
+{
+    constexpr std::uint64_t MAX_RANGE = 262'143'328'850;
+    EnergyAttribution energy;
+    energy.beginInterval({.zones = {zone(0, EnergyDomain::Package, MAX_RANGE - 1'000'000, MAX_RANGE)}, .cpuPackage = {0}}, 1.0);
+    energy.beginInterval({.zones = {zone(0, EnergyDomain::Package, 3'000'000, MAX_RANGE)}, .cpuPackage = {0}}, 1.0);
+
+    const auto power = energy.packagePower();
+    ASSERT_EQ(power.size(), 1U);
+    EXPECT_DOUBLE_EQ(power[0].packageWatts, 4.0);
+}
+
+TEST(EnergyAttributionTest, AttributesEachPackageToItsOwnCpus)
+{
+    const std::vector<std::int32_t> cpuPackage = {0, 0, 1, 1};
+    EnergyAttribution energy;
+    energy.beginInterval({.zones = {zone(0, EnergyDomain::Package, 0),
+                                    zone(0, EnergyDomain::Core, 0),
+                                    zone(0, EnergyDomain::Dram, 0),
+                                    zone(1, EnergyDomain::Package, 0),
+                                    zone(1, EnergyDomain::Dram, 0)},
+                          .cpuPackage = cpuPackage},
+                         1.0);
+    energy.beginInterval({.zones = {zone(0, EnergyDomain::Package, 40'000'000),
+                                    zone(0, EnergyDomain::Core, 30'000'000),
+                                    zone(0, EnergyDomain::Dram, 8'000'000),
+                                    zone(1, EnergyDomain::Package, 10'000'000),
+                                    zone(1, EnergyDomain::Dram, 2'000'000)},
+                          .cpuPackage = cpuPackage},
+                         1.0);
+
+    const std::size_t first = energy.packageOf(1);
+    const std::size_t second = energy.packageOf(2);
+    ASSERT_NE(first, second);
+    EXPECT_EQ(energy.packageOf(-1), EnergyAttribution::NO_PACKAGE);
+
+    // A busy process on package 1 gets none of package 0's energy
+    energy.addCpuTime(first, 5);
+    energy.addCpuTime(second, 95);
+    EXPECT_DOUBLE_EQ(energy.watts(first, 5), 48.0); // Package 0: 40 W + 8 W DRAM, one process
+    EXPECT_DOUBLE_EQ(energy.watts(second, 95), 12.0);
+
+    const auto power = energy.packagePower();
+    ASSERT_EQ(power.size(), 2U);
+    EXPECT_EQ(power[0].package, 0);
+    EXPECT_DOUBLE_EQ(power[0].packageWatts, 40.0);
+    EXPECT_DOUBLE_EQ(power[0].coreWatts, 30.0);
+    EXPECT_DOUBLE_EQ(power[0].dramWatts, 8.0);
+    EXPECT_DOUBLE_EQ(power[1].packageWatts, 10.0);
+}
+
+TEST(EnergyAttributionTest, SinglePackageChargesUnknownCpu)
+{
+    EnergyAttribution energy;
+    energy.beginInterval({.zones = {zone(0, EnergyDomain::Package, 0)}, .cpuPackage = {}}, 1.0);
+    energy.beginInterval({.zones = {zone(0, EnergyDomain::Package, 6'000'000)}, .cpuPackage = {}}, 1.0);
+
+    const std::size_t package = energy.packageOf(-1);
+    ASSERT_NE(package, EnergyAttribution::NO_PACKAGE);
+    energy.addCpuTime(package, 1);
+    EXPECT_DOUBLE_EQ(energy.watts(package, 1), 6.0);
+}
+
+TEST(EnergyAttributionTest, LayoutChangeRestartsBaseline)
+{
+    EnergyAttribution energy;
+    energy.beginInterval({.zones = {zone(0, EnergyDomain::Package, 0)}, .cpuPackage = {0}}, 1.0);
+    energy.beginInterval({.zones = {zone(0, EnergyDomain::Package, 1'000'000), zone(0, EnergyDomain::Dram, 500)}, .cpuPackage = {0}}, 1.0);
+    EXPECT_FALSE(energy.hasInterval());
+}
+
+TEST(EnergyAttributionTest, ProcessModelUsesIntervalCpuTimeNotLifetime)
+{
+    auto probe = std::make_unique<TestMocks::MockProcessProbe>();
+    auto* rawProbe = probe.get();
+
+    // pid 1 has a long history but is idle; pid 2 is new and busy
+    rawProbe->withCpuTime(1, 1'000'000, 0).withLastCpu(1, 0);
+    rawProbe->withCpuTime(2, 10, 0).withLastCpu(2, 0);
+    rawProbe->setTotalCpuTime(1'000'000);
+    rawProbe->withEnergyCounters({.zones = {zone(0, EnergyDomain::Package, 0)}, .cpuPackage = {0}});
+
+    Domain::ProcessModel model(std::move(probe));
+    model.refresh();
+
+    rawProbe->withCpuTime(2, 110, 0);
+    rawProbe->setTotalCpuTime(1'000'100);
+    rawProbe->withEnergyCounters({.zones = {zone(0, EnergyDomain::Package, 5'000'000)}, .cpuPackage = {0}});
+    model.refresh();
+
+    const auto snapshots = model.snapshots();
+    ASSERT_EQ(snapshots.size(), 2U);
+    for (const auto& snapshot : snapshots)
+    {
+        if (snapshot.pid == 1)
+        {
+            EXPECT_DOUBLE_EQ(snapshot.powerWatts, 0.0);
+        }
+        else
+        {
+            EXPECT_GT(snapshot.powerWatts, 0.0);
+        }
+    }
+    ASSERT_EQ(model.packagePower().size(), 1U);
+}
@@ -8,6 +8,7 @@
 /// - PCIe bandwidth rate calculations from counter deltas
 /// - Multi-GPU scenarios
 /// - Capability reporting
+/// - Columnar history and retention
 /// - Thread-safe operations
 
 #include "Domain/GPUModel.h"
@@ -16,6 +17,7 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <thread>
@@ -273,15 +275,15 @@ TEST(GPUModelTest, HistoryMaintainedPerGPU)
     model.refresh();
 
     // Check history for each GPU
-    auto hist0 = model.history("GPU0");
-    auto hist1 = model.history("GPU1");
+    auto hist0 = model.utilizationHistory("GPU0");
+    auto hist1 = model.utilizationHistory("GPU1");
 
     EXPECT_EQ(hist0.size(), 2);
     EXPECT_EQ(hist1.size(), 2);
 
     // Verify latest values (last element in vector)
-    EXPECT_DOUBLE_EQ(hist0.back().utilizationPercent, 60.0);
-    EXPECT_DOUBLE_EQ(hist1.back().utilizationPercent, 80.0);
+    EXPECT_FLOAT_EQ(hist0.back(), 60.0F);
+    EXPECT_FLOAT_EQ(hist1.back(), 80.0F);
 }
 
 // =============================================================================
@@ -371,8 +373,8 @@ TEST(GPUModelTest, HistoryForNonexistentGPUReturnsEmpty)
     Domain::GPUModel model(std::move(probe));
     model.refresh();
 
-    auto hist = model.history("NonexistentGPU");
-    EXPECT_EQ(hist.size(), 0);
+    const auto history = model.historyView();
+    EXPECT_TRUE(history.series("NonexistentGPU", Domain::GPUMetric::UtilizationPercent).empty());
 }
 
 // =============================================================================
@@ -727,6 +729,56 @@ TEST(GPUModelTest, HistoryAccessorsWorkWithMultipleGPUs)
     EXPECT_FLOAT_EQ(hist1[0], 75.0F);
 }
 
+TEST(GPUModelTest, HistoryViewSharesTimestampsAcrossGPUs)
+{
+    auto probe = std::make_unique<MockGPUProbe>();
+    auto* rawProbe = probe.get();
+    rawProbe->withGPU("GPU0", "GPU Zero", "VendorA").withUtilization("GPU0", 10.0);
+
+    Domain::GPUModel model(std::move(probe));
+    model.refresh();
+
+    // A GPU that starts reporting later gets columns aligned at the newest end
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    rawProbe->withGPUCounters("GPU1", makeGPUCounters("GPU1", 90.0)).withUtilization("GPU0", 20.0);
+    model.refresh();
+
+    const auto history = model.historyView();
+    const auto timestamps = history.timestamps();
+    const auto util0 = history.series("GPU0", Domain::GPUMetric::UtilizationPercent);
+    const auto util1 = history.series("GPU1", Domain::GPUMetric::UtilizationPercent);
+
+    ASSERT_EQ(timestamps.size(), 2);
+    ASSERT_EQ(util0.size(), 2);
+    ASSERT_EQ(util1.size(), 1);
+    EXPECT_FLOAT_EQ(util0[0], 10.0F);
+    EXPECT_FLOAT_EQ(util0[1], 20.0F);
+    EXPECT_FLOAT_EQ(util1[0], 90.0F);
+    EXPECT_FLOAT_EQ(history.series("GPU1", Domain::GPUMetric::TemperatureC)[0], 60.0F);
+}
+
+TEST(GPUModelTest, HistoryRetentionFollowsMaxHistorySeconds)
+{
+    auto probe = std::make_unique<MockGPUProbe>();
+    probe->withGPU("GPU0", "Test GPU", "TestVendor");
+
+    Domain::GPUModel model(std::move(probe));
+    model.setMaxHistorySeconds(0.05);
+
+    model.refresh();
+    model.refresh();
+    EXPECT_EQ(model.historyTimestamps().size(), 2);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    model.refresh();
+
+    // Rows older than the window are dropped from the timestamps and every column
+    const auto history = model.historyView();
+    EXPECT_EQ(history.timestamps().size(), 1);
+    EXPECT_EQ(history.series("GPU0", Domain::GPUMetric::UtilizationPercent).size(), 1);
+    EXPECT_EQ(history.series("GPU0", Domain::GPUMetric::FanSpeed).size(), 1);
+}
+
 // =============================================================================
 // Thread Safety Tests for History Accessors
 // =============================================================================
@@ -790,4 +842,120 @@ TEST(GPUModelTest, ConcurrentHistoryAccessDuringRefresh)
     EXPECT_FALSE(hadError.load());
 }
 
+// =============================================================================
+// Asynchronous Refresh Tests
+// =============================================================================
+
+TEST(GPUModelTest, RefreshAsyncPublishesSnapshots)
+{
+    auto probe = std::make_unique<MockGPUProbe>();
+    probe->withGPU("GPU0", "Test GPU");
+    Domain::GPUModel model(std::move(probe));
+
+    model.refreshAsync();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (model.refreshPending() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_FALSE(model.refreshPending());
+    EXPECT_EQ(model.snapshots().size(), 1U);
+    EXPECT_TRUE(model.backendHealth().empty()); // Mock has no guarded backends
+}
+
+TEST(GPUModelTest, HungProbeDoesNotStallFrames)
+{
+    auto probe = std::make_unique<MockGPUProbe>();
+    probe->withGPU("GPU0", "Test GPU");
+    auto* rawProbe = probe.get();
+    Domain::GPUModel model(std::move(probe));
+    model.refresh();
+
+    rawProbe->holdReads();
+
+    // Simulated UI frames: queue a refresh and read everything the GPU section reads
+    for (int frame = 0; frame < 20; ++frame)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        model.refreshAsync();
+        const auto snapshots = model.snapshots();
+        const auto infos = model.gpuInfo();
+        const auto health = model.backendHealth();
+        {
+            const auto history = model.historyView();
+            EXPECT_EQ(history.series("GPU0", Domain::GPUMetric::UtilizationPercent).size(), history.timestamps().size());
+        }
+        const auto frameTime = std::chrono::steady_clock::now() - start;
+
+        EXPECT_EQ(snapshots.size(), 1U);
+        EXPECT_LT(frameTime, std::chrono::milliseconds(20)) << "frame " << frame;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Only the first queued refresh reached the hung probe; the rest were skipped
+    EXPECT_TRUE(model.refreshPending());
+    EXPECT_EQ(rawProbe->readCountersCallCount(), 2U);
+
+    rawProbe->releaseReads();
+}
+
+TEST(GPUModelTest, FactoryDefersDiscoveryToWorker)
+{
+    std::atomic<int> factoryCalls{0};
+    std::thread::id factoryThread;
+    const auto modelPtr = Domain::GPUModel::withDeferredDiscovery(
+        [&]() -> std::unique_ptr<Platform::IGPUProbe>
+        {
+            ++factoryCalls;
+            factoryThread = std::this_thread::get_id();
+            std::this_thread::sleep_for(std::chrono::milliseconds(50)); // Slow vendor dlopen
+            auto probe = std::make_unique<MockGPUProbe>();
+            probe->withGPU("GPU0", "Test GPU").withCapabilities({.hasPerProcessMetrics = true});
+            return probe;
+        });
+    auto& model = *modelPtr;
+
+    // Nothing is discovered until the first refreshAsync()
+    EXPECT_FALSE(model.isReady());
+    EXPECT_TRUE(model.gpuInfo().empty());
+    EXPECT_TRUE(model.snapshots().empty());
+    EXPECT_EQ(factoryCalls.load(), 0);
+
+    const auto start = std::chrono::steady_clock::now();
+    model.refreshAsync();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (model.refreshPending() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_TRUE(model.isReady());
+    EXPECT_EQ(factoryCalls.load(), 1);
+    EXPECT_NE(factoryThread, std::this_thread::get_id());
+    EXPECT_EQ(model.gpuInfo().size(), 1U);
+    EXPECT_EQ(model.snapshots().size(), 1U);
+    EXPECT_TRUE(model.capabilities().hasPerProcessMetrics);
+}
+
+TEST(GPUModelTest, FactoryReturningNullLeavesModelEmpty)
+{
+    const auto modelPtr = Domain::GPUModel::withDeferredDiscovery([] { return std::unique_ptr<Platform::IGPUProbe>{}; });
+    auto& model = *modelPtr;
+    model.refreshAsync();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (model.refreshPending() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_TRUE(model.isReady());
+    EXPECT_TRUE(model.gpuInfo().empty());
+    model.refreshAsync(); // Ready without a probe: nothing to queue
+    EXPECT_FALSE(model.refreshPending());
+}
+
 } // namespace
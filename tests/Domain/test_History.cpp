@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <array>
 #include <string>
 
@@ -385,5 +386,98 @@ TEST(HistoryTest, LargeNumberOfPushes)
     EXPECT_EQ(history.latest(), 9999);
 }
 
+// =============================================================================
+// SpanHistory
+// =============================================================================
+
+TEST(SpanHistoryTest, DefaultConstructedIsEmpty)
+{
+    const SpanHistory<int> history;
+    EXPECT_TRUE(history.empty());
+    EXPECT_TRUE(history.view().empty());
+    EXPECT_EQ(history.capacity(), 0U);
+    EXPECT_EQ(history.latest(), 0);
+}
+
+TEST(SpanHistoryTest, ViewIsChronological)
+{
+    SpanHistory<int> history;
+    for (int i = 1; i <= 3; ++i)
+    {
+        history.push(i);
+    }
+
+    const auto view = history.view();
+    ASSERT_EQ(view.size(), 3U);
+    EXPECT_EQ(view[0], 1);
+    EXPECT_EQ(view[2], 3);
+    EXPECT_EQ(history.latest(), 3);
+}
+
+TEST(SpanHistoryTest, ViewStaysContiguousAcrossWrap)
+{
+    SpanHistory<int> history;
+    // Fill, then slide the window so the ring wraps without growing
+    for (int i = 0; i < 64; ++i)
+    {
+        history.push(i);
+    }
+    const std::size_t capacity = history.capacity();
+    for (int i = 64; i < 200; ++i)
+    {
+        history.dropFront(1);
+        history.push(i);
+    }
+
+    EXPECT_EQ(history.capacity(), capacity);
+    const auto view = history.view();
+    ASSERT_EQ(view.size(), 64U);
+    for (std::size_t i = 0; i < view.size(); ++i)
+    {
+        EXPECT_EQ(view[i], static_cast<int>(136 + i));
+    }
+    EXPECT_EQ(history.latest(), 199);
+}
+
+TEST(SpanHistoryTest, GrowsPreservingOrder)
+{
+    SpanHistory<int> history;
+    for (int i = 0; i < 50; ++i)
+    {
+        history.push(i);
+    }
+    history.dropFront(30);
+    for (int i = 50; i < 150; ++i)
+    {
+        history.push(i);
+    }
+
+    const auto view = history.view();
+    ASSERT_EQ(view.size(), 120U);
+    EXPECT_EQ(view.front(), 30);
+    EXPECT_EQ(view.back(), 149);
+    EXPECT_TRUE(std::ranges::is_sorted(view));
+}
+
+TEST(SpanHistoryTest, KeepNewestAndRelease)
+{
+    SpanHistory<float> history;
+    for (int i = 0; i < 10; ++i)
+    {
+        history.push(static_cast<float>(i));
+    }
+
+    history.keepNewest(4);
+    ASSERT_EQ(history.size(), 4U);
+    EXPECT_FLOAT_EQ(history.view().front(), 6.0F);
+
+    history.keepNewest(10); // No-op when already smaller
+    EXPECT_EQ(history.size(), 4U);
+
+    history.release();
+    EXPECT_TRUE(history.empty());
+    EXPECT_EQ(history.capacity(), 0U);
+}
+
 } // namespace
 } // namespace Domain
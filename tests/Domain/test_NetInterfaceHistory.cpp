@@ -0,0 +1,287 @@
+/// @file test_NetInterfaceHistory.cpp
+/// @brief Tests for Domain::NetInterfaceHistory (per-interface rates and pooled ring history)
+///
+/// Tests cover:
+/// - Interface classification by link kind and by name
+/// - Rates from per-slot previous counters
+/// - Slot reuse after an interface disappears
+/// - History kept across a rename with the same ifindex
+/// - Ring order across wrap-around and arena growth
+/// - Per-group totals
+
+#include "Domain/NetInterfaceHistory.h"
+#include "Domain/SystemModel.h"
+#include "Mocks/MockProbes.h"
+#include "Platform/SystemTypes.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using TestMocks::makeInterfaceCounters;
+
+namespace
+{
+
+using InterfaceList = std::vector<Platform::SystemCounters::InterfaceCounters>;
+
+Platform::SystemCounters::InterfaceCounters
+makeLink(const std::string& name, std::uint32_t ifIndex, std::uint64_t rxBytes, std::uint64_t txBytes, const std::string& kind = {})
+{
+    auto iface = makeInterfaceCounters(name, rxBytes, txBytes);
+    iface.ifIndex = ifIndex;
+    iface.kind = kind;
+    return iface;
+}
+
+/// Feed one sample per second; the first call only establishes baselines.
+Domain::SystemSnapshot step(Domain::NetInterfaceHistory& history, const InterfaceList& interfaces, bool first = false)
+{
+    Domain::SystemSnapshot snap;
+    history.update(interfaces, first ? 0.0 : 1.0, !first, snap);
+    return snap;
+}
+
+std::vector<float> rxHistory(const Domain::NetInterfaceHistory& history, const std::string& name)
+{
+    std::vector<float> out;
+    history.copyRxHistory(name, out);
+    return out;
+}
+
+} // namespace
+
+// =============================================================================
+// Classification
+// =============================================================================
+
+TEST(NetInterfaceHistoryTest, ClassifiesByLinkKind)
+{
+    EXPECT_EQ(Domain::classifyInterface("eth0", ""), Domain::InterfaceGroup::Physical);
+    EXPECT_EQ(Domain::classifyInterface("eth0", "veth"), Domain::InterfaceGroup::Veth);
+    EXPECT_EQ(Domain::classifyInterface("docker0", "bridge"), Domain::InterfaceGroup::Bridge);
+    EXPECT_EQ(Domain::classifyInterface("wg0", "wireguard"), Domain::InterfaceGroup::Tunnel);
+    EXPECT_EQ(Domain::classifyInterface("flannel.1", "vxlan"), Domain::InterfaceGroup::Tunnel);
+    EXPECT_EQ(Domain::classifyInterface("bond0", "bond"), Domain::InterfaceGroup::Virtual);
+}
+
+TEST(NetInterfaceHistoryTest, ClassifiesByNameWithoutKind)
+{
+    EXPECT_EQ(Domain::classifyInterface("enp3s0", ""), Domain::InterfaceGroup::Physical);
+    EXPECT_EQ(Domain::classifyInterface("wlan0", ""), Domain::InterfaceGroup::Physical);
+    EXPECT_EQ(Domain::classifyInterface("veth1a2b3c", ""), Domain::InterfaceGroup::Veth);
+    EXPECT_EQ(Domain::classifyInterface("docker0", ""), Domain::InterfaceGroup::Bridge);
+    EXPECT_EQ(Domain::classifyInterface("br-5f1e2d", ""), Domain::InterfaceGroup::Bridge);
+    EXPECT_EQ(Domain::classifyInterface("tun0", ""), Domain::InterfaceGroup::Tunnel);
+    EXPECT_EQ(Domain::classifyInterface("vEthernet (WSL)", ""), Domain::InterfaceGroup::Virtual);
+}
+
+// =============================================================================
+// Rates and slots
+// =============================================================================
+
+TEST(NetInterfaceHistoryTest, RatesComputedFromSlotCounters)
+{
+    Domain::NetInterfaceHistory history;
+    (void) step(history, {makeLink("eth0", 2, 1000, 500), makeLink("eth1", 3, 0, 0)}, true);
+
+    // Order changes between samples must not matter
+    const auto snap = step(history, {makeLink("eth1", 3, 300, 100), makeLink("eth0", 2, 3000, 1500)});
+    ASSERT_EQ(snap.networkInterfaces.size(), 2U);
+    EXPECT_EQ(snap.networkInterfaces[0].name, "eth1");
+    EXPECT_DOUBLE_EQ(snap.networkInterfaces[0].rxBytesPerSec, 300.0);
+    EXPECT_DOUBLE_EQ(snap.networkInterfaces[1].rxBytesPerSec, 2000.0);
+    EXPECT_DOUBLE_EQ(snap.networkInterfaces[1].txBytesPerSec, 1000.0);
+    EXPECT_EQ(snap.networkInterfaces[1].ifIndex, 2U);
+}
+
+TEST(NetInterfaceHistoryTest, CounterResetReportsZero)
+{
+    Domain::NetInterfaceHistory history;
+    (void) step(history, {makeLink("eth0", 2, 5000, 5000)}, true);
+    const auto snap = step(history, {makeLink("eth0", 2, 100, 100)});
+    EXPECT_DOUBLE_EQ(snap.networkInterfaces[0].rxBytesPerSec, 0.0);
+    EXPECT_DOUBLE_EQ(snap.networkInterfaces[0].txBytesPerSec, 0.0);
+}
+
+TEST(NetInterfaceHistoryTest, SlotsReusedAfterInterfaceRemoval)
+{
+    Domain::NetInterfaceHistory history;
+
+    // Simulate container churn: 100 veths come and go, never more than 10 at once
+    for (std::uint32_t wave = 0; wave < 10; ++wave)
+    {
+        InterfaceList interfaces = {makeLink("eth0", 2, 0, 0)};
+        for (std::uint32_t i = 0; i < 10; ++i)
+        {
+            const std::uint32_t ifIndex = 100 + (wave * 10) + i;
+            interfaces.push_back(makeLink("veth" + std::to_string(ifIndex), ifIndex, 0, 0, "veth"));
+        }
+        (void) step(history, interfaces, wave == 0);
+        EXPECT_EQ(history.liveCount(), 11U);
+    }
+
+    EXPECT_LE(history.slotCapacity(), 21U);
+    EXPECT_TRUE(rxHistory(history, "veth100").empty()); // Gone
+    EXPECT_FALSE(rxHistory(history, "veth195").empty());
+}
+
+TEST(NetInterfaceHistoryTest, ReusedSlotStartsWithFreshBaseline)
+{
+    Domain::NetInterfaceHistory history;
+    (void) step(history, {makeLink("veth1", 10, 1'000'000, 0, "veth")}, true);
+    (void) step(history, {});
+
+    // New interface lands in the freed slot; it must not inherit veth1's counters
+    const auto snap = step(history, {makeLink("veth2", 11, 500, 0, "veth")});
+    EXPECT_EQ(history.slotCapacity(), 1U);
+    EXPECT_DOUBLE_EQ(snap.networkInterfaces[0].rxBytesPerSec, 0.0);
+    EXPECT_EQ(rxHistory(history, "veth2").size(), 1U);
+}
+
+TEST(NetInterfaceHistoryTest, RenameWithSameIfIndexKeepsHistory)
+{
+    Domain::NetInterfaceHistory history;
+    (void) step(history, {makeLink("eth0", 2, 0, 0)}, true);
+    (void) step(history, {makeLink("eth0", 2, 100, 0)});
+
+    // udev-style rename: same ifindex, new name
+    const auto snap = step(history, {makeLink("enp3s0", 2, 300, 0)});
+    EXPECT_DOUBLE_EQ(snap.networkInterfaces[0].rxBytesPerSec, 200.0);
+    EXPECT_TRUE(rxHistory(history, "eth0").empty());
+    EXPECT_EQ(rxHistory(history, "enp3s0"), (std::vector<float>{100.0F, 200.0F}));
+}
+
+TEST(NetInterfaceHistoryTest, InterfacesWithoutIfIndexKeyedByName)
+{
+    Domain::NetInterfaceHistory history;
+    (void) step(history, {makeLink("Ethernet", 0, 0, 0), makeLink("Wi-Fi", 0, 0, 0)}, true);
+    const auto snap = step(history, {makeLink("Wi-Fi", 0, 50, 0), makeLink("Ethernet", 0, 70, 0)});
+    EXPECT_DOUBLE_EQ(snap.networkInterfaces[0].rxBytesPerSec, 50.0);
+    EXPECT_DOUBLE_EQ(snap.networkInterfaces[1].rxBytesPerSec, 70.0);
+    EXPECT_EQ(history.slotCapacity(), 2U);
+}
+
+// =============================================================================
+// Ring history
+// =============================================================================
+
+TEST(NetInterfaceHistoryTest, HistoryOrderedAcrossWrapAndGrowth)
+{
+    Domain::NetInterfaceHistory history;
+    std::uint64_t rx = 0;
+    (void) step(history, {makeLink("eth0", 2, rx, 0)}, true);
+
+    // Wrap the initial ring several times, growing it part-way through
+    constexpr std::size_t SAMPLES = 300;
+    for (std::size_t i = 1; i <= SAMPLES; ++i)
+    {
+        if (i == 150)
+        {
+            history.reserveSamples(200);
+        }
+        rx += i;
+        (void) step(history, {makeLink("eth0", 2, rx, 0)});
+    }
+
+    // 64 samples survived the initial ring; the 151 appended after growth all fit in 256
+    const auto hist = rxHistory(history, "eth0");
+    ASSERT_EQ(hist.size(), 64U + (SAMPLES - 149));
+    for (std::size_t k = 0; k < hist.size(); ++k)
+    {
+        EXPECT_FLOAT_EQ(hist[k], static_cast<float>(SAMPLES - hist.size() + 1 + k));
+    }
+}
+
+TEST(NetInterfaceHistoryTest, ClampLimitsHistoryToWindow)
+{
+    Domain::NetInterfaceHistory history;
+    (void) step(history, {makeLink("eth0", 2, 0, 0)}, true);
+    for (std::uint64_t i = 1; i <= 10; ++i)
+    {
+        (void) step(history, {makeLink("eth0", 2, i * 10, 0)});
+    }
+
+    history.clampSamples(3);
+    EXPECT_EQ(rxHistory(history, "eth0"), (std::vector<float>{10.0F, 10.0F, 10.0F}));
+}
+
+TEST(NetInterfaceHistoryTest, NewInterfaceHasShorterHistory)
+{
+    Domain::NetInterfaceHistory history;
+    (void) step(history, {makeLink("eth0", 2, 0, 0)}, true);
+    (void) step(history, {makeLink("eth0", 2, 10, 0)});
+    (void) step(history, {makeLink("eth0", 2, 20, 0), makeLink("tun0", 9, 0, 0)});
+    EXPECT_EQ(rxHistory(history, "eth0").size(), 2U);
+    EXPECT_EQ(rxHistory(history, "tun0").size(), 1U);
+}
+
+// =============================================================================
+// Groups
+// =============================================================================
+
+TEST(NetInterfaceHistoryTest, GroupTotalsSumMemberRates)
+{
+    Domain::NetInterfaceHistory history;
+    (void) step(history,
+                {makeLink("eth0", 2, 0, 0), makeLink("veth1", 10, 0, 0, "veth"), makeLink("veth2", 11, 0, 0, "veth"),
+                 makeLink("docker0", 3, 0, 0, "bridge")},
+                true);
+
+    auto veth2 = makeLink("veth2", 11, 300, 30, "veth");
+    veth2.isUp = false;
+    const auto snap = step(history,
+                           {makeLink("eth0", 2, 1000, 100), makeLink("veth1", 10, 200, 20, "veth"), veth2,
+                            makeLink("docker0", 3, 500, 50, "bridge")});
+
+    const auto& veth = snap.networkGroups[static_cast<std::size_t>(Domain::InterfaceGroup::Veth)];
+    EXPECT_EQ(veth.interfaceCount, 2U);
+    EXPECT_EQ(veth.upCount, 1U);
+    EXPECT_DOUBLE_EQ(veth.rxBytesPerSec, 500.0);
+    EXPECT_DOUBLE_EQ(veth.txBytesPerSec, 50.0);
+
+    const auto& physical = snap.networkGroups[static_cast<std::size_t>(Domain::InterfaceGroup::Physical)];
+    EXPECT_EQ(physical.interfaceCount, 1U);
+    EXPECT_DOUBLE_EQ(physical.rxBytesPerSec, 1000.0);
+
+    EXPECT_EQ(snap.networkGroups[static_cast<std::size_t>(Domain::InterfaceGroup::Tunnel)].interfaceCount, 0U);
+    EXPECT_EQ(snap.networkInterfaces[1].group, Domain::InterfaceGroup::Veth);
+}
+
+// =============================================================================
+// SystemModel integration
+// =============================================================================
+
+TEST(NetInterfaceHistoryTest, SystemModelTracksGroupHistory)
+{
+    using TestMocks::makeCpuCounters;
+    using TestMocks::makeMemoryCounters;
+    using TestMocks::makeSystemCounters;
+
+    auto probe = std::make_unique<TestMocks::MockSystemProbe>();
+    Domain::SystemModel model(std::move(probe));
+
+    const auto countersAt = [](std::uint64_t vethRx)
+    {
+        return makeSystemCounters(makeCpuCounters(100, 0, 50, 850),
+                                  makeMemoryCounters(1024, 512),
+                                  0,
+                                  {},
+                                  vethRx,
+                                  0,
+                                  {makeLink("eth0", 2, 0, 0), makeLink("vethA", 10, vethRx, 0, "veth")});
+    };
+
+    model.updateFromCounters(countersAt(0), 1.0);
+    model.updateFromCounters(countersAt(400), 2.0);
+    model.updateFromCounters(countersAt(1000), 3.0);
+
+    const auto vethRx = model.netRxHistoryForGroup(Domain::InterfaceGroup::Veth);
+    EXPECT_EQ(vethRx, (std::vector<float>{400.0F, 600.0F}));
+    EXPECT_EQ(model.netRxHistoryForGroup(Domain::InterfaceGroup::Physical), (std::vector<float>{0.0F, 0.0F}));
+    EXPECT_EQ(vethRx.size(), model.timestamps().size());
+    EXPECT_EQ(model.netRxHistoryForInterface("vethA"), vethRx);
+}
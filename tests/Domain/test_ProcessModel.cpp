@@ -7,14 +7,20 @@
 /// - State character translation
 /// - Unique key generation for PID reuse handling
 /// - Thread-safe operations
+/// - Joining per-process GPU counters into snapshots
 
+#include "Domain/GPUEngineMask.h"
+#include "Domain/GPUModel.h"
 #include "Domain/ProcessModel.h"
+#include "Mocks/MockGPUProbe.h"
 #include "Mocks/MockProbes.h"
 #include "Platform/ProcessTypes.h"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <thread>
@@ -818,6 +824,65 @@ TEST(ProcessModelTest, BuilderPatternWithPowerUsage)
     EXPECT_EQ(snaps[0].name, "power_test");
 }
 
+// =============================================================================
+// cgroup CPU Pressure Tests
+// =============================================================================
+
+TEST(ProcessModelTest, CgroupCpuPressureFromStallDelta)
+{
+    auto probe = std::make_unique<MockProcessProbe>();
+    auto* rawProbe = probe.get();
+
+    rawProbe->withProcess(100, "stalled").withCgroupCpuPressure(100, "/app.slice/web.service", 1'000'000, 0);
+    rawProbe->setTotalCpuTime(100000);
+
+    Domain::ProcessModel model(std::move(probe));
+    model.refresh();
+
+    auto snaps = model.snapshots();
+    ASSERT_EQ(snaps.size(), 1);
+    EXPECT_EQ(snaps[0].cgroupPath, "/app.slice/web.service");
+    EXPECT_DOUBLE_EQ(snaps[0].cgroupCpuSomePercent, 0.0); // No previous sample yet
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // 50ms of "some" stall and 10ms of "full" stall over ~100ms
+    rawProbe->withProcess(100, "stalled").withCgroupCpuPressure(100, "/app.slice/web.service", 1'050'000, 10'000);
+    rawProbe->setTotalCpuTime(200000);
+    model.refresh();
+
+    snaps = model.snapshots();
+    ASSERT_EQ(snaps.size(), 1);
+    EXPECT_GT(snaps[0].cgroupCpuSomePercent, 25.0);
+    EXPECT_LE(snaps[0].cgroupCpuSomePercent, 50.0);
+    EXPECT_GT(snaps[0].cgroupCpuFullPercent, 5.0);
+    EXPECT_LE(snaps[0].cgroupCpuFullPercent, 10.0);
+}
+
+TEST(ProcessModelTest, CgroupCpuPressureZeroAfterCgroupMove)
+{
+    auto probe = std::make_unique<MockProcessProbe>();
+    auto* rawProbe = probe.get();
+
+    rawProbe->withProcess(100, "moved").withCgroupCpuPressure(100, "/a.slice", 1'000'000, 0);
+    rawProbe->setTotalCpuTime(100000);
+
+    Domain::ProcessModel model(std::move(probe));
+    model.refresh();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // Different cgroup: its totals are unrelated to the previous ones
+    rawProbe->withProcess(100, "moved").withCgroupCpuPressure(100, "/b.slice", 9'000'000, 0);
+    rawProbe->setTotalCpuTime(200000);
+    model.refresh();
+
+    auto snaps = model.snapshots();
+    ASSERT_EQ(snaps.size(), 1);
+    EXPECT_EQ(snaps[0].cgroupPath, "/b.slice");
+    EXPECT_DOUBLE_EQ(snaps[0].cgroupCpuSomePercent, 0.0);
+}
+
 // =============================================================================
 // I/O Rate Calculation Tests
 // =============================================================================
@@ -1441,3 +1506,297 @@ TEST(ProcessModelTest, PeakRssResetForNewProcess)
     ASSERT_EQ(snaps2.size(), 1);
     EXPECT_EQ(snaps2[0].peakMemoryBytes, 5 * 1024 * 1024); // Peak should reset for new process
 }
+
+// ========== NUMA Locality ==========
+
+namespace
+{
+
+std::unique_ptr<MockProcessProbe> makeNumaProbe()
+{
+    auto probe = std::make_unique<MockProcessProbe>();
+    Platform::ProcessCapabilities caps;
+    caps.hasNumaResidency = true;
+    probe->setCapabilities(caps);
+    probe->withProcess(100, "db").withProcess(200, "web").withProcess(300, "idle");
+    probe->withNumaResidency(100, {100, 300}).withNumaResidency(200, {500, 0, 0}).withNumaResidency(300, {0, 0});
+    return probe;
+}
+
+} // namespace
+
+TEST(ProcessModelTest, NumaLocalityNotSampledUntilRequested)
+{
+    auto probe = makeNumaProbe();
+    auto* rawProbe = probe.get();
+    Domain::ProcessModel model{std::move(probe)};
+
+    model.refresh();
+
+    EXPECT_EQ(rawProbe->numaReadCount(), 0);
+    for (const auto& snap : model.snapshots())
+    {
+        EXPECT_EQ(snap.numaNode, -1);
+        EXPECT_DOUBLE_EQ(snap.numaLocalityPercent, -1.0);
+    }
+}
+
+TEST(ProcessModelTest, NumaLocalityReadOnlyForRequestedPids)
+{
+    auto probe = makeNumaProbe();
+    auto* rawProbe = probe.get();
+    Domain::ProcessModel model{std::move(probe)};
+
+    const std::vector<std::int32_t> visible = {100, 300};
+    model.requestNumaLocality(visible);
+    model.refresh();
+
+    EXPECT_EQ(rawProbe->numaReadCount(), 2);
+    for (const auto& snap : model.snapshots())
+    {
+        if (snap.pid == 100)
+        {
+            EXPECT_EQ(snap.numaNode, 1);
+            EXPECT_DOUBLE_EQ(snap.numaLocalityPercent, 75.0);
+        }
+        else
+        {
+            // 200 was not requested; 300 has no resident pages
+            EXPECT_EQ(snap.numaNode, -1) << "pid " << snap.pid;
+        }
+    }
+}
+
+TEST(ProcessModelTest, NumaLocalityCarriedForwardAfterRequestEnds)
+{
+    auto probe = makeNumaProbe();
+    auto* rawProbe = probe.get();
+    Domain::ProcessModel model{std::move(probe)};
+
+    const std::vector<std::int32_t> visible = {200};
+    model.requestNumaLocality(visible);
+    model.refresh();
+    model.refresh(); // Request was consumed; no new read
+
+    EXPECT_EQ(rawProbe->numaReadCount(), 1);
+    const auto snaps = model.snapshots();
+    const auto it = std::ranges::find(snaps, 200, &Domain::ProcessSnapshot::pid);
+    ASSERT_NE(it, snaps.end());
+    EXPECT_EQ(it->numaNode, 0);
+    EXPECT_DOUBLE_EQ(it->numaLocalityPercent, 100.0);
+}
+
+TEST(ProcessModelTest, NumaLocalityIgnoredWithoutCapability)
+{
+    auto probe = std::make_unique<MockProcessProbe>();
+    probe->withProcess(100, "db").withNumaResidency(100, {100, 300});
+    auto* rawProbe = probe.get();
+    Domain::ProcessModel model{std::move(probe)};
+
+    const std::vector<std::int32_t> visible = {100};
+    model.requestNumaLocality(visible);
+    model.refresh();
+
+    EXPECT_EQ(rawProbe->numaReadCount(), 0);
+    EXPECT_EQ(model.snapshots().at(0).numaNode, -1);
+}
+
+// ========== GPU Usage Join ==========
+
+namespace
+{
+
+std::unique_ptr<TestMocks::MockGPUProbe> makeProcessGPUProbe()
+{
+    auto probe = std::make_unique<TestMocks::MockGPUProbe>();
+    Platform::GPUCapabilities caps;
+    caps.hasPerProcessMetrics = true;
+    probe->withCapabilities(caps);
+    probe->withGPU("gpu0", "Discrete GPU").withGPU("gpu1", "Integrated GPU");
+    return probe;
+}
+
+/// Push the GPU model's per-process counters into the process model, as SystemMetricsPanel does.
+void joinGPUUsage(Domain::ProcessModel& processModel, const Domain::GPUModel& gpuModel)
+{
+    processModel.updateGPUUsage(gpuModel.processCounters(), gpuModel.gpuInfo());
+}
+
+const Domain::ProcessSnapshot& snapshotFor(const std::vector<Domain::ProcessSnapshot>& snaps, std::int32_t pid)
+{
+    const auto it = std::ranges::find(snaps, pid, &Domain::ProcessSnapshot::pid);
+    EXPECT_NE(it, snaps.end());
+    return *it;
+}
+
+} // namespace
+
+TEST(ProcessModelTest, GPUUsageJoinedByPid)
+{
+    auto gpuProbe = makeProcessGPUProbe();
+    gpuProbe->withProcessGPU(300, "gpu0", 2048).withProcessGPU(100, "gpu0", 1024);
+    Domain::GPUModel gpuModel{std::move(gpuProbe)};
+    gpuModel.refresh();
+
+    auto probe = std::make_unique<MockProcessProbe>();
+    probe->withProcess(100, "game").withProcess(200, "shell").withProcess(300, "encoder");
+    Domain::ProcessModel model{std::move(probe)};
+    joinGPUUsage(model, gpuModel);
+    model.refresh();
+
+    const auto snaps = model.snapshots();
+    const auto& game = snapshotFor(snaps, 100);
+    EXPECT_DOUBLE_EQ(game.gpuUtilPercent, 25.0);
+    EXPECT_EQ(game.gpuMemoryBytes, 1024U);
+    EXPECT_EQ(game.gpuEngines, Domain::GPUEngine::Render);
+    EXPECT_EQ(game.gpuDevices, "gpu0");
+    ASSERT_EQ(game.perGpuUsage.size(), 1U);
+    EXPECT_EQ(game.perGpuUsage[0].gpuName, "Discrete GPU");
+
+    const auto& shell = snapshotFor(snaps, 200);
+    EXPECT_DOUBLE_EQ(shell.gpuUtilPercent, 0.0);
+    EXPECT_EQ(shell.gpuMemoryBytes, 0U);
+    EXPECT_EQ(shell.gpuEngines, 0);
+    EXPECT_TRUE(shell.gpuDevices.empty());
+    EXPECT_TRUE(shell.perGpuUsage.empty());
+
+    EXPECT_EQ(snapshotFor(snaps, 300).gpuMemoryBytes, 2048U);
+}
+
+TEST(ProcessModelTest, GPUUsageAggregatedAcrossGPUs)
+{
+    auto gpuProbe = makeProcessGPUProbe();
+    gpuProbe->withProcessGPU(100, "gpu1", 1000).withProcessGPU(100, "gpu0", 3000);
+    Domain::GPUModel gpuModel{std::move(gpuProbe)};
+    gpuModel.refresh();
+
+    auto probe = std::make_unique<MockProcessProbe>();
+    probe->withProcess(100, "render");
+    Domain::ProcessModel model{std::move(probe)};
+    model.refresh();
+    joinGPUUsage(model, gpuModel);
+
+    // The join applies to the current snapshots without waiting for the next refresh
+    const auto snaps = model.snapshots();
+    ASSERT_EQ(snaps.size(), 1U);
+    EXPECT_DOUBLE_EQ(snaps[0].gpuUtilPercent, 50.0);
+    EXPECT_EQ(snaps[0].gpuMemoryBytes, 4000U);
+    EXPECT_EQ(snaps[0].gpuDevices, "gpu0,gpu1");
+    ASSERT_EQ(snaps[0].perGpuUsage.size(), 2U);
+    EXPECT_EQ(snaps[0].perGpuUsage[0].gpuId, "gpu0");
+    EXPECT_EQ(snaps[0].perGpuUsage[0].memoryBytes, 3000U);
+    EXPECT_EQ(snaps[0].perGpuUsage[1].gpuId, "gpu1");
+    EXPECT_DOUBLE_EQ(snaps[0].perGpuUsage[1].utilPercent, 25.0);
+}
+
+TEST(ProcessModelTest, GPUWithoutEnumeratedInfoUsesCounterName)
+{
+    // DRM client stats key amdgpu clients by PCI address, which no enumerating backend uses
+    auto intel = TestMocks::makeProcessGPUCounters(100, "0000:00:02.0");
+    intel.gpuName = "i915 0000:00:02.0";
+    auto amd = TestMocks::makeProcessGPUCounters(100, "0000:03:00.0");
+    amd.gpuName = "amdgpu 0000:03:00.0";
+    const std::vector<Platform::ProcessGPUCounters> counters = {intel, amd};
+    const std::vector<Platform::GPUInfo> gpus = {TestMocks::makeGPUInfo("0000:00:02.0", "Intel Iris Xe", "Intel", true)};
+
+    auto probe = std::make_unique<MockProcessProbe>();
+    probe->withProcess(100, "game");
+    Domain::ProcessModel model{std::move(probe)};
+    model.refresh();
+    model.updateGPUUsage(counters, gpus);
+
+    const auto snap = model.snapshots().at(0);
+    ASSERT_EQ(snap.perGpuUsage.size(), 2U);
+    EXPECT_EQ(snap.perGpuUsage[0].gpuName, "Intel Iris Xe"); // Enumerated GPUs keep their own name
+    EXPECT_TRUE(snap.perGpuUsage[0].isIntegrated);
+    EXPECT_EQ(snap.perGpuUsage[1].gpuName, "amdgpu 0000:03:00.0");
+    EXPECT_FALSE(snap.perGpuUsage[1].isIntegrated);
+}
+
+TEST(ProcessModelTest, GPUEnginesBecomeBitmask)
+{
+    Platform::ProcessGPUCounters render = TestMocks::makeProcessGPUCounters(100, "gpu0");
+    Platform::ProcessGPUCounters media = TestMocks::makeProcessGPUCounters(100, "gpu1");
+    media.activeEngines = {"Video Decode", "Video Encode"};
+    media.encoderUtilPercent = 10.0;
+    media.decoderUtilPercent = 30.0;
+    const std::vector<Platform::ProcessGPUCounters> counters = {render, media};
+
+    auto probe = std::make_unique<MockProcessProbe>();
+    probe->withProcess(100, "player");
+    Domain::ProcessModel model{std::move(probe)};
+    model.updateGPUUsage(counters, {});
+    model.refresh();
+
+    const auto snap = model.snapshots().at(0);
+    EXPECT_EQ(snap.gpuEngines, Domain::GPUEngine::Render | Domain::GPUEngine::VideoDecode | Domain::GPUEngine::VideoEncode);
+    EXPECT_EQ(Domain::GPUEngine::format(snap.gpuEngines), "3D, Video Decode, Video Encode");
+    EXPECT_DOUBLE_EQ(snap.gpuEncoderUtil, 10.0);
+    EXPECT_DOUBLE_EQ(snap.gpuDecoderUtil, 30.0);
+    ASSERT_EQ(snap.perGpuUsage.size(), 2U);
+    EXPECT_EQ(snap.perGpuUsage[1].engines, Domain::GPUEngine::VideoDecode | Domain::GPUEngine::VideoEncode);
+    EXPECT_EQ(Domain::GPUEngine::fromName("Blitter"), Domain::GPUEngine::Other);
+}
+
+TEST(ProcessModelTest, GPUUsageClearedWhenCountersGone)
+{
+    auto probe = std::make_unique<MockProcessProbe>();
+    probe->withProcess(100, "game");
+    Domain::ProcessModel model{std::move(probe)};
+
+    const std::vector<Platform::ProcessGPUCounters> counters = {TestMocks::makeProcessGPUCounters(100, "gpu0")};
+    model.updateGPUUsage(counters, {});
+    model.refresh();
+    EXPECT_GT(model.snapshots().at(0).gpuMemoryBytes, 0U);
+
+    model.updateGPUUsage({}, {});
+    const auto snap = model.snapshots().at(0);
+    EXPECT_EQ(snap.gpuMemoryBytes, 0U);
+    EXPECT_EQ(snap.gpuEngines, 0);
+    EXPECT_TRUE(snap.gpuDevices.empty());
+}
+
+TEST(ProcessModelTest, GPUModelSkipsProcessCountersWithoutCapability)
+{
+    auto gpuProbe = std::make_unique<TestMocks::MockGPUProbe>();
+    gpuProbe->withGPU("gpu0", "GPU").withProcessGPU(100, "gpu0", 1024);
+    auto* rawProbe = gpuProbe.get();
+    Domain::GPUModel gpuModel{std::move(gpuProbe)};
+    gpuModel.refresh();
+
+    EXPECT_EQ(rawProbe->readProcessCountersCallCount(), 0U);
+    EXPECT_TRUE(gpuModel.processCounters().empty());
+}
+
+TEST(ProcessModelTest, GenerationMovesOnlyWhenSnapshotsChange)
+{
+    auto probe = std::make_unique<MockProcessProbe>();
+    probe->withProcess(100, "game");
+    Domain::ProcessModel model{std::move(probe)};
+
+    const std::uint64_t initial = model.generation();
+    EXPECT_EQ(model.generation(), initial); // Reading does not bump it
+
+    model.refresh();
+    const std::uint64_t afterRefresh = model.generation();
+    EXPECT_NE(afterRefresh, initial);
+    (void) model.snapshots();
+    EXPECT_EQ(model.generation(), afterRefresh);
+
+    // Clearing GPU usage that was never set leaves the snapshots as they were
+    model.updateGPUUsage({}, {});
+    EXPECT_EQ(model.generation(), afterRefresh);
+
+    // GPU usage is joined into the snapshots in place, so it counts as a change too
+    const std::vector<Platform::ProcessGPUCounters> counters = {TestMocks::makeProcessGPUCounters(100, "gpu0")};
+    model.updateGPUUsage(counters, {});
+    const std::uint64_t afterGpu = model.generation();
+    EXPECT_NE(afterGpu, afterRefresh);
+
+    // ...but only when the applied values differ
+    model.updateGPUUsage(counters, {});
+    EXPECT_EQ(model.generation(), afterGpu);
+
+    model.updateGPUUsage({}, {});
+    EXPECT_NE(model.generation(), afterGpu);
+}
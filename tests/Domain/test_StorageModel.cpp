@@ -9,6 +9,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdint>
 #include <memory>
 #include <thread>
 
@@ -134,7 +135,7 @@ TEST(StorageModelTest, HistoryGrowsWithSamples)
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
 
-    auto history = model.history();
+    auto history = model.historyTimestamps();
     EXPECT_EQ(history.size(), 5ULL);
 }
 
@@ -163,7 +164,7 @@ TEST(StorageModelTest, MaxHistorySecondsLimitsHistory)
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
 
-    auto history = model.history();
+    auto history = model.historyTimestamps();
     // History should be trimmed - exact size depends on timing, but should be < 10
     EXPECT_LT(history.size(), 10ULL);
 }
@@ -406,5 +407,359 @@ TEST(StorageModelTest, SnapshotReflectsProbeCapabilities)
     EXPECT_TRUE(snap.hasIoTime);
 }
 
+// =============================================================================
+// Extended Statistics (iostat -x equivalents)
+// =============================================================================
+
+Platform::SystemDiskCounters singleDisk(const Platform::DiskCounters& disk)
+{
+    Platform::SystemDiskCounters counters;
+    counters.disks.push_back(disk);
+    return counters;
+}
+
+TEST(StorageModelTest, ComputesLatencyQueueSizeAndUtilization)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+
+    Platform::DiskCounters disk;
+    disk.deviceName = "sda";
+    disk.sectorSize = 512;
+    model.updateFromCounters(singleDisk(disk), 100.0);
+
+    // Over 2 seconds: 200 reads of 8 sectors taking 1000 ms total, 100 writes of 16 sectors taking 3000 ms
+    disk.readsCompleted = 200;
+    disk.readsMerged = 20;
+    disk.readSectors = 1600;
+    disk.readTimeMs = 1000;
+    disk.writesCompleted = 100;
+    disk.writesMerged = 40;
+    disk.writeSectors = 1600;
+    disk.writeTimeMs = 3000;
+    disk.ioInFlight = 3;
+    disk.ioTimeMs = 500;
+    disk.weightedIoTimeMs = 4000;
+    model.updateFromCounters(singleDisk(disk), 102.0);
+
+    const auto snap = model.latestSnapshot();
+    ASSERT_EQ(snap.disks.size(), 1U);
+    const auto& d = snap.disks[0];
+    EXPECT_DOUBLE_EQ(d.readOpsPerSec, 100.0);
+    EXPECT_DOUBLE_EQ(d.writeOpsPerSec, 50.0);
+    EXPECT_DOUBLE_EQ(d.readMergesPerSec, 10.0);
+    EXPECT_DOUBLE_EQ(d.writeMergesPerSec, 20.0);
+    EXPECT_DOUBLE_EQ(d.avgReadTimeMs, 5.0);
+    EXPECT_DOUBLE_EQ(d.avgWriteTimeMs, 30.0);
+    EXPECT_DOUBLE_EQ(d.avgReadRequestBytes, 4096.0);
+    EXPECT_DOUBLE_EQ(d.avgWriteRequestBytes, 8192.0);
+    EXPECT_DOUBLE_EQ(d.avgQueueSize, 2.0);
+    EXPECT_DOUBLE_EQ(d.utilizationPercent, 25.0);
+    EXPECT_EQ(d.ioInFlight, 3U);
+}
+
+TEST(StorageModelTest, IdleIntervalHasZeroLatency)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+
+    Platform::DiskCounters disk;
+    disk.deviceName = "sda";
+    disk.sectorSize = 512;
+    disk.readsCompleted = 10;
+    disk.readTimeMs = 50;
+    model.updateFromCounters(singleDisk(disk), 10.0);
+    model.updateFromCounters(singleDisk(disk), 11.0);
+
+    const auto& d = model.latestSnapshot().disks[0];
+    EXPECT_DOUBLE_EQ(d.avgReadTimeMs, 0.0);
+    EXPECT_DOUBLE_EQ(d.avgReadRequestBytes, 0.0);
+    EXPECT_DOUBLE_EQ(d.avgQueueSize, 0.0);
+}
+
+TEST(StorageModelTest, CounterResetDoesNotProduceNegativeRates)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+
+    Platform::DiskCounters disk;
+    disk.deviceName = "loop0";
+    disk.sectorSize = 512;
+    disk.readsCompleted = 1000;
+    disk.readSectors = 8000;
+    model.updateFromCounters(singleDisk(disk), 10.0);
+
+    disk.readsCompleted = 5;
+    disk.readSectors = 40;
+    model.updateFromCounters(singleDisk(disk), 11.0);
+
+    const auto& d = model.latestSnapshot().disks[0];
+    EXPECT_DOUBLE_EQ(d.readOpsPerSec, 0.0);
+    EXPECT_DOUBLE_EQ(d.readBytesPerSec, 0.0);
+}
+
+TEST(StorageModelTest, ComputesDiscardAndFlushRatesWhenReported)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+
+    Platform::DiskCounters disk;
+    disk.deviceName = "nvme0n1";
+    disk.sectorSize = 512;
+    disk.hasDiscardStats = true;
+    disk.hasFlushStats = true;
+    model.updateFromCounters(singleDisk(disk), 0.0);
+
+    disk.discardsCompleted = 4;
+    disk.discardSectors = 2048;
+    disk.discardTimeMs = 8;
+    disk.flushesCompleted = 10;
+    disk.flushTimeMs = 5;
+    model.updateFromCounters(singleDisk(disk), 2.0);
+
+    const auto& d = model.latestSnapshot().disks[0];
+    EXPECT_TRUE(d.hasDiscardStats);
+    EXPECT_TRUE(d.hasFlushStats);
+    EXPECT_DOUBLE_EQ(d.discardOpsPerSec, 2.0);
+    EXPECT_DOUBLE_EQ(d.discardBytesPerSec, 512.0 * 1024.0);
+    EXPECT_DOUBLE_EQ(d.avgDiscardTimeMs, 2.0);
+    EXPECT_DOUBLE_EQ(d.flushOpsPerSec, 5.0);
+    EXPECT_DOUBLE_EQ(d.avgFlushTimeMs, 0.5);
+}
+
+TEST(StorageModelTest, UpdateFromCountersRecordsGivenTimestamp)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+    model.updateFromCounters({}, 42.0);
+
+    const auto timestamps = model.historyTimestamps();
+    ASSERT_EQ(timestamps.size(), 1U);
+    EXPECT_DOUBLE_EQ(timestamps[0], 42.0);
+}
+
+// =============================================================================
+// Columnar History and Device Lifecycle
+// =============================================================================
+
+Platform::DiskCounters diskNamed(const char* name, std::uint64_t readSectors)
+{
+    Platform::DiskCounters disk;
+    disk.deviceName = name;
+    disk.sectorSize = 512;
+    disk.readSectors = readSectors;
+    return disk;
+}
+
+TEST(StorageModelTest, HistoryViewExposesPerDeviceSeries)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+    model.updateFromCounters(singleDisk(diskNamed("sda", 0)), 1.0);
+    model.updateFromCounters(singleDisk(diskNamed("sda", 2)), 2.0);
+    model.updateFromCounters(singleDisk(diskNamed("sda", 6)), 3.0);
+
+    const auto snap = model.latestSnapshot();
+    const auto view = model.historyView();
+    const auto id = view.findDevice("sda");
+    ASSERT_TRUE(id.has_value());
+    EXPECT_EQ(*id, snap.disks[0].deviceId);
+
+    const auto read = view.series(*id, DiskMetric::ReadBytesPerSec);
+    ASSERT_EQ(read.size(), 3U);
+    EXPECT_FLOAT_EQ(read[0], 0.0F);
+    EXPECT_FLOAT_EQ(read[1], 1024.0F);
+    EXPECT_FLOAT_EQ(read[2], 2048.0F);
+
+    const auto totals = view.totalReadBytesPerSec();
+    ASSERT_EQ(totals.size(), view.timestamps().size());
+    EXPECT_DOUBLE_EQ(totals.back(), 2048.0);
+    EXPECT_FALSE(view.findDevice("sdb").has_value());
+    EXPECT_TRUE(view.series(*id + 100, DiskMetric::ReadBytesPerSec).empty());
+}
+
+TEST(StorageModelTest, NewDeviceSeriesIsAlignedAtNewestEnd)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+    model.updateFromCounters(singleDisk(diskNamed("sda", 0)), 1.0);
+    model.updateFromCounters(singleDisk(diskNamed("sda", 0)), 2.0);
+
+    Platform::SystemDiskCounters both;
+    both.disks.push_back(diskNamed("sda", 0));
+    both.disks.push_back(diskNamed("sdb", 0));
+    model.updateFromCounters(both, 3.0);
+
+    const auto view = model.historyView();
+    EXPECT_EQ(view.timestamps().size(), 3U);
+    EXPECT_EQ(view.series(*view.findDevice("sda"), DiskMetric::UtilizationPercent).size(), 3U);
+    EXPECT_EQ(view.series(*view.findDevice("sdb"), DiskMetric::UtilizationPercent).size(), 1U);
+}
+
+TEST(StorageModelTest, DepartedDeviceKeepsHistoryUntilItAgesOut)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+    model.setMaxHistorySeconds(10.0);
+
+    Platform::SystemDiskCounters both;
+    both.disks.push_back(diskNamed("sda", 0));
+    both.disks.push_back(diskNamed("sdc", 0));
+    model.updateFromCounters(both, 100.0);
+    EXPECT_EQ(model.trackedDeviceCount(), 2U);
+
+    // sdc is unplugged: it stays tracked and records zeros while its last sample is in the window
+    model.updateFromCounters(singleDisk(diskNamed("sda", 0)), 105.0);
+    EXPECT_EQ(model.trackedDeviceCount(), 2U);
+    {
+        const auto view = model.historyView();
+        const auto id = view.findDevice("sdc");
+        ASSERT_TRUE(id.has_value());
+        EXPECT_EQ(view.series(*id, DiskMetric::ReadBytesPerSec).size(), 2U);
+    }
+
+    // Once its last sample leaves the window the slot and its columns are released
+    model.updateFromCounters(singleDisk(diskNamed("sda", 0)), 111.0);
+    EXPECT_EQ(model.trackedDeviceCount(), 1U);
+    EXPECT_FALSE(model.historyView().findDevice("sdc").has_value());
+}
+
+TEST(StorageModelTest, ReleasedDeviceSlotIsReused)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+    model.setMaxHistorySeconds(1.0);
+
+    Platform::SystemDiskCounters both;
+    both.disks.push_back(diskNamed("sda", 0));
+    both.disks.push_back(diskNamed("loop0", 0));
+    model.updateFromCounters(both, 10.0);
+    const DiskDeviceId loopId = *model.historyView().findDevice("loop0");
+
+    model.updateFromCounters(singleDisk(diskNamed("sda", 0)), 20.0);
+    ASSERT_FALSE(model.historyView().findDevice("loop0").has_value());
+
+    Platform::SystemDiskCounters replugged;
+    replugged.disks.push_back(diskNamed("sda", 0));
+    replugged.disks.push_back(diskNamed("loop1", 0));
+    model.updateFromCounters(replugged, 21.0);
+
+    const auto view = model.historyView();
+    EXPECT_EQ(view.findDevice("loop1"), loopId);
+    EXPECT_EQ(view.series(loopId, DiskMetric::ReadBytesPerSec).size(), 1U);
+}
+
+TEST(StorageModelTest, ReturningDeviceRestartsRates)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+    model.updateFromCounters(singleDisk(diskNamed("sdd", 1000)), 1.0);
+    model.updateFromCounters({}, 2.0);
+
+    // Same name, fresh counters: the first sample back has no rate rather than a bogus delta
+    model.updateFromCounters(singleDisk(diskNamed("sdd", 4000)), 3.0);
+    EXPECT_DOUBLE_EQ(model.latestSnapshot().disks[0].readBytesPerSec, 0.0);
+
+    model.updateFromCounters(singleDisk(diskNamed("sdd", 4002)), 4.0);
+    EXPECT_DOUBLE_EQ(model.latestSnapshot().disks[0].readBytesPerSec, 1024.0);
+}
+
+// =============================================================================
+// Mounted Filesystems
+// =============================================================================
+
+Platform::SystemDiskCounters singleMount(std::uint64_t usedBytes, std::uint64_t sequence)
+{
+    constexpr std::uint64_t TOTAL = 1000ULL * 1000ULL;
+    Platform::MountCounters mount;
+    mount.mountPoint = "/data";
+    mount.fsType = "ext4";
+    mount.deviceName = "sda1";
+    mount.diskName = "sda";
+    mount.totalBytes = TOTAL;
+    mount.freeBytes = TOTAL - usedBytes;
+    mount.availBytes = TOTAL - usedBytes - 50'000; // 50 kB reserved for root
+    mount.totalInodes = 1000;
+    mount.freeInodes = 750;
+    mount.capacitySequence = sequence;
+    mount.hasCapacity = true;
+
+    Platform::SystemDiskCounters counters;
+    counters.mounts.push_back(mount);
+    return counters;
+}
+
+TEST(StorageModelTest, MountUsageMatchesDf)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+    model.updateFromCounters(singleMount(450'000, 1), 1.0);
+
+    const auto snap = model.latestSnapshot();
+    ASSERT_EQ(snap.mounts.size(), 1U);
+    const auto& mount = snap.mounts[0];
+    EXPECT_EQ(mount.usedBytes, 450'000U);
+    EXPECT_EQ(mount.availBytes, 500'000U);
+    // Reserved blocks are excluded from the denominator: 450k / (450k + 500k)
+    EXPECT_NEAR(mount.usedPercent, 47.368, 0.001);
+    EXPECT_EQ(mount.usedInodes, 250U);
+    EXPECT_DOUBLE_EQ(mount.inodeUsedPercent, 25.0);
+    EXPECT_EQ(mount.diskName, "sda");
+    EXPECT_DOUBLE_EQ(mount.fillBytesPerSec, 0.0);
+    EXPECT_DOUBLE_EQ(mount.secondsToFull, -1.0);
+}
+
+TEST(StorageModelTest, MountFillRateProjectsTimeToFull)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+    // 1 kB/s growth, sampled every 10 s
+    model.updateFromCounters(singleMount(100'000, 1), 0.0);
+    model.updateFromCounters(singleMount(110'000, 2), 10.0);
+    model.updateFromCounters(singleMount(120'000, 3), 20.0);
+
+    const auto& mount = model.latestSnapshot().mounts[0];
+    EXPECT_NEAR(mount.fillBytesPerSec, 1000.0, 1e-6);
+    // 830 kB available at 1 kB/s
+    EXPECT_NEAR(mount.secondsToFull, 830.0, 1e-6);
+}
+
+TEST(StorageModelTest, RepeatedCapacityReadingIsNotResampled)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+    model.updateFromCounters(singleMount(100'000, 1), 0.0);
+    model.updateFromCounters(singleMount(110'000, 2), 10.0);
+    // Probe ticks between capacity refreshes repeat the cached reading
+    model.updateFromCounters(singleMount(110'000, 2), 11.0);
+    model.updateFromCounters(singleMount(110'000, 2), 12.0);
+
+    EXPECT_NEAR(model.latestSnapshot().mounts[0].fillBytesPerSec, 1000.0, 1e-6);
+    EXPECT_EQ(model.historyView().mountUsedBytes("/data").size(), 2U);
+}
+
+TEST(StorageModelTest, ShrinkingMountHasNoTimeToFull)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+    model.updateFromCounters(singleMount(200'000, 1), 0.0);
+    model.updateFromCounters(singleMount(100'000, 2), 10.0);
+
+    const auto& mount = model.latestSnapshot().mounts[0];
+    EXPECT_LT(mount.fillBytesPerSec, 0.0);
+    EXPECT_DOUBLE_EQ(mount.secondsToFull, -1.0);
+}
+
+TEST(StorageModelTest, MountTrendUsesOnlyTheHistoryWindow)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+    model.setMaxHistorySeconds(30.0);
+    // A burst long ago, then flat usage
+    model.updateFromCounters(singleMount(100'000, 1), 0.0);
+    model.updateFromCounters(singleMount(500'000, 2), 10.0);
+    model.updateFromCounters(singleMount(500'000, 3), 50.0);
+    model.updateFromCounters(singleMount(500'000, 4), 60.0);
+
+    EXPECT_DOUBLE_EQ(model.latestSnapshot().mounts[0].fillBytesPerSec, 0.0);
+    EXPECT_EQ(model.historyView().mountSampleTimes("/data").size(), 2U);
+}
+
+TEST(StorageModelTest, UnmountedFilesystemIsDropped)
+{
+    StorageModel model(std::make_unique<Mocks::MockDiskProbe>());
+    model.updateFromCounters(singleMount(100'000, 1), 0.0);
+    ASSERT_FALSE(model.historyView().mountSampleTimes("/data").empty());
+
+    model.updateFromCounters({}, 1.0);
+    EXPECT_TRUE(model.latestSnapshot().mounts.empty());
+    EXPECT_TRUE(model.historyView().mountSampleTimes("/data").empty());
+}
+
 } // namespace
 } // namespace Domain
@@ -8,16 +8,21 @@
 /// - History tracking
 /// - Thread-safe operations
 /// - Per-core CPU tracking
+/// - Power status refresh on supply change notification
 
 #include "Domain/SamplingConfig.h"
 #include "Domain/SystemModel.h"
 #include "Mocks/MockProbes.h"
+#include "Platform/PowerTypes.h"
 #include "Platform/SystemTypes.h"
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <thread>
+#include <utility>
 #include <vector>
 
 // Use shared mock from TestMocks namespace
@@ -25,6 +30,7 @@ using TestMocks::makeCpuCounters;
 using TestMocks::makeInterfaceCounters;
 using TestMocks::makeMemoryCounters;
 using TestMocks::makeSystemCounters;
+using TestMocks::MockPowerProbe;
 using TestMocks::MockSystemProbe;
 
 // =============================================================================
@@ -442,6 +448,406 @@ TEST(SystemModelTest, PerCoreHistoryTracked)
     EXPECT_FLOAT_EQ(perCoreHist[0][0], 50.0F); // 50% CPU on core 0
 }
 
+TEST(SystemModelTest, PerCoreHistoryStableAcrossCoreOffline)
+{
+    Domain::SystemModel model(nullptr);
+
+    // Tick helper: cores listed in ids, core N at (N * 10)% busy since the previous tick
+    auto makeTick = [](const std::vector<std::uint32_t>& ids, std::uint64_t tick)
+    {
+        Platform::SystemCounters counters;
+        for (const auto id : ids)
+        {
+            const std::uint64_t busy = id * 10;
+            counters.cpuPerCore.push_back(makeCpuCounters(busy * tick, 0, 0, (100 - busy) * tick));
+        }
+        counters.cpuPerCoreIds = ids;
+        return counters;
+    };
+
+    model.updateFromCounters(makeTick({0, 1, 2, 3}, 1), 1.0);
+    model.updateFromCounters(makeTick({0, 1, 2, 3}, 2), 2.0);
+
+    // cpu2 goes offline: cpu3 must keep its slot instead of shifting into cpu2's
+    model.updateFromCounters(makeTick({0, 1, 3}, 3), 3.0);
+
+    auto snap = model.snapshot();
+    EXPECT_EQ(snap.coreCount, 3);
+    ASSERT_EQ(snap.cpuPerCore.size(), 4U);
+    ASSERT_EQ(snap.cpuCoreOnline.size(), 4U);
+    EXPECT_EQ(snap.cpuCoreOnline[2], 0U);
+    EXPECT_DOUBLE_EQ(snap.cpuPerCore[2].totalPercent, 0.0);
+    EXPECT_DOUBLE_EQ(snap.cpuPerCore[3].totalPercent, 30.0);
+
+    auto perCoreHist = model.perCoreHistory();
+    ASSERT_EQ(perCoreHist.size(), 4U);
+    for (const auto& hist : perCoreHist)
+    {
+        EXPECT_EQ(hist.size(), 2U); // Offline core keeps an aligned history
+    }
+    EXPECT_FLOAT_EQ(perCoreHist[3][0], 30.0F);
+    EXPECT_FLOAT_EQ(perCoreHist[3][1], 30.0F);
+    EXPECT_FLOAT_EQ(perCoreHist[2][0], 20.0F);
+    EXPECT_FLOAT_EQ(perCoreHist[2][1], 0.0F);
+
+    // cpu2 comes back: first sample after onlining has no valid delta, the next one does
+    model.updateFromCounters(makeTick({0, 1, 2, 3}, 4), 4.0);
+    snap = model.snapshot();
+    EXPECT_EQ(snap.cpuCoreOnline[2], 1U);
+    EXPECT_DOUBLE_EQ(snap.cpuPerCore[2].totalPercent, 0.0);
+
+    model.updateFromCounters(makeTick({0, 1, 2, 3}, 5), 5.0);
+    snap = model.snapshot();
+    EXPECT_DOUBLE_EQ(snap.cpuPerCore[2].totalPercent, 20.0);
+    EXPECT_EQ(model.perCoreHistory()[3].size(), 4U);
+}
+
+TEST(SystemModelTest, PerCoreHistoryBackfilledForHotpluggedCore)
+{
+    Domain::SystemModel model(nullptr);
+
+    Platform::SystemCounters two;
+    two.cpuPerCore = {makeCpuCounters(0, 0, 0, 0), makeCpuCounters(0, 0, 0, 0)};
+    model.updateFromCounters(two, 1.0);
+    two.cpuPerCore = {makeCpuCounters(50, 0, 0, 50), makeCpuCounters(50, 0, 0, 50)};
+    model.updateFromCounters(two, 2.0);
+
+    // A third vCPU is hotplugged
+    Platform::SystemCounters three;
+    three.cpuPerCore = {makeCpuCounters(100, 0, 0, 100), makeCpuCounters(100, 0, 0, 100), makeCpuCounters(0, 0, 0, 0)};
+    model.updateFromCounters(three, 3.0);
+
+    const auto perCoreHist = model.perCoreHistory();
+    const auto timestamps = model.timestamps();
+    ASSERT_EQ(perCoreHist.size(), 3U);
+    ASSERT_EQ(timestamps.size(), 2U);
+    for (const auto& hist : perCoreHist)
+    {
+        EXPECT_EQ(hist.size(), timestamps.size()); // New core must not truncate the others
+    }
+}
+
+TEST(SystemModelTest, PerCoreFrequencyMappedByLogicalCpuId)
+{
+    Domain::SystemModel model(nullptr);
+
+    auto makeTick = [](std::uint64_t tick)
+    {
+        Platform::SystemCounters counters;
+        counters.cpuPerCore = {makeCpuCounters(10 * tick, 0, 0, 90 * tick), makeCpuCounters(10 * tick, 0, 0, 90 * tick)};
+        counters.cpuPerCoreIds = {0, 3}; // cpu1 and cpu2 offline
+        counters.cpuPerCoreFreqMHz = {1200, 3400};
+        return counters;
+    };
+
+    model.updateFromCounters(makeTick(1), 1.0);
+    model.updateFromCounters(makeTick(2), 2.0);
+
+    const auto snap = model.snapshot();
+    ASSERT_EQ(snap.cpuPerCoreFreqMHz.size(), 4U);
+    EXPECT_EQ(snap.cpuPerCoreFreqMHz[0], 1200U);
+    EXPECT_EQ(snap.cpuPerCoreFreqMHz[1], 0U);
+    EXPECT_EQ(snap.cpuPerCoreFreqMHz[2], 0U);
+    EXPECT_EQ(snap.cpuPerCoreFreqMHz[3], 3400U);
+
+    const auto freqHist = model.perCoreFreqHistory();
+    const auto timestamps = model.timestamps();
+    ASSERT_EQ(freqHist.size(), 4U);
+    for (const auto& hist : freqHist)
+    {
+        EXPECT_EQ(hist.size(), timestamps.size());
+    }
+    ASSERT_FALSE(freqHist[3].empty());
+    EXPECT_FLOAT_EQ(freqHist[3].back(), 3400.0F);
+    EXPECT_FLOAT_EQ(freqHist[1].back(), 0.0F);
+}
+
+// =============================================================================
+// Pressure Stall Information Tests
+// =============================================================================
+
+namespace
+{
+
+Platform::PressureCounters makePressure(std::uint64_t someUs, std::uint64_t fullUs, bool hasSome = true, bool hasFull = true)
+{
+    return Platform::PressureCounters{
+        .available = hasSome || hasFull, .hasSome = hasSome, .hasFull = hasFull, .someTotalUs = someUs, .fullTotalUs = fullUs};
+}
+
+Platform::PressureCounters& pressureOf(Platform::SystemCounters& counters, Platform::PressureResource resource)
+{
+    return counters.pressure[static_cast<std::size_t>(resource)];
+}
+
+} // namespace
+
+TEST(SystemModelTest, PressurePercentComputedFromTotalDeltas)
+{
+    Domain::SystemModel model(nullptr);
+    using Platform::PressureResource;
+
+    auto first = makeSystemCounters(makeCpuCounters(100, 0, 0, 900), makeMemoryCounters(1024, 512));
+    pressureOf(first, PressureResource::Cpu) = makePressure(1'000'000, 0);
+    pressureOf(first, PressureResource::Memory) = makePressure(0, 0);
+    pressureOf(first, PressureResource::Io) = makePressure(5'000'000, 2'000'000);
+    pressureOf(first, PressureResource::Irq) = makePressure(0, 10'000, false, true);
+    model.updateFromCounters(first, 10.0);
+
+    // Two seconds later: cpu some stalled 0.5s, io some 1s / full 0.2s, irq full 0.02s
+    auto second = makeSystemCounters(makeCpuCounters(200, 0, 0, 1800), makeMemoryCounters(1024, 512));
+    pressureOf(second, PressureResource::Cpu) = makePressure(1'500'000, 0);
+    pressureOf(second, PressureResource::Memory) = makePressure(0, 0);
+    pressureOf(second, PressureResource::Io) = makePressure(6'000'000, 2'200'000);
+    pressureOf(second, PressureResource::Irq) = makePressure(0, 30'000, false, true);
+    model.updateFromCounters(second, 12.0);
+
+    const auto snap = model.snapshot();
+    EXPECT_TRUE(snap.pressureCpu.available);
+    EXPECT_NEAR(snap.pressureCpu.somePercent, 25.0, 1e-9);
+    EXPECT_NEAR(snap.pressureCpu.fullPercent, 0.0, 1e-9);
+    EXPECT_NEAR(snap.pressureMemory.somePercent, 0.0, 1e-9);
+    EXPECT_NEAR(snap.pressureIo.somePercent, 50.0, 1e-9);
+    EXPECT_NEAR(snap.pressureIo.fullPercent, 10.0, 1e-9);
+    EXPECT_FALSE(snap.pressureIrq.hasSome);
+    EXPECT_NEAR(snap.pressureIrq.fullPercent, 1.0, 1e-9);
+
+    const auto cpuSome = model.pressureSomeHistory(PressureResource::Cpu);
+    const auto ioFull = model.pressureFullHistory(PressureResource::Io);
+    ASSERT_EQ(cpuSome.size(), model.timestamps().size());
+    ASSERT_EQ(ioFull.size(), model.timestamps().size());
+    EXPECT_FLOAT_EQ(cpuSome.back(), 25.0F);
+    EXPECT_FLOAT_EQ(ioFull.back(), 10.0F);
+}
+
+TEST(SystemModelTest, PressureUnavailableReportsZero)
+{
+    Domain::SystemModel model(nullptr);
+
+    model.updateFromCounters(makeSystemCounters(makeCpuCounters(100, 0, 0, 900), makeMemoryCounters(1024, 512)), 1.0);
+    model.updateFromCounters(makeSystemCounters(makeCpuCounters(200, 0, 0, 1800), makeMemoryCounters(1024, 512)), 2.0);
+
+    const auto snap = model.snapshot();
+    EXPECT_FALSE(snap.pressureCpu.available);
+    EXPECT_DOUBLE_EQ(snap.pressureCpu.somePercent, 0.0);
+    EXPECT_EQ(model.pressureSomeHistory(Platform::PressureResource::Cpu).size(), model.timestamps().size());
+}
+
+TEST(SystemModelTest, PressureCounterResetDoesNotGoNegative)
+{
+    Domain::SystemModel model(nullptr);
+    using Platform::PressureResource;
+
+    auto first = makeSystemCounters(makeCpuCounters(100, 0, 0, 900), makeMemoryCounters(1024, 512));
+    pressureOf(first, PressureResource::Cpu) = makePressure(9'000'000, 0);
+    model.updateFromCounters(first, 1.0);
+
+    auto second = makeSystemCounters(makeCpuCounters(200, 0, 0, 1800), makeMemoryCounters(1024, 512));
+    pressureOf(second, PressureResource::Cpu) = makePressure(100, 0);
+    model.updateFromCounters(second, 2.0);
+
+    EXPECT_DOUBLE_EQ(model.snapshot().pressureCpu.somePercent, 0.0);
+}
+
+// =============================================================================
+// Kernel Activity Tests
+// =============================================================================
+
+namespace
+{
+
+void setActivity(Platform::SystemCounters& counters, Platform::ActivityCounter counter, std::uint64_t total)
+{
+    counters.activity.totals[static_cast<std::size_t>(counter)] = total;
+    counters.activity.present[static_cast<std::size_t>(counter)] = true;
+}
+
+} // namespace
+
+TEST(SystemModelTest, ActivityRatesComputedFromCounterDeltas)
+{
+    Domain::SystemModel model(nullptr);
+    using Platform::ActivityCounter;
+
+    auto first = makeSystemCounters(makeCpuCounters(100, 0, 0, 900), makeMemoryCounters(1024, 512));
+    setActivity(first, ActivityCounter::ContextSwitches, 1'000'000);
+    setActivity(first, ActivityCounter::PageInKiB, 100);
+    setActivity(first, ActivityCounter::MajorFaults, 50);
+    setActivity(first, ActivityCounter::RunqueueWaitNs, 0);
+    first.activity.procsRunning = 3;
+    first.activity.hasProcCounts = true;
+    model.updateFromCounters(first, 10.0);
+
+    EXPECT_TRUE(model.snapshot().activity.available);
+    EXPECT_EQ(model.snapshot().activity.procsRunning, 3U);
+    EXPECT_DOUBLE_EQ(model.snapshot().activity.contextSwitchesPerSec, 0.0); // No previous sample yet
+
+    // Two seconds later
+    auto second = makeSystemCounters(makeCpuCounters(200, 0, 0, 1800), makeMemoryCounters(1024, 512));
+    setActivity(second, ActivityCounter::ContextSwitches, 1'040'000);
+    setActivity(second, ActivityCounter::PageInKiB, 300);
+    setActivity(second, ActivityCounter::MajorFaults, 60);
+    setActivity(second, ActivityCounter::RunqueueWaitNs, 3'000'000'000ULL); // 1.5 tasks waiting on average
+    second.activity.procsRunning = 5;
+    second.activity.procsBlocked = 1;
+    second.activity.hasProcCounts = true;
+    model.updateFromCounters(second, 12.0);
+
+    const auto activity = model.snapshot().activity;
+    EXPECT_DOUBLE_EQ(activity.contextSwitchesPerSec, 20'000.0);
+    EXPECT_DOUBLE_EQ(activity.pageInBytesPerSec, 100.0 * 1024.0);
+    EXPECT_DOUBLE_EQ(activity.majorFaultsPerSec, 5.0);
+    EXPECT_DOUBLE_EQ(activity.runqueueWaitTasks, 1.5);
+    EXPECT_TRUE(activity.hasRunqueueWait);
+    EXPECT_FALSE(activity.hasOomKills);
+    EXPECT_EQ(activity.procsRunning, 5U);
+    EXPECT_EQ(activity.procsBlocked, 1U);
+
+    const auto ctxHist = model.activityHistory(ActivityCounter::ContextSwitches);
+    ASSERT_EQ(ctxHist.size(), model.timestamps().size());
+    EXPECT_FLOAT_EQ(ctxHist.back(), 20'000.0F);
+    EXPECT_EQ(model.activityHistory(ActivityCounter::OomKills).size(), model.timestamps().size());
+}
+
+TEST(SystemModelTest, ActivityRateZeroWhenCounterMissingOrReset)
+{
+    Domain::SystemModel model(nullptr);
+    using Platform::ActivityCounter;
+
+    auto first = makeSystemCounters(makeCpuCounters(100, 0, 0, 900), makeMemoryCounters(1024, 512));
+    setActivity(first, ActivityCounter::PageFaults, 9'000);
+    model.updateFromCounters(first, 1.0);
+
+    // pgfault went backwards; swap counter appears only in the second sample
+    auto second = makeSystemCounters(makeCpuCounters(200, 0, 0, 1800), makeMemoryCounters(1024, 512));
+    setActivity(second, ActivityCounter::PageFaults, 10);
+    setActivity(second, ActivityCounter::SwapInPages, 500);
+    model.updateFromCounters(second, 2.0);
+
+    const auto activity = model.snapshot().activity;
+    EXPECT_DOUBLE_EQ(activity.pageFaultsPerSec, 0.0);
+    EXPECT_DOUBLE_EQ(activity.swapInPagesPerSec, 0.0);
+}
+
+TEST(SystemModelTest, ActivityUnavailableWithoutCounters)
+{
+    Domain::SystemModel model(nullptr);
+    model.updateFromCounters(makeSystemCounters(makeCpuCounters(100, 0, 0, 900), makeMemoryCounters(1024, 512)), 1.0);
+    model.updateFromCounters(makeSystemCounters(makeCpuCounters(200, 0, 0, 1800), makeMemoryCounters(1024, 512)), 2.0);
+
+    EXPECT_FALSE(model.snapshot().activity.available);
+    EXPECT_EQ(model.activityHistory(Platform::ActivityCounter::ContextSwitches).size(), model.timestamps().size());
+}
+
+// =============================================================================
+// NUMA Node Tests
+// =============================================================================
+
+namespace
+{
+
+Platform::NumaNodeCounters makeNumaNode(std::uint32_t id, std::vector<std::uint32_t> cpuIds, std::uint64_t local, std::uint64_t other)
+{
+    Platform::NumaNodeCounters node;
+    node.nodeId = id;
+    node.memTotalBytes = 1000;
+    node.memFreeBytes = 250;
+    node.cpuIds = std::move(cpuIds);
+    node.hasNumaStat = true;
+    node.numaHit = local + other;
+    node.localNode = local;
+    node.otherNode = other;
+    return node;
+}
+
+// Four cores, core N at (N * 10 + 10)% busy since the previous tick
+Platform::SystemCounters makeNumaTick(std::uint64_t tick, std::vector<Platform::NumaNodeCounters> nodes)
+{
+    Platform::SystemCounters counters;
+    for (std::uint32_t id = 0; id < 4; ++id)
+    {
+        const std::uint64_t busy = (id * 10) + 10;
+        counters.cpuPerCore.push_back(makeCpuCounters(busy * tick, 0, 0, (100 - busy) * tick));
+        counters.cpuPerCoreIds.push_back(id);
+    }
+    counters.numaNodes = std::move(nodes);
+    return counters;
+}
+
+} // namespace
+
+TEST(SystemModelTest, NumaNodeCpuMemoryAndAllocationRates)
+{
+    Domain::SystemModel model(nullptr);
+
+    model.updateFromCounters(makeNumaTick(1, {makeNumaNode(0, {0, 1}, 1000, 0), makeNumaNode(1, {2, 3}, 500, 100)}), 1.0);
+    model.updateFromCounters(makeNumaTick(2, {makeNumaNode(0, {0, 1}, 1200, 0), makeNumaNode(1, {2, 3}, 800, 200)}), 3.0);
+
+    const auto snap = model.snapshot();
+    ASSERT_EQ(snap.numaNodes.size(), 2U);
+
+    const auto& node0 = snap.numaNodes[0];
+    EXPECT_EQ(node0.memUsedBytes, 750U);
+    EXPECT_DOUBLE_EQ(node0.memUsedPercent, 75.0);
+    EXPECT_EQ(node0.cpuOnline, 2U);
+    EXPECT_DOUBLE_EQ(node0.cpuPercent, 15.0); // Mean of 10% and 20%
+    EXPECT_DOUBLE_EQ(node0.localPagesPerSec, 100.0);
+    EXPECT_DOUBLE_EQ(node0.localPercent, 100.0);
+
+    const auto& node1 = snap.numaNodes[1];
+    EXPECT_DOUBLE_EQ(node1.cpuPercent, 35.0); // Mean of 30% and 40%
+    EXPECT_DOUBLE_EQ(node1.localPagesPerSec, 150.0);
+    EXPECT_DOUBLE_EQ(node1.otherPagesPerSec, 50.0);
+    EXPECT_DOUBLE_EQ(node1.localPercent, 75.0);
+}
+
+TEST(SystemModelTest, NumaNodeCpusOutsidePerCoreAreIgnored)
+{
+    Domain::SystemModel model(nullptr);
+
+    // Memory-only node and a cpulist naming a core the per-core counters do not have
+    model.updateFromCounters(makeNumaTick(1, {makeNumaNode(0, {0, 9}, 0, 0), makeNumaNode(1, {}, 0, 0)}), 1.0);
+    model.updateFromCounters(makeNumaTick(2, {makeNumaNode(0, {0, 9}, 0, 0), makeNumaNode(1, {}, 0, 0)}), 2.0);
+
+    const auto snap = model.snapshot();
+    ASSERT_EQ(snap.numaNodes.size(), 2U);
+    EXPECT_EQ(snap.numaNodes[0].cpuCount, 2U);
+    EXPECT_EQ(snap.numaNodes[0].cpuOnline, 1U);
+    EXPECT_DOUBLE_EQ(snap.numaNodes[0].cpuPercent, 10.0);
+    EXPECT_EQ(snap.numaNodes[1].cpuOnline, 0U);
+    EXPECT_DOUBLE_EQ(snap.numaNodes[1].cpuPercent, 0.0);
+    EXPECT_DOUBLE_EQ(snap.numaNodes[1].localPercent, 100.0); // Nothing allocated
+}
+
+TEST(SystemModelTest, NumaHistorySlottedByNodeIdWithBackfill)
+{
+    Domain::SystemModel model(nullptr);
+
+    model.updateFromCounters(makeNumaTick(1, {makeNumaNode(0, {0, 1}, 0, 0)}), 1.0);
+    model.updateFromCounters(makeNumaTick(2, {makeNumaNode(0, {0, 1}, 0, 0)}), 2.0);
+
+    // Node 2 comes online (node 1 never exists): histories grow to three slots, all aligned
+    model.updateFromCounters(makeNumaTick(3, {makeNumaNode(0, {0, 1}, 0, 0), makeNumaNode(2, {2, 3}, 0, 0)}), 3.0);
+
+    const auto timestamps = model.timestamps();
+    const auto memHist = model.numaMemoryHistory();
+    const auto cpuHist = model.numaCpuHistory();
+    ASSERT_EQ(memHist.size(), 3U);
+    ASSERT_EQ(cpuHist.size(), 3U);
+    for (std::size_t i = 0; i < memHist.size(); ++i)
+    {
+        EXPECT_EQ(memHist[i].size(), timestamps.size()) << "node " << i;
+        EXPECT_EQ(cpuHist[i].size(), timestamps.size()) << "node " << i;
+    }
+    EXPECT_EQ(model.numaLocalHistory().size(), 3U);
+
+    EXPECT_FLOAT_EQ(memHist[0].back(), 75.0F);
+    EXPECT_FLOAT_EQ(memHist[1].back(), 0.0F);
+    EXPECT_FLOAT_EQ(memHist[2].front(), 0.0F); // Backfilled
+    EXPECT_FLOAT_EQ(memHist[2].back(), 75.0F);
+    EXPECT_FLOAT_EQ(cpuHist[2].back(), 35.0F);
+}
+
 // =============================================================================
 // updateFromCounters Tests
 // =============================================================================
@@ -1282,3 +1688,62 @@ TEST(SystemModelTest, BatteryChargeHistoryTracked)
     auto chargeHist = model.batteryChargeHistory();
     EXPECT_FALSE(chargeHist.empty());
 }
+
+namespace
+{
+
+Platform::PowerCounters makePowerCounters(Platform::BatteryState state, bool isOnAc, int chargePercent = -1)
+{
+    Platform::PowerCounters counters;
+    counters.state = state;
+    counters.isOnAc = isOnAc;
+    counters.chargePercent = chargePercent;
+    return counters;
+}
+
+} // namespace
+
+TEST(SystemModelTest, PowerChangeRefreshesStatusBeforeNextTick)
+{
+    auto probe = std::make_unique<MockSystemProbe>();
+    probe->setCounters(makeSystemCounters(makeCpuCounters(1000, 0, 500, 8500), makeMemoryCounters(1024, 512)));
+    auto powerProbe = std::make_unique<MockPowerProbe>();
+    auto* rawPower = powerProbe.get();
+    rawPower->setCapabilities({.hasBattery = true, .hasChargePercent = true});
+    rawPower->setCounters(makePowerCounters(Platform::BatteryState::Charging, true, 80));
+
+    Domain::SystemModel model(std::move(probe), std::move(powerProbe));
+    model.refresh();
+    EXPECT_TRUE(model.snapshot().power.isOnAc);
+
+    // Nothing changed: no extra probe read
+    EXPECT_FALSE(model.pollPowerChange());
+    EXPECT_EQ(rawPower->readCount(), 1);
+
+    // AC unplugged: the snapshot follows without a refresh()
+    rawPower->setCounters(makePowerCounters(Platform::BatteryState::Discharging, false, 80));
+    rawPower->markChanged();
+    EXPECT_TRUE(model.pollPowerChange());
+    EXPECT_FALSE(model.snapshot().power.isOnAc);
+    EXPECT_TRUE(model.snapshot().power.isDischarging);
+}
+
+TEST(SystemModelTest, PowerChangePicksUpHotpluggedBattery)
+{
+    auto probe = std::make_unique<MockSystemProbe>();
+    probe->setCounters(makeSystemCounters(makeCpuCounters(1000, 0, 500, 8500), makeMemoryCounters(1024, 512)));
+    auto powerProbe = std::make_unique<MockPowerProbe>();
+    auto* rawPower = powerProbe.get();
+    rawPower->setCounters(makePowerCounters(Platform::BatteryState::NotPresent, true));
+
+    Domain::SystemModel model(std::move(probe), std::move(powerProbe));
+    model.refresh();
+    EXPECT_FALSE(model.snapshot().power.hasBattery);
+
+    rawPower->setCapabilities({.hasBattery = true, .hasChargePercent = true});
+    rawPower->setCounters(makePowerCounters(Platform::BatteryState::Discharging, false, 55));
+    rawPower->markChanged();
+    ASSERT_TRUE(model.pollPowerChange());
+    EXPECT_TRUE(model.snapshot().power.hasBattery);
+    EXPECT_EQ(model.snapshot().power.chargePercent, 55);
+}
@@ -0,0 +1,362 @@
+/// @file StubNVML.cpp
+/// @brief Stand-in for libnvidia-ml.so, built as a shared library for NVMLGPUProbe tests.
+///
+/// Exports the NVML entry points NVMLGPUProbe loads with dlsym, backed by scripted devices.
+/// Tests dlopen the same library and script it through the stubNvml* control functions.
+/// Sample queries follow NVML's contract: only samples newer than lastSeenTimeStamp are
+/// returned, NVML_ERROR_NOT_FOUND when there are none, and a null or short buffer reports
+/// the required size (NVML_ERROR_INSUFFICIENT_SIZE for process queries).
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// NOLINTBEGIN(readability-identifier-naming,cppcoreguidelines-pro-type-union-access) - mirrors the NVML C API
+namespace
+{
+
+enum nvmlReturn_t : unsigned int
+{
+    NVML_SUCCESS = 0,
+    NVML_ERROR_INVALID_ARGUMENT = 2,
+    NVML_ERROR_NOT_FOUND = 6,
+    NVML_ERROR_INSUFFICIENT_SIZE = 7,
+};
+
+constexpr unsigned int NVML_GPU_UTILIZATION_SAMPLES = 1;
+constexpr unsigned int NVML_VALUE_TYPE_UNSIGNED_INT = 1;
+
+struct nvmlMemory_t
+{
+    unsigned long long total;
+    unsigned long long free;
+    unsigned long long used;
+};
+
+struct nvmlUtilization_t
+{
+    unsigned int gpu;
+    unsigned int memory;
+};
+
+struct nvmlProcessInfo_t
+{
+    unsigned int pid;
+    unsigned long long usedGpuMemory;
+    unsigned int gpuInstanceId;
+    unsigned int computeInstanceId;
+};
+
+union nvmlValue_t
+{
+    double dVal;
+    int siVal;
+    unsigned int uiVal;
+    unsigned long ulVal;
+    unsigned long long ullVal;
+    signed long long sllVal;
+};
+
+struct nvmlSample_t
+{
+    unsigned long long timeStamp;
+    nvmlValue_t sampleValue;
+};
+
+struct nvmlProcessUtilizationSample_t
+{
+    unsigned int pid;
+    unsigned long long timeStamp;
+    unsigned int smUtil;
+    unsigned int memUtil;
+    unsigned int encUtil;
+    unsigned int decUtil;
+};
+
+constexpr unsigned int SAMPLE_BUFFER_SIZE = 120; // Like the driver's utilization ring
+
+struct StubDevice
+{
+    unsigned int pointUtilization = 0;
+    std::vector<nvmlSample_t> utilizationSamples;
+    std::vector<nvmlProcessUtilizationSample_t> processSamples;
+    std::vector<nvmlProcessInfo_t> computeProcesses;
+    std::vector<nvmlProcessInfo_t> graphicsProcesses;
+};
+
+struct StubState
+{
+    std::mutex mutex;
+    std::vector<StubDevice> devices;
+    unsigned int runningProcessCalls = 0;
+    unsigned int processUtilizationCalls = 0;
+    unsigned int pointUtilizationCalls = 0;
+};
+
+StubState& state()
+{
+    static StubState instance;
+    return instance;
+}
+
+StubDevice* device(void* handle)
+{
+    return static_cast<StubDevice*>(handle);
+}
+
+nvmlReturn_t runningProcesses(const std::vector<nvmlProcessInfo_t>& processes, unsigned int* count, nvmlProcessInfo_t* infos)
+{
+    ++state().runningProcessCalls;
+    const auto available = static_cast<unsigned int>(processes.size());
+    if (infos == nullptr || *count < available)
+    {
+        const bool empty = available == 0;
+        *count = available;
+        return empty ? NVML_SUCCESS : NVML_ERROR_INSUFFICIENT_SIZE;
+    }
+    std::ranges::copy(processes, infos);
+    *count = available;
+    return NVML_SUCCESS;
+}
+
+} // namespace
+
+extern "C"
+{
+
+// --- Control functions (test side) ---
+
+__attribute__((visibility("default"))) void stubNvmlReset(unsigned int deviceCount)
+{
+    const std::scoped_lock lock(state().mutex);
+    state().devices.assign(deviceCount, StubDevice{});
+    state().runningProcessCalls = 0;
+    state().processUtilizationCalls = 0;
+    state().pointUtilizationCalls = 0;
+}
+
+__attribute__((visibility("default"))) void stubNvmlSetPointUtilization(unsigned int index, unsigned int percent)
+{
+    const std::scoped_lock lock(state().mutex);
+    state().devices.at(index).pointUtilization = percent;
+}
+
+__attribute__((visibility("default"))) void stubNvmlAddUtilizationSample(unsigned int index, unsigned long long timeStamp, unsigned int percent)
+{
+    const std::scoped_lock lock(state().mutex);
+    nvmlSample_t sample{};
+    sample.timeStamp = timeStamp;
+    sample.sampleValue.uiVal = percent;
+    state().devices.at(index).utilizationSamples.push_back(sample);
+}
+
+__attribute__((visibility("default"))) void stubNvmlAddProcessSample(
+    unsigned int index, unsigned int pid, unsigned long long timeStamp, unsigned int sm, unsigned int enc, unsigned int dec)
+{
+    const std::scoped_lock lock(state().mutex);
+    state().devices.at(index).processSamples.push_back({pid, timeStamp, sm, 0, enc, dec});
+}
+
+__attribute__((visibility("default"))) void
+stubNvmlAddRunningProcess(unsigned int index, unsigned int pid, unsigned long long memoryBytes, int graphics)
+{
+    const std::scoped_lock lock(state().mutex);
+    auto& stub = state().devices.at(index);
+    (graphics != 0 ? stub.graphicsProcesses : stub.computeProcesses).push_back({pid, memoryBytes, 0, 0});
+}
+
+__attribute__((visibility("default"))) unsigned int stubNvmlRunningProcessCalls()
+{
+    const std::scoped_lock lock(state().mutex);
+    return state().runningProcessCalls;
+}
+
+__attribute__((visibility("default"))) unsigned int stubNvmlProcessUtilizationCalls()
+{
+    const std::scoped_lock lock(state().mutex);
+    return state().processUtilizationCalls;
+}
+
+__attribute__((visibility("default"))) unsigned int stubNvmlPointUtilizationCalls()
+{
+    const std::scoped_lock lock(state().mutex);
+    return state().pointUtilizationCalls;
+}
+
+// --- NVML entry points (probe side) ---
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlInit_v2()
+{
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlShutdown()
+{
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetCount_v2(unsigned int* count)
+{
+    const std::scoped_lock lock(state().mutex);
+    *count = static_cast<unsigned int>(state().devices.size());
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetHandleByIndex_v2(unsigned int index, void** handle)
+{
+    const std::scoped_lock lock(state().mutex);
+    if (index >= state().devices.size())
+    {
+        return NVML_ERROR_INVALID_ARGUMENT;
+    }
+    *handle = &state().devices[index];
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetName(void* /*handle*/, char* name, unsigned int length)
+{
+    std::strncpy(name, "Stub GPU", length - 1);
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetUUID(void* handle, char* uuid, unsigned int length)
+{
+    const std::scoped_lock lock(state().mutex);
+    const auto index = device(handle) - state().devices.data();
+    const std::string id = "GPU-stub-" + std::to_string(index);
+    std::strncpy(uuid, id.c_str(), length - 1);
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetMemoryInfo(void* /*handle*/, nvmlMemory_t* memory)
+{
+    *memory = {.total = 8ULL << 30, .free = 6ULL << 30, .used = 2ULL << 30};
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetUtilizationRates(void* handle, nvmlUtilization_t* utilization)
+{
+    const std::scoped_lock lock(state().mutex);
+    ++state().pointUtilizationCalls;
+    *utilization = {.gpu = device(handle)->pointUtilization, .memory = 0};
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetTemperature(void* /*handle*/, unsigned int /*sensor*/, unsigned int* temp)
+{
+    *temp = 50;
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetPowerUsage(void* /*handle*/, unsigned int* milliwatts)
+{
+    *milliwatts = 100000;
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetPowerManagementLimit(void* /*handle*/, unsigned int* milliwatts)
+{
+    *milliwatts = 250000;
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetClockInfo(void* /*handle*/, unsigned int /*type*/, unsigned int* clock)
+{
+    *clock = 1500;
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetFanSpeed(void* /*handle*/, unsigned int* speed)
+{
+    *speed = 30;
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetPcieThroughput(void* /*handle*/, unsigned int /*counter*/, unsigned int* value)
+{
+    *value = 0;
+    return NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t
+nvmlDeviceGetComputeRunningProcesses(void* handle, unsigned int* count, nvmlProcessInfo_t* infos)
+{
+    const std::scoped_lock lock(state().mutex);
+    return runningProcesses(device(handle)->computeProcesses, count, infos);
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t
+nvmlDeviceGetGraphicsRunningProcesses(void* handle, unsigned int* count, nvmlProcessInfo_t* infos)
+{
+    const std::scoped_lock lock(state().mutex);
+    return runningProcesses(device(handle)->graphicsProcesses, count, infos);
+}
+
+__attribute__((visibility("default"))) const char* nvmlErrorString(nvmlReturn_t /*result*/)
+{
+    return "stub error";
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetSamples(void* handle,
+                                                                          unsigned int type,
+                                                                          unsigned long long lastSeenTimeStamp,
+                                                                          unsigned int* valueType,
+                                                                          unsigned int* count,
+                                                                          nvmlSample_t* samples)
+{
+    const std::scoped_lock lock(state().mutex);
+    if (type != NVML_GPU_UTILIZATION_SAMPLES)
+    {
+        return NVML_ERROR_INVALID_ARGUMENT;
+    }
+    *valueType = NVML_VALUE_TYPE_UNSIGNED_INT;
+    if (samples == nullptr)
+    {
+        *count = SAMPLE_BUFFER_SIZE;
+        return NVML_SUCCESS;
+    }
+
+    unsigned int written = 0;
+    for (const auto& sample : device(handle)->utilizationSamples)
+    {
+        if (sample.timeStamp > lastSeenTimeStamp && written < *count)
+        {
+            samples[written++] = sample;
+        }
+    }
+    *count = written;
+    return written == 0 ? NVML_ERROR_NOT_FOUND : NVML_SUCCESS;
+}
+
+__attribute__((visibility("default"))) nvmlReturn_t nvmlDeviceGetProcessUtilization(void* handle,
+                                                                                     nvmlProcessUtilizationSample_t* samples,
+                                                                                     unsigned int* count,
+                                                                                     unsigned long long lastSeenTimeStamp)
+{
+    const std::scoped_lock lock(state().mutex);
+    ++state().processUtilizationCalls;
+
+    std::vector<nvmlProcessUtilizationSample_t> newer;
+    std::ranges::copy_if(device(handle)->processSamples,
+                         std::back_inserter(newer),
+                         [lastSeenTimeStamp](const auto& sample) { return sample.timeStamp > lastSeenTimeStamp; });
+    if (newer.empty())
+    {
+        *count = 0;
+        return NVML_ERROR_NOT_FOUND;
+    }
+    if (samples == nullptr || *count < newer.size())
+    {
+        *count = static_cast<unsigned int>(newer.size());
+        return NVML_ERROR_INSUFFICIENT_SIZE;
+    }
+    std::ranges::copy(newer, samples);
+    *count = static_cast<unsigned int>(newer.size());
+    return NVML_SUCCESS;
+}
+
+} // extern "C"
+// NOLINTEND(readability-identifier-naming,cppcoreguidelines-pro-type-union-access)
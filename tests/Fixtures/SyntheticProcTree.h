@@ -0,0 +1,279 @@
+/// @file SyntheticProcTree.h
+/// @brief Generator for synthetic procfs/sysfs trees used by tests and benchmarks
+
+#pragma once
+
+#include "Platform/Linux/SystemRoots.h"
+#include "TempTree.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+namespace Fixtures
+{
+
+/// Shape of a generated tree. Per-process fd counts and command-line lengths cycle through
+/// [base, base + spread] by process index, so one tree mixes light and heavy processes.
+struct SyntheticProcOptions
+{
+    std::size_t processes = 100;
+    std::size_t fdsPerProcess = 8;     // Entries in <pid>/fd
+    std::size_t fdSpread = 0;          // Extra fds for some processes (index % (spread + 1))
+    std::size_t socketsPerProcess = 2; // How many of the fds are socket:[inode] links
+    std::size_t cmdlineBytes = 64;     // Approximate length of <pid>/cmdline
+    std::size_t cmdlineSpread = 0;     // Extra cmdline bytes for some processes
+    std::int32_t firstPid = 1000;
+};
+
+/// A /proc-shaped tree (plus a /sys skeleton, empty until a helper adds to it) under a fresh temporary directory,
+/// removed on destruction. Point a probe at it with roots().
+///
+/// Every process gets stat, statm, status, cmdline, io, cgroup and an fd directory of
+/// symlinks; the top level gets stat (with btime), meminfo, uptime, loadavg, net/dev (lo,
+/// synth0, synth1) and a "self" link to the first process. All values are deterministic functions of the process index
+/// so tests can assert on them. Pass a tmpfs directory (e.g. /dev/shm) as @p parent to keep
+/// benchmarks off the disk.
+class SyntheticProcTree
+{
+  public:
+    static constexpr std::uint64_t BOOT_TIME_EPOCH = 1700000000;
+    static constexpr std::uint64_t MEM_TOTAL_KB = 16384000;
+    static constexpr std::uint32_t UID = 1000;
+    static constexpr std::size_t CGROUP_SCOPES = 8;
+
+    explicit SyntheticProcTree(SyntheticProcOptions options = {},
+                               const std::filesystem::path& parent = std::filesystem::temp_directory_path())
+        : m_Options(options), m_Tree("proc", parent), m_Root(m_Tree.root())
+    {
+        std::filesystem::create_directories(m_Root / "sys");
+        writeSystemFiles();
+        for (std::size_t index = 0; index < m_Options.processes; ++index)
+        {
+            writeProcess(index);
+        }
+        if (m_Options.processes > 0)
+        {
+            std::filesystem::create_directory_symlink(std::to_string(pid(0)), procRoot() / "self");
+        }
+    }
+
+    ~SyntheticProcTree() = default;
+
+    SyntheticProcTree(const SyntheticProcTree&) = delete;
+    SyntheticProcTree& operator=(const SyntheticProcTree&) = delete;
+    SyntheticProcTree(SyntheticProcTree&&) = delete;
+    SyntheticProcTree& operator=(SyntheticProcTree&&) = delete;
+
+    [[nodiscard]] std::filesystem::path procRoot() const
+    {
+        return m_Root / "proc";
+    }
+
+    [[nodiscard]] std::filesystem::path sysRoot() const
+    {
+        return m_Root / "sys";
+    }
+
+    /// Roots for constructing probes against this tree.
+    [[nodiscard]] Platform::SystemRoots roots() const
+    {
+        return Platform::SystemRoots{.proc = procRoot().string(), .sys = sysRoot().string()};
+    }
+
+    [[nodiscard]] const SyntheticProcOptions& options() const noexcept
+    {
+        return m_Options;
+    }
+
+    [[nodiscard]] std::int32_t pid(std::size_t index) const noexcept
+    {
+        return m_Options.firstPid + static_cast<std::int32_t>(index);
+    }
+
+    [[nodiscard]] static std::string name(std::size_t index)
+    {
+        return "worker-" + std::to_string(index % 97);
+    }
+
+    [[nodiscard]] std::size_t fdCount(std::size_t index) const noexcept
+    {
+        return m_Options.fdsPerProcess + (index % (m_Options.fdSpread + 1));
+    }
+
+    [[nodiscard]] std::size_t socketCount(std::size_t index) const noexcept
+    {
+        return m_Options.socketsPerProcess < fdCount(index) ? m_Options.socketsPerProcess : fdCount(index);
+    }
+
+    /// Inode of socket @p socket of process @p index (its fd/ link reads "socket:[inode]").
+    [[nodiscard]] std::uint64_t socketInode(std::size_t index, std::size_t socket) const noexcept
+    {
+        return 100000 + (static_cast<std::uint64_t>(index) * 1024) + socket;
+    }
+
+    /// Command line as LinuxProcessProbe reports it (arguments joined by spaces).
+    [[nodiscard]] std::string command(std::size_t index) const
+    {
+        const std::size_t target = m_Options.cmdlineBytes + (index % (m_Options.cmdlineSpread + 1));
+        std::string command = "/usr/bin/" + name(index) + " --config /etc/app.conf";
+        for (std::size_t arg = 0; command.size() < target; ++arg)
+        {
+            command += " --opt" + std::to_string(arg) + "=value";
+        }
+        return command;
+    }
+
+    [[nodiscard]] static std::uint64_t threads(std::size_t index) noexcept
+    {
+        return 1 + (index % 8);
+    }
+
+    [[nodiscard]] static std::uint64_t userTicks(std::size_t index) noexcept
+    {
+        return 100 + (index * 3);
+    }
+
+    [[nodiscard]] static std::uint64_t systemTicks(std::size_t index) noexcept
+    {
+        return 50 + index;
+    }
+
+    /// cgroup v2 path of process @p index; processes are spread over eight scopes.
+    [[nodiscard]] static std::string cgroupPath(std::size_t index)
+    {
+        return "/user.slice/app-" + std::to_string(index % CGROUP_SCOPES) + ".scope";
+    }
+
+    /// Mount a cgroup v2 hierarchy at <sys>/fs/cgroup holding every process's scope, each
+    /// with cgroup.freeze and cpu.pressure. Construct probes after calling this.
+    void addCgroupV2() const
+    {
+        const auto root = sysRoot() / "fs" / "cgroup";
+        std::filesystem::create_directories(root);
+        std::ofstream(root / "cgroup.controllers") << "cpuset cpu io memory pids\n";
+        for (std::size_t scope = 0; scope < CGROUP_SCOPES; ++scope)
+        {
+            const auto dir = root / cgroupPath(scope).substr(1);
+            std::filesystem::create_directories(dir);
+            std::ofstream(dir / "cgroup.freeze") << "0\n";
+            std::ofstream(dir / "cpu.pressure") << "some avg10=0.00 avg60=0.00 avg300=0.00 total=" << (1000 * (scope + 1)) << '\n'
+                                                << "full avg10=0.00 avg60=0.00 avg300=0.00 total=" << (500 * (scope + 1)) << '\n';
+        }
+    }
+
+    /// Freeze (or thaw) the scope of process @p index, as `systemctl freeze` would.
+    void setFrozen(std::size_t index, bool frozen) const
+    {
+        std::ofstream(sysRoot() / "fs" / "cgroup" / cgroupPath(index).substr(1) / "cgroup.freeze") << (frozen ? "1\n" : "0\n");
+    }
+
+    /// Open fd @p fd of process @p index on DRM node @p node and give it @p fdinfo as its
+    /// /proc/<pid>/fdinfo/<fd>. Call again with new contents to advance the client's counters.
+    void writeDrmFd(std::size_t index, int fd, std::string_view fdinfo, std::string_view node = "/dev/dri/renderD128") const
+    {
+        const auto dir = procRoot() / std::to_string(pid(index));
+        const auto link = dir / "fd" / std::to_string(fd);
+        if (!std::filesystem::is_symlink(link))
+        {
+            std::filesystem::create_symlink(std::filesystem::path(node), link);
+        }
+        std::filesystem::create_directories(dir / "fdinfo");
+        std::ofstream(dir / "fdinfo" / std::to_string(fd)) << "pos:\t0\nflags:\t02100002\nmnt_id:\t26\nino:\t1063\n" << fdinfo;
+    }
+
+    /// Add <sys>/class/drm/card<card> for a PCI device @p pdev bound to @p driver, laid out
+    /// like sysfs (device and driver are symlinks).
+    void addDrmCard(unsigned card, std::string_view driver, std::string_view pdev) const
+    {
+        const auto devices = sysRoot() / "devices" / "pci0000:00";
+        const auto drivers = sysRoot() / "bus" / "pci" / "drivers";
+        std::filesystem::create_directories(devices / pdev);
+        std::filesystem::create_directories(drivers / driver);
+        std::filesystem::create_directory_symlink(std::filesystem::path("../../../bus/pci/drivers") / driver, devices / pdev / "driver");
+
+        const auto cardDir = sysRoot() / "class" / "drm" / ("card" + std::to_string(card));
+        std::filesystem::create_directories(cardDir);
+        std::filesystem::create_directory_symlink(std::filesystem::path("../../../devices/pci0000:00") / pdev, cardDir / "device");
+    }
+
+  private:
+    void writeSystemFiles() const
+    {
+        const auto proc = procRoot();
+        std::filesystem::create_directories(proc);
+        std::ofstream(proc / "stat") << "cpu  4705 356 584 3699176 23060 0 277 0 0 0\n"
+                                     << "cpu0 1393 280 290 1849176 11030 0 183 0 0 0\n"
+                                     << "cpu1 3312 76 294 1850000 12030 0 94 0 0 0\n"
+                                     << "intr 114930548 113199788 3 0 5 263 0 4 [...]\n"
+                                     << "ctxt 1990473\nbtime " << BOOT_TIME_EPOCH << "\nprocesses 2915\n"
+                                     << "procs_running 1\nprocs_blocked 0\n";
+        std::ofstream(proc / "meminfo") << "MemTotal:       " << MEM_TOTAL_KB << " kB\nMemFree:         8192000 kB\n"
+                                        << "MemAvailable:   12288000 kB\nBuffers:          512000 kB\nCached:          2048000 kB\n"
+                                        << "SwapTotal:       4096000 kB\nSwapFree:        4096000 kB\n";
+        std::ofstream(proc / "uptime") << "12345.67 23456.78\n";
+        std::ofstream(proc / "loadavg") << "0.50 0.40 0.30 1/" << m_Options.processes << ' ' << pid(0) << '\n';
+        std::filesystem::create_directories(proc / "net");
+        std::ofstream(proc / "net" / "dev")
+            << "Inter-|   Receive                                                |  Transmit\n"
+            << " face |bytes    packets errs drop fifo frame compressed multicast|bytes    packets errs drop fifo colls carrier compressed\n"
+            << "    lo:  500000    5000    0    0    0     0          0         0   500000    5000    0    0    0     0       0          0\n"
+            << "synth0:  100000    1000    0    0    0     0          0         0   200000    2000    0    0    0     0       0          0\n"
+            << "synth1:  300000    3000    0    0    0     0          0         0   400000    4000    0    0    0     0       0          0\n";
+    }
+
+    void writeProcess(std::size_t index) const
+    {
+        const std::int32_t processId = pid(index);
+        const auto dir = procRoot() / std::to_string(processId);
+        std::filesystem::create_directories(dir / "fd");
+
+        std::ofstream(dir / "stat") << processId << " (" << name(index) << ") S 1 " << processId << ' ' << processId
+                                    << " 0 -1 4194560 1520 0 3 0 " << userTicks(index) << ' ' << systemTicks(index) << " 0 0 20 0 "
+                                    << threads(index) << " 0 " << (1234 + index) << " 23592960 2270 "
+                                    << "18446744073709551615 1 1 0 0 0 0 0 4096 0 0 0 0 17 3 0 0 0 0 0\n";
+        std::ofstream(dir / "statm") << "5760 2270 1720 123 0 1032 0\n";
+
+        std::ofstream status(dir / "status");
+        status << "Name:\t" << name(index) << "\nUmask:\t0022\nState:\tS (sleeping)\nTgid:\t" << processId << "\nNgid:\t0\nPid:\t"
+               << processId << "\nPPid:\t1\nTracerPid:\t0\nUid:\t" << UID << '\t' << UID << '\t' << UID << '\t' << UID << "\nGid:\t"
+               << UID << '\t' << UID << '\t' << UID << '\t' << UID << "\nFDSize:\t64\nGroups:\t" << UID
+               << "\nVmPeak:\t   23040 kB\nVmSize:\t   23040 kB\nVmLck:\t       0 kB\nVmHWM:\t    9080 kB\n"
+               << "VmRSS:\t    9080 kB\nRssAnon:\t    2200 kB\nRssFile:\t    6880 kB\nRssShmem:\t       0 kB\n"
+               << "VmData:\t    4128 kB\nVmStk:\t     132 kB\nVmExe:\t     492 kB\nVmLib:\t    2860 kB\n"
+               << "VmPTE:\t      84 kB\nVmSwap:\t       0 kB\nThreads:\t" << threads(index)
+               << "\nSigQ:\t0/63158\nSigPnd:\t0000000000000000\nShdPnd:\t0000000000000000\n"
+               << "SigBlk:\t0000000000000000\nSigIgn:\t0000000000001000\nSigCgt:\t0000000180004002\n"
+               << "CapInh:\t0000000000000000\nCapPrm:\t0000000000000000\nCapEff:\t0000000000000000\n"
+               << "CapBnd:\t000001ffffffffff\nCapAmb:\t0000000000000000\nNoNewPrivs:\t0\nSeccomp:\t0\n"
+               << "Cpus_allowed:\tff\nCpus_allowed_list:\t0-7\nMems_allowed_list:\t0\n"
+               << "voluntary_ctxt_switches:\t150\nnonvoluntary_ctxt_switches:\t3\n";
+
+        std::ofstream cmdline(dir / "cmdline", std::ios::binary);
+        for (const char c : command(index))
+        {
+            cmdline << (c == ' ' ? '\0' : c);
+        }
+        cmdline << '\0';
+
+        std::ofstream(dir / "io") << "rchar: 123456\nwchar: 7890\nsyscr: 120\nsyscw: 40\nread_bytes: 4096\n"
+                                  << "write_bytes: 8192\ncancelled_write_bytes: 0\n";
+        std::ofstream(dir / "cgroup") << "0::" << cgroupPath(index) << '\n';
+
+        const std::size_t sockets = socketCount(index);
+        for (std::size_t fd = 0; fd < fdCount(index); ++fd)
+        {
+            const std::string target = fd < sockets ? "socket:[" + std::to_string(socketInode(index, fd)) + "]" : "/dev/null";
+            std::filesystem::create_symlink(target, dir / "fd" / std::to_string(fd));
+        }
+    }
+
+    SyntheticProcOptions m_Options;
+    TempTree m_Tree; // Owns the directory and removes it on destruction
+    std::filesystem::path m_Root;
+};
+
+} // namespace Fixtures
@@ -0,0 +1,77 @@
+/// @file TempTree.h
+/// @brief Self-removing temporary directory for tests that lay out procfs/sysfs-shaped files
+
+#pragma once
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include <unistd.h>
+
+namespace Fixtures
+{
+
+/// Write @p text to @p path, creating missing parent directories and replacing any previous
+/// contents.
+inline void writeFile(const std::filesystem::path& path, std::string_view text)
+{
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << text;
+}
+
+/// A fresh directory "tasksmack_<prefix>_<pid>_<n>" under @p parent, removed with everything
+/// in it on destruction. The counter keeps trees of one test process apart, so fixtures can
+/// nest or run side by side.
+class TempTree
+{
+  public:
+    explicit TempTree(std::string_view prefix, const std::filesystem::path& parent = std::filesystem::temp_directory_path())
+        : m_Root(parent / uniqueName(prefix))
+    {
+        std::filesystem::create_directories(m_Root);
+    }
+
+    ~TempTree()
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(m_Root, ec);
+    }
+
+    TempTree(const TempTree&) = delete;
+    TempTree& operator=(const TempTree&) = delete;
+    TempTree(TempTree&&) = delete;
+    TempTree& operator=(TempTree&&) = delete;
+
+    [[nodiscard]] const std::filesystem::path& root() const noexcept
+    {
+        return m_Root;
+    }
+
+    /// "<root>/<relative>".
+    [[nodiscard]] std::filesystem::path path(const std::filesystem::path& relative) const
+    {
+        return m_Root / relative;
+    }
+
+    /// writeFile() relative to the root.
+    void write(const std::filesystem::path& relative, std::string_view text) const
+    {
+        writeFile(m_Root / relative, text);
+    }
+
+  private:
+    [[nodiscard]] static std::string uniqueName(std::string_view prefix)
+    {
+        static std::atomic<unsigned> counter{0};
+        return "tasksmack_" + std::string(prefix) + "_" + std::to_string(::getpid()) + "_" + std::to_string(counter++);
+    }
+
+    std::filesystem::path m_Root;
+};
+
+} // namespace Fixtures
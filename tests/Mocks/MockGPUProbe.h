@@ -8,7 +8,9 @@
 
 #include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -148,12 +150,14 @@ class MockGPUProbe : public Platform::IGPUProbe
     [[nodiscard]] std::vector<Platform::GPUCounters> readGPUCounters() override
     {
         ++m_ReadCountersCount;
+        waitWhileHeld();
         return m_Counters;
     }
 
     [[nodiscard]] std::vector<Platform::ProcessGPUCounters> readProcessGPUCounters() override
     {
         ++m_ReadProcessCountersCount;
+        waitWhileHeld();
         return m_ProcessCounters;
     }
 
@@ -183,7 +187,28 @@ class MockGPUProbe : public Platform::IGPUProbe
         return m_ReadProcessCountersCount.load();
     }
 
+    /// Make counter reads block until releaseReads(), simulating a hung driver call.
+    void holdReads()
+    {
+        const std::scoped_lock lock(m_HoldMutex);
+        m_Held = true;
+    }
+
+    /// Notifies under the lock: a detached worker may destroy this probe as soon as its read returns.
+    void releaseReads()
+    {
+        const std::scoped_lock lock(m_HoldMutex);
+        m_Held = false;
+        m_HoldReleased.notify_all();
+    }
+
   private:
+    void waitWhileHeld()
+    {
+        std::unique_lock lock(m_HoldMutex); // NOLINT(misc-const-correctness) - lock guard pattern
+        m_HoldReleased.wait(lock, [this] { return !m_Held; });
+    }
+
     std::vector<Platform::GPUInfo> m_GPUInfo;
     std::vector<Platform::GPUCounters> m_Counters;
     std::vector<Platform::ProcessGPUCounters> m_ProcessCounters;
@@ -192,6 +217,10 @@ class MockGPUProbe : public Platform::IGPUProbe
     std::atomic<std::uint32_t> m_EnumerateCount{0};
     std::atomic<std::uint32_t> m_ReadCountersCount{0};
     std::atomic<std::uint32_t> m_ReadProcessCountersCount{0};
+
+    std::mutex m_HoldMutex;
+    std::condition_variable m_HoldReleased;
+    bool m_Held = false;
 };
 
 } // namespace TestMocks
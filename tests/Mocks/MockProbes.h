@@ -1,19 +1,23 @@
 /// @file MockProbes.h
 /// @brief Shared mock implementations for platform probes used in unit tests.
 ///
-/// This header provides reusable mock classes for IProcessProbe and ISystemProbe,
+/// This header provides reusable mock classes for IProcessProbe, ISystemProbe and IPowerProbe,
 /// along with helper functions for creating test data.
 
 #pragma once
 
+#include "Platform/IPowerProbe.h"
 #include "Platform/IProcessProbe.h"
 #include "Platform/ISystemProbe.h"
+#include "Platform/PowerTypes.h"
 #include "Platform/ProcessTypes.h"
 #include "Platform/SystemTypes.h"
 
 #include <atomic>
 #include <cstdint>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace TestMocks
@@ -216,6 +220,38 @@ class MockProcessProbe : public Platform::IProcessProbe
         return *this;
     }
 
+    MockProcessProbe& withCgroupCpuPressure(int32_t pid, const std::string& cgroupPath, uint64_t someStallUs, uint64_t fullStallUs)
+    {
+        findOrCreateProcess(pid,
+                            [&cgroupPath, someStallUs, fullStallUs](Platform::ProcessCounters& c)
+                            {
+                                c.cgroupPath = cgroupPath;
+                                c.hasCgroupCpuPressure = true;
+                                c.cgroupCpuSomeStallUs = someStallUs;
+                                c.cgroupCpuFullStallUs = fullStallUs;
+                            });
+        return *this;
+    }
+
+    MockProcessProbe& withLastCpu(int32_t pid, int32_t cpu)
+    {
+        findOrCreateProcess(pid, [cpu](Platform::ProcessCounters& c) { c.lastCpu = cpu; });
+        return *this;
+    }
+
+    /// Package energy counters returned by readEnergyCounters().
+    MockProcessProbe& withEnergyCounters(Platform::EnergyCounters counters)
+    {
+        m_EnergyCounters = std::move(counters);
+        return *this;
+    }
+
+    MockProcessProbe& withNumaResidency(int32_t pid, std::vector<uint64_t> kibPerNode)
+    {
+        m_NumaResidency[pid] = std::move(kibPerNode);
+        return *this;
+    }
+
     // Backward compatibility: legacy setters
     void setCounters(std::vector<Platform::ProcessCounters> counters)
     {
@@ -263,6 +299,30 @@ class MockProcessProbe : public Platform::IProcessProbe
         return m_SystemTotalMemory;
     }
 
+    [[nodiscard]] bool readNumaResidency(int32_t pid, std::vector<uint64_t>& kibPerNode) override
+    {
+        m_NumaReadCount.fetch_add(1);
+        const auto it = m_NumaResidency.find(pid);
+        if (it == m_NumaResidency.end())
+        {
+            kibPerNode.clear();
+            return false;
+        }
+        kibPerNode = it->second;
+        return true;
+    }
+
+    [[nodiscard]] Platform::EnergyCounters readEnergyCounters() override
+    {
+        return m_EnergyCounters;
+    }
+
+    /// Get number of times readNumaResidency() was called (thread-safe).
+    [[nodiscard]] int numaReadCount() const
+    {
+        return m_NumaReadCount.load();
+    }
+
     void setSystemTotalMemory(uint64_t bytes)
     {
         m_SystemTotalMemory = bytes;
@@ -305,6 +365,9 @@ class MockProcessProbe : public Platform::IProcessProbe
     Platform::ProcessCapabilities m_Capabilities;
     long m_TicksPerSecond = 100; // Standard HZ value
     std::atomic<int> m_EnumerateCount{0};
+    std::unordered_map<int32_t, std::vector<uint64_t>> m_NumaResidency;
+    std::atomic<int> m_NumaReadCount{0};
+    Platform::EnergyCounters m_EnergyCounters;
 };
 
 // =============================================================================
@@ -366,6 +429,58 @@ class MockSystemProbe : public Platform::ISystemProbe
     std::atomic<int> m_ReadCount{0};
 };
 
+// =============================================================================
+// Mock Power Probe
+// =============================================================================
+
+/// Mock implementation of IPowerProbe for testing.
+/// markChanged() makes the next pollChanged() report a supply change.
+class MockPowerProbe : public Platform::IPowerProbe
+{
+  public:
+    void setCounters(Platform::PowerCounters counters)
+    {
+        m_Counters = std::move(counters);
+    }
+
+    void setCapabilities(Platform::PowerCapabilities caps)
+    {
+        m_Capabilities = caps;
+    }
+
+    void markChanged()
+    {
+        m_Changed = true;
+    }
+
+    [[nodiscard]] Platform::PowerCounters read() override
+    {
+        ++m_ReadCount;
+        return m_Counters;
+    }
+
+    [[nodiscard]] Platform::PowerCapabilities capabilities() const override
+    {
+        return m_Capabilities;
+    }
+
+    [[nodiscard]] bool pollChanged() override
+    {
+        return std::exchange(m_Changed, false);
+    }
+
+    [[nodiscard]] int readCount() const
+    {
+        return m_ReadCount;
+    }
+
+  private:
+    Platform::PowerCounters m_Counters;
+    Platform::PowerCapabilities m_Capabilities;
+    int m_ReadCount = 0;
+    bool m_Changed = false;
+};
+
 // =============================================================================
 // Additional Process Counter Helpers
 // =============================================================================
@@ -0,0 +1,311 @@
+/// @file test_BatchFileReader.cpp
+/// @brief Tests for Platform::BatchFileReader
+///
+/// Every test runs against each backend configuration: forced synchronous reads,
+/// io_uring with fixed-file slots, and io_uring with ordinary descriptors. The io_uring
+/// variants skip themselves where the kernel or a seccomp filter refuses io_uring.
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "Fixtures/TempTree.h"
+#include "Platform/Linux/BatchFileReader.h"
+#include "Platform/Linux/ProcFile.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Platform
+{
+namespace
+{
+
+enum class Mode
+{
+    Sync,
+    RingFixedFiles,
+    RingPlainFiles,
+};
+
+[[nodiscard]] std::string modeName(const ::testing::TestParamInfo<Mode>& info)
+{
+    switch (info.param)
+    {
+    case Mode::Sync:
+        return "Sync";
+    case Mode::RingFixedFiles:
+        return "RingFixedFiles";
+    case Mode::RingPlainFiles:
+        return "RingPlainFiles";
+    }
+    return "Unknown";
+}
+
+class BatchFileReaderTest : public ::testing::TestWithParam<Mode>
+{
+  protected:
+    void SetUp() override
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) - POSIX open() is variadic
+        m_DirFd = ::open(m_Tree.root().c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        ASSERT_GE(m_DirFd, 0);
+    }
+
+    void TearDown() override
+    {
+        ::close(m_DirFd);
+    }
+
+    /// Reader for the current mode, or null if the kernel refuses the io_uring variant.
+    [[nodiscard]] static std::unique_ptr<BatchFileReader> makeReader(BatchFileReader::Options options = {})
+    {
+        options.useIoUring = GetParam() != Mode::Sync;
+        options.registerFiles = GetParam() == Mode::RingFixedFiles;
+        auto reader = std::make_unique<BatchFileReader>(options);
+        const bool refused = (options.useIoUring && reader->backend() != BatchFileReader::Backend::IoUring) ||
+                             (options.registerFiles && !reader->usesRegisteredFiles());
+        return refused ? nullptr : std::move(reader);
+    }
+
+    Fixtures::TempTree m_Tree{"batch"};
+    int m_DirFd = -1;
+};
+
+TEST_P(BatchFileReaderTest, ReadsFilesRelativeToDirectory)
+{
+    m_Tree.write("1/stat", "1 (init) S 0\n");
+    m_Tree.write("2/stat", "2 (kthreadd) S 0\n");
+    auto reader = makeReader();
+    if (!reader)
+    {
+        GTEST_SKIP() << "io_uring variant not available on this kernel";
+    }
+
+    const auto first = reader->add(m_DirFd, "1/stat");
+    const auto second = reader->add(m_DirFd, "2/stat");
+    reader->submit();
+
+    EXPECT_EQ(reader->result(first), "1 (init) S 0\n");
+    EXPECT_EQ(reader->result(second), "2 (kthreadd) S 0\n");
+    EXPECT_EQ(reader->error(first), 0);
+    EXPECT_EQ(reader->error(second), 0);
+}
+
+TEST_P(BatchFileReaderTest, MissingFileFailsAlone)
+{
+    m_Tree.write("1/stat", "alive\n");
+    m_Tree.write("3/stat", "also alive\n");
+    auto reader = makeReader();
+    if (!reader)
+    {
+        GTEST_SKIP() << "io_uring variant not available on this kernel";
+    }
+
+    (void) reader->add(m_DirFd, "1/stat");
+    const auto gone = reader->add(m_DirFd, "2/stat");
+    const auto last = reader->add(m_DirFd, "3/stat");
+    reader->submit();
+
+    EXPECT_EQ(reader->error(gone), ENOENT);
+    EXPECT_TRUE(reader->result(gone).empty());
+    EXPECT_EQ(reader->result(0), "alive\n");
+    EXPECT_EQ(reader->result(last), "also alive\n");
+}
+
+TEST_P(BatchFileReaderTest, EmptyFileIsNotAnError)
+{
+    m_Tree.write("empty", "");
+    auto reader = makeReader();
+    if (!reader)
+    {
+        GTEST_SKIP() << "io_uring variant not available on this kernel";
+    }
+
+    const auto index = reader->add(m_DirFd, "empty");
+    reader->submit();
+    EXPECT_EQ(reader->error(index), 0);
+    EXPECT_TRUE(reader->result(index).empty());
+}
+
+TEST_P(BatchFileReaderTest, FileLargerThanSlotIsNotTruncated)
+{
+    const std::string big(10000, 'x');
+    m_Tree.write("big", big);
+    m_Tree.write("small", "ok");
+    auto reader = makeReader({.slotSize = 256});
+    if (!reader)
+    {
+        GTEST_SKIP() << "io_uring variant not available on this kernel";
+    }
+
+    const auto bigIndex = reader->add(m_DirFd, "big");
+    const auto smallIndex = reader->add(m_DirFd, "small");
+    reader->submit();
+
+    EXPECT_EQ(reader->result(bigIndex), big);
+    EXPECT_EQ(reader->result(smallIndex), "ok");
+    if (reader->backend() == BatchFileReader::Backend::IoUring)
+    {
+        EXPECT_EQ(reader->stats().slotOverflows, 1U);
+    }
+}
+
+TEST_P(BatchFileReaderTest, BatchLargerThanQueueDepthIsChunked)
+{
+    constexpr int FILES = 50;
+    for (int i = 0; i < FILES; ++i)
+    {
+        m_Tree.write(std::to_string(i), "value " + std::to_string(i));
+    }
+    auto reader = makeReader({.queueDepth = 8});
+    if (!reader)
+    {
+        GTEST_SKIP() << "io_uring variant not available on this kernel";
+    }
+
+    for (int i = 0; i < FILES; ++i)
+    {
+        (void) reader->add(m_DirFd, std::to_string(i));
+    }
+    reader->submit();
+
+    ASSERT_EQ(reader->size(), static_cast<std::size_t>(FILES));
+    for (int i = 0; i < FILES; ++i)
+    {
+        EXPECT_EQ(reader->result(static_cast<std::size_t>(i)), "value " + std::to_string(i));
+    }
+    if (GetParam() == Mode::RingFixedFiles)
+    {
+        EXPECT_EQ(reader->stats().syscalls, 7U); // ceil(50 / 8) io_uring_enter calls
+    }
+    else if (GetParam() == Mode::Sync)
+    {
+        EXPECT_EQ(reader->stats().syscalls, 3U * FILES); // openat + pread + close each
+    }
+}
+
+TEST_P(BatchFileReaderTest, ClearStartsAFreshBatch)
+{
+    m_Tree.write("a", "first");
+    m_Tree.write("b", "second");
+    auto reader = makeReader();
+    if (!reader)
+    {
+        GTEST_SKIP() << "io_uring variant not available on this kernel";
+    }
+
+    (void) reader->add(m_DirFd, "a");
+    reader->submit();
+    EXPECT_EQ(reader->result(0), "first");
+
+    reader->clear();
+    EXPECT_EQ(reader->size(), 0U);
+    (void) reader->add(m_DirFd, "b");
+    reader->submit();
+    EXPECT_EQ(reader->result(0), "second");
+
+    // Re-submitting re-reads, picking up new contents
+    m_Tree.write("b", "changed");
+    reader->submit();
+    EXPECT_EQ(reader->result(0), "changed");
+    EXPECT_EQ(reader->stats().batches, 3U);
+}
+
+TEST_P(BatchFileReaderTest, AbsolutePathsIgnoreDirectory)
+{
+    m_Tree.write("abs", "absolute");
+    auto reader = makeReader();
+    if (!reader)
+    {
+        GTEST_SKIP() << "io_uring variant not available on this kernel";
+    }
+
+    const auto index = reader->add(AT_FDCWD, m_Tree.path("abs").string());
+    reader->submit();
+    EXPECT_EQ(reader->result(index), "absolute");
+}
+
+TEST_P(BatchFileReaderTest, MatchesProcFileForProcSelf)
+{
+    auto reader = makeReader();
+    if (!reader)
+    {
+        GTEST_SKIP() << "io_uring variant not available on this kernel";
+    }
+
+    const auto index = reader->add(AT_FDCWD, "/proc/self/cmdline");
+    reader->submit();
+
+    ProcFile cmdline("/proc/self/cmdline");
+    ASSERT_TRUE(cmdline.isOpen());
+    EXPECT_EQ(reader->result(index), cmdline.read());
+}
+
+[[nodiscard]] std::size_t openDescriptorCount()
+{
+    std::error_code ec;
+    const auto entries = std::filesystem::directory_iterator("/proc/self/fd", ec);
+    return ec ? 0 : static_cast<std::size_t>(std::distance(begin(entries), end(entries)));
+}
+
+int g_EntersBeforeFault = 0;
+
+/// Lets the first enter of a batch (the opens) through, then fails every later one
+int failAfterFirstEnter()
+{
+    return g_EntersBeforeFault-- > 0 ? 0 : EIO;
+}
+
+TEST_P(BatchFileReaderTest, FailedReadWaveClosesOpenedDescriptors)
+{
+    if (GetParam() != Mode::RingPlainFiles)
+    {
+        GTEST_SKIP() << "Only plain-descriptor chains split opens and reads across two enters";
+    }
+    auto reader = makeReader();
+    if (!reader)
+    {
+        GTEST_SKIP() << "io_uring variant not available on this kernel";
+    }
+
+    constexpr std::size_t FILE_COUNT = 8;
+    for (std::size_t i = 0; i < FILE_COUNT; ++i)
+    {
+        m_Tree.write("f" + std::to_string(i), "value " + std::to_string(i));
+        (void) reader->add(m_DirFd, "f" + std::to_string(i));
+    }
+
+    const std::size_t before = openDescriptorCount();
+    g_EntersBeforeFault = 1;
+    BatchFileReader::setEnterFaultHook(&failAfterFirstEnter);
+    reader->submit();
+    BatchFileReader::setEnterFaultHook(nullptr);
+
+    // The fallback drops the ring, whose own descriptor is the only one that may go away
+    EXPECT_EQ(reader->backend(), BatchFileReader::Backend::Sync);
+    EXPECT_EQ(openDescriptorCount(), before - 1);
+    for (std::size_t i = 0; i < FILE_COUNT; ++i)
+    {
+        EXPECT_EQ(reader->result(i), "value " + std::to_string(i));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends,
+                         BatchFileReaderTest,
+                         ::testing::Values(Mode::Sync, Mode::RingFixedFiles, Mode::RingPlainFiles),
+                         modeName);
+
+} // namespace
+} // namespace Platform
+
+#endif // __linux__ && __has_include(<unistd.h>)
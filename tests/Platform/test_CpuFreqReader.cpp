@@ -0,0 +1,139 @@
+/// @file test_CpuFreqReader.cpp
+/// @brief Tests for Platform::CpuFreqReader
+///
+/// The reader is pointed at a temporary directory laid out like
+/// /sys/devices/system/cpu so values and hotplug transitions are deterministic.
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "Fixtures/TempTree.h"
+#include "Platform/Linux/CpuFreqReader.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace Platform
+{
+namespace
+{
+
+class CpuFreqReaderTest : public ::testing::Test
+{
+  protected:
+    void writeFreq(std::uint32_t cpu, const std::string& file, const std::string& kHz) const
+    {
+        m_Tree.write(std::filesystem::path("cpu" + std::to_string(cpu)) / "cpufreq" / file, kHz + '\n');
+    }
+
+    void removeCpu(std::uint32_t cpu) const
+    {
+        std::filesystem::remove_all(m_Root / ("cpu" + std::to_string(cpu)));
+    }
+
+    Fixtures::TempTree m_Tree{"cpufreq"};
+    std::filesystem::path m_Root = m_Tree.root();
+};
+
+TEST_F(CpuFreqReaderTest, ReadsScalingCurFreqInMHz)
+{
+    writeFreq(0, "scaling_cur_freq", "2400000");
+    writeFreq(1, "scaling_cur_freq", "3600500");
+
+    CpuFreqReader reader(m_Root.string());
+    std::vector<std::uint32_t> mhz;
+    reader.read({0, 1}, mhz);
+
+    ASSERT_EQ(mhz.size(), 2U);
+    EXPECT_EQ(mhz[0], 2400U);
+    EXPECT_EQ(mhz[1], 3600U);
+}
+
+TEST_F(CpuFreqReaderTest, OutputIsParallelToRequestedIds)
+{
+    writeFreq(2, "scaling_cur_freq", "1000000");
+    writeFreq(5, "scaling_cur_freq", "5000000");
+
+    CpuFreqReader reader(m_Root.string());
+    std::vector<std::uint32_t> mhz;
+    reader.read({5, 2}, mhz);
+
+    ASSERT_EQ(mhz.size(), 2U);
+    EXPECT_EQ(mhz[0], 5000U);
+    EXPECT_EQ(mhz[1], 1000U);
+}
+
+TEST_F(CpuFreqReaderTest, MissingCpufreqReportsZero)
+{
+    writeFreq(0, "scaling_cur_freq", "2000000");
+
+    CpuFreqReader reader(m_Root.string());
+    std::vector<std::uint32_t> mhz;
+    reader.read({0, 1}, mhz);
+
+    ASSERT_EQ(mhz.size(), 2U);
+    EXPECT_EQ(mhz[0], 2000U);
+    EXPECT_EQ(mhz[1], 0U);
+}
+
+TEST_F(CpuFreqReaderTest, FallsBackToCpuinfoCurFreq)
+{
+    writeFreq(0, "cpuinfo_cur_freq", "1800000");
+
+    CpuFreqReader reader(m_Root.string());
+    std::vector<std::uint32_t> mhz;
+    reader.read({0}, mhz);
+
+    ASSERT_EQ(mhz.size(), 1U);
+    EXPECT_EQ(mhz[0], 1800U);
+}
+
+TEST_F(CpuFreqReaderTest, RereadSeesUpdatedValueThroughPersistentDescriptor)
+{
+    writeFreq(0, "scaling_cur_freq", "1200000");
+
+    CpuFreqReader reader(m_Root.string());
+    std::vector<std::uint32_t> mhz;
+    reader.read({0}, mhz);
+    ASSERT_EQ(mhz[0], 1200U);
+
+    writeFreq(0, "scaling_cur_freq", "4800000");
+    reader.read({0}, mhz);
+    EXPECT_EQ(mhz[0], 4800U);
+}
+
+TEST_F(CpuFreqReaderTest, ReopensAfterCpuWasAbsent)
+{
+    writeFreq(0, "scaling_cur_freq", "1000000");
+    writeFreq(1, "scaling_cur_freq", "1100000");
+
+    CpuFreqReader reader(m_Root.string());
+    std::vector<std::uint32_t> mhz;
+    reader.read({0, 1}, mhz);
+    ASSERT_EQ(mhz[1], 1100U);
+
+    // CPU 1 goes offline (directory removed), then comes back with a new file
+    removeCpu(1);
+    reader.read({0}, mhz);
+    ASSERT_EQ(mhz.size(), 1U);
+
+    writeFreq(1, "scaling_cur_freq", "2200000");
+    reader.read({0, 1}, mhz);
+    ASSERT_EQ(mhz.size(), 2U);
+    EXPECT_EQ(mhz[1], 2200U);
+}
+
+} // namespace
+} // namespace Platform
+
+#else
+
+TEST(CpuFreqReaderTest, SkippedOnNonLinux)
+{
+    GTEST_SKIP() << "CpuFreqReader tests require Linux (sysfs, unistd.h)";
+}
+
+#endif
@@ -0,0 +1,278 @@
+/// @file test_DrmClientStats.cpp
+/// @brief Tests for Platform::parseDrmFdinfo and Platform::DrmClientStats
+///
+/// The collector runs against Fixtures::SyntheticProcTree with DRM cards and fdinfo files
+/// added per test; samples pass explicit timestamps so utilization is exact.
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "Fixtures/SyntheticProcTree.h"
+#include "Platform/GPUTypes.h"
+#include "Platform/Linux/DrmClientStats.h"
+#include "Platform/Linux/DrmFdinfoParse.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Platform
+{
+namespace
+{
+
+constexpr const char* INTEL_PDEV = "0000:00:02.0";
+constexpr const char* AMD_PDEV = "0000:03:00.0";
+
+/// fdinfo text of an i915 client.
+std::string i915Fdinfo(std::uint64_t clientId, std::uint64_t renderNs, std::uint64_t videoNs = 0, std::uint64_t memoryKiB = 0)
+{
+    return "drm-driver:\ti915\ndrm-pdev:\t" + std::string(INTEL_PDEV) + "\ndrm-client-id:\t" + std::to_string(clientId) +
+           "\ndrm-engine-render:\t" + std::to_string(renderNs) + " ns\ndrm-engine-copy:\t0 ns\ndrm-engine-video:\t" +
+           std::to_string(videoNs) + " ns\ndrm-engine-capacity-video:\t2\ndrm-engine-video-enhance:\t0 ns\n" +
+           "drm-memory-system:\t" + std::to_string(memoryKiB) + " KiB\n";
+}
+
+const ProcessGPUCounters* findProcess(const std::vector<ProcessGPUCounters>& counters, std::int32_t pid)
+{
+    const auto it = std::ranges::find_if(counters, [pid](const ProcessGPUCounters& c) { return c.pid == pid; });
+    return it == counters.end() ? nullptr : &*it;
+}
+
+// ========== parseDrmFdinfo ==========
+
+TEST(DrmFdinfoParseTest, ParsesAmdgpuClient)
+{
+    const std::string text = "pos:\t0\nflags:\t02100002\nmnt_id:\t24\nino:\t1124\n"
+                             "drm-driver:\tamdgpu\ndrm-client-id:\t52\ndrm-pdev:\t0000:03:00.0\n"
+                             "drm-memory-vram:\t8192 KiB\ndrm-memory-gtt:\t2 MiB\ndrm-memory-cpu:\t0 KiB\n"
+                             "drm-engine-gfx:\t1204000000 ns\ndrm-engine-compute:\t0 ns\ndrm-engine-enc:\t35000 ns\n";
+    DrmFdinfo info;
+    ASSERT_TRUE(parseDrmFdinfo(text, info));
+
+    EXPECT_EQ(info.driver, "amdgpu");
+    EXPECT_EQ(info.pdev, "0000:03:00.0");
+    EXPECT_EQ(info.clientId, 52U);
+    EXPECT_EQ(info.memoryBytes, (8192ULL * 1024) + (2ULL * 1024 * 1024));
+    ASSERT_EQ(info.engines.size(), 3U);
+    EXPECT_EQ(info.engines[0].name, "gfx");
+    EXPECT_EQ(info.engines[0].busyNs, 1204000000U);
+    EXPECT_TRUE(info.engines[0].hasBusyNs);
+    EXPECT_EQ(info.engines[2].name, "enc");
+    EXPECT_EQ(info.engines[2].busyNs, 35000U);
+}
+
+TEST(DrmFdinfoParseTest, ParsesEngineCapacity)
+{
+    DrmFdinfo info;
+    ASSERT_TRUE(parseDrmFdinfo(i915Fdinfo(7, 100, 200), info));
+
+    const auto video = std::ranges::find_if(info.engines, [](const DrmEngineUsage& e) { return e.name == "video"; });
+    ASSERT_NE(video, info.engines.end());
+    EXPECT_EQ(video->busyNs, 200U);
+    EXPECT_EQ(video->capacity, 2U);
+
+    const auto render = std::ranges::find_if(info.engines, [](const DrmEngineUsage& e) { return e.name == "render"; });
+    ASSERT_NE(render, info.engines.end());
+    EXPECT_EQ(render->capacity, 1U);
+}
+
+TEST(DrmFdinfoParseTest, ParsesXeCycles)
+{
+    const std::string text = "drm-driver:\txe\ndrm-pdev:\t0000:00:02.0\ndrm-client-id:\t3\n"
+                             "drm-cycles-rcs:\t28257900\ndrm-total-cycles-rcs:\t7655183225\ndrm-engine-capacity-vcs:\t2\n";
+    DrmFdinfo info;
+    ASSERT_TRUE(parseDrmFdinfo(text, info));
+
+    ASSERT_EQ(info.engines.size(), 2U);
+    EXPECT_EQ(info.engines[0].name, "rcs");
+    EXPECT_TRUE(info.engines[0].hasCycles);
+    EXPECT_FALSE(info.engines[0].hasBusyNs);
+    EXPECT_EQ(info.engines[0].cycles, 28257900U);
+    EXPECT_EQ(info.engines[0].totalCycles, 7655183225U);
+    EXPECT_EQ(info.engines[1].name, "vcs");
+    EXPECT_FALSE(info.engines[1].hasCycles);
+}
+
+TEST(DrmFdinfoParseTest, NonDrmFdIsRejected)
+{
+    DrmFdinfo info;
+    EXPECT_FALSE(parseDrmFdinfo("pos:\t0\nflags:\t0100002\nmnt_id:\t22\nino:\t5\n", info));
+    EXPECT_FALSE(parseDrmFdinfo("", info));
+    EXPECT_TRUE(info.engines.empty());
+}
+
+// ========== DrmClientStats ==========
+
+TEST(DrmClientStatsTest, UnavailableWithoutIntelOrAmdCard)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 1});
+    EXPECT_FALSE(DrmClientStats(tree.roots()).isAvailable());
+
+    tree.addDrmCard(0, "nvidia", "0000:01:00.0");
+    DrmClientStats stats(tree.roots());
+    EXPECT_FALSE(stats.isAvailable());
+    EXPECT_TRUE(stats.sample().empty());
+}
+
+TEST(DrmClientStatsTest, FirstSampleReportsMemoryOnly)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 2});
+    tree.addDrmCard(0, "i915", INTEL_PDEV);
+    tree.writeDrmFd(1, 10, i915Fdinfo(5, 1000000000, 0, 4096));
+
+    DrmClientStats stats(tree.roots());
+    ASSERT_TRUE(stats.isAvailable());
+
+    const auto counters = stats.sample(std::chrono::steady_clock::time_point{});
+    ASSERT_EQ(counters.size(), 1U);
+    EXPECT_EQ(counters[0].pid, tree.pid(1));
+    EXPECT_EQ(counters[0].gpuId, INTEL_PDEV);
+    EXPECT_EQ(counters[0].gpuMemoryBytes, 4096U * 1024U);
+    EXPECT_DOUBLE_EQ(counters[0].gpuUtilPercent, 0.0);
+    EXPECT_TRUE(counters[0].activeEngines.empty());
+}
+
+TEST(DrmClientStatsTest, BusyTimeDeltasBecomeUtilization)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 1});
+    tree.addDrmCard(0, "i915", INTEL_PDEV);
+    tree.writeDrmFd(0, 10, i915Fdinfo(5, 1000000000, 0));
+
+    DrmClientStats stats(tree.roots());
+    const std::chrono::steady_clock::time_point start{};
+    (void) stats.sample(start);
+
+    // 0.5 s of render and 1 s of video (over two video engines) in one second
+    tree.writeDrmFd(0, 10, i915Fdinfo(5, 1500000000, 1000000000));
+    const auto counters = stats.sample(start + std::chrono::seconds(1));
+
+    ASSERT_EQ(counters.size(), 1U);
+    EXPECT_NEAR(counters[0].gpuUtilPercent, 50.0, 1e-9);
+    EXPECT_NEAR(counters[0].decoderUtilPercent, 50.0, 1e-9);
+    EXPECT_DOUBLE_EQ(counters[0].encoderUtilPercent, 0.0);
+    EXPECT_EQ(counters[0].activeEngines, (std::vector<std::string>{"3D", "Video Decode"}));
+}
+
+TEST(DrmClientStatsTest, XeCyclesBecomeUtilization)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 1});
+    tree.addDrmCard(0, "xe", INTEL_PDEV);
+    const auto fdinfo = [](std::uint64_t cycles, std::uint64_t total)
+    {
+        return "drm-driver:\txe\ndrm-pdev:\t" + std::string(INTEL_PDEV) + "\ndrm-client-id:\t9\ndrm-cycles-ccs:\t" +
+               std::to_string(cycles) + "\ndrm-total-cycles-ccs:\t" + std::to_string(total) + "\n";
+    };
+    tree.writeDrmFd(0, 10, fdinfo(1000, 100000));
+
+    DrmClientStats stats(tree.roots());
+    (void) stats.sample();
+    tree.writeDrmFd(0, 10, fdinfo(26000, 200000));
+    const auto counters = stats.sample();
+
+    ASSERT_EQ(counters.size(), 1U);
+    EXPECT_NEAR(counters[0].gpuUtilPercent, 25.0, 1e-9);
+    EXPECT_EQ(counters[0].activeEngines, std::vector<std::string>{"Compute"});
+}
+
+TEST(DrmClientStatsTest, SharedClientIsCountedOnce)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 2});
+    tree.addDrmCard(0, "i915", INTEL_PDEV);
+    // Client 5 reachable through a dup()ed fd and through an fd inherited by process 1
+    tree.writeDrmFd(0, 10, i915Fdinfo(5, 0, 0, 1024));
+    tree.writeDrmFd(0, 11, i915Fdinfo(5, 0, 0, 1024));
+    tree.writeDrmFd(1, 10, i915Fdinfo(5, 0, 0, 1024));
+
+    DrmClientStats stats(tree.roots());
+    const auto counters = stats.sample();
+
+    ASSERT_EQ(counters.size(), 1U);
+    EXPECT_EQ(counters[0].gpuMemoryBytes, 1024U * 1024U);
+}
+
+TEST(DrmClientStatsTest, ClientsAreGroupedPerProcessAndGpu)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 2});
+    tree.addDrmCard(0, "i915", INTEL_PDEV);
+    tree.addDrmCard(1, "amdgpu", AMD_PDEV);
+    tree.writeDrmFd(0, 10, i915Fdinfo(1, 0, 0, 100));
+    tree.writeDrmFd(0, 11, i915Fdinfo(2, 0, 0, 200));
+    tree.writeDrmFd(0,
+                    12,
+                    "drm-driver:\tamdgpu\ndrm-pdev:\t" + std::string(AMD_PDEV) +
+                        "\ndrm-client-id:\t1\ndrm-memory-vram:\t300 KiB\ndrm-engine-gfx:\t0 ns\n",
+                    "/dev/dri/renderD129");
+    tree.writeDrmFd(1, 10, i915Fdinfo(3, 0, 0, 400));
+
+    DrmClientStats stats(tree.roots());
+    const auto counters = stats.sample();
+    ASSERT_EQ(counters.size(), 3U);
+
+    const auto intel = std::ranges::find_if(counters, [&](const auto& c) { return c.pid == tree.pid(0) && c.gpuId == INTEL_PDEV; });
+    ASSERT_NE(intel, counters.end());
+    EXPECT_EQ(intel->gpuMemoryBytes, 300U * 1024U);
+
+    const auto amd = std::ranges::find_if(counters, [&](const auto& c) { return c.pid == tree.pid(0) && c.gpuId == AMD_PDEV; });
+    ASSERT_NE(amd, counters.end());
+    EXPECT_EQ(amd->gpuMemoryBytes, 300U * 1024U);
+
+    const auto* other = findProcess(counters, tree.pid(1));
+    ASSERT_NE(other, nullptr);
+    EXPECT_EQ(other->gpuMemoryBytes, 400U * 1024U);
+}
+
+TEST(DrmClientStatsTest, CountersCarryDriverAndPdevAsFallbackName)
+{
+    // amdgpu cards are enumerated by ROCm (if at all), whose ids are not PCI addresses, so
+    // the join needs a name of its own for them
+    const Fixtures::SyntheticProcTree tree({.processes = 1});
+    tree.addDrmCard(0, "amdgpu", AMD_PDEV);
+    tree.writeDrmFd(0, 10, "drm-driver:\tamdgpu\ndrm-pdev:\t" + std::string(AMD_PDEV) + "\ndrm-client-id:\t1\ndrm-engine-gfx:\t0 ns\n");
+
+    DrmClientStats stats(tree.roots());
+    const auto counters = stats.sample();
+    ASSERT_EQ(counters.size(), 1U);
+    EXPECT_EQ(counters[0].gpuId, AMD_PDEV);
+    EXPECT_EQ(counters[0].gpuName, "amdgpu " + std::string(AMD_PDEV));
+}
+
+TEST(DrmClientStatsTest, IgnoresClientsOfUnsupportedDrivers)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 1});
+    tree.addDrmCard(0, "i915", INTEL_PDEV);
+    tree.writeDrmFd(0, 10, "drm-driver:\tnvidia-drm\ndrm-pdev:\t0000:01:00.0\ndrm-client-id:\t4\n");
+    tree.writeDrmFd(0, 11, ""); // DRM fd on a kernel without client stats
+
+    DrmClientStats stats(tree.roots());
+    EXPECT_TRUE(stats.sample().empty());
+}
+
+TEST(DrmClientStatsTest, ReturningClientStartsOver)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 1});
+    tree.addDrmCard(0, "i915", INTEL_PDEV);
+    tree.writeDrmFd(0, 10, i915Fdinfo(5, 1000000000));
+
+    DrmClientStats stats(tree.roots());
+    const std::chrono::steady_clock::time_point start{};
+    (void) stats.sample(start);
+
+    // The client disappears for one sample...
+    tree.writeDrmFd(0, 10, "");
+    EXPECT_TRUE(stats.sample(start + std::chrono::seconds(1)).empty());
+
+    // ...so its next appearance has no baseline to compute utilization from
+    tree.writeDrmFd(0, 10, i915Fdinfo(5, 2000000000));
+    const auto counters = stats.sample(start + std::chrono::seconds(2));
+    ASSERT_EQ(counters.size(), 1U);
+    EXPECT_DOUBLE_EQ(counters[0].gpuUtilPercent, 0.0);
+}
+
+} // namespace
+} // namespace Platform
+
+#endif // __linux__ && __has_include(<unistd.h>)
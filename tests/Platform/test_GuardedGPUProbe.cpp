@@ -0,0 +1,181 @@
+/// @file test_GuardedGPUProbe.cpp
+/// @brief Tests for Platform::GuardedGPUProbe
+///
+/// A MockGPUProbe with held reads stands in for a vendor library stuck inside the driver.
+
+#include "Mocks/MockGPUProbe.h"
+#include "Platform/GPUTypes.h"
+#include "Platform/GuardedGPUProbe.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace Platform
+{
+namespace
+{
+
+using namespace std::chrono_literals;
+
+struct GuardedFixture
+{
+    TestMocks::MockGPUProbe* mock = nullptr;
+    std::unique_ptr<GuardedGPUProbe> guard;
+};
+
+GuardedFixture makeGuarded(GPUProbeGuardConfig config)
+{
+    auto mock = std::make_unique<TestMocks::MockGPUProbe>();
+    mock->withGPU("gpu0", "Test GPU");
+    mock->withCapabilities({.hasTemperature = true, .hasPerProcessMetrics = true});
+    GuardedFixture fixture;
+    fixture.mock = mock.get();
+    fixture.guard = std::make_unique<GuardedGPUProbe>("Mock", std::move(mock), config);
+    return fixture;
+}
+
+/// Poll @p done for up to a second; late results arrive on the worker thread.
+bool eventually(const std::function<bool()>& done)
+{
+    const auto until = std::chrono::steady_clock::now() + 1s;
+    while (!done())
+    {
+        if (std::chrono::steady_clock::now() > until)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+
+TEST(GuardedGPUProbeTest, PassesCallsThroughWhenHealthy)
+{
+    auto fixture = makeGuarded({});
+
+    EXPECT_EQ(fixture.guard->enumerateGPUs().size(), 1U);
+    EXPECT_EQ(fixture.guard->readGPUCounters().size(), 1U);
+    EXPECT_TRUE(fixture.guard->capabilities().hasPerProcessMetrics);
+
+    const auto health = fixture.guard->health();
+    EXPECT_EQ(health.name, "Mock");
+    EXPECT_EQ(health.state, GPUBackendState::Healthy);
+    EXPECT_EQ(health.totalTimeouts, 0U);
+    ASSERT_EQ(fixture.guard->backendHealth().size(), 1U);
+}
+
+TEST(GuardedGPUProbeTest, HungCallReturnsAtDeadline)
+{
+    auto fixture = makeGuarded({.deadline = 50ms});
+    fixture.mock->holdReads();
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto counters = fixture.guard->readGPUCounters();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(counters.empty());
+    EXPECT_GE(elapsed, 50ms);
+    EXPECT_LT(elapsed, 500ms);
+
+    const auto health = fixture.guard->health();
+    EXPECT_EQ(health.state, GPUBackendState::Degraded);
+    EXPECT_EQ(health.consecutiveTimeouts, 1U);
+
+    fixture.mock->releaseReads();
+}
+
+TEST(GuardedGPUProbeTest, BreakerOpensAfterThresholdAndStopsCallingBackend)
+{
+    auto fixture = makeGuarded({.deadline = 20ms, .failureThreshold = 2, .initialBackoff = 10s});
+    fixture.mock->holdReads();
+
+    EXPECT_TRUE(fixture.guard->readGPUCounters().empty()); // Times out
+    EXPECT_TRUE(fixture.guard->readGPUCounters().empty()); // Backend still stuck: fails at once, opens breaker
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(fixture.guard->readGPUCounters().empty());
+    EXPECT_TRUE(fixture.guard->readProcessGPUCounters().empty());
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 20ms);
+
+    EXPECT_EQ(fixture.mock->readCountersCallCount(), 1U);
+    EXPECT_EQ(fixture.mock->readProcessCountersCallCount(), 0U);
+
+    const auto health = fixture.guard->health();
+    EXPECT_EQ(health.state, GPUBackendState::Backoff);
+    EXPECT_EQ(health.totalTimeouts, 2U);
+    EXPECT_GT(health.backoffRemainingSeconds, 5.0);
+
+    fixture.mock->releaseReads();
+}
+
+TEST(GuardedGPUProbeTest, LateResultIsDropped)
+{
+    auto fixture = makeGuarded({.deadline = 20ms});
+    fixture.mock->holdReads();
+    EXPECT_TRUE(fixture.guard->readGPUCounters().empty());
+
+    fixture.mock->releaseReads();
+    EXPECT_TRUE(eventually([&] { return fixture.guard->health().droppedResults == 1; }));
+
+    // The next call gets fresh data, not the stale result
+    EXPECT_EQ(fixture.guard->readGPUCounters().size(), 1U);
+    EXPECT_EQ(fixture.mock->readCountersCallCount(), 2U);
+    EXPECT_EQ(fixture.guard->health().state, GPUBackendState::Healthy);
+}
+
+TEST(GuardedGPUProbeTest, RecoversAfterBackoff)
+{
+    auto fixture = makeGuarded({.deadline = 20ms, .failureThreshold = 1, .initialBackoff = 50ms});
+    fixture.mock->holdReads();
+    EXPECT_TRUE(fixture.guard->readGPUCounters().empty());
+    EXPECT_EQ(fixture.guard->health().state, GPUBackendState::Backoff);
+
+    fixture.mock->releaseReads();
+    EXPECT_TRUE(eventually([&] { return fixture.guard->health().backoffRemainingSeconds == 0.0; }));
+    EXPECT_TRUE(eventually([&] { return fixture.guard->health().droppedResults == 1; }));
+
+    EXPECT_EQ(fixture.guard->readGPUCounters().size(), 1U);
+    const auto health = fixture.guard->health();
+    EXPECT_EQ(health.state, GPUBackendState::Healthy);
+    EXPECT_EQ(health.consecutiveTimeouts, 0U);
+    EXPECT_EQ(health.totalTimeouts, 1U);
+}
+
+TEST(GuardedGPUProbeTest, FailedTrialDoublesBackoff)
+{
+    auto fixture = makeGuarded({.deadline = 20ms, .failureThreshold = 1, .initialBackoff = 50ms, .maxBackoff = 10s});
+    fixture.mock->holdReads();
+    EXPECT_TRUE(fixture.guard->readGPUCounters().empty());
+
+    // Still hung when the backoff ends: the trial fails and the backoff doubles
+    EXPECT_TRUE(eventually([&] { return fixture.guard->health().backoffRemainingSeconds == 0.0; }));
+    EXPECT_TRUE(fixture.guard->readGPUCounters().empty());
+
+    const auto health = fixture.guard->health();
+    EXPECT_EQ(health.state, GPUBackendState::Backoff);
+    EXPECT_GT(health.backoffRemainingSeconds, 0.05);
+    EXPECT_EQ(health.totalTimeouts, 2U);
+
+    fixture.mock->releaseReads();
+}
+
+TEST(GuardedGPUProbeTest, DestroysWhileBackendIsStuck)
+{
+    auto fixture = makeGuarded({.deadline = 20ms});
+    fixture.mock->holdReads();
+    EXPECT_TRUE(fixture.guard->readGPUCounters().empty());
+
+    // The worker is detached and keeps the backend alive until the call returns
+    auto* mock = fixture.mock;
+    fixture.guard.reset();
+    mock->releaseReads();
+}
+
+} // namespace
+} // namespace Platform
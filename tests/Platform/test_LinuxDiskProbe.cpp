@@ -8,11 +8,13 @@
 
 #if defined(__linux__) && __has_include(<unistd.h>)
 
+#include "Platform/Linux/DiskStatsParse.h"
 #include "Platform/Linux/LinuxDiskProbe.h"
 #include "Platform/StorageTypes.h"
 
 #include <chrono>
 #include <fstream>
+#include <string_view>
 #include <thread>
 
 namespace Platform
@@ -160,6 +162,84 @@ TEST(LinuxDiskProbeTest, ConsecutiveReadsAreConsistent)
     EXPECT_EQ(counters1.disks.size(), counters2.disks.size());
 }
 
+// =============================================================================
+// Line Parser
+// =============================================================================
+
+TEST(DiskStatsParseTest, ParsesClassicElevenFieldLine)
+{
+    std::string_view name;
+    DiskCounters disk;
+    ASSERT_TRUE(parseDiskStatsLine("   8       0 sda 100 5 2000 300 50 7 1000 400 2 600 700", name, disk));
+
+    EXPECT_EQ(name, "sda");
+    EXPECT_EQ(disk.readsCompleted, 100ULL);
+    EXPECT_EQ(disk.readsMerged, 5ULL);
+    EXPECT_EQ(disk.readSectors, 2000ULL);
+    EXPECT_EQ(disk.readTimeMs, 300ULL);
+    EXPECT_EQ(disk.writesCompleted, 50ULL);
+    EXPECT_EQ(disk.writesMerged, 7ULL);
+    EXPECT_EQ(disk.writeSectors, 1000ULL);
+    EXPECT_EQ(disk.writeTimeMs, 400ULL);
+    EXPECT_EQ(disk.ioInFlight, 2ULL);
+    EXPECT_EQ(disk.ioTimeMs, 600ULL);
+    EXPECT_EQ(disk.weightedIoTimeMs, 700ULL);
+    EXPECT_FALSE(disk.hasDiscardStats);
+    EXPECT_FALSE(disk.hasFlushStats);
+}
+
+TEST(DiskStatsParseTest, ParsesDiscardFields)
+{
+    std::string_view name;
+    DiskCounters disk;
+    ASSERT_TRUE(parseDiskStatsLine("259 0 nvme0n1 1 0 8 1 2 0 16 2 0 3 3 10 1 4096 20", name, disk));
+
+    EXPECT_EQ(name, "nvme0n1");
+    EXPECT_TRUE(disk.hasDiscardStats);
+    EXPECT_FALSE(disk.hasFlushStats);
+    EXPECT_EQ(disk.discardsCompleted, 10ULL);
+    EXPECT_EQ(disk.discardsMerged, 1ULL);
+    EXPECT_EQ(disk.discardSectors, 4096ULL);
+    EXPECT_EQ(disk.discardTimeMs, 20ULL);
+}
+
+TEST(DiskStatsParseTest, ParsesFlushFields)
+{
+    std::string_view name;
+    DiskCounters disk;
+    ASSERT_TRUE(parseDiskStatsLine("259 0 nvme0n1 1 0 8 1 2 0 16 2 0 3 3 10 1 4096 20 55 110", name, disk));
+
+    EXPECT_TRUE(disk.hasDiscardStats);
+    EXPECT_TRUE(disk.hasFlushStats);
+    EXPECT_EQ(disk.flushesCompleted, 55ULL);
+    EXPECT_EQ(disk.flushTimeMs, 110ULL);
+}
+
+TEST(DiskStatsParseTest, RejectsShortOrMalformedLines)
+{
+    std::string_view name;
+    DiskCounters disk;
+    EXPECT_FALSE(parseDiskStatsLine("", name, disk));
+    EXPECT_FALSE(parseDiskStatsLine("8 0 sda 1 2 3", name, disk));
+    EXPECT_FALSE(parseDiskStatsLine("8 0", name, disk));
+    EXPECT_FALSE(parseDiskStatsLine("x 0 sda 1 2 3 4 5 6 7 8 9 10 11", name, disk));
+}
+
+TEST(LinuxDiskProbeTest, DiscardAndFlushFlagsAreConsistent)
+{
+    LinuxDiskProbe probe;
+    const auto counters = probe.read();
+
+    for (const auto& disk : counters.disks)
+    {
+        // Flush fields come after the discard fields, so they never appear alone
+        if (disk.hasFlushStats)
+        {
+            EXPECT_TRUE(disk.hasDiscardStats) << disk.deviceName;
+        }
+    }
+}
+
 } // namespace
 } // namespace Platform
 
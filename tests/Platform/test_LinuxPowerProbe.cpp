@@ -1,16 +1,24 @@
 /// @file test_LinuxPowerProbe.cpp
 /// @brief Integration tests for Platform::LinuxPowerProbe
 ///
-/// These are integration tests that interact with the real /sys/class/power_supply filesystem.
-/// They verify that the probe correctly reads and parses battery/power information.
+/// The first group are integration tests that interact with the real /sys/class/power_supply
+/// filesystem. The SyntheticPowerSupply tests point the probe at a Fixtures::SyntheticProcTree
+/// whose /sys gets a class/power_supply directory, so batteries, AC state and hotplug are
+/// deterministic.
 
 #include <gtest/gtest.h>
 
 #if defined(__linux__) && __has_include(<unistd.h>)
 
+#include "Fixtures/SyntheticProcTree.h"
+#include "Fixtures/TempTree.h"
 #include "Platform/Linux/LinuxPowerProbe.h"
 #include "Platform/PowerTypes.h"
 
+#include <chrono>
+#include <filesystem>
+#include <string>
+
 namespace Platform
 {
 namespace
@@ -132,6 +140,154 @@ TEST(LinuxPowerProbeTest, ChargePercentInValidRange)
     EXPECT_TRUE(counters.chargePercent == -1 || (counters.chargePercent >= 0 && counters.chargePercent <= 100));
 }
 
+// =============================================================================
+// Synthetic power_supply tree
+// =============================================================================
+
+class SyntheticPowerSupplyTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::filesystem::create_directories(supplies());
+    }
+
+    [[nodiscard]] std::filesystem::path supplies() const
+    {
+        return m_Tree.sysRoot() / "class" / "power_supply";
+    }
+
+    void write(const std::string& supply, const std::string& attribute, const std::string& text) const
+    {
+        Fixtures::writeFile(supplies() / supply / attribute, text + "\n");
+    }
+
+    void writeBattery(const std::string& name, const std::string& status) const
+    {
+        write(name, "type", "Battery");
+        write(name, "status", status);
+        write(name, "capacity", "75");
+        write(name, "energy_now", "30000000");
+        write(name, "energy_full", "40000000");
+        write(name, "energy_full_design", "50000000");
+        write(name, "power_now", "10000000");
+        write(name, "voltage_now", "12000000");
+        write(name, "technology", "Li-poly");
+        write(name, "model_name", "Test Cell");
+    }
+
+    [[nodiscard]] LinuxPowerProbe makeProbe(std::chrono::milliseconds rescanInterval = LinuxPowerProbe::DEFAULT_RESCAN_INTERVAL) const
+    {
+        return LinuxPowerProbe(m_Tree.roots(), rescanInterval);
+    }
+
+    Fixtures::SyntheticProcTree m_Tree{{.processes = 0}};
+};
+
+TEST_F(SyntheticPowerSupplyTest, NoSuppliesMeansNoBatteryOnAc)
+{
+    LinuxPowerProbe probe = makeProbe();
+    EXPECT_FALSE(probe.capabilities().hasBattery);
+    EXPECT_FALSE(probe.hasUevents()); // Synthetic roots never listen to the real kernel
+
+    const auto counters = probe.read();
+    EXPECT_EQ(counters.state, BatteryState::NotPresent);
+    EXPECT_TRUE(counters.isOnAc);
+}
+
+TEST_F(SyntheticPowerSupplyTest, ReadsEnergyBatteryThroughPersistentHandles)
+{
+    writeBattery("BAT0", "Discharging");
+    LinuxPowerProbe probe = makeProbe();
+
+    const auto caps = probe.capabilities();
+    ASSERT_TRUE(caps.hasBattery);
+    EXPECT_TRUE(caps.hasChargeCapacity);
+    EXPECT_TRUE(caps.hasHealthPercent);
+    EXPECT_FALSE(caps.hasCycleCount);
+
+    auto counters = probe.read();
+    EXPECT_EQ(counters.state, BatteryState::Discharging);
+    EXPECT_FALSE(counters.isOnAc);
+    EXPECT_EQ(counters.chargePercent, 75);
+    EXPECT_DOUBLE_EQ(counters.chargeNowWh, 30.0);
+    EXPECT_DOUBLE_EQ(counters.powerNowW, 10.0);
+    EXPECT_EQ(counters.voltageNowMv, 12000U);
+    EXPECT_EQ(counters.healthPercent, 80);
+    EXPECT_EQ(counters.timeToEmptySec, 10800U);
+    EXPECT_EQ(counters.technology, "Li-poly");
+    EXPECT_EQ(counters.model, "Test Cell");
+
+    // Values change in place; the next read sees them without rediscovery
+    write("BAT0", "status", "Charging");
+    write("BAT0", "capacity", "76");
+    counters = probe.read();
+    EXPECT_EQ(counters.state, BatteryState::Charging);
+    EXPECT_EQ(counters.chargePercent, 76);
+    EXPECT_DOUBLE_EQ(counters.powerNowW, -10.0);
+    EXPECT_EQ(probe.scanCount(), 1U);
+}
+
+TEST_F(SyntheticPowerSupplyTest, ConvertsChargeAndCurrentWithVoltage)
+{
+    write("BAT1", "type", "Battery");
+    write("BAT1", "status", "Discharging");
+    write("BAT1", "charge_now", "2000000");  // 2 Ah
+    write("BAT1", "charge_full", "4000000"); // 4 Ah
+    write("BAT1", "charge_full_design", "5000000");
+    write("BAT1", "current_now", "-500000"); // 0.5 A, signed by this driver
+    write("BAT1", "voltage_now", "10000000"); // 10 V
+
+    LinuxPowerProbe probe = makeProbe();
+    const auto counters = probe.read();
+    EXPECT_DOUBLE_EQ(counters.chargeNowWh, 20.0);
+    EXPECT_DOUBLE_EQ(counters.chargeFullWh, 40.0);
+    EXPECT_DOUBLE_EQ(counters.powerNowW, 5.0);
+    EXPECT_EQ(counters.healthPercent, 80);
+}
+
+TEST_F(SyntheticPowerSupplyTest, PrefersSystemBatteryAndReadsMainsOnline)
+{
+    writeBattery("hidpp_battery_0", "Discharging");
+    writeBattery("BAT0", "Not charging");
+    write("AC", "type", "Mains");
+    write("AC", "online", "1");
+    write("ucsi-source-psy-USBC000:001", "type", "USB");
+    write("ucsi-source-psy-USBC000:001", "online", "0");
+
+    LinuxPowerProbe probe = makeProbe();
+    auto counters = probe.read();
+    EXPECT_EQ(counters.state, BatteryState::Full);
+    EXPECT_TRUE(counters.isOnAc);
+
+    // Unplugged but the battery has not flipped to Discharging yet: AC state comes from mains
+    write("AC", "online", "0");
+    counters = probe.read();
+    EXPECT_FALSE(counters.isOnAc);
+
+    // Charging over USB-C counts as AC
+    write("ucsi-source-psy-USBC000:001", "online", "1");
+    counters = probe.read();
+    EXPECT_TRUE(counters.isOnAc);
+}
+
+TEST_F(SyntheticPowerSupplyTest, RescanIntervalPicksUpHotplug)
+{
+    LinuxPowerProbe lazy = makeProbe();
+    LinuxPowerProbe eager = makeProbe(std::chrono::milliseconds{0});
+    ASSERT_FALSE(eager.capabilities().hasBattery);
+
+    writeBattery("BAT0", "Discharging");
+    (void) lazy.read();
+    (void) eager.read();
+
+    // The default interval keeps ticks free of directory walks
+    EXPECT_FALSE(lazy.capabilities().hasBattery);
+    EXPECT_EQ(lazy.scanCount(), 1U);
+    EXPECT_TRUE(eager.capabilities().hasBattery);
+    EXPECT_FALSE(eager.pollChanged()); // No uevents without the real sysfs
+}
+
 } // namespace
 } // namespace Platform
 
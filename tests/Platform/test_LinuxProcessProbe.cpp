@@ -16,14 +16,19 @@
 
 #if TASKSMACK_HAS_UNISTD
 
+#include "Fixtures/SyntheticProcTree.h"
 #include "Platform/Linux/LinuxProcessProbe.h"
 #include "Platform/ProcessTypes.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <limits>
 #include <thread>
+#include <vector>
 
+#include <sched.h>
 #include <unistd.h>
 
 #else
@@ -517,6 +522,100 @@ TEST(LinuxProcessProbeTest, IoCountersIncreaseWithActivity)
     std::filesystem::remove(tempFilePath);
 }
 
+// =============================================================================
+// NUMA Residency Tests
+// =============================================================================
+
+TEST(LinuxProcessProbeTest, NumaResidencyForSelfProcess)
+{
+    LinuxProcessProbe probe;
+    if (!probe.capabilities().hasNumaResidency)
+    {
+        GTEST_SKIP() << "numa_maps not available (kernel built without CONFIG_NUMA)";
+    }
+
+    std::vector<uint64_t> kibPerNode;
+    ASSERT_TRUE(probe.readNumaResidency(getpid(), kibPerNode));
+    ASSERT_FALSE(kibPerNode.empty());
+
+    uint64_t totalKib = 0;
+    for (const uint64_t kib : kibPerNode)
+    {
+        totalKib += kib;
+    }
+    EXPECT_GT(totalKib, 0U); // The test binary itself is resident somewhere
+}
+
+TEST(LinuxProcessProbeTest, NumaResidencyForMissingProcessFails)
+{
+    LinuxProcessProbe probe;
+    std::vector<uint64_t> kibPerNode = {1, 2};
+    EXPECT_FALSE(probe.readNumaResidency(std::numeric_limits<int32_t>::max(), kibPerNode));
+    EXPECT_TRUE(kibPerNode.empty());
+}
+
+// =============================================================================
+// Synthetic Tree: cgroup Freezer State and CPU Affinity
+// =============================================================================
+
+TEST(LinuxProcessProbeTest, AffinityOfOwnProcessMatchesSchedGetaffinity)
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cpuSet), &cpuSet), 0);
+    std::uint64_t expected = 0;
+    for (int cpu = 0; cpu < 64; ++cpu)
+    {
+        if (CPU_ISSET(static_cast<std::size_t>(cpu), &cpuSet) != 0)
+        {
+            expected |= 1ULL << cpu;
+        }
+    }
+
+    LinuxProcessProbe probe;
+    const auto processes = probe.enumerate();
+    const auto self = std::ranges::find(processes, static_cast<int32_t>(getpid()), &ProcessCounters::pid);
+    ASSERT_NE(self, processes.end());
+    EXPECT_EQ(self->cpuAffinityMask, expected);
+}
+
+TEST(LinuxProcessProbeTest, AffinityParsesMultiGroupCpusAllowed)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 2});
+    // 72 CPUs: the most significant group comes first and is shorter
+    std::ofstream(tree.procRoot() / std::to_string(tree.pid(1)) / "status")
+        << "Name:\tbig\nUid:\t1000\t1000\t1000\t1000\nCpus_allowed:\tff,80000000,0000000f\nCpus_allowed_list:\t0-3,63,64-71\n";
+
+    LinuxProcessProbe probe(tree.roots());
+    const auto processes = probe.enumerate();
+    ASSERT_EQ(processes.size(), 2U);
+    for (const auto& proc : processes)
+    {
+        EXPECT_EQ(proc.cpuAffinityMask, proc.pid == tree.pid(1) ? 0x800000000000000FULL : 0xFFULL) << proc.pid;
+    }
+}
+
+TEST(LinuxProcessProbeTest, FrozenCgroupReportsSuspended)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 24});
+    tree.addCgroupV2();
+    tree.setFrozen(3, true);
+
+    LinuxProcessProbe probe(tree.roots());
+    auto processes = probe.enumerate();
+    ASSERT_EQ(processes.size(), 24U);
+    for (const auto& proc : processes)
+    {
+        const auto index = static_cast<std::size_t>(proc.pid - tree.pid(0));
+        EXPECT_EQ(proc.cgroupPath, Fixtures::SyntheticProcTree::cgroupPath(index));
+        EXPECT_EQ(proc.status, index % Fixtures::SyntheticProcTree::CGROUP_SCOPES == 3 ? "Suspended" : "") << proc.pid;
+    }
+
+    tree.setFrozen(3, false);
+    processes = probe.enumerate();
+    EXPECT_TRUE(std::ranges::all_of(processes, [](const ProcessCounters& proc) { return proc.status.empty(); }));
+}
+
 } // namespace
 } // namespace Platform
 
@@ -8,11 +8,15 @@
 
 #if defined(__linux__) && __has_include(<unistd.h>)
 
+#include "Platform/Linux/ActivityParse.h"
 #include "Platform/Linux/LinuxSystemProbe.h"
+#include "Platform/Linux/PressureParse.h"
 #include "Platform/SystemTypes.h"
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <thread>
 #include <unordered_map>
 #include <vector>
@@ -156,6 +160,19 @@ TEST(LinuxSystemProbeTest, CpuCountersIncrease)
     EXPECT_GT(counters2.cpuTotal.total(), counters1.cpuTotal.total());
 }
 
+TEST(LinuxSystemProbeTest, PerCoreCountersTaggedWithLogicalCpuId)
+{
+    LinuxSystemProbe probe;
+    auto counters = probe.read();
+
+    ASSERT_EQ(counters.cpuPerCoreIds.size(), counters.cpuPerCore.size());
+    for (std::size_t i = 1; i < counters.cpuPerCoreIds.size(); ++i)
+    {
+        // /proc/stat lists online CPUs in ascending id order (gaps for offline CPUs)
+        EXPECT_LT(counters.cpuPerCoreIds[i - 1], counters.cpuPerCoreIds[i]);
+    }
+}
+
 TEST(LinuxSystemProbeTest, UptimeIncreases)
 {
     LinuxSystemProbe probe;
@@ -255,6 +272,187 @@ TEST(LinuxSystemProbeTest, CpuFrequencyIfAvailable)
     }
 }
 
+// =============================================================================
+// Pressure Stall Information Tests
+// =============================================================================
+
+TEST(LinuxSystemProbeTest, ParsePressureReadsSomeAndFullTotals)
+{
+    PressureCounters pressure;
+    ASSERT_TRUE(parsePressure("some avg10=4.44 avg60=3.74 avg300=5.15 total=367051706\n"
+                              "full avg10=0.00 avg60=0.00 avg300=0.00 total=1234\n",
+                              pressure));
+
+    EXPECT_TRUE(pressure.available);
+    EXPECT_TRUE(pressure.hasSome);
+    EXPECT_TRUE(pressure.hasFull);
+    EXPECT_EQ(pressure.someTotalUs, 367051706U);
+    EXPECT_EQ(pressure.fullTotalUs, 1234U);
+}
+
+TEST(LinuxSystemProbeTest, ParsePressureHandlesFullOnlyAndSomeOnly)
+{
+    // /proc/pressure/irq only has a "full" line; pre-5.13 cpu only has "some"
+    PressureCounters irq;
+    ASSERT_TRUE(parsePressure("full avg10=0.10 avg60=0.02 avg300=0.00 total=98765\n", irq));
+    EXPECT_FALSE(irq.hasSome);
+    EXPECT_TRUE(irq.hasFull);
+    EXPECT_EQ(irq.fullTotalUs, 98765U);
+
+    PressureCounters cpu;
+    ASSERT_TRUE(parsePressure("some avg10=0.00 avg60=0.00 avg300=0.00 total=42", cpu));
+    EXPECT_TRUE(cpu.hasSome);
+    EXPECT_FALSE(cpu.hasFull);
+    EXPECT_EQ(cpu.someTotalUs, 42U);
+}
+
+TEST(LinuxSystemProbeTest, ParsePressureRejectsMalformedText)
+{
+    PressureCounters pressure;
+    pressure.available = true;
+    EXPECT_FALSE(parsePressure("", pressure));
+    EXPECT_FALSE(pressure.available);
+    EXPECT_FALSE(parsePressure("some avg10=0.00 avg60=0.00 avg300=0.00\n", pressure));
+    EXPECT_FALSE(parsePressure("garbage total=12\n", pressure));
+}
+
+TEST(LinuxSystemProbeTest, PressureCountersMatchCapability)
+{
+    LinuxSystemProbe probe;
+    const auto caps = probe.capabilities();
+    const auto first = probe.read();
+    const auto& cpuFirst = first.pressure[static_cast<std::size_t>(PressureResource::Cpu)];
+
+    if (!caps.hasPressure)
+    {
+        EXPECT_FALSE(cpuFirst.available);
+        GTEST_SKIP() << "/proc/pressure not available on this kernel";
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const auto second = probe.read();
+    const auto& cpuSecond = second.pressure[static_cast<std::size_t>(PressureResource::Cpu)];
+    if (cpuFirst.hasSome && cpuSecond.hasSome)
+    {
+        EXPECT_GE(cpuSecond.someTotalUs, cpuFirst.someTotalUs) << "PSI totals are cumulative";
+    }
+}
+
+// =============================================================================
+// Kernel Activity Tests
+// =============================================================================
+
+namespace
+{
+
+std::uint64_t activityTotal(const ActivityCounters& activity, ActivityCounter counter)
+{
+    return activity.totals[static_cast<std::size_t>(counter)];
+}
+
+bool activityPresent(const ActivityCounters& activity, ActivityCounter counter)
+{
+    return activity.present[static_cast<std::size_t>(counter)];
+}
+
+} // namespace
+
+TEST(LinuxSystemProbeTest, ParseVmStatExtractsConfiguredKeys)
+{
+    ActivityCounters activity;
+    ASSERT_TRUE(parseVmStat("nr_free_pages 123456\n"
+                            "pgpgin 1000\n"
+                            "pgpgout 2000\n"
+                            "pswpin 3\n"
+                            "pswpout 4\n"
+                            "pgalloc_normal 99999\n"
+                            "pgfault 500000\n"
+                            "pgmajfault 77\n"
+                            "oom_kill 2\n",
+                            activity));
+
+    EXPECT_EQ(activityTotal(activity, ActivityCounter::PageInKiB), 1000U);
+    EXPECT_EQ(activityTotal(activity, ActivityCounter::PageOutKiB), 2000U);
+    EXPECT_EQ(activityTotal(activity, ActivityCounter::SwapInPages), 3U);
+    EXPECT_EQ(activityTotal(activity, ActivityCounter::SwapOutPages), 4U);
+    EXPECT_EQ(activityTotal(activity, ActivityCounter::PageFaults), 500000U);
+    EXPECT_EQ(activityTotal(activity, ActivityCounter::MajorFaults), 77U);
+    EXPECT_EQ(activityTotal(activity, ActivityCounter::OomKills), 2U);
+    EXPECT_TRUE(activityPresent(activity, ActivityCounter::OomKills));
+    EXPECT_FALSE(activityPresent(activity, ActivityCounter::NumaMigrations)); // No NUMA balancing
+    EXPECT_FALSE(activityPresent(activity, ActivityCounter::ContextSwitches)); // Comes from /proc/stat
+}
+
+TEST(LinuxSystemProbeTest, ParseProcStatActivityReadsTailFields)
+{
+    ActivityCounters activity;
+    ASSERT_TRUE(parseProcStatActivity("cpu  100 0 50 850 0 0 0 0 0 0\n"
+                                      "cpu0 100 0 50 850 0 0 0 0 0 0\n"
+                                      "intr 12345 0 0 0\n"
+                                      "ctxt 2412830913\n"
+                                      "btime 1700000000\n"
+                                      "processes 1234567\n"
+                                      "procs_running 3\n"
+                                      "procs_blocked 1\n"
+                                      "softirq 1 2 3\n",
+                                      activity));
+
+    EXPECT_EQ(activityTotal(activity, ActivityCounter::ContextSwitches), 2412830913U);
+    EXPECT_EQ(activityTotal(activity, ActivityCounter::ProcessesCreated), 1234567U);
+    EXPECT_TRUE(activity.hasProcCounts);
+    EXPECT_EQ(activity.procsRunning, 3U);
+    EXPECT_EQ(activity.procsBlocked, 1U);
+}
+
+TEST(LinuxSystemProbeTest, ParseSchedStatSumsCpuLines)
+{
+    ActivityCounters activity;
+    ASSERT_TRUE(parseSchedStat("version 15\n"
+                               "timestamp 4295122464\n"
+                               "cpu0 0 0 100 50 80 40 9000000 1000000 300\n"
+                               "domain0 3 1 2 3 4 5 6 7 8 9 10\n"
+                               "cpu1 0 0 100 50 80 40 8000000 2000000 200\n"
+                               "domain0 3 1 2 3 4 5 6 7 8 9 10\n",
+                               activity));
+
+    EXPECT_EQ(activityTotal(activity, ActivityCounter::RunqueueWaitNs), 3000000U);
+    EXPECT_EQ(activityTotal(activity, ActivityCounter::Timeslices), 500U);
+    EXPECT_TRUE(activityPresent(activity, ActivityCounter::RunqueueWaitNs));
+}
+
+TEST(LinuxSystemProbeTest, ParseSchedStatRejectsOldVersions)
+{
+    ActivityCounters activity;
+    EXPECT_FALSE(parseSchedStat("version 14\ncpu0 0 0 0 0 0 0 0 0 0 1 2 3\n", activity));
+    EXPECT_FALSE(parseSchedStat("", activity));
+    EXPECT_FALSE(activityPresent(activity, ActivityCounter::RunqueueWaitNs));
+}
+
+TEST(LinuxSystemProbeTest, ActivityCountersAreCumulative)
+{
+    LinuxSystemProbe probe;
+    if (!probe.capabilities().hasActivity)
+    {
+        GTEST_SKIP() << "/proc/vmstat not available";
+    }
+
+    const auto first = probe.read();
+    ASSERT_TRUE(activityPresent(first.activity, ActivityCounter::ContextSwitches));
+    ASSERT_TRUE(activityPresent(first.activity, ActivityCounter::PageFaults));
+    EXPECT_TRUE(first.activity.hasProcCounts);
+    EXPECT_GE(first.activity.procsRunning, 1U) << "The test itself is running";
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    const auto second = probe.read();
+    for (std::size_t i = 0; i < ACTIVITY_COUNTER_COUNT; ++i)
+    {
+        if (first.activity.present[i] && second.activity.present[i])
+        {
+            EXPECT_GE(second.activity.totals[i], first.activity.totals[i]) << "Activity counter " << i << " decreased";
+        }
+    }
+}
+
 // =============================================================================
 // Network Counter Tests
 // =============================================================================
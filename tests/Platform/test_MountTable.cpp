@@ -0,0 +1,249 @@
+/// @file test_MountTable.cpp
+/// @brief Tests for Platform::MountTable and the mountinfo parser in MountInfoParse.h
+///
+/// The table is pointed at a generated mountinfo file and a temporary directory laid
+/// out like /sys/dev/block, so filtering and device mapping are deterministic.
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "Fixtures/TempTree.h"
+#include "Platform/Linux/MountInfoParse.h"
+#include "Platform/Linux/MountTable.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Platform
+{
+namespace
+{
+
+// ========== Parser ==========
+
+TEST(MountInfoParseTest, ParsesLineWithOptionalFields)
+{
+    MountInfoFields fields;
+    ASSERT_TRUE(parseMountInfoLine("36 35 98:0 /mnt1 /mnt/parent rw,noatime master:1 shared:2 - ext3 /dev/root rw,errors=continue",
+                                   fields));
+    EXPECT_EQ(fields.major, 98U);
+    EXPECT_EQ(fields.minor, 0U);
+    EXPECT_EQ(fields.root, "/mnt1");
+    EXPECT_EQ(fields.mountPoint, "/mnt/parent");
+    EXPECT_EQ(fields.options, "rw,noatime");
+    EXPECT_EQ(fields.fsType, "ext3");
+    EXPECT_EQ(fields.source, "/dev/root");
+}
+
+TEST(MountInfoParseTest, ParsesLineWithoutOptionalFields)
+{
+    MountInfoFields fields;
+    ASSERT_TRUE(parseMountInfoLine("29 1 259:2 / / ro,relatime - btrfs /dev/nvme0n1p2 ro", fields));
+    EXPECT_EQ(fields.mountPoint, "/");
+    EXPECT_EQ(fields.fsType, "btrfs");
+    EXPECT_TRUE(isReadOnlyMount(fields.options));
+}
+
+TEST(MountInfoParseTest, RejectsMalformedLines)
+{
+    MountInfoFields fields;
+    EXPECT_FALSE(parseMountInfoLine("", fields));
+    EXPECT_FALSE(parseMountInfoLine("36 35 98 / /mnt rw - ext4 /dev/sda1 rw", fields));
+    EXPECT_FALSE(parseMountInfoLine("36 35 98:0 / /mnt rw shared:1", fields));
+}
+
+TEST(MountInfoParseTest, UnescapesOctalSequences)
+{
+    EXPECT_EQ(unescapeMountPath("/media/My\\040Disk"), "/media/My Disk");
+    EXPECT_EQ(unescapeMountPath("/a\\134b\\011c"), "/a\\b\tc");
+    EXPECT_EQ(unescapeMountPath("/trailing\\04"), "/trailing\\04");
+    EXPECT_EQ(unescapeMountPath("/plain"), "/plain");
+}
+
+TEST(MountInfoParseTest, ClassifiesFilesystems)
+{
+    EXPECT_TRUE(isPseudoFilesystem("proc"));
+    EXPECT_TRUE(isPseudoFilesystem("cgroup2"));
+    EXPECT_TRUE(isPseudoFilesystem("squashfs"));
+    EXPECT_FALSE(isPseudoFilesystem("ext4"));
+    EXPECT_FALSE(isPseudoFilesystem("tmpfs"));
+    EXPECT_TRUE(isNetworkFilesystem("nfs4"));
+    EXPECT_FALSE(isNetworkFilesystem("xfs"));
+    EXPECT_FALSE(isReadOnlyMount("rw,relatime"));
+    EXPECT_FALSE(isReadOnlyMount("rootcontext=x"));
+}
+
+// ========== MountTable ==========
+
+class MountTableTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::filesystem::create_directories(m_Root / "mnt");
+
+        // /sys/dev/block/8:1 -> sda1, a partition of sda
+        const auto sda1 = m_Root / "devices/block/sda/sda1";
+        Fixtures::writeFile(sda1 / "partition", "1\n");
+        // /sys/dev/block/253:0 -> dm-0, an LVM volume on sda2
+        const auto sda2 = m_Root / "devices/block/sda/sda2";
+        Fixtures::writeFile(sda2 / "partition", "2\n");
+        const auto dm0 = m_Root / "devices/virtual/block/dm-0";
+        std::filesystem::create_directories(dm0 / "slaves");
+        std::filesystem::create_directory_symlink(sda2, dm0 / "slaves/sda2");
+
+        std::filesystem::create_directories(m_Root / "dev-block");
+        std::filesystem::create_directory_symlink(sda1, m_Root / "dev-block/8:1");
+        std::filesystem::create_directory_symlink(dm0, m_Root / "dev-block/253:0");
+    }
+
+    /// Create a directory to mount on (statvfs needs it to exist) and return its mountinfo spelling.
+    [[nodiscard]] std::string mountDir(const std::string& name, const std::string& escaped) const
+    {
+        std::filesystem::create_directories(m_Root / "mnt" / name);
+        return (m_Root / "mnt").string() + "/" + escaped;
+    }
+
+    void writeStandardTable()
+    {
+        const std::string data = mountDir("data", "data");
+        const std::string lvm = mountDir("lvm", "lvm");
+        const std::string bind = mountDir("bind", "bind");
+        const std::string spaced = mountDir("my disk", "my\\040disk");
+        std::string table;
+        table += "22 1 8:1 / " + data + " rw,relatime shared:1 - ext4 /dev/sda1 rw\n";
+        table += "23 1 253:0 / " + lvm + " ro,noatime - xfs /dev/mapper/vg-root ro\n";
+        table += "24 1 0:5 / /proc rw,nosuid - proc proc rw\n";
+        table += "25 1 8:1 /sub " + bind + " rw - ext4 /dev/sda1 rw\n";
+        table += "26 1 0:40 / /net rw - nfs4 server:/export rw\n";
+        table += "27 1 0:41 / " + spaced + " rw - tmpfs tmpfs rw,size=1024k\n";
+        m_Tree.write("mountinfo", table);
+    }
+
+    [[nodiscard]] MountTable makeTable(std::chrono::milliseconds interval = MountTable::DEFAULT_CAPACITY_INTERVAL) const
+    {
+        return MountTable((m_Root / "mountinfo").string(), (m_Root / "dev-block").string(), interval);
+    }
+
+    Fixtures::TempTree m_Tree{"mounts"};
+    std::filesystem::path m_Root = m_Tree.root();
+};
+
+TEST_F(MountTableTest, FiltersPseudoNetworkAndBindMounts)
+{
+    writeStandardTable();
+    auto table = makeTable();
+    ASSERT_TRUE(table.isAvailable());
+
+    std::vector<MountCounters> mounts;
+    table.read(mounts);
+
+    ASSERT_EQ(mounts.size(), 3U);
+    EXPECT_EQ(mounts[0].mountPoint, (m_Root / "mnt/data").string());
+    EXPECT_EQ(mounts[0].fsType, "ext4");
+    EXPECT_EQ(mounts[1].mountPoint, (m_Root / "mnt/lvm").string());
+    EXPECT_TRUE(mounts[1].readOnly);
+    EXPECT_EQ(mounts[2].mountPoint, (m_Root / "mnt/my disk").string());
+}
+
+TEST_F(MountTableTest, MapsMountsToWholeDisks)
+{
+    writeStandardTable();
+    auto table = makeTable();
+
+    std::vector<MountCounters> mounts;
+    table.read(mounts);
+    ASSERT_EQ(mounts.size(), 3U);
+
+    EXPECT_EQ(mounts[0].deviceName, "sda1");
+    EXPECT_EQ(mounts[0].diskName, "sda");
+    EXPECT_EQ(mounts[1].deviceName, "dm-0");
+    EXPECT_EQ(mounts[1].diskName, "sda");
+    EXPECT_TRUE(mounts[2].deviceName.empty()); // tmpfs
+    EXPECT_TRUE(mounts[2].diskName.empty());
+}
+
+TEST_F(MountTableTest, ReadsCapacity)
+{
+    writeStandardTable();
+    auto table = makeTable();
+
+    std::vector<MountCounters> mounts;
+    table.read(mounts);
+    ASSERT_FALSE(mounts.empty());
+    for (const auto& mount : mounts)
+    {
+        EXPECT_TRUE(mount.hasCapacity) << mount.mountPoint;
+        EXPECT_GT(mount.totalBytes, 0U) << mount.mountPoint;
+        EXPECT_LE(mount.availBytes, mount.freeBytes) << mount.mountPoint;
+        EXPECT_LE(mount.freeBytes, mount.totalBytes) << mount.mountPoint;
+    }
+}
+
+TEST_F(MountTableTest, ParsesOnceWithoutMountEvents)
+{
+    writeStandardTable();
+    auto table = makeTable();
+
+    std::vector<MountCounters> mounts;
+    for (int i = 0; i < 5; ++i)
+    {
+        table.read(mounts);
+    }
+    EXPECT_EQ(table.parseCount(), 1U);
+    EXPECT_EQ(mounts.size(), 3U);
+}
+
+TEST_F(MountTableTest, CapacityRefreshFollowsInterval)
+{
+    writeStandardTable();
+
+    std::vector<MountCounters> mounts;
+    auto slow = makeTable(std::chrono::hours(1));
+    slow.read(mounts);
+    const auto firstSequence = mounts.at(0).capacitySequence;
+    slow.read(mounts);
+    EXPECT_EQ(mounts.at(0).capacitySequence, firstSequence);
+
+    auto eager = makeTable(std::chrono::milliseconds(0));
+    eager.read(mounts);
+    const auto eagerSequence = mounts.at(0).capacitySequence;
+    eager.read(mounts);
+    EXPECT_GT(mounts.at(0).capacitySequence, eagerSequence);
+}
+
+TEST_F(MountTableTest, MissingTableIsUnavailable)
+{
+    auto table = makeTable();
+    EXPECT_FALSE(table.isAvailable());
+
+    std::vector<MountCounters> mounts(2);
+    table.read(mounts);
+    EXPECT_TRUE(mounts.empty());
+}
+
+TEST(MountTableSystemTest, ReportsRootFilesystem)
+{
+    MountTable table;
+    if (!table.isAvailable())
+    {
+        GTEST_SKIP() << "/proc/self/mountinfo not available";
+    }
+
+    std::vector<MountCounters> mounts;
+    table.read(mounts);
+    const auto root = std::ranges::find(mounts, std::string("/"), &MountCounters::mountPoint);
+    ASSERT_NE(root, mounts.end());
+    EXPECT_TRUE(root->hasCapacity);
+    EXPECT_GT(root->totalBytes, 0U);
+}
+
+} // namespace
+} // namespace Platform
+
+#endif // __linux__ && __has_include(<unistd.h>)
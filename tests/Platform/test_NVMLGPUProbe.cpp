@@ -0,0 +1,256 @@
+/// @file test_NVMLGPUProbe.cpp
+/// @brief Tests for Platform::NVMLGPUProbe against the stub NVML library
+///
+/// The probe loads Fixtures/StubNVML.cpp (built as a shared library) in place of
+/// libnvidia-ml.so; the test opens the same library to script devices and samples.
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) && __has_include(<unistd.h>) && defined(TASKSMACK_STUB_NVML_PATH)
+
+#include "Platform/GPUTypes.h"
+#include "Platform/Linux/NVMLGPUProbe.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <dlfcn.h>
+
+namespace Platform
+{
+namespace
+{
+
+using namespace std::chrono_literals;
+
+/// Typed access to the stub's control functions.
+class StubNVML
+{
+  public:
+    StubNVML() : m_Handle(dlopen(TASKSMACK_STUB_NVML_PATH, RTLD_NOW))
+    {
+        EXPECT_NE(m_Handle, nullptr) << dlerror(); // NOLINT(concurrency-mt-unsafe) - test setup is single-threaded
+    }
+
+    ~StubNVML()
+    {
+        if (m_Handle != nullptr)
+        {
+            dlclose(m_Handle);
+        }
+    }
+
+    StubNVML(const StubNVML&) = delete;
+    StubNVML& operator=(const StubNVML&) = delete;
+    StubNVML(StubNVML&&) = delete;
+    StubNVML& operator=(StubNVML&&) = delete;
+
+    void reset(unsigned int deviceCount) const
+    {
+        fn<void (*)(unsigned int)>("stubNvmlReset")(deviceCount);
+    }
+    void setPointUtilization(unsigned int device, unsigned int percent) const
+    {
+        fn<void (*)(unsigned int, unsigned int)>("stubNvmlSetPointUtilization")(device, percent);
+    }
+    void addUtilizationSample(unsigned int device, unsigned long long timeStamp, unsigned int percent) const
+    {
+        fn<void (*)(unsigned int, unsigned long long, unsigned int)>("stubNvmlAddUtilizationSample")(device, timeStamp, percent);
+    }
+    void addProcessSample(unsigned int device, unsigned int pid, unsigned long long timeStamp, unsigned int sm, unsigned int enc = 0) const
+    {
+        using Fn = void (*)(unsigned int, unsigned int, unsigned long long, unsigned int, unsigned int, unsigned int);
+        fn<Fn>("stubNvmlAddProcessSample")(device, pid, timeStamp, sm, enc, 0);
+    }
+    void addRunningProcess(unsigned int device, unsigned int pid, unsigned long long memoryBytes, bool graphics) const
+    {
+        fn<void (*)(unsigned int, unsigned int, unsigned long long, int)>("stubNvmlAddRunningProcess")(
+            device, pid, memoryBytes, graphics ? 1 : 0);
+    }
+    [[nodiscard]] unsigned int runningProcessCalls() const
+    {
+        return fn<unsigned int (*)()>("stubNvmlRunningProcessCalls")();
+    }
+    [[nodiscard]] unsigned int processUtilizationCalls() const
+    {
+        return fn<unsigned int (*)()>("stubNvmlProcessUtilizationCalls")();
+    }
+    [[nodiscard]] unsigned int pointUtilizationCalls() const
+    {
+        return fn<unsigned int (*)()>("stubNvmlPointUtilizationCalls")();
+    }
+
+  private:
+    template<typename Fn> [[nodiscard]] Fn fn(const char* name) const
+    {
+        return reinterpret_cast<Fn>(dlsym(m_Handle, name)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast) - dlsym
+    }
+
+    void* m_Handle;
+};
+
+NVMLProbeOptions stubOptions(std::chrono::milliseconds processListInterval = 0ms)
+{
+    return {.libraryPath = TASKSMACK_STUB_NVML_PATH, .processListInterval = processListInterval};
+}
+
+const ProcessGPUCounters* findPid(const std::vector<ProcessGPUCounters>& counters, std::int32_t pid)
+{
+    const auto it = std::ranges::find(counters, pid, &ProcessGPUCounters::pid);
+    return it != counters.end() ? &*it : nullptr;
+}
+
+TEST(NVMLGPUProbeTest, LoadsStubLibrary)
+{
+    const StubNVML stub;
+    stub.reset(2);
+    NVMLGPUProbe probe(stubOptions());
+
+    ASSERT_TRUE(probe.isAvailable());
+    const auto gpus = probe.enumerateGPUs();
+    ASSERT_EQ(gpus.size(), 2U);
+    EXPECT_EQ(gpus[0].id, "GPU-stub-0");
+    EXPECT_EQ(gpus[1].id, "GPU-stub-1");
+    EXPECT_TRUE(probe.capabilities().hasPerProcessMetrics);
+}
+
+TEST(NVMLGPUProbeTest, MissingLibraryIsUnavailable)
+{
+    NVMLGPUProbe probe({.libraryPath = "/nonexistent/libnvidia-ml.so"});
+    EXPECT_FALSE(probe.isAvailable());
+    EXPECT_TRUE(probe.readGPUCounters().empty());
+}
+
+TEST(NVMLGPUProbeTest, UtilizationAveragesOnlyNewSamples)
+{
+    const StubNVML stub;
+    stub.reset(1);
+    stub.setPointUtilization(0, 99);
+    stub.addUtilizationSample(0, 100, 20);
+    stub.addUtilizationSample(0, 200, 40);
+    NVMLGPUProbe probe(stubOptions());
+
+    auto counters = probe.readGPUCounters();
+    ASSERT_EQ(counters.size(), 1U);
+    EXPECT_DOUBLE_EQ(counters[0].utilizationPercent, 30.0);
+
+    // Only the sample after timestamp 200 counts now
+    stub.addUtilizationSample(0, 300, 90);
+    counters = probe.readGPUCounters();
+    EXPECT_DOUBLE_EQ(counters[0].utilizationPercent, 90.0);
+    EXPECT_EQ(stub.pointUtilizationCalls(), 0U);
+}
+
+TEST(NVMLGPUProbeTest, UtilizationFallsBackToPointReadWithoutNewSamples)
+{
+    const StubNVML stub;
+    stub.reset(1);
+    stub.setPointUtilization(0, 55);
+    NVMLGPUProbe probe(stubOptions());
+
+    const auto counters = probe.readGPUCounters();
+    ASSERT_EQ(counters.size(), 1U);
+    EXPECT_DOUBLE_EQ(counters[0].utilizationPercent, 55.0);
+    EXPECT_EQ(stub.pointUtilizationCalls(), 1U);
+}
+
+TEST(NVMLGPUProbeTest, ProcessUtilizationAveragesSamplesPerPid)
+{
+    const StubNVML stub;
+    stub.reset(1);
+    stub.addRunningProcess(0, 100, 256ULL << 20, false);
+    stub.addRunningProcess(0, 100, 256ULL << 20, true);
+    stub.addRunningProcess(0, 200, 64ULL << 20, true);
+    stub.addProcessSample(0, 100, 10, 40);
+    stub.addProcessSample(0, 100, 20, 60);
+    stub.addProcessSample(0, 200, 15, 10, 30);
+    NVMLGPUProbe probe(stubOptions());
+
+    const auto counters = probe.readProcessGPUCounters();
+    ASSERT_EQ(counters.size(), 2U);
+
+    const auto* first = findPid(counters, 100);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first->gpuId, "GPU-stub-0");
+    EXPECT_DOUBLE_EQ(first->gpuUtilPercent, 50.0);
+    EXPECT_EQ(first->gpuMemoryBytes, 256ULL << 20);
+    EXPECT_EQ(first->activeEngines, (std::vector<std::string>{"Compute", "3D"}));
+
+    const auto* second = findPid(counters, 200);
+    ASSERT_NE(second, nullptr);
+    EXPECT_DOUBLE_EQ(second->gpuUtilPercent, 10.0);
+    EXPECT_DOUBLE_EQ(second->encoderUtilPercent, 30.0);
+    EXPECT_EQ(second->activeEngines, (std::vector<std::string>{"3D", "Video Encode"}));
+}
+
+TEST(NVMLGPUProbeTest, ProcessWithoutNewSamplesIsIdle)
+{
+    const StubNVML stub;
+    stub.reset(1);
+    stub.addRunningProcess(0, 100, 1ULL << 20, true);
+    stub.addProcessSample(0, 100, 10, 70);
+    NVMLGPUProbe probe(stubOptions());
+
+    EXPECT_DOUBLE_EQ(findPid(probe.readProcessGPUCounters(), 100)->gpuUtilPercent, 70.0);
+
+    const auto counters = probe.readProcessGPUCounters();
+    const auto* process = findPid(counters, 100);
+    ASSERT_NE(process, nullptr);
+    EXPECT_DOUBLE_EQ(process->gpuUtilPercent, 0.0);
+    EXPECT_EQ(process->gpuMemoryBytes, 1ULL << 20);
+}
+
+TEST(NVMLGPUProbeTest, ProcessListFollowsItsOwnCadence)
+{
+    const StubNVML stub;
+    stub.reset(1);
+    stub.addRunningProcess(0, 100, 1ULL << 20, true);
+    NVMLGPUProbe probe(stubOptions(1h));
+
+    (void)probe.readProcessGPUCounters();
+    const unsigned int listCalls = stub.runningProcessCalls();
+    EXPECT_GT(listCalls, 0U);
+
+    // A process that started after the listing still gets utilization from its samples
+    stub.addProcessSample(0, 300, 50, 25);
+    for (int tick = 0; tick < 5; ++tick)
+    {
+        const auto counters = probe.readProcessGPUCounters();
+        EXPECT_NE(findPid(counters, 100), nullptr);
+        if (tick == 0)
+        {
+            const auto* started = findPid(counters, 300);
+            ASSERT_NE(started, nullptr);
+            EXPECT_DOUBLE_EQ(started->gpuUtilPercent, 25.0);
+            EXPECT_EQ(started->gpuMemoryBytes, 0U);
+        }
+    }
+
+    EXPECT_EQ(stub.runningProcessCalls(), listCalls);
+    EXPECT_EQ(stub.processUtilizationCalls(), 7U); // Every read, plus one size query when samples first appeared
+}
+
+TEST(NVMLGPUProbeTest, ProcessBuffersGrowWhenMoreProcessesAppear)
+{
+    const StubNVML stub;
+    stub.reset(1);
+    NVMLGPUProbe probe(stubOptions());
+    EXPECT_TRUE(probe.readProcessGPUCounters().empty());
+
+    for (unsigned int pid = 1; pid <= 40; ++pid)
+    {
+        stub.addRunningProcess(0, pid, 1ULL << 20, true);
+        stub.addProcessSample(0, pid, 1000 + pid, 5);
+    }
+    const auto counters = probe.readProcessGPUCounters();
+    ASSERT_EQ(counters.size(), 40U);
+    EXPECT_TRUE(std::ranges::all_of(counters, [](const auto& counter) { return counter.gpuUtilPercent == 5.0; }));
+}
+
+} // namespace
+} // namespace Platform
+
+#endif
@@ -0,0 +1,228 @@
+// Tests for NetlinkLinkStats (rtnetlink RTM_GETLINK interface statistics)
+// Only compiled on Linux
+
+#if defined(__linux__)
+
+#include "Platform/Linux/NetlinkLinkStats.h"
+#include "Platform/Linux/ProcFile.h"
+#include "Platform/Linux/ProcParse.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <linux/if.h>
+#include <linux/if_link.h>
+#include <linux/rtnetlink.h>
+
+namespace Platform
+{
+namespace
+{
+
+/// Builds an RTM_NEWLINK payload (ifinfomsg + rtattr chain) for parser tests.
+class LinkMessageBuilder
+{
+  public:
+    LinkMessageBuilder(int ifIndex, unsigned int flags)
+    {
+        ifinfomsg ifm{};
+        ifm.ifi_index = ifIndex;
+        ifm.ifi_flags = flags;
+        append(&ifm, sizeof(ifm));
+    }
+
+    LinkMessageBuilder& attr(unsigned short type, const void* data, std::size_t len)
+    {
+        rtattr rta{};
+        rta.rta_type = type;
+        rta.rta_len = static_cast<unsigned short>(RTA_LENGTH(len));
+        append(&rta, sizeof(rta));
+        append(data, len);
+        return *this;
+    }
+
+    LinkMessageBuilder& name(const std::string& ifName)
+    {
+        return attr(IFLA_IFNAME, ifName.c_str(), ifName.size() + 1);
+    }
+
+    [[nodiscard]] const void* data() const
+    {
+        return m_Storage.data();
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_Size;
+    }
+
+  private:
+    void append(const void* data, std::size_t len)
+    {
+        const std::size_t aligned = RTA_ALIGN(len);
+        m_Storage.resize((m_Size + aligned + sizeof(std::uint32_t) - 1) / sizeof(std::uint32_t));
+        std::memcpy(reinterpret_cast<char*>(m_Storage.data()) + m_Size, data, len);
+        m_Size += aligned;
+    }
+
+    std::vector<std::uint32_t> m_Storage; // uint32_t storage keeps rtattr alignment
+    std::size_t m_Size = 0;
+};
+
+// ========== parseLinkMessage Tests ==========
+
+TEST(NetlinkLinkStatsTest, ParseLinkMessageReadsStats64MtuAndOperState)
+{
+    rtnl_link_stats64 stats{};
+    stats.rx_bytes = 0x1'0000'0001ULL; // Above 32 bits
+    stats.tx_bytes = 987654321;
+    stats.rx_packets = 1000;
+    stats.tx_packets = 2000;
+    const std::uint32_t mtu = 9000;
+    const std::uint8_t operState = IF_OPER_UP;
+
+    LinkMessageBuilder msg(7, 0);
+    msg.name("veth1a2b3c4")
+        .attr(IFLA_MTU, &mtu, sizeof(mtu))
+        .attr(IFLA_OPERSTATE, &operState, sizeof(operState))
+        .attr(IFLA_STATS64, &stats, sizeof(stats));
+
+    LinkStats link;
+    ASSERT_TRUE(NetlinkLinkStats::parseLinkMessage(msg.data(), msg.size(), link));
+    EXPECT_EQ(link.ifIndex, 7U);
+    EXPECT_EQ(link.name, "veth1a2b3c4");
+    EXPECT_EQ(link.rxBytes, 0x1'0000'0001ULL);
+    EXPECT_EQ(link.txBytes, 987654321ULL);
+    EXPECT_EQ(link.rxPackets, 1000ULL);
+    EXPECT_EQ(link.txPackets, 2000ULL);
+    EXPECT_EQ(link.mtu, 9000U);
+    EXPECT_TRUE(link.isUp);
+    EXPECT_FALSE(link.isLoopback);
+}
+
+TEST(NetlinkLinkStatsTest, ParseLinkMessagePrefersStats64OverStats)
+{
+    rtnl_link_stats stats32{};
+    stats32.rx_bytes = 1;
+    stats32.tx_bytes = 2;
+    rtnl_link_stats64 stats64{};
+    stats64.rx_bytes = 100;
+    stats64.tx_bytes = 200;
+
+    // Either attribute order must yield the 64-bit counters
+    LinkMessageBuilder first(2, 0);
+    first.name("eth0").attr(IFLA_STATS64, &stats64, sizeof(stats64)).attr(IFLA_STATS, &stats32, sizeof(stats32));
+    LinkMessageBuilder second(2, 0);
+    second.name("eth0").attr(IFLA_STATS, &stats32, sizeof(stats32)).attr(IFLA_STATS64, &stats64, sizeof(stats64));
+
+    for (const auto* msg : {&first, &second})
+    {
+        LinkStats link;
+        ASSERT_TRUE(NetlinkLinkStats::parseLinkMessage(msg->data(), msg->size(), link));
+        EXPECT_EQ(link.rxBytes, 100ULL);
+        EXPECT_EQ(link.txBytes, 200ULL);
+    }
+}
+
+TEST(NetlinkLinkStatsTest, ParseLinkMessageHandlesLoopbackAndDownState)
+{
+    const std::uint8_t operState = IF_OPER_DOWN;
+    LinkMessageBuilder msg(1, IFF_LOOPBACK);
+    msg.name("lo").attr(IFLA_OPERSTATE, &operState, sizeof(operState));
+
+    LinkStats link;
+    ASSERT_TRUE(NetlinkLinkStats::parseLinkMessage(msg.data(), msg.size(), link));
+    EXPECT_TRUE(link.isLoopback);
+    EXPECT_FALSE(link.isUp);
+    EXPECT_EQ(link.rxBytes, 0ULL); // No stats attribute
+}
+
+TEST(NetlinkLinkStatsTest, ParseLinkMessageRejectsTruncatedOrNamelessPayload)
+{
+    LinkMessageBuilder nameless(3, 0);
+    const std::uint32_t mtu = 1500;
+    nameless.attr(IFLA_MTU, &mtu, sizeof(mtu));
+
+    LinkStats link;
+    EXPECT_FALSE(NetlinkLinkStats::parseLinkMessage(nameless.data(), nameless.size(), link));
+    EXPECT_FALSE(NetlinkLinkStats::parseLinkMessage(nameless.data(), sizeof(ifinfomsg) - 1, link));
+}
+
+// ========== query Tests ==========
+
+TEST(NetlinkLinkStatsTest, QueryIncludesLoopback)
+{
+    NetlinkLinkStats stats;
+    if (!stats.isAvailable())
+    {
+        GTEST_SKIP() << "NETLINK_ROUTE not available on this system";
+    }
+
+    std::vector<LinkStats> links;
+    ASSERT_TRUE(stats.query(links));
+    const auto lo = std::ranges::find_if(links, [](const LinkStats& link) { return link.isLoopback; });
+    ASSERT_NE(lo, links.end());
+    EXPECT_NE(lo->ifIndex, 0U);
+    EXPECT_GT(lo->mtu, 0U);
+}
+
+TEST(NetlinkLinkStatsTest, QueryMatchesProcNetDevInterfaces)
+{
+    NetlinkLinkStats stats;
+    if (!stats.isAvailable())
+    {
+        GTEST_SKIP() << "NETLINK_ROUTE not available on this system";
+    }
+
+    std::vector<LinkStats> links;
+    ASSERT_TRUE(stats.query(links));
+
+    ProcFile netDev("/proc/net/dev");
+    ASSERT_TRUE(netDev.isOpen());
+    std::string_view text = netDev.read();
+    std::string_view line;
+    (void) ProcParse::nextLine(text, line); // Headers
+    (void) ProcParse::nextLine(text, line);
+    while (ProcParse::nextLine(text, line))
+    {
+        std::string_view nameField = line.substr(0, line.find(':'));
+        const std::string name(ProcParse::nextToken(nameField));
+        EXPECT_TRUE(std::ranges::any_of(links, [&name](const LinkStats& link) { return link.name == name; }))
+            << "Interface " << name << " missing from RTM_GETLINK dump";
+    }
+}
+
+TEST(NetlinkLinkStatsTest, RepeatedQueriesReuseSocket)
+{
+    NetlinkLinkStats stats;
+    if (!stats.isAvailable())
+    {
+        GTEST_SKIP() << "NETLINK_ROUTE not available on this system";
+    }
+
+    std::vector<LinkStats> first;
+    std::vector<LinkStats> second;
+    ASSERT_TRUE(stats.query(first));
+    ASSERT_TRUE(stats.query(second));
+    ASSERT_EQ(first.size(), second.size()); // Output is cleared, not appended to
+
+    for (const auto& link : first)
+    {
+        const auto it = std::ranges::find_if(second, [&link](const LinkStats& other) { return other.ifIndex == link.ifIndex; });
+        ASSERT_NE(it, second.end());
+        EXPECT_GE(it->rxBytes, link.rxBytes) << "Interface " << link.name << " rxBytes decreased";
+        EXPECT_GE(it->txBytes, link.txBytes) << "Interface " << link.name << " txBytes decreased";
+    }
+}
+
+} // namespace
+} // namespace Platform
+
+#endif // __linux__
@@ -0,0 +1,227 @@
+/// @file test_NumaNodeReader.cpp
+/// @brief Tests for Platform::NumaNodeReader and the NUMA parsers in NumaParse.h
+///
+/// The reader is pointed at a temporary directory laid out like
+/// /sys/devices/system/node so node sets and hot-remove are deterministic.
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "Fixtures/TempTree.h"
+#include "Platform/Linux/NumaNodeReader.h"
+#include "Platform/Linux/NumaParse.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Platform
+{
+namespace
+{
+
+// ========== Parsers ==========
+
+TEST(NumaParseTest, NodeMemInfoReadsTotalFreeAndFilePages)
+{
+    constexpr std::string_view text = "Node 1 MemTotal:       16314328 kB\n"
+                                      "Node 1 MemFree:         9276812 kB\n"
+                                      "Node 1 MemUsed:         7037516 kB\n"
+                                      "Node 1 Active:          3000000 kB\n"
+                                      "Node 1 FilePages:       4431768 kB\n";
+    NumaNodeCounters node;
+    ASSERT_TRUE(parseNodeMemInfo(text, node));
+    EXPECT_EQ(node.memTotalBytes, 16314328ULL * 1024);
+    EXPECT_EQ(node.memFreeBytes, 9276812ULL * 1024);
+    EXPECT_EQ(node.filePagesBytes, 4431768ULL * 1024);
+}
+
+TEST(NumaParseTest, NodeMemInfoWithoutTotalFails)
+{
+    NumaNodeCounters node;
+    EXPECT_FALSE(parseNodeMemInfo("Node 0 MemFree: 100 kB\n", node));
+    EXPECT_FALSE(parseNodeMemInfo("", node));
+}
+
+TEST(NumaParseTest, NumaStatReadsAllCounters)
+{
+    constexpr std::string_view text = "numa_hit 123456789\n"
+                                      "numa_miss 12\n"
+                                      "numa_foreign 34\n"
+                                      "interleave_hit 5678\n"
+                                      "local_node 123450000\n"
+                                      "other_node 6789\n";
+    NumaNodeCounters node;
+    ASSERT_TRUE(parseNumaStat(text, node));
+    EXPECT_TRUE(node.hasNumaStat);
+    EXPECT_EQ(node.numaHit, 123456789U);
+    EXPECT_EQ(node.numaMiss, 12U);
+    EXPECT_EQ(node.numaForeign, 34U);
+    EXPECT_EQ(node.localNode, 123450000U);
+    EXPECT_EQ(node.otherNode, 6789U);
+}
+
+TEST(NumaParseTest, NumaStatMissingCounterLeavesFlagClear)
+{
+    NumaNodeCounters node;
+    EXPECT_FALSE(parseNumaStat("numa_hit 1\nnuma_miss 2\n", node));
+    EXPECT_FALSE(node.hasNumaStat);
+}
+
+TEST(NumaParseTest, NumaMapsSumsPagesPerNodeWeightedByPageSize)
+{
+    constexpr std::string_view text =
+        "55d4c2a4e000 default file=/usr/bin/bash mapped=47 mapmax=2 N0=40 N1=7 kernelpagesize_kB=4\n"
+        "7f2a10000000 bind:1 anon=512 dirty=512 N1=2 kernelpagesize_kB=2048\n"
+        "7ffd8a1f0000 default stack anon=3 dirty=3 N0=3 kernelpagesize_kB=4\n"
+        "7ffd8a3fe000 default\n";
+    std::vector<std::uint64_t> kib;
+    ASSERT_TRUE(parseNumaMaps(text, kib));
+    ASSERT_EQ(kib.size(), 2U);
+    EXPECT_EQ(kib[0], (40U + 3U) * 4U);
+    EXPECT_EQ(kib[1], (7U * 4U) + (2U * 2048U));
+}
+
+TEST(NumaParseTest, NumaMapsIgnoresMalformedTokensAndResetsOutput)
+{
+    std::vector<std::uint64_t> kib = {999, 999, 999};
+    // "N=" has no id, "Nx=" is not a node, "N5" has no count
+    ASSERT_TRUE(parseNumaMaps("1000 default N=3 Nx=4 N5 N2=1\n", kib));
+    ASSERT_EQ(kib.size(), 3U);
+    EXPECT_EQ(kib[0], 0U);
+    EXPECT_EQ(kib[1], 0U);
+    EXPECT_EQ(kib[2], 4U);
+
+    EXPECT_FALSE(parseNumaMaps("1000 default\n", kib));
+}
+
+// ========== Reader ==========
+
+class NumaNodeReaderTest : public ::testing::Test
+{
+  protected:
+    void writeOnline(const std::string& list) const
+    {
+        m_Tree.write("online", list + "\n");
+    }
+
+    void writeNode(std::uint32_t id, std::uint64_t totalKb, std::uint64_t freeKb, const std::string& cpuList) const
+    {
+        const std::filesystem::path dir = "node" + std::to_string(id);
+        const std::string prefix = "Node " + std::to_string(id) + " ";
+        m_Tree.write(dir / "meminfo",
+                     prefix + "MemTotal: " + std::to_string(totalKb) + " kB\n" + prefix + "MemFree: " + std::to_string(freeKb) +
+                         " kB\n" + prefix + "FilePages: 0 kB\n");
+        m_Tree.write(dir / "numastat",
+                     "numa_hit 100\nnuma_miss 0\nnuma_foreign 0\ninterleave_hit 0\nlocal_node 90\nother_node 10\n");
+        m_Tree.write(dir / "cpulist", cpuList + "\n");
+    }
+
+    Fixtures::TempTree m_Tree{"numa"};
+    std::filesystem::path m_Root = m_Tree.root();
+};
+
+TEST_F(NumaNodeReaderTest, UnavailableWithoutOnlineFile)
+{
+    NumaNodeReader reader(m_Root.string());
+    EXPECT_FALSE(reader.isAvailable());
+
+    std::vector<NumaNodeCounters> nodes(1);
+    reader.read(nodes);
+    EXPECT_TRUE(nodes.empty());
+}
+
+TEST_F(NumaNodeReaderTest, ReadsEveryOnlineNode)
+{
+    writeOnline("0-1");
+    writeNode(0, 1000, 400, "0-3");
+    writeNode(1, 2000, 500, "4-5,7");
+
+    NumaNodeReader reader(m_Root.string());
+    ASSERT_TRUE(reader.isAvailable());
+
+    std::vector<NumaNodeCounters> nodes;
+    reader.read(nodes);
+    ASSERT_EQ(nodes.size(), 2U);
+
+    EXPECT_EQ(nodes[0].nodeId, 0U);
+    EXPECT_EQ(nodes[0].memTotalBytes, 1000U * 1024);
+    EXPECT_EQ(nodes[0].memFreeBytes, 400U * 1024);
+    EXPECT_EQ(nodes[0].cpuIds, (std::vector<std::uint32_t>{0, 1, 2, 3}));
+    EXPECT_TRUE(nodes[0].hasNumaStat);
+    EXPECT_EQ(nodes[0].localNode, 90U);
+
+    EXPECT_EQ(nodes[1].nodeId, 1U);
+    EXPECT_EQ(nodes[1].cpuIds, (std::vector<std::uint32_t>{4, 5, 7}));
+}
+
+TEST_F(NumaNodeReaderTest, MemoryOnlyNodeHasNoCpus)
+{
+    writeOnline("0,2");
+    writeNode(0, 1000, 400, "0-1");
+    writeNode(2, 8000, 8000, "");
+
+    NumaNodeReader reader(m_Root.string());
+    std::vector<NumaNodeCounters> nodes;
+    reader.read(nodes);
+    ASSERT_EQ(nodes.size(), 2U);
+    EXPECT_EQ(nodes[1].nodeId, 2U);
+    EXPECT_TRUE(nodes[1].cpuIds.empty());
+}
+
+TEST_F(NumaNodeReaderTest, RereadsUpdatedValuesThroughPersistentHandles)
+{
+    writeOnline("0");
+    writeNode(0, 1000, 400, "0");
+
+    NumaNodeReader reader(m_Root.string());
+    std::vector<NumaNodeCounters> nodes;
+    reader.read(nodes);
+    ASSERT_EQ(nodes.size(), 1U);
+    EXPECT_EQ(nodes[0].memFreeBytes, 400U * 1024);
+
+    writeNode(0, 1000, 100, "0");
+    reader.read(nodes);
+    ASSERT_EQ(nodes.size(), 1U);
+    EXPECT_EQ(nodes[0].memFreeBytes, 100U * 1024);
+}
+
+TEST_F(NumaNodeReaderTest, NodeRemovedAndReaddedIsReopened)
+{
+    writeOnline("0-1");
+    writeNode(0, 1000, 400, "0");
+    writeNode(1, 2000, 500, "1");
+
+    NumaNodeReader reader(m_Root.string());
+    std::vector<NumaNodeCounters> nodes;
+    reader.read(nodes);
+    ASSERT_EQ(nodes.size(), 2U);
+
+    // Hot-remove deletes the directory; the recreated files are new inodes
+    writeOnline("0");
+    std::filesystem::remove_all(m_Root / "node1");
+    reader.read(nodes);
+    ASSERT_EQ(nodes.size(), 1U);
+
+    writeOnline("0-1");
+    writeNode(1, 4000, 3000, "1");
+    reader.read(nodes);
+    ASSERT_EQ(nodes.size(), 2U);
+    EXPECT_EQ(nodes[1].memTotalBytes, 4000U * 1024);
+    EXPECT_EQ(nodes[1].memFreeBytes, 3000U * 1024);
+}
+
+} // namespace
+} // namespace Platform
+
+#else
+
+TEST(NumaNodeReaderTest, SkippedOnNonLinux)
+{
+    GTEST_SKIP() << "NumaNodeReader tests require Linux (sysfs, unistd.h)";
+}
+
+#endif
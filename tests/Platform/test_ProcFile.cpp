@@ -0,0 +1,334 @@
+/// @file test_ProcFile.cpp
+/// @brief Tests for Platform::ProcFile, Platform::ProcParse and Platform::SharedProcStat
+///
+/// ProcFile and ProcParse are exercised against temporary files with known contents;
+/// SharedProcStat is exercised against the real /proc/stat.
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "Fixtures/TempTree.h"
+#include "Platform/Linux/ProcFile.h"
+#include "Platform/Linux/ProcParse.h"
+#include "Platform/Linux/SharedProcStat.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace Platform
+{
+namespace
+{
+
+class ProcFileTest : public ::testing::Test
+{
+  protected:
+    void writeFile(const std::string& contents) const
+    {
+        Fixtures::writeFile(m_Path, contents);
+    }
+
+    Fixtures::TempTree m_Tree{"procfile"};
+    std::filesystem::path m_Path = m_Tree.path("file");
+};
+
+// =============================================================================
+// ProcFile
+// =============================================================================
+
+TEST_F(ProcFileTest, MissingFileIsNotOpen)
+{
+    ProcFile file("/nonexistent/tasksmack/file");
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_TRUE(file.read().empty());
+}
+
+TEST_F(ProcFileTest, ReadsWholeFile)
+{
+    writeFile("hello world\n");
+    ProcFile file(m_Path.string());
+    ASSERT_TRUE(file.isOpen());
+    EXPECT_EQ(file.read(), "hello world\n");
+}
+
+TEST_F(ProcFileTest, RereadSeesNewContentsWithoutReopening)
+{
+    writeFile("first\n");
+    ProcFile file(m_Path.string());
+    ASSERT_TRUE(file.isOpen());
+    EXPECT_EQ(file.read(), "first\n");
+
+    // Rewrite in place (same inode) - pread at offset 0 must observe the new contents
+    writeFile("second value\n");
+    EXPECT_EQ(file.read(), "second value\n");
+}
+
+TEST_F(ProcFileTest, GrowsBufferForLargeFiles)
+{
+    const std::string large(100'000, 'x');
+    writeFile(large);
+    ProcFile file(m_Path.string());
+    ASSERT_TRUE(file.isOpen());
+    EXPECT_EQ(file.read().size(), large.size());
+}
+
+TEST_F(ProcFileTest, MoveTransfersOwnership)
+{
+    writeFile("moved\n");
+    ProcFile original(m_Path.string());
+    ProcFile moved(std::move(original));
+
+    EXPECT_TRUE(moved.isOpen());
+    EXPECT_EQ(moved.read(), "moved\n");
+}
+
+TEST(ProcFileRealTest, ReadsProcSeqFilesRepeatedly)
+{
+    ProcFile meminfo("/proc/meminfo");
+    ASSERT_TRUE(meminfo.isOpen());
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const std::string_view text = meminfo.read();
+        EXPECT_TRUE(text.starts_with("MemTotal:"));
+    }
+}
+
+// =============================================================================
+// ProcParse
+// =============================================================================
+
+TEST(ProcParseTest, NextLineSplitsOnNewlines)
+{
+    std::string_view text = "a b\nc\n\nlast";
+    std::string_view line;
+
+    ASSERT_TRUE(ProcParse::nextLine(text, line));
+    EXPECT_EQ(line, "a b");
+    ASSERT_TRUE(ProcParse::nextLine(text, line));
+    EXPECT_EQ(line, "c");
+    ASSERT_TRUE(ProcParse::nextLine(text, line));
+    EXPECT_EQ(line, "");
+    ASSERT_TRUE(ProcParse::nextLine(text, line));
+    EXPECT_EQ(line, "last");
+    EXPECT_FALSE(ProcParse::nextLine(text, line));
+}
+
+TEST(ProcParseTest, ParsesTokensAndIntegers)
+{
+    std::string_view line = "cpu0  12 34\t56 notanumber";
+
+    EXPECT_EQ(ProcParse::nextToken(line), "cpu0");
+
+    uint64_t a = 0;
+    uint64_t b = 0;
+    uint64_t c = 0;
+    ASSERT_TRUE(ProcParse::nextInteger(line, a));
+    ASSERT_TRUE(ProcParse::nextInteger(line, b));
+    ASSERT_TRUE(ProcParse::nextInteger(line, c));
+    EXPECT_EQ(a, 12U);
+    EXPECT_EQ(b, 34U);
+    EXPECT_EQ(c, 56U);
+
+    uint64_t bad = 99;
+    EXPECT_FALSE(ProcParse::nextInteger(line, bad));
+    EXPECT_EQ(bad, 99U);
+}
+
+TEST(ProcParseTest, ParsesSignedIntegers)
+{
+    std::string_view line = " -1";
+    int64_t value = 0;
+    ASSERT_TRUE(ProcParse::nextInteger(line, value));
+    EXPECT_EQ(value, -1);
+}
+
+TEST(ProcParseTest, ParsesDecimals)
+{
+    std::string_view text = "12345.67 0.31 7";
+    double a = 0.0;
+    double b = 0.0;
+    double c = 0.0;
+    ASSERT_TRUE(ProcParse::nextDecimal(text, a));
+    ASSERT_TRUE(ProcParse::nextDecimal(text, b));
+    ASSERT_TRUE(ProcParse::nextDecimal(text, c));
+    EXPECT_NEAR(a, 12345.67, 1e-6);
+    EXPECT_NEAR(b, 0.31, 1e-9);
+    EXPECT_NEAR(c, 7.0, 1e-9);
+}
+
+TEST(ProcParseTest, TrimRightStripsNewline)
+{
+    EXPECT_EQ(ProcParse::trimRight("up\n"), "up");
+    EXPECT_EQ(ProcParse::trimRight("\n"), "");
+}
+
+TEST(ProcParseTest, ParsesIdListRangesAndSingles)
+{
+    std::vector<std::uint8_t> mask;
+    ASSERT_TRUE(ProcParse::parseIdList("0-2,5,7-8\n", mask));
+
+    const std::vector<std::uint8_t> expected = {1, 1, 1, 0, 0, 1, 0, 1, 1};
+    EXPECT_EQ(mask, expected);
+}
+
+TEST(ProcParseTest, IdListReusesMaskAndClearsStaleBits)
+{
+    std::vector<std::uint8_t> mask;
+    ASSERT_TRUE(ProcParse::parseIdList("0-3", mask));
+    ASSERT_TRUE(ProcParse::parseIdList("0,3", mask));
+
+    const std::vector<std::uint8_t> expected = {1, 0, 0, 1};
+    EXPECT_EQ(mask, expected);
+}
+
+TEST(ProcParseTest, IdListRejectsMalformedInput)
+{
+    std::vector<std::uint8_t> mask;
+    EXPECT_FALSE(ProcParse::parseIdList("3-1", mask));
+    EXPECT_TRUE(mask.empty());
+    EXPECT_FALSE(ProcParse::parseIdList("abc", mask));
+    EXPECT_TRUE(mask.empty());
+}
+
+TEST(ProcParseTest, ScanKeyedValuesExtractsOnlyTableKeys)
+{
+    constexpr std::array<ProcParse::KeySlot, 3> table = {{
+        {.key = "beta", .slot = 0},
+        {.key = "delta", .slot = 2},
+        {.key = "missing", .slot = 1},
+    }};
+    std::array<std::uint64_t, 3> values = {7, 7, 7};
+    std::array<bool, 3> found{};
+
+    EXPECT_EQ(ProcParse::scanKeyedValues("alpha 1\nbeta 2\ngamma 3\ndelta 4\nalphabet 5\n", table, values, found), 2U);
+    EXPECT_EQ(values[0], 2U);
+    EXPECT_EQ(values[2], 4U);
+    EXPECT_EQ(values[1], 7U); // Untouched when not found
+    EXPECT_TRUE(found[0]);
+    EXPECT_FALSE(found[1]);
+    EXPECT_TRUE(found[2]);
+}
+
+TEST(ProcParseTest, ScanKeyedValuesIgnoresKeyPrefixes)
+{
+    constexpr std::array<ProcParse::KeySlot, 1> table = {{{.key = "pgfault", .slot = 0}}};
+    std::array<std::uint64_t, 1> values{};
+    std::array<bool, 1> found{};
+
+    // "pgfault" must not match "pgfault_foo" and must be found after it
+    EXPECT_EQ(ProcParse::scanKeyedValues("pgfault_foo 1\npgfault 42", table, values, found), 1U);
+    EXPECT_EQ(values[0], 42U);
+}
+
+TEST(ProcParseTest, FormatPidPathBuildsTerminatedRelativePaths)
+{
+    std::array<char, 48> buffer{};
+    EXPECT_EQ(ProcParse::formatPidPath(buffer, 1234, "stat"), "1234/stat");
+    EXPECT_EQ(buffer[9], '\0'); // Usable as a C string for openat()
+    EXPECT_EQ(ProcParse::formatPidPath(buffer, 2147483647, "fdinfo/", 2147483647), "2147483647/fdinfo/2147483647");
+    EXPECT_EQ(ProcParse::formatPidPath(buffer, 7, "fdinfo/", 0), "7/fdinfo/0");
+}
+
+TEST(ProcParseTest, FormatPidPathRejectsPathsThatDoNotFit)
+{
+    std::array<char, 8> buffer{};
+    EXPECT_EQ(ProcParse::formatPidPath(buffer, 12, "stat"), "12/stat"); // Exactly fits with the NUL
+    EXPECT_TRUE(ProcParse::formatPidPath(buffer, 123, "stat").empty());
+    EXPECT_TRUE(ProcParse::formatPidPath(buffer, 1, "fdinfo/", 10).empty());
+}
+
+TEST(ProcParseTest, ParsesRealCpuOnlineList)
+{
+    ProcFile online("/sys/devices/system/cpu/online");
+    if (!online.isOpen())
+    {
+        GTEST_SKIP() << "/sys/devices/system/cpu/online not available";
+    }
+
+    std::vector<std::uint8_t> mask;
+    ASSERT_TRUE(ProcParse::parseIdList(online.read(), mask));
+    ASSERT_FALSE(mask.empty());
+    EXPECT_EQ(mask[0], 1U); // Boot CPU
+}
+
+// =============================================================================
+// SharedProcStat
+// =============================================================================
+
+TEST(SharedProcStatTest, ReadsAggregateCpuLine)
+{
+    SharedProcStat::Consumer consumer;
+    const auto text = SharedProcStat::instance().read(consumer);
+    ASSERT_NE(text, nullptr);
+    EXPECT_TRUE(text->starts_with("cpu "));
+}
+
+TEST(SharedProcStatTest, SecondConsumerSharesSnapshot)
+{
+    SharedProcStat::Consumer systemConsumer;
+    SharedProcStat::Consumer processConsumer;
+
+    const auto first = SharedProcStat::instance().read(systemConsumer);
+    const auto second = SharedProcStat::instance().read(processConsumer);
+    ASSERT_NE(first, nullptr);
+
+    // One read serves both consumers, and the bytes are shared rather than copied
+    EXPECT_EQ(systemConsumer.lastGeneration, processConsumer.lastGeneration);
+    EXPECT_EQ(first, second);
+}
+
+TEST(SharedProcStatTest, SameConsumerAlwaysGetsFreshSnapshot)
+{
+    SharedProcStat::Consumer consumer;
+
+    ASSERT_NE(SharedProcStat::instance().read(consumer), nullptr);
+    const uint64_t firstGeneration = consumer.lastGeneration;
+    ASSERT_NE(SharedProcStat::instance().read(consumer), nullptr);
+
+    EXPECT_GT(consumer.lastGeneration, firstGeneration);
+}
+
+TEST(SharedProcStatTest, SharingDoesNotDependOnTiming)
+{
+    SharedProcStat::Consumer first;
+    SharedProcStat::Consumer second;
+
+    // Probes on independent timers still share: the second consumer has not seen this snapshot
+    ASSERT_NE(SharedProcStat::instance().read(first), nullptr);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_NE(SharedProcStat::instance().read(second), nullptr);
+
+    EXPECT_EQ(second.lastGeneration, first.lastGeneration);
+}
+
+TEST(SharedProcStatTest, HeldSnapshotIsNotOverwritten)
+{
+    SharedProcStat::Consumer consumer;
+    const auto held = SharedProcStat::instance().read(consumer);
+    ASSERT_NE(held, nullptr);
+    const std::string copy = *held;
+
+    const auto next = SharedProcStat::instance().read(consumer);
+    EXPECT_NE(held, next);
+    EXPECT_EQ(*held, copy);
+}
+
+} // namespace
+} // namespace Platform
+
+#else
+
+TEST(ProcFileTest, SkippedOnNonLinux)
+{
+    GTEST_SKIP() << "ProcFile tests require Linux (/proc, unistd.h)";
+}
+
+#endif
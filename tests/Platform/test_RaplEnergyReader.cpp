@@ -0,0 +1,167 @@
+/// @file test_RaplEnergyReader.cpp
+/// @brief Tests for Platform::RaplEnergyReader
+///
+/// The reader is pointed at temporary directories laid out like /sys/class/powercap and
+/// /sys/devices/system/cpu so zone sets and package topology are deterministic.
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "Fixtures/TempTree.h"
+#include "Platform/Linux/RaplEnergyReader.h"
+#include "Platform/ProcessTypes.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace Platform
+{
+namespace
+{
+
+class RaplEnergyReaderTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::filesystem::create_directories(powercap());
+        std::filesystem::create_directories(cpus());
+    }
+
+    [[nodiscard]] std::filesystem::path powercap() const
+    {
+        return m_Tree.path("powercap");
+    }
+
+    [[nodiscard]] std::filesystem::path cpus() const
+    {
+        return m_Tree.path("cpu");
+    }
+
+    /// powercap/<zone> with the given name, counter and wrap point.
+    void writeZone(const std::string& zone, const std::string& name, std::uint64_t energyUj, std::uint64_t maxRangeUj = 262143328850) const
+    {
+        const auto dir = powercap() / zone;
+        Fixtures::writeFile(dir / "name", name + "\n");
+        Fixtures::writeFile(dir / "energy_uj", std::to_string(energyUj) + "\n");
+        Fixtures::writeFile(dir / "max_energy_range_uj", std::to_string(maxRangeUj) + "\n");
+    }
+
+    void writeCpus(const std::vector<int>& physicalPackageIds) const
+    {
+        Fixtures::writeFile(cpus() / "present", "0-" + std::to_string(physicalPackageIds.size() - 1) + "\n");
+        for (std::size_t cpu = 0; cpu < physicalPackageIds.size(); ++cpu)
+        {
+            Fixtures::writeFile(cpus() / ("cpu" + std::to_string(cpu)) / "topology" / "physical_package_id",
+                                std::to_string(physicalPackageIds[cpu]) + "\n");
+        }
+    }
+
+    [[nodiscard]] RaplEnergyReader makeReader() const
+    {
+        return RaplEnergyReader(powercap().string(), cpus().string());
+    }
+
+    Fixtures::TempTree m_Tree{"rapl"};
+};
+
+TEST_F(RaplEnergyReaderTest, UnavailableWithoutZones)
+{
+    writeCpus({0, 0});
+    const RaplEnergyReader reader = makeReader();
+    EXPECT_FALSE(reader.isAvailable());
+}
+
+TEST_F(RaplEnergyReaderTest, ReadsPackagesAndSubzonesButSkipsPsys)
+{
+    writeZone("intel-rapl:0", "package-0", 1000, 5000);
+    writeZone("intel-rapl:0:0", "core", 600);
+    writeZone("intel-rapl:0:1", "uncore", 100);
+    writeZone("intel-rapl:0:2", "dram", 300);
+    writeZone("intel-rapl:1", "psys", 9000);
+    writeZone("intel-rapl:1:0", "core", 9000);
+    writeCpus({0, 0});
+
+    RaplEnergyReader reader = makeReader();
+    ASSERT_TRUE(reader.isAvailable());
+    ASSERT_EQ(reader.zoneCount(), 4U);
+
+    EnergyCounters counters;
+    reader.read(counters);
+    ASSERT_EQ(counters.zones.size(), 4U);
+    EXPECT_EQ(counters.zones[0].domain, EnergyDomain::Package);
+    EXPECT_EQ(counters.zones[0].energyMicrojoules, 1000U);
+    EXPECT_EQ(counters.zones[0].maxEnergyRangeMicrojoules, 5000U);
+    EXPECT_EQ(counters.zones[1].domain, EnergyDomain::Core);
+    EXPECT_EQ(counters.zones[2].domain, EnergyDomain::Uncore);
+    EXPECT_EQ(counters.zones[3].domain, EnergyDomain::Dram);
+    EXPECT_EQ(counters.zones[3].energyMicrojoules, 300U);
+    for (const auto& zone : counters.zones)
+    {
+        EXPECT_EQ(zone.package, 0);
+    }
+    EXPECT_EQ(counters.cpuPackage, (std::vector<std::int32_t>{0, 0}));
+}
+
+TEST_F(RaplEnergyReaderTest, MapsCpusToPackagesByPhysicalIdRank)
+{
+    // Physical ids need not be dense; RAPL numbers packages 0..n-1 in CPU order
+    writeZone("intel-rapl:0", "package-0", 10);
+    writeZone("intel-rapl:1", "package-1", 20);
+    writeZone("intel-rapl:1:0", "dram", 5);
+    writeCpus({3, 3, 7, 7});
+
+    RaplEnergyReader reader = makeReader();
+    EnergyCounters counters;
+    reader.read(counters);
+
+    ASSERT_EQ(counters.zones.size(), 3U);
+    EXPECT_EQ(counters.zones[0].package, 0);
+    EXPECT_EQ(counters.zones[1].package, 1);
+    EXPECT_EQ(counters.zones[1].domain, EnergyDomain::Package);
+    EXPECT_EQ(counters.zones[2].package, 1);
+    EXPECT_EQ(counters.zones[2].domain, EnergyDomain::Dram);
+    EXPECT_EQ(counters.cpuPackage, (std::vector<std::int32_t>{0, 0, 1, 1}));
+}
+
+TEST_F(RaplEnergyReaderTest, RereadsCountersThroughPersistentHandles)
+{
+    writeZone("intel-rapl:0", "package-0", 1000);
+    writeCpus({0});
+
+    RaplEnergyReader reader = makeReader();
+    EnergyCounters counters;
+    reader.read(counters);
+    ASSERT_EQ(counters.zones.size(), 1U);
+    EXPECT_EQ(counters.zones[0].energyMicrojoules, 1000U);
+
+    Fixtures::writeFile(powercap() / "intel-rapl:0" / "energy_uj", "2500\n");
+    reader.read(counters);
+    EXPECT_EQ(counters.zones[0].energyMicrojoules, 2500U);
+}
+
+TEST_F(RaplEnergyReaderTest, SkipsUnreadableZones)
+{
+    writeZone("intel-rapl:0", "package-0", 1000);
+    writeZone("intel-rapl:0:0", "dram", 50);
+    std::filesystem::remove(powercap() / "intel-rapl:0:0" / "energy_uj");
+    writeCpus({0});
+
+    const RaplEnergyReader reader = makeReader();
+    EXPECT_EQ(reader.zoneCount(), 1U);
+}
+
+} // namespace
+} // namespace Platform
+
+#else
+
+TEST(RaplEnergyReaderTest, SkippedOnNonLinux)
+{
+    GTEST_SKIP() << "RaplEnergyReader tests require Linux (sysfs, unistd.h)";
+}
+
+#endif
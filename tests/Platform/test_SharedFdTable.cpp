@@ -0,0 +1,151 @@
+/// @file test_SharedFdTable.cpp
+/// @brief Tests for Platform::walkFdTable and Platform::SharedFdTable
+///
+/// The walk runs against Fixtures::SyntheticProcTree, whose fd links are known in advance.
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "Fixtures/SyntheticProcTree.h"
+#include "Platform/Linux/SharedFdTable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace Platform
+{
+namespace
+{
+
+TEST(SharedFdTableTest, WalkCountsFdsAndMapsSockets)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 8, .fdsPerProcess = 3, .fdSpread = 4, .socketsPerProcess = 2});
+
+    const FdTable table = walkFdTable(tree.procRoot().string());
+    ASSERT_EQ(table.fdCounts.size(), 8U);
+    EXPECT_EQ(table.socketOwners.size(), 16U);
+    EXPECT_TRUE(table.drmFds.empty());
+
+    for (std::size_t index = 0; index < 8; ++index)
+    {
+        const auto fds = table.fdCounts.find(tree.pid(index));
+        ASSERT_NE(fds, table.fdCounts.end());
+        EXPECT_EQ(fds->second, static_cast<std::int32_t>(tree.fdCount(index)));
+
+        for (std::size_t socket = 0; socket < 2; ++socket)
+        {
+            const auto owner = table.socketOwners.find(tree.socketInode(index, socket));
+            ASSERT_NE(owner, table.socketOwners.end());
+            EXPECT_EQ(owner->second, tree.pid(index));
+        }
+    }
+}
+
+TEST(SharedFdTableTest, WalkListsDrmFds)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 3, .fdsPerProcess = 2, .socketsPerProcess = 0});
+    tree.writeDrmFd(1, 10, "");
+    tree.writeDrmFd(1, 11, "", "/dev/dri/card0");
+
+    const FdTable table = walkFdTable(tree.procRoot().string());
+    ASSERT_EQ(table.drmFds.size(), 2U);
+    for (const auto& drmFd : table.drmFds)
+    {
+        EXPECT_EQ(drmFd.pid, tree.pid(1));
+        EXPECT_TRUE(drmFd.fd == 10 || drmFd.fd == 11);
+    }
+    EXPECT_EQ(table.fdCounts.at(tree.pid(1)), 4);
+}
+
+TEST(SharedFdTableTest, MissingProcRootGivesEmptyTable)
+{
+    const FdTable table = walkFdTable("/nonexistent/tasksmack/proc");
+    EXPECT_TRUE(table.fdCounts.empty());
+    EXPECT_TRUE(table.socketOwners.empty());
+    EXPECT_TRUE(table.drmFds.empty());
+}
+
+TEST(SharedFdTableTest, SecondConsumerReusesFreshWalk)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 2});
+    auto& shared = SharedFdTable::instance(tree.procRoot().string());
+
+    SharedFdTable::Consumer first;
+    SharedFdTable::Consumer second;
+    const auto walksBefore = shared.walkCount();
+
+    const auto firstTable = shared.read(first);
+    const auto secondTable = shared.read(second);
+    EXPECT_EQ(firstTable, secondTable);
+    EXPECT_EQ(shared.walkCount(), walksBefore + 1);
+}
+
+TEST(SharedFdTableTest, ConsumerNeverSeesTheSameWalkTwice)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 2});
+    auto& shared = SharedFdTable::instance(tree.procRoot().string());
+
+    SharedFdTable::Consumer consumer;
+    const auto before = shared.read(consumer);
+    tree.writeDrmFd(0, 20, "");
+    const auto after = shared.read(consumer);
+
+    EXPECT_NE(before, after);
+    EXPECT_TRUE(before->drmFds.empty());
+    EXPECT_EQ(after->drmFds.size(), 1U);
+}
+
+TEST(SharedFdTableTest, StaleWalkIsNotShared)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 2});
+    auto& shared = SharedFdTable::instance(tree.procRoot().string());
+
+    SharedFdTable::Consumer first;
+    SharedFdTable::Consumer second;
+    const auto firstTable = shared.read(first);
+    std::this_thread::sleep_for(SharedFdTable::SHARE_WINDOW * 2);
+    const auto secondTable = shared.read(second);
+
+    EXPECT_NE(firstTable, secondTable);
+}
+
+TEST(SharedFdTableTest, ConcurrentConsumersEachGetACompleteTable)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 16});
+    auto& shared = SharedFdTable::instance(tree.procRoot().string());
+
+    constexpr int THREADS = 4;
+    constexpr int READS = 20;
+    std::vector<std::thread> threads;
+    std::vector<int> complete(THREADS, 0);
+    for (int t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back(
+            [&shared, &complete, t]()
+            {
+                SharedFdTable::Consumer consumer;
+                for (int i = 0; i < READS; ++i)
+                {
+                    const auto table = shared.read(consumer);
+                    complete[static_cast<std::size_t>(t)] += (table && table->fdCounts.size() == 16U) ? 1 : 0;
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const int count : complete)
+    {
+        EXPECT_EQ(count, READS);
+    }
+}
+
+} // namespace
+} // namespace Platform
+
+#endif // __linux__ && __has_include(<unistd.h>)
@@ -0,0 +1,190 @@
+/// @file test_SystemRoots.cpp
+/// @brief Tests for Platform::SystemRoots and probes running against a synthetic /proc
+///
+/// The probe tests build a tree with Fixtures::SyntheticProcTree and point the Linux
+/// probes at it, so every value they report is known in advance.
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) && __has_include(<unistd.h>)
+
+#include "Fixtures/SyntheticProcTree.h"
+#include "Platform/Linux/LinuxProcessProbe.h"
+#include "Platform/Linux/LinuxSystemProbe.h"
+#include "Platform/Linux/SystemRoots.h"
+#include "Platform/PlatformConfig.h"
+#include "Platform/ProcessTypes.h"
+
+#if TASKSMACK_HAS_NETLINK_SOCKET_STATS
+#include "Platform/Linux/NetlinkSocketStats.h"
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Platform
+{
+namespace
+{
+
+// ========== SystemRoots ==========
+
+/// Sets an environment variable for the lifetime of the guard, then restores it.
+class ScopedEnv
+{
+  public:
+    ScopedEnv(const char* name, const char* value) : m_Name(name)
+    {
+        // NOLINTNEXTLINE(concurrency-mt-unsafe) - tests run single-threaded
+        if (const char* previous = std::getenv(name))
+        {
+            m_Previous = previous;
+        }
+        ::setenv(name, value, 1);
+    }
+
+    ~ScopedEnv()
+    {
+        if (m_Previous)
+        {
+            ::setenv(m_Name, m_Previous->c_str(), 1);
+        }
+        else
+        {
+            ::unsetenv(m_Name);
+        }
+    }
+
+    ScopedEnv(const ScopedEnv&) = delete;
+    ScopedEnv& operator=(const ScopedEnv&) = delete;
+    ScopedEnv(ScopedEnv&&) = delete;
+    ScopedEnv& operator=(ScopedEnv&&) = delete;
+
+  private:
+    const char* m_Name;
+    std::optional<std::string> m_Previous;
+};
+
+TEST(SystemRootsTest, DefaultsToHostTrees)
+{
+    const SystemRoots roots;
+    EXPECT_TRUE(roots.isDefault());
+    EXPECT_EQ(roots.procPath("meminfo"), "/proc/meminfo");
+    EXPECT_EQ(roots.sysPath("class/net"), "/sys/class/net");
+}
+
+TEST(SystemRootsTest, EnvironmentOverridesRoots)
+{
+    const ScopedEnv proc(SystemRoots::PROC_ROOT_ENV, "/host/proc//");
+    const ScopedEnv sys(SystemRoots::SYS_ROOT_ENV, "/host/sys");
+
+    const SystemRoots roots = SystemRoots::fromEnvironment();
+    EXPECT_FALSE(roots.isDefault());
+    EXPECT_EQ(roots.proc, "/host/proc");
+    EXPECT_EQ(roots.procPath("1/stat"), "/host/proc/1/stat");
+    EXPECT_EQ(roots.sysPath("dev/block"), "/host/sys/dev/block");
+}
+
+TEST(SystemRootsTest, EmptyVariableKeepsDefault)
+{
+    const ScopedEnv proc(SystemRoots::PROC_ROOT_ENV, "");
+    const ScopedEnv sys(SystemRoots::SYS_ROOT_ENV, "/");
+
+    const SystemRoots roots = SystemRoots::fromEnvironment();
+    EXPECT_EQ(roots.proc, "/proc");
+    EXPECT_EQ(roots.sys, "/");
+}
+
+// ========== Probes against a synthetic tree ==========
+
+TEST(SyntheticProcTreeTest, ProcessProbeEnumeratesFixture)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 25, .fdsPerProcess = 4, .fdSpread = 3, .cmdlineBytes = 40, .cmdlineSpread = 200});
+    LinuxProcessProbe probe(tree.roots());
+
+    auto processes = probe.enumerate();
+    ASSERT_EQ(processes.size(), 25U);
+    std::ranges::sort(processes, {}, &ProcessCounters::pid);
+
+    for (std::size_t index = 0; index < processes.size(); ++index)
+    {
+        const auto& proc = processes[index];
+        EXPECT_EQ(proc.pid, tree.pid(index));
+        EXPECT_EQ(proc.name, Fixtures::SyntheticProcTree::name(index));
+        EXPECT_EQ(proc.command, tree.command(index));
+        EXPECT_EQ(proc.handleCount, static_cast<std::int32_t>(tree.fdCount(index)));
+        EXPECT_EQ(proc.threadCount, static_cast<std::int32_t>(Fixtures::SyntheticProcTree::threads(index)));
+        EXPECT_EQ(proc.userTime, Fixtures::SyntheticProcTree::userTicks(index));
+        EXPECT_EQ(proc.systemTime, Fixtures::SyntheticProcTree::systemTicks(index));
+        EXPECT_EQ(proc.cgroupPath, "/user.slice/app-" + std::to_string(index % 8) + ".scope");
+        EXPECT_EQ(proc.lastCpu, 3); // stat field 39 (processor)
+        EXPECT_GE(proc.startTimeEpoch, Fixtures::SyntheticProcTree::BOOT_TIME_EPOCH);
+    }
+}
+
+TEST(SyntheticProcTreeTest, ProcessProbeReadsFixtureSystemFiles)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 3});
+    const LinuxProcessProbe probe(tree.roots());
+
+    EXPECT_EQ(probe.systemTotalMemory(), Fixtures::SyntheticProcTree::MEM_TOTAL_KB * 1024);
+    EXPECT_EQ(probe.totalCpuTime(), 4705U + 356 + 584 + 3699176 + 23060 + 277);
+    EXPECT_TRUE(probe.capabilities().hasIoCounters); // "self" links to a process with an io file
+}
+
+TEST(SyntheticProcTreeTest, SystemProbeReadsFixture)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 1});
+    LinuxSystemProbe probe(tree.roots());
+
+    const auto counters = probe.read();
+    EXPECT_EQ(counters.memory.totalBytes, Fixtures::SyntheticProcTree::MEM_TOTAL_KB * 1024);
+    EXPECT_EQ(counters.uptimeSeconds, 12345U);
+    EXPECT_DOUBLE_EQ(counters.loadAvg1, 0.5);
+    EXPECT_EQ(counters.cpuPerCore.size(), 2U);
+}
+
+TEST(SyntheticProcTreeTest, SystemProbeReadsFixtureInterfaces)
+{
+    // Interfaces come from the tree's net/dev, not from rtnetlink (the live namespace)
+    const Fixtures::SyntheticProcTree tree({.processes = 1});
+    LinuxSystemProbe probe(tree.roots());
+
+    const auto counters = probe.read();
+    ASSERT_EQ(counters.networkInterfaces.size(), 2U);
+    EXPECT_EQ(counters.networkInterfaces[0].name, "synth0");
+    EXPECT_EQ(counters.networkInterfaces[0].rxBytes, 100000U);
+    EXPECT_EQ(counters.networkInterfaces[0].txBytes, 200000U);
+    EXPECT_EQ(counters.networkInterfaces[1].name, "synth1");
+    EXPECT_EQ(counters.netRxBytes, 400000U);
+    EXPECT_EQ(counters.netTxBytes, 600000U);
+}
+
+#if TASKSMACK_HAS_NETLINK_SOCKET_STATS
+TEST(SyntheticProcTreeTest, SocketInodesMapToOwningProcess)
+{
+    const Fixtures::SyntheticProcTree tree({.processes = 10, .fdsPerProcess = 6, .socketsPerProcess = 3});
+
+    const auto inodeToPid = buildInodeToPidMap(tree.procRoot().string());
+    ASSERT_EQ(inodeToPid.size(), 30U);
+    for (std::size_t index = 0; index < 10; ++index)
+    {
+        for (std::size_t socket = 0; socket < 3; ++socket)
+        {
+            const auto it = inodeToPid.find(tree.socketInode(index, socket));
+            ASSERT_NE(it, inodeToPid.end());
+            EXPECT_EQ(it->second, tree.pid(index));
+        }
+    }
+}
+#endif
+
+} // namespace
+} // namespace Platform
+
+#endif // __linux__ && __has_include(<unistd.h>)
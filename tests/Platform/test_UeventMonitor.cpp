@@ -0,0 +1,84 @@
+/// @file test_UeventMonitor.cpp
+/// @brief Tests for Platform::UeventMonitor
+///
+/// Datagram parsing is tested with captured kernel uevent payloads. The socket itself
+/// only delivers events in the initial network namespace, so the live test just checks
+/// that polling an idle monitor never blocks.
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) && __has_include(<linux/netlink.h>)
+
+#include "Platform/Linux/UeventMonitor.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Platform
+{
+namespace
+{
+
+using namespace std::string_view_literals;
+
+TEST(UeventMonitorTest, ParsesKernelChangeEvent)
+{
+    constexpr auto datagram = "change@/devices/LNXSYSTM:00/LNXSYBUS:00/ACPI0003:00/power_supply/AC\0"
+                              "ACTION=change\0"
+                              "DEVPATH=/devices/LNXSYSTM:00/LNXSYBUS:00/ACPI0003:00/power_supply/AC\0"
+                              "SUBSYSTEM=power_supply\0"
+                              "POWER_SUPPLY_NAME=AC\0"
+                              "POWER_SUPPLY_TYPE=Mains\0"
+                              "POWER_SUPPLY_ONLINE=0\0"
+                              "SEQNUM=4211\0"sv;
+    Uevent event;
+    ASSERT_TRUE(UeventMonitor::parse(datagram, event));
+    EXPECT_EQ(event.action, UeventAction::Change);
+    EXPECT_EQ(event.subsystem, "power_supply");
+    EXPECT_EQ(event.devPath, "/devices/LNXSYSTM:00/LNXSYBUS:00/ACPI0003:00/power_supply/AC");
+}
+
+TEST(UeventMonitorTest, ParsesAddAndRemove)
+{
+    Uevent event;
+    ASSERT_TRUE(UeventMonitor::parse("add@/power_supply/BAT1\0ACTION=add\0DEVPATH=/power_supply/BAT1\0SUBSYSTEM=power_supply\0"sv, event));
+    EXPECT_EQ(event.action, UeventAction::Add);
+
+    ASSERT_TRUE(UeventMonitor::parse("remove@/power_supply/BAT1\0ACTION=remove\0SUBSYSTEM=power_supply"sv, event));
+    EXPECT_EQ(event.action, UeventAction::Remove);
+    EXPECT_TRUE(event.devPath.empty());
+
+    ASSERT_TRUE(UeventMonitor::parse("bind@/x\0ACTION=bind\0SUBSYSTEM=power_supply\0"sv, event));
+    EXPECT_EQ(event.action, UeventAction::Other);
+}
+
+TEST(UeventMonitorTest, RejectsUdevAndMalformedMessages)
+{
+    Uevent event;
+    // udevd re-broadcasts carry a binary "libudev" header instead of action@devpath
+    EXPECT_FALSE(UeventMonitor::parse("libudev\0\xfe\xed\xca\xfe"sv, event));
+    EXPECT_FALSE(UeventMonitor::parse(""sv, event));
+    EXPECT_FALSE(UeventMonitor::parse("change@/x"sv, event)); // Header only, no terminator
+    EXPECT_FALSE(UeventMonitor::parse("change@/x\0ACTION=change\0"sv, event)); // No SUBSYSTEM
+}
+
+TEST(UeventMonitorTest, PollOnIdleSocketReturnsImmediately)
+{
+    UeventMonitor monitor("tasksmack_no_such_subsystem");
+    std::vector<Uevent> events;
+    EXPECT_EQ(monitor.poll(events), 0U);
+    EXPECT_TRUE(events.empty());
+}
+
+} // namespace
+} // namespace Platform
+
+#else
+
+TEST(UeventMonitorTest, SkippedOnNonLinux)
+{
+    GTEST_SKIP() << "UeventMonitor tests require Linux (netlink)";
+}
+
+#endif
@@ -1156,3 +1156,16 @@ TEST(FormatTest, FormatCpuTimeCompactHandlesZero)
     const auto result = UI::Format::formatCpuTimeCompact(0.0);
     EXPECT_EQ(result, "0:00");
 }
+
+TEST(FormatTest, FormatDurationShortPicksTwoLargestUnits)
+{
+    EXPECT_EQ(UI::Format::formatDurationShort(45.0), "45s");
+    EXPECT_EQ(UI::Format::formatDurationShort(725.0), "12m");
+    EXPECT_EQ(UI::Format::formatDurationShort(12000.0), "3h 20m");
+    EXPECT_EQ(UI::Format::formatDurationShort(446400.0), "5d 4h");
+}
+
+TEST(FormatTest, FormatDurationShortClampsNegative)
+{
+    EXPECT_EQ(UI::Format::formatDurationShort(-5.0), "0s");
+}